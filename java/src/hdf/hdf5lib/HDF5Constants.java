@@ -55,12 +55,14 @@ public class HDF5Constants {
     public static final int H5AC_METADATA_WRITE_STRATEGY_DISTRIBUTED = H5AC_METADATA_WRITE_STRATEGY_DISTRIBUTED();
     public static final int H5C_incr_off = H5C_incr_off();
     public static final int H5C_incr_threshold = H5C_incr_threshold();
+    public static final int H5C_incr_miss_rate_curve = H5C_incr_miss_rate_curve();
     public static final int H5C_flash_incr_off = H5C_flash_incr_off();
     public static final int H5C_flash_incr_add_space = H5C_flash_incr_add_space();
     public static final int H5C_decr_off = H5C_decr_off();
     public static final int H5C_decr_threshold = H5C_decr_threshold();
     public static final int H5C_decr_age_out = H5C_decr_age_out();
     public static final int H5C_decr_age_out_with_threshold = H5C_decr_age_out_with_threshold();
+    public static final int H5C_decr_miss_rate_curve = H5C_decr_miss_rate_curve();
     public static final int H5D_CHUNK_IDX_BTREE = H5D_CHUNK_IDX_BTREE();
     public static final int H5D_ALLOC_TIME_DEFAULT = H5D_ALLOC_TIME_DEFAULT();
     public static final int H5D_ALLOC_TIME_EARLY = H5D_ALLOC_TIME_EARLY();
@@ -735,6 +737,8 @@ public class HDF5Constants {
 
     private static native final int H5C_incr_threshold();
 
+    private static native final int H5C_incr_miss_rate_curve();
+
     private static native final int H5C_flash_incr_off();
 
     private static native final int H5C_flash_incr_add_space();
@@ -747,6 +751,8 @@ public class HDF5Constants {
 
     private static native final int H5C_decr_age_out_with_threshold();
 
+    private static native final int H5C_decr_miss_rate_curve();
+
     private static native final int H5D_CHUNK_IDX_BTREE();
 
     private static native final int H5D_ALLOC_TIME_DEFAULT();
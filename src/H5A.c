@@ -33,6 +33,8 @@
 #include "H5Sprivate.h"         /* Dataspace functions                      */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 
 /****************/
 /* Local Macros */
@@ -1463,6 +1465,91 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Aiterate_by_name() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_all
+ PURPOSE
+    Retrieve the names, datatypes, dataspaces and values of all the
+    attributes of an object at once
+ USAGE
+    ssize_t H5Aread_all(loc_id, idx_type, order, nattrs, info, buf_size, buf)
+        hid_t loc_id;           IN: Object to read attributes of
+        H5_index_t idx_type;    IN: Type of index to use
+        H5_iter_order_t order;  IN: Order to return attributes in
+        size_t *nattrs;         IN/OUT: # of elements in 'info' (IN) &
+                                    # of attributes of the object (OUT)
+        H5A_bulk_info_t info[]; OUT: Information for each attribute
+        size_t *buf_size;       IN/OUT: Size of 'buf' (IN) & size of buffer
+                                    needed for all the attributes (OUT)
+        void *buf;              OUT: Buffer for attributes' names & data
+ RETURNS
+    Returns the number of attributes whose information was returned in
+    'info' on success, negative on failure.
+
+ DESCRIPTION
+        This function decodes all the attributes of the object specified
+    with 'loc_id' in one pass over the object's header (and dense attribute
+    storage, if used), instead of opening each attribute in turn.  For each
+    attribute, in the order given by 'idx_type' & 'order', an element of
+    'info' receives the attribute's name, the IDs of a copy of its
+    datatype & dataspace (as from H5Aget_type & H5Aget_space), and its
+    data, as H5Aread would return it when reading with that datatype.
+    The names and data are stored in 'buf', with each attribute's data
+    aligned for any native datatype, relative to the start of 'buf'.
+        Attributes are returned until either 'info' or 'buf' is full; the
+    number returned is the return value of this function and the total
+    number of attributes of the object and the size of buffer needed to
+    return all of them are returned in '*nattrs' & '*buf_size', so the
+    application can call this function again with larger buffers when
+    needed.  The application must close the datatype & dataspace IDs
+    returned and reclaim any variable-length data returned (with
+    H5Dvlen_reclaim), just as when using H5Aget_type, H5Aget_space and
+    H5Aread.
+--------------------------------------------------------------------------*/
+ssize_t
+H5Aread_all(hid_t loc_id, H5_index_t idx_type, H5_iter_order_t order,
+    size_t *nattrs, H5A_bulk_info_t info[], size_t *buf_size, void *buf)
+{
+    H5VL_object_t *vol_obj = NULL;        /* object token of loc_id */
+    H5VL_loc_params_t loc_params;
+    ssize_t     ret_value = -1;         /* Return value */
+
+    FUNC_ENTER_API((-1))
+    H5TRACE7("Zs", "iIiIo*z*x*zx", loc_id, idx_type, order, nattrs, info,
+             buf_size, buf);
+
+    /* check arguments */
+    if(H5I_ATTR == H5I_get_type(loc_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, (-1), "location is not valid for an attribute")
+    if(idx_type <= H5_INDEX_UNKNOWN || idx_type >= H5_INDEX_N)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "invalid index type specified")
+    if(order <= H5_ITER_UNKNOWN || order >= H5_ITER_N)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "invalid iteration order specified")
+    if(!nattrs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "nattrs parameter cannot be NULL")
+    if(*nattrs > 0 && !info)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "info parameter cannot be NULL")
+    if(!buf_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "buf_size parameter cannot be NULL")
+    if(*buf_size > 0 && !buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, (-1), "buf parameter cannot be NULL")
+
+    loc_params.type = H5VL_OBJECT_BY_SELF;
+    loc_params.obj_type = H5I_get_type(loc_id);
+
+    /* get the loc object */
+    if(NULL == (vol_obj = H5VL_vol_object(loc_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, (-1), "invalid location identifier")
+
+    /* Read the attributes */
+    if(H5VL_attr_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_ATTR_READ_ALL, &loc_params, (int)idx_type, (int)order, nattrs, info, buf_size, buf, &ret_value) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_READERROR, (-1), "unable to read attributes")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_all() */
+
 
 /*--------------------------------------------------------------------------
  NAME
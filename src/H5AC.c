@@ -409,11 +409,13 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
 #endif /* H5_HAVE_PARALLEL */
 
     /* Turn on metadata cache logging, if being used
-     * This will be JSON until we create a special API call. Trace output
-     * is generated when logging is controlled by the struct.
+     * This will be JSON or binary, as set with H5Pset_mdc_log_style().
+     * Trace output is generated when logging is controlled by the struct.
      */
     if(H5F_USE_MDC_LOGGING(f))
-        if(H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f), H5C_LOG_STYLE_JSON, H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
+        if(H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f),
+                (H5F_MDC_LOG_STYLE_BINARY == H5F_MDC_LOG_STYLE(f) ? H5C_LOG_STYLE_BINARY : H5C_LOG_STYLE_JSON),
+                H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "mdc logging setup failed")
 
     /* Set the cache parameters */
@@ -430,6 +432,7 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
     int_ci_config.generate_image     = image_config_ptr->generate_image;
     int_ci_config.save_resize_status = image_config_ptr->save_resize_status;
     int_ci_config.entry_ageout       = image_config_ptr->entry_ageout;
+    int_ci_config.incremental        = image_config_ptr->incremental;
     if(H5C_set_cache_image_config(f, f->shared->cache, &int_ci_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "auto resize configuration failed")
 
@@ -911,6 +914,37 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_load_cache_image_on_next_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_update_cache_image
+ *
+ * Purpose:     Bring an incrementally maintained metadata cache image
+ *              up to date with the contents of the cache.  Does nothing
+ *              if the cache image is not maintained incrementally.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_update_cache_image(H5F_t *f)
+{
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+
+    if(H5C_update_cache_image(f) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "call to H5C_update_cache_image failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_update_cache_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_mark_entry_dirty
@@ -2001,17 +2035,19 @@ H5AC_validate_cache_image_config(H5AC_cache_image_config_t *config_ptr)
     if(config_ptr == NULL)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "NULL config_ptr on entry")
 
-    if(config_ptr->version != H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION)
+    if(config_ptr->version != H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION
+            && config_ptr->version != H5AC__CACHE_IMAGE_CONFIG_VERSION_1)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Unknown image config version")
 
     /* don't need to get the current H5C image config here since the
      * default values of fields not in the H5AC config will always be 
-     * valid.
+     * valid.  Version 1 configurations have no incremental field.
      */
-    internal_config.version            = config_ptr->version;
     internal_config.generate_image     = config_ptr->generate_image;
     internal_config.save_resize_status = config_ptr->save_resize_status;
     internal_config.entry_ageout       = config_ptr->entry_ageout;
+    if(config_ptr->version != H5AC__CACHE_IMAGE_CONFIG_VERSION_1)
+        internal_config.incremental    = config_ptr->incremental;
 
     if(H5C_validate_cache_image_config(&internal_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "error(s) in new cache image config")
@@ -297,12 +297,16 @@ typedef struct H5AC_proxy_entry_t {
 }
 #endif /* H5_HAVE_PARALLEL */
 
+/* Version of H5AC_cache_image_config_t without the incremental field */
+#define H5AC__CACHE_IMAGE_CONFIG_VERSION_1      1
+
 #define H5AC__DEFAULT_CACHE_IMAGE_CONFIG                                     \
 {                                                                            \
    /* int32_t version            = */ H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION, \
    /* hbool_t generate_image     = */ FALSE,                                 \
    /* hbool_t save_resize_status = */ FALSE,                                 \
-   /* int32_t entry_ageout       = */ H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE  \
+   /* int32_t entry_ageout       = */ H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE, \
+   /* hbool_t incremental        = */ FALSE                                  \
 }
 /*
  * Library prototypes.
@@ -420,6 +424,7 @@ H5_DLL herr_t H5AC_validate_config(H5AC_cache_config_t *config_ptr);
 /* Cache image routines */
 H5_DLL herr_t H5AC_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr, 
     hsize_t len, hbool_t rw);
+H5_DLL herr_t H5AC_update_cache_image(H5F_t *f);
 H5_DLL herr_t H5AC_validate_cache_image_config(H5AC_cache_image_config_t *config_ptr);
 H5_DLL hbool_t H5AC_cache_image_pending(const H5F_t *f);
 H5_DLL herr_t H5AC_force_cache_image_load(H5F_t * f);
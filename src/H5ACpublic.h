@@ -164,7 +164,7 @@ extern "C" {
  *
  * incr_mode: Instance of the H5C_cache_incr_mode enumerated type whose
  *      value indicates how we determine whether the cache size should be
- *      increased.  At present there are two possible values:
+ *      increased.  At present there are three possible values:
  *
  *      H5C_incr__off:  Don't attempt to increase the size of the cache
  *              automatically.
@@ -181,6 +181,20 @@ extern "C" {
  *              at its maximum size, or if the cache is not already using
  *              all available space.
  *
+ *      H5C_incr__miss_rate_curve: Over each epoch, track the reuse
+ *              distances of a sample of the cache's entries, and from
+ *              them estimate the hit rate the cache would achieve at
+ *              each size between zero and max_size.  At the end of the
+ *              epoch, increase the size of the cache to the smallest
+ *              size beyond which the estimated hit rate stops improving
+ *              appreciably (the "knee" of the miss rate curve), plus the
+ *              empty_reserve if it is enabled.
+ *
+ *              The increase is limited by max_size and max_increment,
+ *              and is not attempted if the cache is not already using
+ *              all available space.  The lower_hr_threshold and
+ *              increment fields are ignored in this mode.
+ *
  *      Note that you must set decr_mode to H5C_incr__off if you
  *      disable metadata cache entry evictions.
  *
@@ -269,7 +283,7 @@ extern "C" {
  *
  * decr_mode: Instance of the H5C_cache_decr_mode enumerated type whose
  *      value indicates how we determine whether the cache size should be
- *      decreased.  At present there are four possibilities.
+ *      decreased.  At present there are five possibilities.
  *
  *      H5C_decr__off:  Don't attempt to decrease the size of the cache
  *              automatically.
@@ -295,6 +309,19 @@ extern "C" {
  *              over the last epoch exceeds the value provided in the
  *              upper_hr_threshold field.
  *
+ *      H5C_decr__miss_rate_curve:  At the end of each epoch, decrease the
+ *              size of the cache to the knee of the estimated miss rate
+ *              curve (see H5C_incr__miss_rate_curve above), plus the
+ *              empty_reserve if it is enabled.  This reduction may be
+ *              modified by the min_size and the max_decrement.
+ *
+ *              In this mode, the cache also reserves room for each type
+ *              of entry in proportion to the knee of that type's own
+ *              miss rate curve, and prefers evicting clean entries of
+ *              types that exceed their reservation.  The decrement,
+ *              upper_hr_threshold and epochs_before_eviction fields are
+ *              ignored in this mode.
+ *
  *      Note that you must set decr_mode to H5C_decr__off if you
  *      disable metadata cache entry evictions.
  *
@@ -344,7 +371,9 @@ extern "C" {
  *
  * apply_empty_reserve:  Boolean field controlling whether the empty_reserve
  *      field is to be used in computing the new cache size when the
- *      decr_mode is H5C_decr__age_out or H5C_decr__age_out_with_threshold.
+ *      decr_mode is H5C_decr__age_out or H5C_decr__age_out_with_threshold,
+ *      or when either the incr_mode or the decr_mode uses the miss rate
+ *      curve.
  *
  * empty_reserve:  To avoid a constant racheting down of cache size by small
  *      amounts in the H5C_decr__age_out and H5C_decr__age_out_with_threshold
@@ -553,9 +582,26 @@ typedef struct H5AC_cache_config_t
  *    current value, any value in excess of 255 will be the functional
  *    equivalent of H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE.
  *
+ * incremental: Boolean flag indicating whether the cache image should be
+ *    kept in the file for the life of the file, rather than being written
+ *    on file close and discarded when the file is next opened R/W.
+ *
+ *    When this flag is set, the image is brought up to date on each flush
+ *    of the file in which cache entries that appear in the image have
+ *    been written, reusing its block in the file if it is large enough,
+ *    and the file close reuses the image written by the last flush if no
+ *    such entries have been written since.  On file open, only the index
+ *    of the image is read, and the image of each entry is read from the
+ *    image block the first time the entry is protected.
+ *
+ *    Images written in this mode use version 1 of the metadata cache
+ *    image block format, which can't be read by earlier versions of the
+ *    library.  This field is ignored if persistent free space management
+ *    is in use, and was added in version 2 of this structure.
+ *
  ****************************************************************************/
 
-#define H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION     1
+#define H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION     2
 
 #define H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE    -1
 #define H5AC__CACHE_IMAGE__ENTRY_AGEOUT__MAX    100
@@ -565,6 +611,7 @@ typedef struct H5AC_cache_image_config_t {
     hbool_t                             generate_image;
     hbool_t                             save_resize_status;
     int                                 entry_ageout;
+    hbool_t                             incremental;
 } H5AC_cache_image_config_t;
 
 #ifdef __cplusplus
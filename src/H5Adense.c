@@ -60,6 +60,9 @@
 /* Size of stack buffer for serialized attributes */
 #define H5A_ATTR_BUF_SIZE               128
 
+/* Number of attributes read from the fractal heaps at once when iterating */
+#define H5A_DENSE_ITER_BATCH_SIZE       32
+
 
 /******************/
 /* Local Typedefs */
@@ -95,6 +98,10 @@ typedef struct {
     const H5A_attr_iter_op_t *attr_op;  /* Callback for each attribute       */
     void        *op_data;               /* Callback data for each attribute  */
 
+    /* batch of attributes to read from the fractal heaps */
+    size_t      nbatch;                 /* # of attributes in batch          */
+    H5A_dense_bt2_name_rec_t batch_rec[H5A_DENSE_ITER_BATCH_SIZE]; /* Records for attributes in batch */
+
     /* upward */
     int         op_ret;                 /* Return value from callback        */
 } H5A_bt2_ud_it_t;
@@ -137,6 +144,13 @@ typedef struct H5A_bt2_ud_rmbi_t {
 } H5A_bt2_ud_rmbi_t;
 
 
+/* Stream of attribute records for bulk-loading an index */
+typedef struct {
+    H5A_bt2_ud_ins_t **recs;            /* Records, in index order           */
+    size_t      next;                   /* Index of next record to load      */
+} H5A_dense_bulk_t;
+
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -145,6 +159,10 @@ typedef struct H5A_bt2_ud_rmbi_t {
 /********************/
 /* Local Prototypes */
 /********************/
+static int H5A__dense_name_cmp(const void *_rec1, const void *_rec2);
+static int H5A__dense_corder_cmp(const void *_rec1, const void *_rec2);
+static herr_t H5A__dense_bulk_cb(const void **udata, void *_op_data);
+static int H5A__dense_iterate_batch(H5A_bt2_ud_it_t *bt2_udata);
 
 
 /*********************/
@@ -434,6 +452,80 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5A__dense_open() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__dense_name_cmp
+ *
+ * Purpose:     Callback routine for sorting attribute records by name
+ *              index order: by the hash value of the name, then by name.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5A__dense_name_cmp(const void *_rec1, const void *_rec2)
+{
+    const H5A_bt2_ud_ins_t *rec1 = *(const H5A_bt2_ud_ins_t * const *)_rec1;
+    const H5A_bt2_ud_ins_t *rec2 = *(const H5A_bt2_ud_ins_t * const *)_rec2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(rec1->common.name_hash < rec2->common.name_hash ? -1 :
+            (rec1->common.name_hash > rec2->common.name_hash ? 1 :
+             HDstrcmp(rec1->common.name, rec2->common.name)))
+} /* end H5A__dense_name_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__dense_corder_cmp
+ *
+ * Purpose:     Callback routine for sorting attribute records by creation
+ *              order.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5A__dense_corder_cmp(const void *_rec1, const void *_rec2)
+{
+    const H5A_bt2_ud_ins_t *rec1 = *(const H5A_bt2_ud_ins_t * const *)_rec1;
+    const H5A_bt2_ud_ins_t *rec2 = *(const H5A_bt2_ud_ins_t * const *)_rec2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(rec1->common.corder < rec2->common.corder ? -1 :
+            (rec1->common.corder > rec2->common.corder ? 1 : 0))
+} /* end H5A__dense_corder_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__dense_bulk_cb
+ *
+ * Purpose:     v2 B-tree bulk-load callback, returning the next attribute
+ *              record of a batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5A__dense_bulk_cb(const void **udata, void *_op_data)
+{
+    H5A_dense_bulk_t *op_data = (H5A_dense_bulk_t *)_op_data;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    *udata = op_data->recs[op_data->next++];
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5A__dense_bulk_cb() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5A__dense_insert
@@ -451,15 +543,55 @@ done:
 herr_t
 H5A__dense_insert(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr)
 {
-    H5A_bt2_ud_ins_t udata;             /* User data for v2 B-tree insertion */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(ainfo);
+    HDassert(attr);
+
+    /* Insert the attribute as a batch of one */
+    if(H5A__dense_insert_multi(f, ainfo, (size_t)1, &attr) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to add to dense storage")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__dense_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__dense_insert_multi
+ *
+ * Purpose:     Insert a batch of attributes into dense storage structures
+ *              for an object.
+ *
+ *              The heaps and v2 B-trees are opened once for the whole
+ *              batch.  When the indices are empty, as they are right after
+ *              the object's attributes are converted to dense storage or
+ *              when the object is copied, they are bulk-loaded instead of
+ *              having the attributes inserted one at a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5A__dense_insert_multi(H5F_t *f, const H5O_ainfo_t *ainfo, size_t nattrs,
+    H5A_t **attrs)
+{
+    H5A_bt2_ud_ins_t *recs = NULL;      /* v2 B-tree records for attributes */
+    H5A_bt2_ud_ins_t **order = NULL;    /* v2 B-tree records, in index order */
     H5HF_t *fheap = NULL;               /* Fractal heap handle for attributes */
     H5HF_t *shared_fheap = NULL;        /* Fractal heap handle for shared header messages */
     H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
     H5B2_t *bt2_corder = NULL;          /* v2 B-tree handle for creation order index */
     H5WB_t *wb = NULL;                  /* Wrapped buffer for attribute data */
     uint8_t attr_buf[H5A_ATTR_BUF_SIZE]; /* Buffer for serializing message */
-    unsigned mesg_flags = 0;            /* Flags for storing message */
     htri_t attr_sharable;               /* Flag indicating attributes are sharable */
+    hsize_t nrec;                       /* # of attributes already indexed */
+    size_t u;                           /* Local index variable */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -467,31 +599,59 @@ H5A__dense_insert(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr)
     /* Check arguments */
     HDassert(f);
     HDassert(ainfo);
-    HDassert(attr);
+    HDassert(attrs || 0 == nattrs);
+
+    if(0 == nattrs)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate the v2 B-tree records */
+    if(NULL == (recs = (H5A_bt2_ud_ins_t *)H5MM_malloc(nattrs * sizeof(H5A_bt2_ud_ins_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for attribute batch")
+    if(NULL == (order = (H5A_bt2_ud_ins_t **)H5MM_malloc(nattrs * sizeof(H5A_bt2_ud_ins_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for attribute batch")
 
     /* Check if attributes are shared in this file */
     if((attr_sharable = H5SM_type_shared(f, H5O_ATTR_ID)) < 0)
         HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't determine if attributes are shared")
 
+    /* Determine how each attribute is stored */
+    for(u = 0; u < nattrs; u++) {
+        unsigned mesg_flags = 0;        /* Flags for storing message */
+
+        /* Check if attribute should be shared */
+        if(attr_sharable) {
+            htri_t shared_mesg;         /* Should this message be stored in the Shared Message table? */
+
+            /* Check if message is already shared */
+            if((shared_mesg = H5O_msg_is_shared(H5O_ATTR_ID, attrs[u])) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "error determining if message is shared")
+            else if(shared_mesg > 0)
+                /* Mark the message as shared */
+                mesg_flags |= H5O_MSG_FLAG_SHARED;
+            else {
+                /* Should this attribute be written as a SOHM? */
+                if(H5SM_try_share(f, NULL, 0, H5O_ATTR_ID, attrs[u], &mesg_flags) < 0)
+                    HGOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL, "error determining if message should be shared")
+
+                /* Attributes can't be "unique be shareable" yet */
+                HDassert(!(mesg_flags & H5O_MSG_FLAG_SHAREABLE));
+            } /* end else */
+        } /* end if */
+
+        /* Set up the v2 B-tree record for the attribute */
+        recs[u].common.f = f;
+        recs[u].common.name = attrs[u]->shared->name;
+        recs[u].common.name_hash = H5_checksum_lookup3(attrs[u]->shared->name, HDstrlen(attrs[u]->shared->name), 0);
+        H5_CHECKED_ASSIGN(recs[u].common.flags, uint8_t, mesg_flags, unsigned);
+        recs[u].common.corder = attrs[u]->shared->crt_idx;
+        recs[u].common.found_op = NULL;
+        recs[u].common.found_op_data = NULL;
+        order[u] = &recs[u];
+    } /* end for */
+
     /* Get handle for shared message heap, if attributes are sharable */
     if(attr_sharable) {
         haddr_t shared_fheap_addr;      /* Address of fractal heap to use */
-        htri_t shared_mesg;             /* Should this message be stored in the Shared Message table? */
-
-        /* Check if message is already shared */
-        if((shared_mesg = H5O_msg_is_shared(H5O_ATTR_ID, attr)) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "error determining if message is shared")
-        else if(shared_mesg > 0)
-            /* Mark the message as shared */
-            mesg_flags |= H5O_MSG_FLAG_SHARED;
-        else {
-            /* Should this attribute be written as a SOHM? */
-            if(H5SM_try_share(f, NULL, 0, H5O_ATTR_ID, attr, &mesg_flags) < 0)
-                HGOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL, "error determining if message should be shared")
-
-            /* Attributes can't be "unique be shareable" yet */
-            HDassert(!(mesg_flags & H5O_MSG_FLAG_SHAREABLE));
-        } /* end else */
 
         /* Retrieve the address of the shared message's fractal heap */
         if(H5SM_get_fheap_addr(f, H5O_ATTR_ID, &shared_fheap_addr) < 0)
@@ -509,71 +669,89 @@ H5A__dense_insert(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr)
     if(NULL == (fheap = H5HF_open(f, ainfo->fheap_addr)))
         HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
 
-    /* Check for inserting shared attribute */
-    if(mesg_flags & H5O_MSG_FLAG_SHARED) {
-        /* Sanity check */
-        HDassert(attr_sharable);
+    /* Store the attributes that aren't shared in the fractal heap */
+    for(u = 0; u < nattrs; u++) {
+        recs[u].common.fheap = fheap;
+        recs[u].common.shared_fheap = shared_fheap;
 
-        /* Use heap ID for shared message heap */
-        udata.id = attr->sh_loc.u.heap_id;
-    } /* end if */
-    else {
-        void *attr_ptr;         /* Pointer to serialized message */
-        size_t attr_size;       /* Size of serialized attribute in the heap */
+        /* Check for inserting shared attribute */
+        if(recs[u].common.flags & H5O_MSG_FLAG_SHARED) {
+            /* Sanity check */
+            HDassert(attr_sharable);
 
-        /* Find out the size of buffer needed for serialized message */
-        if((attr_size = H5O_msg_raw_size(f, H5O_ATTR_ID, FALSE, attr)) == 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTGETSIZE, FAIL, "can't get message size")
+            /* Use heap ID for shared message heap */
+            recs[u].id = attrs[u]->sh_loc.u.heap_id;
+        } /* end if */
+        else {
+            void *attr_ptr;         /* Pointer to serialized message */
+            size_t attr_size;       /* Size of serialized attribute in the heap */
 
-        /* Wrap the local buffer for serialized attributes */
-        if(NULL == (wb = H5WB_wrap(attr_buf, sizeof(attr_buf))))
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't wrap buffer")
+            /* Find out the size of buffer needed for serialized message */
+            if((attr_size = H5O_msg_raw_size(f, H5O_ATTR_ID, FALSE, attrs[u])) == 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTGETSIZE, FAIL, "can't get message size")
 
-        /* Get a pointer to a buffer that's large enough for attribute */
-        if(NULL == (attr_ptr = H5WB_actual(wb, attr_size)))
-            HGOTO_ERROR(H5E_ATTR, H5E_NOSPACE, FAIL, "can't get actual buffer")
+            /* Wrap the local buffer for serialized attributes */
+            if(NULL == wb && NULL == (wb = H5WB_wrap(attr_buf, sizeof(attr_buf))))
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't wrap buffer")
 
-        /* Create serialized form of attribute or shared message */
-        if(H5O_msg_encode(f, H5O_ATTR_ID, FALSE, (unsigned char *)attr_ptr, attr) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "can't encode attribute")
+            /* Get a pointer to a buffer that's large enough for attribute */
+            if(NULL == (attr_ptr = H5WB_actual(wb, attr_size)))
+                HGOTO_ERROR(H5E_ATTR, H5E_NOSPACE, FAIL, "can't get actual buffer")
 
-        /* Insert the serialized attribute into the fractal heap */
-        /* (sets the heap ID in the user data) */
-        if(H5HF_insert(fheap, attr_size, attr_ptr, &udata.id) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to insert attribute into fractal heap")
-    } /* end else */
+            /* Create serialized form of attribute or shared message */
+            if(H5O_msg_encode(f, H5O_ATTR_ID, FALSE, (unsigned char *)attr_ptr, attrs[u]) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "can't encode attribute")
+
+            /* Insert the serialized attribute into the fractal heap */
+            /* (sets the heap ID in the record) */
+            if(H5HF_insert(fheap, attr_size, attr_ptr, &recs[u].id) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to insert attribute into fractal heap")
+        } /* end else */
+    } /* end for */
 
     /* Open the name index v2 B-tree */
     if(NULL == (bt2_name = H5B2_open(f, ainfo->name_bt2_addr, NULL)))
         HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
 
-    /* Create the callback information for v2 B-tree record insertion */
-    udata.common.f = f;
-    udata.common.fheap = fheap;
-    udata.common.shared_fheap = shared_fheap;
-    udata.common.name = attr->shared->name;
-    udata.common.name_hash = H5_checksum_lookup3(attr->shared->name, HDstrlen(attr->shared->name), 0);
-    H5_CHECKED_ASSIGN(udata.common.flags, uint8_t, mesg_flags, unsigned);
-    udata.common.corder = attr->shared->crt_idx;
-    udata.common.found_op = NULL;
-    udata.common.found_op_data = NULL;
-    /* udata.id already set */
-
-    /* Insert attribute into 'name' tracking v2 B-tree */
-    if(H5B2_insert(bt2_name, &udata) < 0)
-        HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
-
-    /* Check if we should create a creation order index v2 B-tree record */
+    /* Check if we should create creation order index v2 B-tree records */
     if(ainfo->index_corder) {
         /* Open the creation order index v2 B-tree */
         HDassert(H5F_addr_defined(ainfo->corder_bt2_addr));
         if(NULL == (bt2_corder = H5B2_open(f, ainfo->corder_bt2_addr, NULL)))
             HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for creation order index")
+    } /* end if */
 
-        /* Insert the record into the creation order index v2 B-tree */
-        if(H5B2_insert(bt2_corder, &udata) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+    /* Check if the indices are empty */
+    if(H5B2_get_nrec(bt2_name, &nrec) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOUNT, FAIL, "can't retrieve # of records in index")
+
+    /* Insert the attributes into the v2 B-tree indices */
+    if(0 == nrec) {
+        H5A_dense_bulk_t bulk;          /* Stream of records to bulk-load */
+
+        HDqsort(order, nattrs, sizeof(H5A_bt2_ud_ins_t *), H5A__dense_name_cmp);
+        bulk.recs = order;
+        bulk.next = 0;
+        if(H5B2_bulk_load(bt2_name, (hsize_t)nattrs, H5A__dense_bulk_cb, &bulk) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to bulk load v2 B-tree for name index")
+
+        if(bt2_corder) {
+            HDqsort(order, nattrs, sizeof(H5A_bt2_ud_ins_t *), H5A__dense_corder_cmp);
+            bulk.next = 0;
+            if(H5B2_bulk_load(bt2_corder, (hsize_t)nattrs, H5A__dense_bulk_cb, &bulk) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to bulk load v2 B-tree for creation order index")
+        } /* end if */
     } /* end if */
+    else
+        for(u = 0; u < nattrs; u++) {
+            /* Insert attribute into 'name' tracking v2 B-tree */
+            if(H5B2_insert(bt2_name, &recs[u]) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+
+            /* Insert the record into the creation order index v2 B-tree */
+            if(bt2_corder && H5B2_insert(bt2_corder, &recs[u]) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+        } /* end for */
 
 done:
     /* Release resources */
@@ -587,9 +765,11 @@ done:
         HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for creation order index")
     if(wb && H5WB_unwrap(wb) < 0)
         HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    H5MM_xfree(order);
+    H5MM_xfree(recs);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5A__dense_insert() */
+} /* end H5A__dense_insert_multi() */
 
 
 /*-------------------------------------------------------------------------
@@ -1031,49 +1211,58 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5A__dense_iterate_bt2_cb
+ * Function:    H5A__dense_iterate_batch
  *
- * Purpose:     v2 B-tree callback for dense attribute storage iterator
+ * Purpose:     Read the batch of attributes gathered while iterating over
+ *              dense attribute storage from the fractal heaps at once, then
+ *              make the callback for each of them
  *
  * Return:      H5_ITER_ERROR/H5_ITER_CONT/H5_ITER_STOP
  *
- * Programmer:	Quincey Koziol
- *		koziol@hdfgroup.org
- *		Dec  5 2006
- *
  *-------------------------------------------------------------------------
  */
 static int
-H5A__dense_iterate_bt2_cb(const void *_record, void *_bt2_udata)
+H5A__dense_iterate_batch(H5A_bt2_ud_it_t *bt2_udata)
 {
-    const H5A_dense_bt2_name_rec_t *record = (const H5A_dense_bt2_name_rec_t *)_record; /* Record from B-tree */
-    H5A_bt2_ud_it_t *bt2_udata = (H5A_bt2_ud_it_t *)_bt2_udata;         /* User data for callback */
-    herr_t ret_value = H5_ITER_CONT;         /* Return value */
+    H5A_fh_ud_cp_t fh_udata[H5A_DENSE_ITER_BATCH_SIZE];    /* User data for fractal heap 'op' callbacks */
+    const void *ids[H5A_DENSE_ITER_BATCH_SIZE];     /* Heap IDs of unshared attributes */
+    void *op_data[H5A_DENSE_ITER_BATCH_SIZE];       /* User data for unshared attributes */
+    const void *shared_ids[H5A_DENSE_ITER_BATCH_SIZE];  /* Heap IDs of shared attributes */
+    void *shared_op_data[H5A_DENSE_ITER_BATCH_SIZE];    /* User data for shared attributes */
+    size_t nbatch = bt2_udata->nbatch;  /* # of attributes in batch */
+    size_t nids = 0, nshared_ids = 0;   /* # of unshared & shared attributes */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Check for skipping attributes */
-    if(bt2_udata->skip > 0)
-        --bt2_udata->skip;
-    else {
-        H5A_fh_ud_cp_t fh_udata;        /* User data for fractal heap 'op' callback */
-        H5HF_t *fheap;                  /* Fractal heap handle for attribute storage */
+    /* Prepare user data for callbacks, sorting the attributes by heap */
+    for(u = 0; u < nbatch; u++) {
+        fh_udata[u].f = bt2_udata->f;
+        fh_udata[u].record = &bt2_udata->batch_rec[u];
+        fh_udata[u].attr = NULL;
 
         /* Check for iterating over shared attribute */
-        if(record->flags & H5O_MSG_FLAG_SHARED)
-            fheap = bt2_udata->shared_fheap;
-        else
-            fheap = bt2_udata->fheap;
+        if(bt2_udata->batch_rec[u].flags & H5O_MSG_FLAG_SHARED) {
+            shared_ids[nshared_ids] = &bt2_udata->batch_rec[u].id;
+            shared_op_data[nshared_ids++] = &fh_udata[u];
+        } /* end if */
+        else {
+            ids[nids] = &bt2_udata->batch_rec[u].id;
+            op_data[nids++] = &fh_udata[u];
+        } /* end else */
+    } /* end for */
+    bt2_udata->nbatch = 0;
 
-        /* Prepare user data for callback */
-        /* down */
-        fh_udata.f = bt2_udata->f;
-        fh_udata.record = record;
-        fh_udata.attr = NULL;
+    /* Call fractal heap 'op' routine, to copy the attributes' information */
+    if(nids > 0 && H5HF_op_batch(bt2_udata->fheap, nids, ids, H5A__dense_copy_fh_cb, op_data) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPERATE, H5_ITER_ERROR, "heap op callback failed")
+    if(nshared_ids > 0 && H5HF_op_batch(bt2_udata->shared_fheap, nshared_ids, shared_ids, H5A__dense_copy_fh_cb, shared_op_data) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPERATE, H5_ITER_ERROR, "heap op callback failed")
 
-        /* Call fractal heap 'op' routine, to copy the attribute information */
-        if(H5HF_op(fheap, &record->id, H5A__dense_copy_fh_cb, &fh_udata) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTOPERATE, H5_ITER_ERROR, "heap op callback failed")
+    /* Make the callbacks, in iteration order */
+    for(u = 0; u < nbatch && ret_value == H5_ITER_CONT; u++) {
+        H5A_t *attr = fh_udata[u].attr;         /* Copy of attribute */
 
         /* Check which type of callback to make */
         switch(bt2_udata->attr_op->op_type) {
@@ -1082,46 +1271,92 @@ H5A__dense_iterate_bt2_cb(const void *_record, void *_bt2_udata)
                 H5A_info_t ainfo;               /* Info for attribute */
 
                 /* Get the attribute information */
-                if(H5A__get_info(fh_udata.attr, &ainfo) < 0)
+                if(H5A__get_info(attr, &ainfo) < 0)
                     HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, H5_ITER_ERROR, "unable to get attribute info")
 
                 /* Make the application callback */
-                ret_value = (bt2_udata->attr_op->u.app_op2)(bt2_udata->loc_id, fh_udata.attr->shared->name, &ainfo, bt2_udata->op_data);
+                ret_value = (bt2_udata->attr_op->u.app_op2)(bt2_udata->loc_id, attr->shared->name, &ainfo, bt2_udata->op_data);
                 break;
             }
 
 #ifndef H5_NO_DEPRECATED_SYMBOLS
             case H5A_ATTR_OP_APP:
                 /* Make the application callback */
-                ret_value = (bt2_udata->attr_op->u.app_op)(bt2_udata->loc_id, fh_udata.attr->shared->name, bt2_udata->op_data);
+                ret_value = (bt2_udata->attr_op->u.app_op)(bt2_udata->loc_id, attr->shared->name, bt2_udata->op_data);
                 break;
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
             case H5A_ATTR_OP_LIB:
                 /* Call the library's callback */
-                ret_value = (bt2_udata->attr_op->u.lib_op)(fh_udata.attr, bt2_udata->op_data);
+                ret_value = (bt2_udata->attr_op->u.lib_op)(attr, bt2_udata->op_data);
                 break;
 
             default:
                 HDassert("unknown attribute op type" && 0);
 #ifdef NDEBUG
-                HGOTO_ERROR(H5E_ATTR, H5E_UNSUPPORTED, FAIL, "unsupported attribute op type")
+                HGOTO_ERROR(H5E_ATTR, H5E_UNSUPPORTED, H5_ITER_ERROR, "unsupported attribute op type")
 #endif /* NDEBUG */
         } /* end switch */
 
-        /* Release the space allocated for the attribute */
-        H5O_msg_free(H5O_ATTR_ID, fh_udata.attr);
-    } /* end else */
-
-    /* Increment the number of attributes passed through */
-    /* (whether we skipped them or not) */
-    bt2_udata->count++;
+        /* Increment the number of attributes passed through */
+        bt2_udata->count++;
+    } /* end for */
 
     /* Check for callback failure and pass along return value */
     if(ret_value < 0)
         HERROR(H5E_ATTR, H5E_CANTNEXT, "iteration operator failed");
 
 done:
+    /* Release the space allocated for the attributes */
+    for(u = 0; u < nbatch; u++)
+        if(fh_udata[u].attr)
+            H5O_msg_free(H5O_ATTR_ID, fh_udata[u].attr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__dense_iterate_batch() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__dense_iterate_bt2_cb
+ *
+ * Purpose:     v2 B-tree callback for dense attribute storage iterator.
+ *              Attributes are gathered into a batch, which is read from the
+ *              fractal heaps (and the callbacks made) when it fills up.
+ *
+ * Return:      H5_ITER_ERROR/H5_ITER_CONT/H5_ITER_STOP
+ *
+ * Programmer:	Quincey Koziol
+ *		koziol@hdfgroup.org
+ *		Dec  5 2006
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5A__dense_iterate_bt2_cb(const void *_record, void *_bt2_udata)
+{
+    const H5A_dense_bt2_name_rec_t *record = (const H5A_dense_bt2_name_rec_t *)_record; /* Record from B-tree */
+    H5A_bt2_ud_it_t *bt2_udata = (H5A_bt2_ud_it_t *)_bt2_udata;         /* User data for callback */
+    herr_t ret_value = H5_ITER_CONT;         /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check for skipping attributes */
+    if(bt2_udata->skip > 0) {
+        --bt2_udata->skip;
+
+        /* Increment the number of attributes passed through */
+        bt2_udata->count++;
+    } /* end if */
+    else {
+        /* Add the attribute to the batch */
+        bt2_udata->batch_rec[bt2_udata->nbatch++] = *record;
+
+        /* Make the callbacks for the attributes in the batch, when it's full */
+        if(bt2_udata->nbatch == H5A_DENSE_ITER_BATCH_SIZE)
+            ret_value = H5A__dense_iterate_batch(bt2_udata);
+    } /* end else */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5A__dense_iterate_bt2_cb() */
 
@@ -1225,12 +1460,18 @@ H5A__dense_iterate(H5F_t *f, hid_t loc_id, const H5O_ainfo_t *ainfo,
         udata.count = 0;
         udata.attr_op = attr_op;
         udata.op_data = op_data;
+        udata.nbatch = 0;
 
         /* Iterate over the records in the v2 B-tree's "native" order */
         /* (by hash of name) */
         if((ret_value = H5B2_iterate(bt2, H5A__dense_iterate_bt2_cb, &udata)) < 0)
             HERROR(H5E_ATTR, H5E_BADITER, "attribute iteration failed");
 
+        /* Make the callbacks for the attributes left in the batch */
+        else if(ret_value == H5_ITER_CONT && udata.nbatch > 0)
+            if((ret_value = H5A__dense_iterate_batch(&udata)) < 0)
+                HERROR(H5E_ATTR, H5E_BADITER, "attribute iteration failed");
+
         /* Update the last attribute examined, if requested */
         if(last_attr)
             *last_attr = udata.count;
@@ -49,6 +49,9 @@
 /* Local Macros */
 /****************/
 
+/* Alignment of attributes' data in the buffer for H5Aread_all */
+#define H5A_READ_ALL_ALIGN      16
+
 
 /******************/
 /* Local Typedefs */
@@ -76,8 +79,23 @@ typedef struct {
     H5O_copy_t *cpy_info;       /* Information on copying options   */
     const H5O_loc_t *oloc_src;
     H5O_loc_t *oloc_dst;
+    H5A_attr_table_t atable;    /* Copied attributes, to insert into dense storage */
+    size_t alloc_attrs;         /* Size of attribute table */
 } H5A_dense_file_cp_ud_t;
 
+/* Data exchange structure to use when reading all attributes of an object */
+typedef struct {
+    const H5O_loc_t *oloc;      /* Location of object */
+    size_t max_nattrs;          /* # of elements in info array */
+    H5A_bulk_info_t *info;      /* Array of attribute information to fill */
+    size_t buf_size;            /* Size of buffer for names & data */
+    uint8_t *buf;               /* Buffer for names & data */
+    size_t nattrs;              /* # of attributes visited */
+    size_t nfilled;             /* # of attributes returned */
+    size_t used;                /* Size of buffer needed */
+    hbool_t full;               /* Whether the info array or buffer filled up */
+} H5A_read_all_ud_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -99,6 +117,7 @@ static herr_t H5A__attr_sort_table(H5A_attr_table_t *atable, H5_index_t idx_type
     H5_iter_order_t order);
 static herr_t H5A__iterate_common(hid_t loc_id, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t *idx, H5A_attr_iter_op_t *attr_op, void *op_data);
+static herr_t H5A__read_all_cb(const H5A_t *attr, void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -2417,6 +2436,8 @@ done:
  * Function:    H5A__dense_post_copy_file_cb
  *
  * Purpose:     Callback routine for copying a dense attribute from SRC to DST.
+ *              The copy is added to a table of attributes to insert into
+ *              the destination's dense storage together.
  *
  * Return:      Success:        Non-negative
  *              Failure:        Negative
@@ -2453,15 +2474,20 @@ H5A__dense_post_copy_file_cb(const H5A_t *attr_src, void *_udata)
     if(H5O_msg_reset_share(H5O_ATTR_ID, attr_dst) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "unable to reset attribute sharing")
 
-    /* Set COPIED tag for destination object's metadata */
-    H5_BEGIN_TAG(H5AC__COPIED_TAG);
+    /* Check for needing to increase the size of the attribute table */
+    if(udata->atable.nattrs >= udata->alloc_attrs) {
+        size_t na = MAX(1, udata->alloc_attrs * 2);     /* New # of attributes allocated */
+        H5A_t **x;              /* Pointer to larger attribute table */
 
-    /* Insert attribute into dense storage */
-    if(H5A__dense_insert(udata->file, udata->ainfo, attr_dst) < 0)
-        HGOTO_ERROR_TAG(H5E_OHDR, H5E_CANTINSERT, H5_ITER_ERROR, "unable to add to dense storage")
+        if(NULL == (x = (H5A_t **)H5MM_realloc(udata->atable.attrs, sizeof(H5A_t *) * na)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed")
+        udata->alloc_attrs = na;
+        udata->atable.attrs = x;
+    } /* end if */
 
-    /* Reset metadata tag */
-    H5_END_TAG
+    /* Add attribute to table, for inserting into dense storage */
+    udata->atable.attrs[udata->atable.nattrs++] = attr_dst;
+    attr_dst = NULL;
 
 done:
     if(attr_dst && H5A__close(attr_dst) < 0)
@@ -2505,15 +2531,39 @@ H5A__dense_post_copy_file_all(const H5O_loc_t *src_oloc, const H5O_ainfo_t *ainf
     udata.cpy_info = cpy_info;                /* Information on copying options   */
     udata.oloc_src = src_oloc;
     udata.oloc_dst = dst_oloc;
+    udata.atable.nattrs = 0;
+    udata.atable.attrs = NULL;
+    udata.alloc_attrs = 0;
 
     attr_op.op_type = H5A_ATTR_OP_LIB;
     attr_op.u.lib_op = H5A__dense_post_copy_file_cb;
 
+    /* Copy the attributes */
     if(H5A__dense_iterate(src_oloc->file, (hid_t)0, ainfo_src, H5_INDEX_NAME,
             H5_ITER_NATIVE, (hsize_t)0, NULL, &attr_op, &udata) < 0)
         HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
 
+    /* Set COPIED tag for destination object's metadata */
+    H5_BEGIN_TAG(H5AC__COPIED_TAG);
+
+    /* Insert the copies into dense storage together */
+    if(H5A__dense_insert_multi(dst_oloc->file, ainfo_dst, udata.atable.nattrs, udata.atable.attrs) < 0)
+        HGOTO_ERROR_TAG(H5E_OHDR, H5E_CANTINSERT, FAIL, "unable to add to dense storage")
+
+    /* Reset metadata tag */
+    H5_END_TAG
+
 done:
+    /* Release the copies */
+    if(udata.atable.attrs) {
+        size_t u;               /* Local index variable */
+
+        for(u = 0; u < udata.atable.nattrs; u++)
+            if(H5A__close(udata.atable.attrs[u]) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close destination attribute")
+        H5MM_xfree(udata.atable.attrs);
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5A__dense_post_copy_file_all */
 
@@ -2709,6 +2759,169 @@ H5A__iterate_old(hid_t loc_id, unsigned *attr_num, H5A_operator1_t op,
 } /* H5A__iterate_old() */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__read_all_cb
+ *
+ * Purpose:     Attribute iteration callback for H5A__read_all, which returns
+ *              an attribute's name, datatype, dataspace & data, if there's
+ *              room for them.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5A__read_all_cb(const H5A_t *_attr, void *_udata)
+{
+    H5A_t *attr = (H5A_t *)_attr;       /* Attribute, casting away const OK */
+    H5A_read_all_ud_t *udata = (H5A_read_all_ud_t *)_udata;     /* User data for callback */
+    const H5T_t *mem_type;              /* Datatype to return data in */
+    hid_t type_id = H5I_INVALID_HID;    /* ID of datatype */
+    hid_t space_id = H5I_INVALID_HID;   /* ID of dataspace */
+    hssize_t snelmts;                   /* # of elements in attribute */
+    size_t name_len;                    /* Length of attribute's name */
+    size_t data_size;                   /* Size of attribute's data */
+    size_t data_off;                    /* Offset of data in buffer */
+    size_t name_off;                    /* Offset of name in buffer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(attr);
+    HDassert(udata);
+
+    /* Attributes iterated over aren't opened, give them the object's location */
+    if(!attr->obj_opened) {
+        attr->oloc.file = udata->oloc->file;
+        attr->oloc.addr = udata->oloc->addr;
+    } /* end if */
+
+    /* Mark datatype as being on disk now, as when opening the attribute */
+    if(H5T_set_loc(attr->shared->dt, udata->oloc->file, H5T_LOC_DISK) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "invalid datatype location")
+
+    /* Get a copy of the attribute's datatype, which its data is returned in */
+    if((type_id = H5A__get_type(attr)) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get datatype")
+    if(NULL == (mem_type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Compute the location of the attribute's data & name in the buffer */
+    if((snelmts = H5S_GET_EXTENT_NPOINTS(attr->shared->ds)) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOUNT, FAIL, "dataspace is invalid")
+    data_size = (size_t)snelmts * H5T_GET_SIZE(mem_type);
+    name_len = HDstrlen(attr->shared->name);
+    data_off = ((udata->used + H5A_READ_ALL_ALIGN - 1) / H5A_READ_ALL_ALIGN) * H5A_READ_ALL_ALIGN;
+    name_off = data_off + data_size;
+    udata->used = name_off + name_len + 1;
+    udata->nattrs++;
+
+    /* Check for room to return the attribute */
+    if(udata->full || udata->nfilled == udata->max_nattrs || udata->used > udata->buf_size)
+        udata->full = TRUE;
+    else {
+        H5A_bulk_info_t *info = &udata->info[udata->nfilled];
+
+        /* Get a copy of the attribute's dataspace */
+        if((space_id = H5A_get_space(attr)) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get dataspace")
+
+        /* Read the attribute's data */
+        if(data_size > 0)
+            if(H5A__read(attr, mem_type, udata->buf + data_off) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attribute")
+
+        /* Copy the attribute's name */
+        HDmemcpy(udata->buf + name_off, attr->shared->name, name_len + 1);
+
+        /* Return the attribute's information */
+        info->name = (const char *)(udata->buf + name_off);
+        info->type_id = type_id;
+        info->space_id = space_id;
+        info->data_size = data_size;
+        info->data = data_size > 0 ? udata->buf + data_off : NULL;
+        udata->nfilled++;
+
+        /* The IDs belong to the application now */
+        type_id = space_id = H5I_INVALID_HID;
+    } /* end else */
+
+done:
+    /* Release resources */
+    if(type_id >= 0 && H5I_dec_app_ref(type_id) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "unable to close datatype")
+    if(space_id >= 0 && H5I_dec_app_ref(space_id) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "unable to close dataspace")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__read_all_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__read_all
+ *
+ * Purpose:     Private version of H5Aread_all
+ *
+ * Return:      Success:    # of attributes returned in INFO
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5A__read_all(const H5G_loc_t *loc, H5_index_t idx_type, H5_iter_order_t order,
+    size_t *nattrs, H5A_bulk_info_t info[], size_t *buf_size, void *buf)
+{
+    H5A_attr_iter_op_t attr_op;         /* Attribute operator */
+    H5A_read_all_ud_t udata;            /* User data for callback */
+    size_t u;                           /* Local index variable */
+    ssize_t ret_value = -1;             /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(loc);
+    HDassert(nattrs);
+    HDassert(buf_size);
+
+    /* Build attribute operator info */
+    attr_op.op_type = H5A_ATTR_OP_LIB;
+    attr_op.u.lib_op = H5A__read_all_cb;
+
+    /* Set up user data for callback */
+    udata.oloc = loc->oloc;
+    udata.max_nattrs = *nattrs;
+    udata.info = info;
+    udata.buf_size = *buf_size;
+    udata.buf = (uint8_t *)buf;
+    udata.nattrs = 0;
+    udata.nfilled = 0;
+    udata.used = 0;
+    udata.full = FALSE;
+
+    /* Visit all the attributes of the object */
+    if(H5O_attr_iterate_real(H5I_INVALID_HID, loc->oloc, idx_type, order, (hsize_t)0, NULL, &attr_op, &udata) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_BADITER, (-1), "error iterating over attributes")
+
+    /* Set return values */
+    *nattrs = udata.nattrs;
+    *buf_size = udata.used;
+    ret_value = (ssize_t)udata.nfilled;
+
+done:
+    /* Release the IDs for attributes returned, on failure */
+    if(ret_value < 0)
+        for(u = 0; u < udata.nfilled; u++) {
+            if(H5I_dec_app_ref(info[u].type_id) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, (-1), "unable to close datatype")
+            if(H5I_dec_app_ref(info[u].space_id) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, (-1), "unable to close dataspace")
+        } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__read_all() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5A__delete_by_name
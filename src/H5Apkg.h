@@ -205,6 +205,9 @@ H5_DLL herr_t H5A__rename_by_name(H5G_loc_t loc, const char *obj_name, const cha
     const char *new_attr_name);
 H5_DLL herr_t H5A__iterate(const H5G_loc_t *loc, const char *obj_name,H5_index_t idx_type, H5_iter_order_t order,
     hsize_t *idx, H5A_operator2_t op, void *op_data);
+H5_DLL ssize_t H5A__read_all(const H5G_loc_t *loc, H5_index_t idx_type,
+    H5_iter_order_t order, size_t *nattrs, H5A_bulk_info_t info[],
+    size_t *buf_size, void *buf);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
 H5_DLL herr_t H5A__iterate_old(hid_t loc_id, unsigned *attr_num,
     H5A_operator1_t op, void *op_data);
@@ -222,6 +225,8 @@ H5_DLL ssize_t H5A__get_name(H5A_t *attr, size_t buf_size, char *buf);
 H5_DLL herr_t H5A__dense_create(H5F_t *f, H5O_ainfo_t *ainfo);
 H5_DLL H5A_t *H5A__dense_open(H5F_t *f, const H5O_ainfo_t *ainfo, const char *name);
 H5_DLL herr_t H5A__dense_insert(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr);
+H5_DLL herr_t H5A__dense_insert_multi(H5F_t *f, const H5O_ainfo_t *ainfo,
+    size_t nattrs, H5A_t **attrs);
 H5_DLL herr_t H5A__dense_write(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr);
 H5_DLL herr_t H5A__dense_rename(H5F_t *f, const H5O_ainfo_t *ainfo,
     const char *old_name, const char *new_name);
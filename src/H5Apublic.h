@@ -30,6 +30,15 @@ typedef struct {
     hsize_t             data_size;      /* Size of raw data		  */
 } H5A_info_t;
 
+/* Information about an attribute, returned in bulk by H5Aread_all */
+typedef struct {
+    const char          *name;          /* Name of attribute              */
+    hid_t               type_id;        /* Datatype of attribute          */
+    hid_t               space_id;       /* Dataspace of attribute         */
+    size_t              data_size;      /* Size of attribute's data       */
+    void                *data;          /* Attribute's data               */
+} H5A_bulk_info_t;
+
 /* Typedef for H5Aiterate2() callbacks */
 typedef herr_t (*H5A_operator2_t)(hid_t location_id/*in*/,
     const char *attr_name/*in*/, const H5A_info_t *ainfo/*in*/, void *op_data/*in,out*/);
@@ -82,6 +91,9 @@ H5_DLL herr_t  H5Aiterate2(hid_t loc_id, H5_index_t idx_type,
 H5_DLL herr_t  H5Aiterate_by_name(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t *idx, H5A_operator2_t op, void *op_data,
     hid_t lapd_id);
+H5_DLL ssize_t H5Aread_all(hid_t loc_id, H5_index_t idx_type,
+    H5_iter_order_t order, size_t *nattrs, H5A_bulk_info_t info[],
+    size_t *buf_size, void *buf);
 H5_DLL herr_t  H5Adelete(hid_t loc_id, const char *name);
 H5_DLL herr_t  H5Adelete_by_name(hid_t loc_id, const char *obj_name,
     const char *attr_name, hid_t lapl_id);
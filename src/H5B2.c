@@ -295,6 +295,64 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_load
+ *
+ * Purpose:	Adds 'nrec' records to an empty B-tree, building its nodes
+ *		directly instead of inserting the records one at a time.
+ *
+ *		The records are retrieved by calling 'op' once per record,
+ *		which must return them in increasing order, according to
+ *		the class's 'compare' method.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_bulk_load(H5B2_t *bt2, hsize_t nrec, H5B2_bulk_t op, void *op_data)
+{
+    H5B2_hdr_t	*hdr;                   /* Pointer to the B-tree header */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments. */
+    HDassert(bt2);
+    HDassert(op);
+
+    /* Set the shared v2 B-tree header's file context for this operation */
+    bt2->hdr->f = bt2->f;
+
+    /* Get the v2 B-tree header */
+    hdr = bt2->hdr;
+
+    /* Only an empty B-tree can be bulk-loaded */
+    if(H5F_addr_defined(hdr->root.addr))
+        HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "B-tree is not empty")
+
+    /* SWMR writers need the flush dependencies set up by regular insertions */
+    if(hdr->swmr_write) {
+        hsize_t u;              /* Local index */
+
+        for(u = 0; u < nrec; u++) {
+            const void *udata = NULL;   /* Record to insert */
+
+            if((op)(&udata, op_data) < 0 || NULL == udata)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTGET, FAIL, "can't get record to load")
+            if(H5B2__insert(hdr, (void *)udata) < 0)       /* Casting away const OK */
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to insert record into B-tree")
+        } /* end for */
+    } /* end if */
+    else
+        if(H5B2__bulk_load(hdr, nrec, op, op_data) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to bulk load B-tree")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2_bulk_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2_update
@@ -63,6 +63,7 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5B2__hdr_init_node_info(H5B2_hdr_t *hdr, unsigned depth);
 
 
 /*********************/
@@ -181,24 +182,9 @@ H5B2__hdr_init(H5B2_hdr_t *hdr, const H5B2_create_t *cparam, void *ctx_udata,
 
     /* Initialize internal node info */
     if(depth > 0) {
-        for(u = 1; u < (unsigned)(depth + 1); u++) {
-            sz_max_nrec = H5B2_NUM_INT_REC(hdr, u);
-            H5_CHECKED_ASSIGN(hdr->node_info[u].max_nrec, unsigned, sz_max_nrec, size_t)
-            HDassert(hdr->node_info[u].max_nrec <= hdr->node_info[u - 1].max_nrec);
-
-            hdr->node_info[u].split_nrec = (hdr->node_info[u].max_nrec * hdr->split_percent) / 100;
-            hdr->node_info[u].merge_nrec = (hdr->node_info[u].max_nrec * hdr->merge_percent) / 100;
-
-            hdr->node_info[u].cum_max_nrec = ((hdr->node_info[u].max_nrec + 1) *
-                hdr->node_info[u - 1].cum_max_nrec) + hdr->node_info[u].max_nrec;
-            u_max_nrec_size = H5VM_limit_enc_size((uint64_t)hdr->node_info[u].cum_max_nrec);
-            H5_CHECKED_ASSIGN(hdr->node_info[u].cum_max_nrec_size, uint8_t, u_max_nrec_size, unsigned)
-
-            if(NULL == (hdr->node_info[u].nat_rec_fac = H5FL_fac_init(hdr->cls->nrec_size * hdr->node_info[u].max_nrec)))
-                HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't create node native key block factory")
-            if(NULL == (hdr->node_info[u].node_ptr_fac = H5FL_fac_init(sizeof(H5B2_node_ptr_t) * (hdr->node_info[u].max_nrec + 1))))
-                HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't create internal 'branch' node node pointer block factory")
-        } /* end for */
+        for(u = 1; u < (unsigned)(depth + 1); u++)
+            if(H5B2__hdr_init_node_info(hdr, u) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't initialize internal node info")
     } /* end if */
 
     /* Determine if we are doing SWMR writes.  Only enable for data chunks for now. */
@@ -221,6 +207,95 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5B2__hdr_init() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__hdr_init_node_info
+ *
+ * Purpose:	Initialize the node info for internal nodes at a depth of
+ *              the B-tree, from the node info at the depth below it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__hdr_init_node_info(H5B2_hdr_t *hdr, unsigned depth)
+{
+    H5B2_node_info_t *node_info;        /* Node info to initialize */
+    size_t sz_max_nrec;                 /* Temporary variable for range checking */
+    unsigned u_max_nrec_size;           /* Temporary variable for range checking */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    HDassert(hdr);
+    HDassert(depth > 0 && depth <= hdr->depth);
+
+    node_info = &hdr->node_info[depth];
+    sz_max_nrec = H5B2_NUM_INT_REC(hdr, depth);
+    H5_CHECKED_ASSIGN(node_info->max_nrec, unsigned, sz_max_nrec, size_t)
+    HDassert(node_info->max_nrec <= hdr->node_info[depth - 1].max_nrec);
+
+    node_info->split_nrec = (node_info->max_nrec * hdr->split_percent) / 100;
+    node_info->merge_nrec = (node_info->max_nrec * hdr->merge_percent) / 100;
+
+    node_info->cum_max_nrec = ((node_info->max_nrec + 1) *
+        hdr->node_info[depth - 1].cum_max_nrec) + node_info->max_nrec;
+    u_max_nrec_size = H5VM_limit_enc_size((uint64_t)node_info->cum_max_nrec);
+    H5_CHECKED_ASSIGN(node_info->cum_max_nrec_size, uint8_t, u_max_nrec_size, unsigned)
+
+    node_info->nat_rec_fac = NULL;
+    node_info->node_ptr_fac = NULL;
+    if(NULL == (node_info->nat_rec_fac = H5FL_fac_init(hdr->cls->nrec_size * node_info->max_nrec)))
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't create node native key block factory")
+    if(NULL == (node_info->node_ptr_fac = H5FL_fac_init(sizeof(H5B2_node_ptr_t) * (node_info->max_nrec + 1))))
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't create internal 'branch' node node pointer block factory")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2__hdr_init_node_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__hdr_incr_depth
+ *
+ * Purpose:	Add a level to the B-tree's node info, for a new root node
+ *              one level above the current one.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2__hdr_incr_depth(H5B2_hdr_t *hdr)
+{
+    H5B2_node_info_t *node_info;        /* New table of node info structs */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(hdr);
+
+    /* Re-allocate array of node info structs */
+    if(NULL == (node_info = H5FL_SEQ_REALLOC(H5B2_node_info_t, hdr->node_info, (size_t)(hdr->depth + 2))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    hdr->node_info = node_info;
+
+    /* Update depth of B-tree */
+    hdr->depth++;
+
+    /* Set up node info for new depth of tree */
+    if(H5B2__hdr_init_node_info(hdr, hdr->depth) < 0) {
+        hdr->depth--;
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't initialize internal node info")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2__hdr_incr_depth() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2__hdr_alloc
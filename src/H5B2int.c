@@ -35,6 +35,7 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5B2pkg.h"		/* v2 B-trees				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 
@@ -42,11 +43,25 @@
 /* Local Macros */
 /****************/
 
+/* Largest run of sibling leaf nodes to read with one I/O operation */
+#define H5B2_PREFETCH_MAX_SIZE  (256 * 1024)
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* State for bulk-loading records into a B-tree */
+typedef struct H5B2_bulk_load_t {
+    H5B2_bulk_t op;             /* Callback to retrieve the next record */
+    void *op_data;              /* Context for callback */
+    hsize_t *fill;              /* # of records in a full subtree at each depth */
+#ifndef NDEBUG
+    uint8_t *prev;              /* Copy of the previous native record loaded */
+    hbool_t have_prev;          /* Whether a previous record was loaded */
+#endif /* NDEBUG */
+} H5B2_bulk_load_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -56,6 +71,14 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5B2__bulk_load_rec(H5B2_hdr_t *hdr, H5B2_bulk_load_t *load,
+    void *nrecord);
+static herr_t H5B2__bulk_load_node(H5B2_hdr_t *hdr, uint16_t depth,
+    H5B2_node_ptr_t *node_ptr, void *parent, hsize_t nrec,
+    H5B2_bulk_load_t *load);
+static herr_t H5B2__prefetch_leaves(H5B2_hdr_t *hdr,
+    const H5B2_node_ptr_t *node_ptrs, unsigned nchildren, unsigned start,
+    unsigned *end);
 static herr_t H5B2__update_child_flush_depends(H5B2_hdr_t *hdr, 
     unsigned depth, const H5B2_node_ptr_t *node_ptrs, unsigned start_idx,
     unsigned end_idx, void *old_parent, void *new_parent);
@@ -75,9 +98,6 @@ static herr_t H5B2__update_child_flush_depends(H5B2_hdr_t *hdr,
 /* Local Variables */
 /*******************/
 
-/* Declare a free list to manage the 'H5B2_node_info_t' sequence information */
-H5FL_SEQ_EXTERN(H5B2_node_info_t);
-
 
 
 /*-------------------------------------------------------------------------
@@ -346,8 +366,6 @@ H5B2__split_root(H5B2_hdr_t *hdr)
     H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
     unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
     H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
-    size_t sz_max_nrec;                 /* Temporary variable for range checking */
-    unsigned u_max_nrec_size;           /* Temporary variable for range checking */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -355,26 +373,9 @@ H5B2__split_root(H5B2_hdr_t *hdr)
     /* Check arguments. */
     HDassert(hdr);
 
-    /* Update depth of B-tree */
-    hdr->depth++;
-
-    /* Re-allocate array of node info structs */
-    if(NULL == (hdr->node_info = H5FL_SEQ_REALLOC(H5B2_node_info_t, hdr->node_info, (size_t)(hdr->depth + 1))))
-        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-
-    /* Update node info for new depth of tree */
-    sz_max_nrec = H5B2_NUM_INT_REC(hdr, hdr->depth);
-    H5_CHECKED_ASSIGN(hdr->node_info[hdr->depth].max_nrec, unsigned, sz_max_nrec, size_t)
-    hdr->node_info[hdr->depth].split_nrec = (hdr->node_info[hdr->depth].max_nrec * hdr->split_percent) / 100;
-    hdr->node_info[hdr->depth].merge_nrec = (hdr->node_info[hdr->depth].max_nrec * hdr->merge_percent) / 100;
-    hdr->node_info[hdr->depth].cum_max_nrec = ((hdr->node_info[hdr->depth].max_nrec + 1) *
-        hdr->node_info[hdr->depth - 1].cum_max_nrec) + hdr->node_info[hdr->depth].max_nrec;
-    u_max_nrec_size = H5VM_limit_enc_size((uint64_t)hdr->node_info[hdr->depth].cum_max_nrec);
-    H5_CHECKED_ASSIGN(hdr->node_info[hdr->depth].cum_max_nrec_size, uint8_t, u_max_nrec_size, unsigned)
-    if(NULL == (hdr->node_info[hdr->depth].nat_rec_fac = H5FL_fac_init(hdr->cls->nrec_size * hdr->node_info[hdr->depth].max_nrec)))
-	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't create node native key block factory")
-    if(NULL == (hdr->node_info[hdr->depth].node_ptr_fac = H5FL_fac_init(sizeof(H5B2_node_ptr_t) * (hdr->node_info[hdr->depth].max_nrec + 1))))
-	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't create internal 'branch' node node pointer block factory")
+    /* Add a new level to the B-tree's node info */
+    if(H5B2__hdr_incr_depth(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't increase depth of B-tree")
 
     /* Keep old root node pointer info */
     old_root_ptr = hdr->root;
@@ -1483,6 +1484,281 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2__insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__bulk_load_rec
+ *
+ * Purpose:	Retrieve the next record from a bulk-load stream and store
+ *		it in a node's native record table.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__bulk_load_rec(H5B2_hdr_t *hdr, H5B2_bulk_load_t *load, void *nrecord)
+{
+    const void *udata = NULL;           /* Record to store */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(load);
+    HDassert(nrecord);
+
+    /* Get the next record */
+    if((load->op)(&udata, load->op_data) < 0 || NULL == udata)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTGET, FAIL, "can't get record to load")
+
+#ifndef NDEBUG
+    /* Records must arrive in increasing order */
+    if(load->have_prev) {
+        int cmp = 0;            /* Comparison value of records */
+
+        if((hdr->cls->compare)(udata, load->prev, &cmp) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTCOMPARE, FAIL, "can't compare btree2 records")
+        HDassert(cmp > 0);
+    } /* end if */
+#endif /* NDEBUG */
+
+    /* Store the record in the node */
+    if((hdr->cls->store)(nrecord, udata) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to store record")
+
+#ifndef NDEBUG
+    HDmemcpy(load->prev, nrecord, hdr->cls->nrec_size);
+    load->have_prev = TRUE;
+#endif /* NDEBUG */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__bulk_load_rec() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__bulk_load_node
+ *
+ * Purpose:	Create a node holding a subtree of records from a bulk-load
+ *		stream, filling its descendants as full as the B-tree's
+ *		split thresholds allow.
+ *
+ *		The records are divided as evenly as possible among the
+ *		fewest children that can hold them, so every node except
+ *		the root is at least half full.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__bulk_load_node(H5B2_hdr_t *hdr, uint16_t depth, H5B2_node_ptr_t *node_ptr,
+    void *parent, hsize_t nrec, H5B2_bulk_load_t *load)
+{
+    H5B2_internal_t *internal = NULL;   /* Pointer to internal node */
+    H5B2_leaf_t *leaf = NULL;           /* Pointer to leaf node */
+    unsigned u;                         /* Local index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(node_ptr);
+    HDassert(load);
+    HDassert(nrec > 0 && nrec <= load->fill[depth]);
+
+    /* Create new node */
+    node_ptr->node_nrec = 0;
+    node_ptr->all_nrec = 0;
+    if(depth > 0) {
+        hsize_t child_fill = load->fill[depth - 1];  /* Capacity of each child */
+        hsize_t child_nrec;             /* # of records in each child */
+        hsize_t extra;                  /* # of children with one more record */
+        unsigned nchildren;             /* # of children for this node */
+
+        /* Use the fewest children able to hold the records */
+        nchildren = (unsigned)((nrec + 1 + child_fill) / (child_fill + 1));
+        if(nchildren < 2)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "node parameters too small for bulk load")
+        HDassert(nchildren <= hdr->node_info[depth].split_nrec + 1);
+        child_nrec = (nrec - (nchildren - 1)) / nchildren;
+        extra = (nrec - (nchildren - 1)) % nchildren;
+
+        if(H5B2__create_internal(hdr, parent, node_ptr, depth) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create new internal node")
+        if(NULL == (internal = H5B2__protect_internal(hdr, parent, node_ptr, depth, FALSE, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree internal node")
+
+        /* Load each child, followed by the record separating it from the next */
+        for(u = 0; u < nchildren; u++) {
+            if(H5B2__bulk_load_node(hdr, (uint16_t)(depth - 1), &internal->node_ptrs[u], internal, child_nrec + (u < extra ? 1 : 0), load) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to load B-tree child node")
+            if(u < (nchildren - 1))
+                if(H5B2__bulk_load_rec(hdr, load, H5B2_INT_NREC(internal, hdr, u)) < 0)
+                    HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to load record into B-tree internal node")
+        } /* end for */
+        internal->nrec = (uint16_t)(nchildren - 1);
+    } /* end if */
+    else {
+        if(H5B2__create_leaf(hdr, parent, node_ptr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create new leaf node")
+        if(NULL == (leaf = H5B2__protect_leaf(hdr, parent, node_ptr, FALSE, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree leaf node")
+
+        /* Load the records */
+        for(u = 0; u < nrec; u++)
+            if(H5B2__bulk_load_rec(hdr, load, H5B2_LEAF_NREC(leaf, hdr, u)) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to load record into B-tree leaf node")
+        leaf->nrec = (uint16_t)nrec;
+    } /* end else */
+
+    /* Update node pointer */
+    node_ptr->node_nrec = internal ? internal->nrec : leaf->nrec;
+    node_ptr->all_nrec = nrec;
+
+done:
+    /* Release the node (marked as dirty) */
+    if(internal && H5AC_unprotect(hdr->f, H5AC_BT2_INT, node_ptr->addr, internal, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree internal node")
+    if(leaf && H5AC_unprotect(hdr->f, H5AC_BT2_LEAF, node_ptr->addr, leaf, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree leaf node")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__bulk_load_node() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__bulk_load
+ *
+ * Purpose:	Build an empty B-tree from a stream of records in
+ *		increasing order, writing each node once.  Nodes are
+ *		filled up to their split threshold, so that the tree has
+ *		the minimum depth and node count that later insertions
+ *		into it will preserve.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2__bulk_load(H5B2_hdr_t *hdr, hsize_t nrec, H5B2_bulk_t op, void *op_data)
+{
+    H5B2_bulk_load_t load;              /* Bulk-load state */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(op);
+    HDassert(!H5F_addr_defined(hdr->root.addr));
+    HDassert(hdr->depth == 0);
+
+    /* Initialize bulk-load state */
+    HDmemset(&load, 0, sizeof(load));
+    load.op = op;
+    load.op_data = op_data;
+
+    /* Check for nothing to do */
+    if(0 == nrec)
+        HGOTO_DONE(SUCCEED)
+
+    /* Add levels until a full tree can hold all the records */
+    if(NULL == (load.fill = (hsize_t *)H5MM_malloc(sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for bulk load info")
+    load.fill[0] = hdr->node_info[0].split_nrec;
+    while(load.fill[hdr->depth] < nrec) {
+        hsize_t *fill;          /* Resized fill table */
+
+        if(H5B2__hdr_incr_depth(hdr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "can't increase depth of B-tree")
+        if(NULL == (fill = (hsize_t *)H5MM_realloc(load.fill, sizeof(hsize_t) * (size_t)(hdr->depth + 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for bulk load info")
+        load.fill = fill;
+        load.fill[hdr->depth] = ((hsize_t)hdr->node_info[hdr->depth].split_nrec + 1) *
+                load.fill[hdr->depth - 1] + hdr->node_info[hdr->depth].split_nrec;
+    } /* end while */
+
+#ifndef NDEBUG
+    if(NULL == (load.prev = (uint8_t *)H5MM_malloc(hdr->cls->nrec_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for bulk load info")
+#endif /* NDEBUG */
+
+    /* Build the tree, from the root down */
+    if(H5B2__bulk_load_node(hdr, hdr->depth, &hdr->root, hdr, nrec, &load) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to bulk load B-tree")
+
+    /* Mark B-tree header as dirty */
+    if(H5B2__hdr_dirty(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTMARKDIRTY, FAIL, "unable to mark B-tree header dirty")
+
+done:
+    load.fill = (hsize_t *)H5MM_xfree(load.fill);
+#ifndef NDEBUG
+    load.prev = (uint8_t *)H5MM_xfree(load.prev);
+#endif /* NDEBUG */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__bulk_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__prefetch_leaves
+ *
+ * Purpose:	Find the run of sibling leaf nodes starting at a child of
+ *		an internal node that are adjacent in the file and not yet
+ *		cached, and read them with one I/O operation.
+ *
+ *		'*end' is set to the index of the first child after the run.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__prefetch_leaves(H5B2_hdr_t *hdr, const H5B2_node_ptr_t *node_ptrs,
+    unsigned nchildren, unsigned start, unsigned *end)
+{
+    haddr_t addr;                       /* Address of the run */
+    size_t size = 0;                    /* Size of the run */
+    unsigned u;                         /* Local index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(node_ptrs);
+    HDassert(start < nchildren);
+    HDassert(end);
+
+    /* Extend the run while the next leaf follows the previous one */
+    addr = node_ptrs[start].addr;
+    for(u = start; u < nchildren; u++) {
+        unsigned status = 0;        /* Cache status of leaf */
+
+        if(!H5F_addr_eq(node_ptrs[u].addr, addr + size)
+                || (size + hdr->node_size) > H5B2_PREFETCH_MAX_SIZE)
+            break;
+        if(H5AC_get_entry_status(hdr->f, node_ptrs[u].addr, &status) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTGET, FAIL, "unable to check status of B-tree leaf node")
+        if(status & H5AC_ES__IN_CACHE)
+            break;
+        size += hdr->node_size;
+    } /* end for */
+    *end = MAX(u, start + 1);
+
+    /* Read the leaves, if there's more than one */
+    if(u > (start + 1))
+        if(H5F_block_prefetch(hdr->f, H5FD_MEM_BTREE, addr, size) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_READERROR, FAIL, "unable to prefetch B-tree leaf nodes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__prefetch_leaves() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2__iterate_node
@@ -1511,6 +1787,7 @@ H5B2__iterate_node(H5B2_hdr_t *hdr, uint16_t depth, const H5B2_node_ptr_t *curr_
     uint8_t *native = NULL;             /* Pointers to copy of node's native records */
     H5B2_node_ptr_t *node_ptrs = NULL;  /* Pointers to node's node pointers */
     hbool_t node_pinned = FALSE;        /* Whether node is pinned */
+    unsigned prefetch_end = 0;          /* Index of first child not prefetched */
     unsigned u;                         /* Local index */
     herr_t ret_value = H5_ITER_CONT;    /* Iterator return value */
 
@@ -1573,6 +1850,11 @@ H5B2__iterate_node(H5B2_hdr_t *hdr, uint16_t depth, const H5B2_node_ptr_t *curr_
     for(u = 0; u < curr_node->node_nrec && !ret_value; u++) {
         /* Descend into child node, if current node is an internal node */
         if(depth > 0) {
+            /* Read upcoming sibling leaves together */
+            if(depth == 1 && u >= prefetch_end)
+                if(H5B2__prefetch_leaves(hdr, node_ptrs, (unsigned)curr_node->node_nrec + 1, u, &prefetch_end) < 0)
+                    HGOTO_ERROR(H5E_BTREE, H5E_READERROR, FAIL, "unable to prefetch B-tree leaf nodes")
+
             if((ret_value = H5B2__iterate_node(hdr, (uint16_t)(depth - 1), &(node_ptrs[u]), node, op, op_data)) < 0)
                 HERROR(H5E_BTREE, H5E_CANTLIST, "node iteration failed");
         } /* end if */
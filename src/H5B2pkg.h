@@ -368,6 +368,7 @@ H5_DLL H5B2_hdr_t *H5B2__hdr_protect(H5F_t *f, haddr_t hdr_addr,
     void *ctx_udata, unsigned flags);
 H5_DLL herr_t H5B2__hdr_unprotect(H5B2_hdr_t *hdr, unsigned cache_flags);
 H5_DLL herr_t H5B2__hdr_delete(H5B2_hdr_t *hdr);
+H5_DLL herr_t H5B2__hdr_incr_depth(H5B2_hdr_t *hdr);
 
 /* Routines for operating on leaf nodes */
 H5_DLL H5B2_leaf_t * H5B2__protect_leaf(H5B2_hdr_t *hdr, void *parent,
@@ -398,6 +399,8 @@ H5_DLL herr_t H5B2__insert_internal(H5B2_hdr_t *hdr, uint16_t depth,
     H5B2_nodepos_t curr_pos, void *parent, void *udata);
 H5_DLL herr_t H5B2__insert_leaf(H5B2_hdr_t *hdr, H5B2_node_ptr_t *curr_node_ptr,
     H5B2_nodepos_t curr_pos, void *parent, void *udata);
+H5_DLL herr_t H5B2__bulk_load(H5B2_hdr_t *hdr, hsize_t nrec, H5B2_bulk_t op,
+    void *op_data);
 
 /* Routines for update records */
 H5_DLL herr_t H5B2__update_internal(H5B2_hdr_t *hdr, uint16_t depth,
@@ -81,6 +81,7 @@
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5Cpkg.h"		/* Cache				*/
+#include "H5Clog.h"             /* Cache logging                        */
 #include "H5CXprivate.h"        /* API Contexts                         */
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fpkg.h"		/* Files				*/
@@ -317,6 +318,9 @@ H5C_create(size_t		      max_cache_size,
 	cache_ptr->slist_ring_size[i]		= (size_t)0;
     } /* end for */
 
+    for(i = 0; i < H5C__MAX_NUM_TYPE_IDS; i++)
+	cache_ptr->index_type_size[i]		= (size_t)0;
+
     for(i = 0; i < H5C__HASH_TABLE_LEN; i++)
         (cache_ptr->index)[i] = NULL;
 
@@ -414,6 +418,8 @@ H5C_create(size_t		      max_cache_size,
     (cache_ptr->resize_ctl).apply_empty_reserve = TRUE;
     (cache_ptr->resize_ctl).empty_reserve	= H5C__DEF_AR_EMPTY_RESERVE;
 
+    cache_ptr->mrc				= NULL;
+
     cache_ptr->epoch_markers_active		= 0;
 
     /* no need to initialize the ring buffer itself */
@@ -441,6 +447,7 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->image_ctl.generate_image     = FALSE;
     cache_ptr->image_ctl.save_resize_status = FALSE;
     cache_ptr->image_ctl.entry_ageout       = -1;
+    cache_ptr->image_ctl.incremental        = FALSE;
     cache_ptr->image_ctl.flags              = H5C_CI__ALL_FLAGS;
 
     cache_ptr->serialization_in_progress= FALSE;
@@ -450,6 +457,7 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->image_addr		= HADDR_UNDEF;
     cache_ptr->image_len		= 0;
     cache_ptr->image_data_len		= 0;
+    cache_ptr->image_is_current		= FALSE;
 
     cache_ptr->entries_loaded_counter		= 0;
     cache_ptr->entries_inserted_counter		= 0;
@@ -542,13 +550,25 @@ H5C_def_auto_resize_rpt_fcn(H5C_t * cache_ptr,
             break;
 
         case increase:
-            HDassert( hit_rate < (cache_ptr->resize_ctl).lower_hr_threshold );
             HDassert( old_max_cache_size < new_max_cache_size );
 
-            HDfprintf(stdout,
-                      "%sAuto cache resize -- hit rate (%lf) out of bounds low (%6.5lf).\n",
-                      cache_ptr->prefix, hit_rate,
-                      (cache_ptr->resize_ctl).lower_hr_threshold);
+            if ( (cache_ptr->resize_ctl).incr_mode ==
+                 H5C_incr__miss_rate_curve ) {
+
+                HDfprintf(stdout,
+                          "%sAuto cache resize -- increase by miss rate curve.  HR = %lf\n",
+                          cache_ptr->prefix, hit_rate);
+
+            } else {
+
+                HDassert( hit_rate <
+                          (cache_ptr->resize_ctl).lower_hr_threshold );
+
+                HDfprintf(stdout,
+                          "%sAuto cache resize -- hit rate (%lf) out of bounds low (%6.5lf).\n",
+                          cache_ptr->prefix, hit_rate,
+                          (cache_ptr->resize_ctl).lower_hr_threshold);
+            }
 
             HDfprintf(stdout,
                     "%s	cache size increased from (%Zu/%Zu) to (%Zu/%Zu).\n",
@@ -618,6 +638,12 @@ H5C_def_auto_resize_rpt_fcn(H5C_t * cache_ptr,
                               (cache_ptr->resize_ctl).upper_hr_threshold);
                     break;
 
+                case H5C_decr__miss_rate_curve:
+                    HDfprintf(stdout,
+                              "%sAuto cache resize -- decrease by miss rate curve.  HR = %lf\n",
+                              cache_ptr->prefix, hit_rate);
+                    break;
+
                 default:
                     HDfprintf(stdout,
                               "%sAuto cache resize -- decrease by unknown mode.  HR = %lf\n",
@@ -752,6 +778,13 @@ H5C_prep_for_file_close(H5F_t *f)
      */
     if(cache_ptr->close_warning_received)
         HGOTO_DONE(SUCCEED)
+
+    /* Bring an incrementally maintained cache image up to date before 
+     * the close warning, as doing so may allocate file space.
+     */
+    if(H5C__prep_incremental_image_for_file_close(f) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't update cache image")
+
     cache_ptr->close_warning_received = TRUE;
 
     /* Make certain there aren't any protected entries */
@@ -866,6 +899,10 @@ H5C_dest(H5F_t * f)
     if(cache_ptr->log_info != NULL)
         H5MM_xfree(cache_ptr->log_info);
 
+    if(cache_ptr->mrc != NULL)
+        if(H5C__mrc_dest(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTRELEASE, FAIL, "can't release miss rate curve info")
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
     if(cache_ptr->get_entry_ptr_from_addr_counter > 0)
@@ -1382,6 +1419,8 @@ H5C_insert_entry(H5F_t *             f,
     entry_ptr->prefetch_type_id			= 0;
     entry_ptr->age				= 0;
     entry_ptr->prefetched_dirty                 = FALSE;
+    entry_ptr->prefetch_image_addr              = HADDR_UNDEF;
+    entry_ptr->prefetch_image_chksum            = 0;
 #ifndef NDEBUG  /* debugging field */
     entry_ptr->serialization_count		= 0;
 #endif /* NDEBUG */
@@ -1465,6 +1504,11 @@ H5C_insert_entry(H5F_t *             f,
     H5C__INSERT_ENTRY_IN_SLIST(cache_ptr, entry_ptr, FAIL)
     H5C__UPDATE_RP_FOR_INSERTION(cache_ptr, entry_ptr, FAIL)
 
+    /* New entries are not hits or misses, but later accesses to them are */
+    if(cache_ptr->mrc)
+        if(H5C__mrc_access(cache_ptr, entry_ptr, FALSE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't update miss rate curves")
+
 #if H5C_DO_EXTREME_SANITY_CHECKS
     if((H5C_validate_protected_entry_list(cache_ptr) < 0) ||
             (H5C_validate_pinned_entry_list(cache_ptr) < 0) ||
@@ -1897,6 +1941,14 @@ H5C_move_entry(H5C_t *	     cache_ptr,
 
     entry_ptr->addr = new_addr;
 
+    /* Track the entry at its new address in the miss rate curves */
+    if(cache_ptr->mrc) {
+        if(H5C__mrc_remove(cache_ptr, old_addr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't update miss rate curves")
+        if(H5C__mrc_access(cache_ptr, entry_ptr, FALSE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't update miss rate curves")
+    } /* end if */
+
     if(!entry_ptr->destroy_in_progress) {
         hbool_t		was_dirty;      /* Whether the entry was previously dirty */
 
@@ -2521,6 +2573,10 @@ H5C_protect(H5F_t *		f,
 
     H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit)
 
+    if(cache_ptr->mrc)
+        if(H5C__mrc_access(cache_ptr, entry_ptr, TRUE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, NULL, "can't update miss rate curves")
+
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)
 
     ret_value = thing;
@@ -2728,6 +2784,11 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr,
                  cache_ptr->size_increase_possible = FALSE;
             break;
 
+        case H5C_incr__miss_rate_curve:
+            if((config_ptr->apply_max_increment) && (config_ptr->max_increment <= 0))
+                 cache_ptr->size_increase_possible = FALSE;
+            break;
+
         default: /* should be unreachable */
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Unknown incr_mode?!?!?")
     } /* end switch */
@@ -2762,6 +2823,11 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr,
                 cache_ptr->size_decrease_possible = FALSE;
             break;
 
+        case H5C_decr__miss_rate_curve:
+            if((config_ptr->apply_max_decrement) && (config_ptr->max_decrement <= 0))
+                cache_ptr->size_decrease_possible = FALSE;
+            break;
+
         default: /* should be unreachable */
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Unknown decr_mode?!?!?")
     } /* end switch */
@@ -2833,6 +2899,10 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr,
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "error removing all epoch markers")
     }
 
+    /* start or stop estimating the miss rate curves */
+    if(H5C__mrc_configure(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't configure miss rate curve estimation")
+
     /* configure flash size increase facility.  We wait until the
      * end of the function, as we need the max_cache_size set before
      * we start to keep things simple.
@@ -3448,7 +3518,8 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t * config_ptr,
 
     if((tests & H5C_RESIZE_CFG__VALIDATE_INCREMENT) != 0) {
         if((config_ptr->incr_mode != H5C_incr__off) &&
-                (config_ptr->incr_mode != H5C_incr__threshold))
+                (config_ptr->incr_mode != H5C_incr__threshold) &&
+                (config_ptr->incr_mode != H5C_incr__miss_rate_curve))
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid incr_mode")
 
         if(config_ptr->incr_mode == H5C_incr__threshold) {
@@ -3490,7 +3561,8 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t * config_ptr,
         if ( ( config_ptr->decr_mode != H5C_decr__off ) &&
              ( config_ptr->decr_mode != H5C_decr__threshold ) &&
              ( config_ptr->decr_mode != H5C_decr__age_out ) &&
-             ( config_ptr->decr_mode != H5C_decr__age_out_with_threshold )
+             ( config_ptr->decr_mode != H5C_decr__age_out_with_threshold ) &&
+             ( config_ptr->decr_mode != H5C_decr__miss_rate_curve )
            ) {
 
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid decr_mode")
@@ -3535,6 +3607,20 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t * config_ptr,
     } /* H5C_RESIZE_CFG__VALIDATE_DECREMENT */
 
 
+    if ( (tests & (H5C_RESIZE_CFG__VALIDATE_INCREMENT |
+                   H5C_RESIZE_CFG__VALIDATE_DECREMENT)) != 0 ) {
+        /* the miss rate curve modes scale the knee of the curve by
+         * 1 / (1 - empty_reserve)
+         */
+        if(((config_ptr->incr_mode == H5C_incr__miss_rate_curve) ||
+                    (config_ptr->decr_mode == H5C_decr__miss_rate_curve)) &&
+                (config_ptr->apply_empty_reserve) &&
+                ((config_ptr->empty_reserve >= (double)1.0f) ||
+                    (config_ptr->empty_reserve < (double)0.0f)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "empty_reserve must be in the interval [0.0, 1.0) for the miss rate curve modes")
+    } /* H5C_incr__miss_rate_curve || H5C_decr__miss_rate_curve */
+
+
     if ( (tests & H5C_RESIZE_CFG__VALIDATE_INTERACTIONS) != 0 ) {
         if((config_ptr->incr_mode == H5C_incr__threshold)
                 && ((config_ptr->decr_mode == H5C_decr__threshold) ||
@@ -3975,6 +4061,7 @@ H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted)
     size_t			old_max_cache_size = 0;
     size_t			new_min_clean_size = 0;
     size_t			old_min_clean_size = 0;
+    size_t			mrc_size = 0;
     double			hit_rate;
     enum H5C_resize_status	status = in_spec; /* will change if needed */
     herr_t			ret_value = SUCCEED;      /* Return value */
@@ -4012,6 +4099,13 @@ H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted)
 
     HDassert( ( (double)0.0f <= hit_rate ) && ( hit_rate <= (double)1.0f ) );
 
+    /* If either mode uses the miss rate curves, get the cache size they
+     * indicate.  mrc_size is left at zero if there aren't enough samples.
+     */
+    if(cache_ptr->mrc)
+        if(H5C__mrc_estimate_size(cache_ptr, &mrc_size) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't estimate cache size from miss rate curves")
+
     switch((cache_ptr->resize_ctl).incr_mode) {
         case H5C_incr__off:
             if(cache_ptr->size_increase_possible)
@@ -4064,6 +4158,37 @@ H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted)
             }
             break;
 
+        case H5C_incr__miss_rate_curve:
+            /* mrc_size is already clipped to [min_size, max_size].  As
+             * with the threshold mode, don't grow a cache which hasn't
+             * used up the space allotted to it.
+             */
+            if ( ( mrc_size > cache_ptr->max_cache_size ) &&
+                 ( cache_ptr->cache_full ) ) {
+
+                if ( ! cache_ptr->size_increase_possible ) {
+
+                    status = increase_disabled;
+
+                } else {
+
+                    new_max_cache_size = mrc_size;
+
+                    /* clip to max increment if necessary */
+                    if ( ( (cache_ptr->resize_ctl).apply_max_increment ) &&
+                         ( (cache_ptr->max_cache_size +
+                            (cache_ptr->resize_ctl).max_increment) <
+                           new_max_cache_size ) ) {
+
+                        new_max_cache_size = cache_ptr->max_cache_size +
+                                         (cache_ptr->resize_ctl).max_increment;
+                    }
+
+                    status = increase;
+                }
+            }
+            break;
+
         default:
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unknown incr_mode")
     }
@@ -4165,6 +4290,34 @@ H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted)
                 } /* end if */
                 break;
 
+            case H5C_decr__miss_rate_curve:
+                /* mrc_size is zero if there is no estimate yet */
+                if ( ( mrc_size > 0 ) &&
+                     ( mrc_size < cache_ptr->max_cache_size ) ) {
+
+                    if ( ! cache_ptr->size_decrease_possible ) {
+
+                        status = decrease_disabled;
+
+                    } else {
+
+                        new_max_cache_size = mrc_size;
+
+                        /* clip to max decrement if necessary */
+                        if ( ( (cache_ptr->resize_ctl).apply_max_decrement ) &&
+                             ( ((cache_ptr->resize_ctl).max_decrement +
+                                new_max_cache_size) <
+                               cache_ptr->max_cache_size ) ) {
+
+                            new_max_cache_size = cache_ptr->max_cache_size -
+                                         (cache_ptr->resize_ctl).max_decrement;
+                        }
+
+                        status = decrease;
+                    }
+                }
+                break;
+
             default:
                 HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unknown incr_mode")
         }
@@ -4585,6 +4738,7 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
 
                 bytes_evicted += entry_ptr->size;
 
+                H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, H5C_LOG_EVICT_AGEOUT, FAIL)
                 if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0 )
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
             } /* end else-if */
@@ -4656,9 +4810,11 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
 
             prev_ptr = entry_ptr->prev;
 
-            if(!(entry_ptr->is_dirty) && !(entry_ptr->prefetched_dirty))
+            if(!(entry_ptr->is_dirty) && !(entry_ptr->prefetched_dirty)) {
+                H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, H5C_LOG_EVICT_AGEOUT, FAIL)
                 if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush clean entry")
+            } /* end if */
 
             /* just skip the entry if it is dirty, as we can't do
              * anything with it now since we can't write.
@@ -5451,6 +5607,7 @@ H5C_flush_invalidate_ring(H5F_t * f, H5C_ring_t ring, unsigned flags)
                     } /* end if */
                 } /* end else-if */
                 else {
+                    H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, H5C_LOG_EVICT_INVALIDATE, FAIL)
                     if(H5C__flush_single_entry(f, entry_ptr, (cooked_flags | H5C__DURING_FLUSH_FLAG | H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG)) < 0)
                         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "dirty entry flush destroy failed")
 
@@ -5555,6 +5712,7 @@ H5C_flush_invalidate_ring(H5F_t * f, H5C_ring_t ring, unsigned flags)
                      */
                     cache_ptr->entry_watched_for_removal = next_entry_ptr;
 
+                    H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, H5C_LOG_EVICT_INVALIDATE, FAIL)
                     if(H5C__flush_single_entry(f, entry_ptr, (cooked_flags | H5C__DURING_FLUSH_FLAG | H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG)) < 0)
                         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Entry flush destroy failed")
 
@@ -6059,6 +6217,15 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
     /* Preserve current dirty state for later */
     was_dirty = entry_ptr->is_dirty;
 
+    /* Prefetched entries reconstructed from an incremental cache image
+     * don't have their images in memory until needed -- read the image
+     * now if we are about to use it.
+     */
+    if((write_entry || generate_image || update_page_buffer)
+            && entry_ptr->prefetched && NULL == entry_ptr->image_ptr)
+        if(H5C__load_prefetched_entry_image(f, entry_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load prefetched entry image")
+
     /* The entry is dirty, and we are doing a flush, a flush destroy or have
      * been requested to generate an image.  In those cases, serialize the
      * entry.
@@ -6109,6 +6276,13 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
                 && (((entry_ptr->type->flags) & H5C__CLASS_SKIP_WRITES) == 0)) {
             H5FD_mem_t mem_type = H5FD_MEM_DEFAULT;
 
+            /* The on disk cache image no longer matches the file once an
+             * entry that may appear in it is written.
+             */
+            if(cache_ptr->image_is_current && entry_ptr->ring <= H5C_MAX_RING_IN_IMAGE)
+                if(H5C__invalidate_cache_image(f, cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't mark metadata cache image stale")
+
 #ifdef H5_HAVE_PARALLEL
             if(cache_ptr->coll_write_list) {
                 if(H5SL_insert(cache_ptr->coll_write_list, entry_ptr, &entry_ptr->addr) < 0)
@@ -6339,6 +6513,13 @@ H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr, unsigned flags)
             else    /* no file space free size callback -- use entry size */
                 fsf_size = entry_ptr->size;
 
+            /* The space may be reused, so the on disk cache image no
+             * longer matches the file either.
+             */
+            if(cache_ptr->image_is_current && entry_ptr->ring <= H5C_MAX_RING_IN_IMAGE)
+                if(H5C__invalidate_cache_image(f, cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't mark metadata cache image stale")
+
             /* Release the space on disk */
             if(H5MF_xfree(f, entry_ptr->type->mem_type, entry_ptr->addr, fsf_size) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "unable to free file space for cache entry")
@@ -6810,6 +6991,8 @@ H5C_load_entry(H5F_t *              f,
     entry->prefetch_type_id             = 0;
     entry->age                          = 0;
     entry->prefetched_dirty             = FALSE;
+    entry->prefetch_image_addr          = HADDR_UNDEF;
+    entry->prefetch_image_chksum        = 0;
 #ifndef NDEBUG  /* debugging field */
     entry->serialization_count          = 0;
 #endif /* NDEBUG */
@@ -6880,6 +7063,8 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
     hbool_t		prev_is_dirty = FALSE;
     hbool_t             didnt_flush_entry = FALSE;
     hbool_t		restart_scan;
+    hbool_t		skip_reserved = (cache_ptr->mrc != NULL);
+    hbool_t		skipped_reserved = FALSE;
     H5C_cache_entry_t *	entry_ptr;
     H5C_cache_entry_t *	prev_ptr;
     H5C_cache_entry_t *	next_ptr;
@@ -6987,6 +7172,17 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 
                         restart_scan = TRUE;
 
+                } else if ( ( skip_reserved ) &&
+                            ( (cache_ptr->index_size + space_needed) >
+                              cache_ptr->max_cache_size ) &&
+                            ( H5C__MRC_ENTRY_IS_RESERVED(cache_ptr, entry_ptr) ) ) {
+
+                    /* Keep clean entries of types that are within the room
+                     * reserved for them from their miss rate curves.
+                     */
+                    skipped_reserved = TRUE;
+                    didnt_flush_entry = TRUE;
+
                 } else if ( (cache_ptr->index_size + space_needed) > cache_ptr->max_cache_size 
 #ifdef H5_HAVE_PARALLEL
                             && !(entry_ptr->coll_access)
@@ -6996,6 +7192,7 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
                     cache_ptr->entries_scanned_to_make_space++;
 #endif /* H5C_COLLECT_CACHE_STATS */
 
+                    H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, H5C_LOG_EVICT_REPLACEMENT, FAIL)
                     if(H5C__flush_single_entry(f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
                 } else {
@@ -7058,6 +7255,16 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
 		    entry_ptr = prev_ptr;
 
 		}
+	    } else if ( skipped_reserved ) {
+
+                /* we reached the head of the LRU list without making
+                 * enough space -- scan again, this time evicting entries
+                 * within their reservations too.
+                 */
+                skip_reserved = FALSE;
+                skipped_reserved = FALSE;
+                entry_ptr = cache_ptr->LRU_tail_ptr;
+
 	    } else {
 
 		entry_ptr = NULL;
@@ -7150,6 +7357,7 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t	write_permitted)
                  && ( ! (entry_ptr->coll_access) )
 #endif /* H5_HAVE_PARALLEL */
                ) {
+                H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, H5C_LOG_EVICT_REPLACEMENT, FAIL)
                 if(H5C__flush_single_entry(f, entry_ptr,
                         H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
@@ -201,6 +201,11 @@ typedef struct H5CX_t {
     hbool_t rank0_bcast;        /* Whether a dataset meets read-with-rank0-and-bcast requirements */
 #endif /* H5_HAVE_PARALLEL */
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Internal: Thread-safe raw data reads */
+    struct H5D_deferred_io_t *deferred_io; /* Raw data reads to perform after releasing the library lock */
+#endif /* H5_HAVE_THREADSAFE */
+
     /* Cached DXPL properties */
     size_t max_temp_buf;        /* Maximum temporary buffer size */
     hbool_t max_temp_buf_valid; /* Whether maximum temporary buffer size is valid */
@@ -232,6 +237,8 @@ typedef struct H5CX_t {
     hbool_t filter_cb_valid;    /* Whether filter callback function is valid */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
     hbool_t data_transform_valid; /* Whether data transform info is valid */
+    H5D_io_plan_t *io_plan;     /* Selection I/O plan (H5D_XFER_IO_PLAN_NAME) */
+    hbool_t io_plan_valid;      /* Whether selection I/O plan is valid */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     hbool_t vl_alloc_info_valid; /* Whether VL datatype alloc info is valid */
     H5T_conv_cb_t dt_conv_cb;   /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
@@ -315,6 +322,7 @@ typedef struct H5CX_dxpl_cache_t {
     H5Z_EDC_t err_detect;           /* Error detection info (H5D_XFER_EDC_NAME) */
     H5Z_cb_t filter_cb;             /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
     H5Z_data_xform_t *data_transform; /* Data transform info (H5D_XFER_XFORM_NAME) */
+    H5D_io_plan_t *io_plan;         /* Selection I/O plan (H5D_XFER_IO_PLAN_NAME) */
     H5T_vlen_alloc_info_t vl_alloc_info; /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t dt_conv_cb;       /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
 } H5CX_dxpl_cache_t;
@@ -450,6 +458,10 @@ H5CX__init_package(void)
     if(H5P_peek(dx_plist, H5D_XFER_XFORM_NAME, &H5CX_def_dxpl_cache.data_transform) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
 
+    /* Look at the selection I/O plan property */
+    if(H5P_peek(dx_plist, H5D_XFER_IO_PLAN_NAME, &H5CX_def_dxpl_cache.io_plan) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve selection I/O plan")
+
     /* Get VL datatype alloc info */
     if(H5P_get(dx_plist, H5D_XFER_VLEN_ALLOC_NAME, &H5CX_def_dxpl_cache.vl_alloc_info.alloc_func) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve VL datatype alloc info")
@@ -1285,6 +1297,33 @@ H5CX_get_mpio_rank0_bcast(void)
 } /* end H5CX_get_mpio_rank0_bcast() */
 #endif /* H5_HAVE_PARALLEL */
 
+#ifdef H5_HAVE_THREADSAFE
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_deferred_io
+ *
+ * Purpose:     Retrieves the list of raw data reads to perform outside the
+ *              library lock for the current API call context.
+ *
+ * Return:      Pointer to list on success / NULL if reads aren't deferred
+ *              for this API call <can't fail>
+ *
+ *-------------------------------------------------------------------------
+ */
+struct H5D_deferred_io_t *
+H5CX_get_deferred_io(void)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((*head)->ctx.deferred_io)
+} /* end H5CX_get_deferred_io() */
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_btree_split_ratios
@@ -1869,6 +1908,60 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_data_transform() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_io_plan
+ *
+ * Purpose:     Retrieves the selection I/O plan for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_io_plan(H5D_io_plan_t **io_plan)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(io_plan);
+    HDassert(head && *head);
+    HDassert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    /* Check if the value has been retrieved already */
+    if(!(*head)->ctx.io_plan_valid) {
+        /* Check for default DXPL */
+        if((*head)->ctx.dxpl_id == H5P_DATASET_XFER_DEFAULT)
+            (*head)->ctx.io_plan = H5CX_def_dxpl_cache.io_plan;
+        else {
+            /* Check if the property list is already available */
+            if(NULL == (*head)->ctx.dxpl)
+                /* Get the dataset transfer property list pointer */
+                if(NULL == ((*head)->ctx.dxpl = (H5P_genplist_t *)H5I_object((*head)->ctx.dxpl_id)))
+                    HGOTO_ERROR(H5E_CONTEXT, H5E_BADTYPE, FAIL, "can't get default dataset transfer property list")
+
+            /* Get selection I/O plan value */
+            /* (Note: 'peek', not 'get' - the plan is owned by the DXPL,
+             *          which outlives the API call)
+             */
+            if(H5P_peek((*head)->ctx.dxpl, H5D_XFER_IO_PLAN_NAME, &(*head)->ctx.io_plan) < 0)
+                HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve selection I/O plan")
+        } /* end else */
+
+        /* Mark the value as valid */
+        (*head)->ctx.io_plan_valid = TRUE;
+    } /* end if */
+
+    /* Get the value */
+    *io_plan = (*head)->ctx.io_plan;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_io_plan() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_vlen_alloc_info
@@ -2244,6 +2337,34 @@ H5CX_set_mpio_rank0_bcast(hbool_t rank0_bcast)
 } /* end H5CX_set_mpio_rank0_bcast() */
 #endif /* H5_HAVE_PARALLEL */
 
+#ifdef H5_HAVE_THREADSAFE
+
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_deferred_io
+ *
+ * Purpose:     Sets the list of raw data reads to perform outside the
+ *              library lock for the current API call context.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_deferred_io(struct H5D_deferred_io_t *deferred_io)
+{
+    H5CX_node_t **head = H5CX_get_my_context();  /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(head && *head);
+
+    (*head)->ctx.deferred_io = deferred_io;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_deferred_io() */
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5CX_set_vlen_alloc_info
@@ -39,6 +39,11 @@
 /* Library Private Typedefs */
 /****************************/
 
+/* Forward declaration of structure for selection I/O plan (H5Dprivate.h) */
+struct H5D_io_plan_t;
+
+/* Forward declaration of structure for deferred raw data reads (H5Dpkg.h) */
+struct H5D_deferred_io_t;
 
 /*****************************/
 /* Library-private Variables */
@@ -79,6 +84,9 @@ H5_DLL herr_t H5CX_get_mpi_coll_datatypes(MPI_Datatype *btype, MPI_Datatype *fty
 H5_DLL hbool_t H5CX_get_mpi_file_flushing(void);
 H5_DLL hbool_t H5CX_get_mpio_rank0_bcast(void);
 #endif /* H5_HAVE_PARALLEL */
+#ifdef H5_HAVE_THREADSAFE
+H5_DLL struct H5D_deferred_io_t *H5CX_get_deferred_io(void);
+#endif /* H5_HAVE_THREADSAFE */
 
 /* "Getter" routines for DXPL properties cached in API context */
 H5_DLL herr_t H5CX_get_btree_split_ratios(double split_ratio[3]);
@@ -99,6 +107,7 @@ H5_DLL herr_t H5CX_get_mpio_chunk_opt_ratio(unsigned *mpio_chunk_opt_ratio);
 H5_DLL herr_t H5CX_get_err_detect(H5Z_EDC_t *err_detect);
 H5_DLL herr_t H5CX_get_filter_cb(H5Z_cb_t *filter_cb);
 H5_DLL herr_t H5CX_get_data_transform(H5Z_data_xform_t **data_transform);
+H5_DLL herr_t H5CX_get_io_plan(struct H5D_io_plan_t **io_plan);
 H5_DLL herr_t H5CX_get_vlen_alloc_info(H5T_vlen_alloc_info_t *vl_alloc_info);
 H5_DLL herr_t H5CX_get_dt_conv_cb(H5T_conv_cb_t *cb_struct);
 
@@ -115,6 +124,9 @@ H5_DLL herr_t H5CX_set_mpio_coll_opt(H5FD_mpio_collective_opt_t mpio_coll_opt);
 H5_DLL void H5CX_set_mpi_file_flushing(hbool_t flushing);
 H5_DLL void H5CX_set_mpio_rank0_bcast(hbool_t rank0_bcast);
 #endif /* H5_HAVE_PARALLEL */
+#ifdef H5_HAVE_THREADSAFE
+H5_DLL void H5CX_set_deferred_io(struct H5D_deferred_io_t *deferred_io);
+#endif /* H5_HAVE_THREADSAFE */
 
 /* "Setter" routines for DXPL properties cached in API context */
 #ifdef H5_HAVE_PARALLEL
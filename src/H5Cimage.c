@@ -62,6 +62,16 @@
 #define H5C__MDCI_BLOCK_SIGNATURE	"MDCI"
 #define H5C__MDCI_BLOCK_SIGNATURE_LEN	4
 #define H5C__MDCI_BLOCK_VERSION_0	0
+#define H5C__MDCI_BLOCK_VERSION_1	1
+
+/* Offset of the status byte in a version 1 cache image block header.
+ * The status byte is not covered by the index checksum, so that the
+ * image can be marked stale with a single byte write.
+ */
+#define H5C__MDCI_STATUS_OFFSET		(H5C__MDCI_BLOCK_SIGNATURE_LEN + 1)
+
+/* Metadata cache image status flags -- max 8 bits */
+#define H5C__MDCI_STATUS_STALE		0x01
 
 /* Metadata cache image header flags -- max 8 bits */
 #define H5C__MDCI_HEADER_HAVE_RESIZE_STATUS	0x01
@@ -80,9 +90,6 @@
 #define H5C_IMAGE_ENTRY_T_MAGIC		0x005CAC08
 #define H5C_IMAGE_ENTRY_T_BAD_MAGIC	0xBeefDead
 
-/* Maximum ring allowed in image */
-#define H5C_MAX_RING_IN_IMAGE   H5C_RING_MDFSM
-
 
 /******************/
 /* Local Typedefs */
@@ -94,10 +101,14 @@
 /********************/
 
 /* Helper routines */
-static size_t H5C__cache_image_block_entry_header_size(const H5F_t *f);
-static size_t H5C__cache_image_block_header_size(const H5F_t *f);
+static hbool_t H5C__incremental_image(const H5F_t *f, const H5C_t *cache_ptr);
+static size_t H5C__cache_image_block_entry_header_size(const H5F_t *f,
+    unsigned version);
+static size_t H5C__cache_image_block_header_size(const H5F_t *f,
+    unsigned version);
 static herr_t H5C__decode_cache_image_header(const H5F_t *f,
-    H5C_t *cache_ptr, const uint8_t **buf);
+    H5C_t *cache_ptr, const uint8_t **buf, unsigned *version, hbool_t *stale,
+    size_t *index_len);
 #ifndef NDEBUG	/* only used in assertions */
 static herr_t H5C__decode_cache_image_entry(const H5F_t *f,
     const H5C_t *cache_ptr, const uint8_t **buf, unsigned entry_num);
@@ -105,23 +116,29 @@ static herr_t H5C__decode_cache_image_entry(const H5F_t *f,
 static herr_t H5C__destroy_pf_entry_child_flush_deps(H5C_t *cache_ptr, 
     H5C_cache_entry_t *pf_entry_ptr, H5C_cache_entry_t **fd_children);
 static herr_t H5C__encode_cache_image_header(const H5F_t *f,
-    const H5C_t *cache_ptr, uint8_t **buf);
+    const H5C_t *cache_ptr, uint8_t **buf, unsigned version, size_t index_len);
 static herr_t H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, 
-    uint8_t **buf, unsigned entry_num);
+    uint8_t **buf, unsigned entry_num, unsigned version);
 static herr_t H5C__prep_for_file_close__compute_fd_heights(const H5C_t *cache_ptr);
 static void H5C__prep_for_file_close__compute_fd_heights_real(
     H5C_cache_entry_t  *entry_ptr, uint32_t fd_height);
 static herr_t H5C__prep_for_file_close__setup_image_entries_array(H5C_t *cache_ptr);
 static herr_t H5C__prep_for_file_close__scan_entries(const H5F_t *f,
     H5C_t *cache_ptr);
-static herr_t H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr);
+static herr_t H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr,
+    hbool_t lazy);
+static herr_t H5C__release_incremental_image_entries(H5C_t *cache_ptr);
 static H5C_cache_entry_t *H5C__reconstruct_cache_entry(const H5F_t *f,
-    H5C_t *cache_ptr, const uint8_t **buf);
+    H5C_t *cache_ptr, const uint8_t **buf, unsigned version, hbool_t lazy,
+    size_t *image_off);
 static herr_t H5C__write_cache_image_superblock_msg(H5F_t *f, hbool_t create);
 static herr_t H5C__read_cache_image(H5F_t * f, H5C_t *cache_ptr);
 static herr_t H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr);
 static herr_t H5C__construct_cache_image_buffer(H5F_t *f, H5C_t *cache_ptr);
+static herr_t H5C__construct_incremental_cache_image(H5F_t *f,
+    H5C_t *cache_ptr);
 static herr_t H5C__free_image_entries_array(H5C_t *cache_ptr);
+static herr_t H5C__load_prefetched_entry_images(H5F_t *f, H5C_t *cache_ptr);
 
 
 /*********************/
@@ -266,13 +283,13 @@ H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
 
     /* Construct the cache image block header image */
     p = (uint8_t *)cache_ptr->image_buffer;
-    if(H5C__encode_cache_image_header(f, cache_ptr, &p) < 0)
+    if(H5C__encode_cache_image_header(f, cache_ptr, &p, H5C__MDCI_BLOCK_VERSION_0, (size_t)0) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "header image construction failed")
     HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_data_len);
 
     /* Construct the cache entry images */
     for(u = 0; u < cache_ptr->num_entries_in_image; u++)
-	if(H5C__encode_cache_image_entry(f, cache_ptr, &p, u) < 0)
+	if(H5C__encode_cache_image_entry(f, cache_ptr, &p, u, H5C__MDCI_BLOCK_VERSION_0) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "entry image construction failed")
     HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_data_len);
 
@@ -292,6 +309,9 @@ H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
         uint32_t        old_chksum;
         const uint8_t *	q;
         H5C_t *	        fake_cache_ptr = NULL;
+        unsigned        version;
+        hbool_t         stale;
+        size_t          index_len;
         unsigned        v;
         herr_t          status;      /* Status from decoding */
 
@@ -302,8 +322,9 @@ H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
 	/* needed for sanity checks */
 	fake_cache_ptr->image_len = cache_ptr->image_len;
         q = (const uint8_t *)cache_ptr->image_buffer;
-        status = H5C__decode_cache_image_header(f, fake_cache_ptr, &q);
+        status = H5C__decode_cache_image_header(f, fake_cache_ptr, &q, &version, &stale, &index_len);
         HDassert(status >= 0);
+        HDassert(version == H5C__MDCI_BLOCK_VERSION_0);
 
         HDassert(NULL != p);
         HDassert(fake_cache_ptr->num_entries_in_image == cache_ptr->num_entries_in_image);
@@ -374,6 +395,84 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__construct_cache_image_buffer() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__construct_incremental_cache_image
+ *
+ * Purpose:     Allocate a buffer of size cache_ptr->image_data_len, and
+ *		load it with a version 1 image of the metadata cache: the
+ *		header and the index of the entries, followed by the 
+ *		images of the entries in index order.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__construct_incremental_cache_image(H5F_t *f, H5C_t *cache_ptr)
+{
+    uint8_t *	p;                      /* Pointer into image buffer */
+    uint8_t *	chksum_image;           /* Start of checksummed data */
+    size_t      index_len;              /* Length of the header and index */
+    uint32_t    chksum;
+    unsigned	u;                      /* Local index variable */
+    herr_t 	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(cache_ptr == f->shared->cache);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(H5C__incremental_image(f, cache_ptr));
+    HDassert(cache_ptr->num_entries_in_image > 0);
+    HDassert(cache_ptr->image_entries);
+    HDassert(cache_ptr->image_data_len > 0);
+    HDassert(cache_ptr->image_buffer == NULL);
+
+    /* The entry images follow the header and index */
+    index_len = cache_ptr->image_data_len;
+    for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
+        HDassert(index_len > cache_ptr->image_entries[u].size);
+        index_len -= cache_ptr->image_entries[u].size;
+    } /* end for */
+
+    /* Allocate the buffer in which to construct the cache image block */
+    if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_data_len + 1)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+
+    /* Construct the cache image block header */
+    p = (uint8_t *)cache_ptr->image_buffer;
+    if(H5C__encode_cache_image_header(f, cache_ptr, &p, H5C__MDCI_BLOCK_VERSION_1, index_len) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "header image construction failed")
+
+    /* Construct the index */
+    for(u = 0; u < cache_ptr->num_entries_in_image; u++)
+	if(H5C__encode_cache_image_entry(f, cache_ptr, &p, u, H5C__MDCI_BLOCK_VERSION_1) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "entry index construction failed")
+
+    /* Compute the checksum of the header and index, less the status byte
+     * and what precedes it, and encode 
+     */
+    chksum_image = (uint8_t *)cache_ptr->image_buffer + H5C__MDCI_STATUS_OFFSET + 1;
+    chksum = H5_checksum_metadata(chksum_image, (size_t)(p - chksum_image), 0);
+    UINT32ENCODE(p, chksum);
+    HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) == index_len);
+
+    /* Append the entry images */
+    for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
+        HDassert(cache_ptr->image_entries[u].image_ptr);
+        HDmemcpy(p, cache_ptr->image_entries[u].image_ptr, cache_ptr->image_entries[u].size);
+        p += cache_ptr->image_entries[u].size;
+    } /* end for */
+    HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) == cache_ptr->image_data_len);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__construct_incremental_cache_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__generate_cache_image()
@@ -504,7 +603,7 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
     HDassert(pf_entry_ptr->type->id == H5AC_PREFETCHED_ENTRY_ID);
     HDassert(pf_entry_ptr->prefetched);
     HDassert(pf_entry_ptr->image_up_to_date);
-    HDassert(pf_entry_ptr->image_ptr);
+    HDassert(pf_entry_ptr->image_ptr || H5F_addr_defined(pf_entry_ptr->prefetch_image_addr));
     HDassert(pf_entry_ptr->size > 0);
     HDassert(pf_entry_ptr->addr == addr);
     HDassert(type);
@@ -523,6 +622,11 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
     HDassert(type->get_initial_load_size);
     HDassert(type->deserialize);
 
+    /* Read the image of the entry, if it was loaded on demand */
+    if(NULL == pf_entry_ptr->image_ptr)
+        if(H5C__load_prefetched_entry_image(f, pf_entry_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read prefetched entry image")
+
     /* if *pf_entry_ptr is a flush dependency child, destroy all such
      * relationships now.  The client will restore the relationship(s) with
      * the deserialized entry if appropriate.
@@ -669,6 +773,8 @@ H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t *cache_ptr,
     ds_entry_ptr->prefetch_type_id          	= 0;
     ds_entry_ptr->age		          	= 0;
     ds_entry_ptr->prefetched_dirty              = pf_entry_ptr->prefetched_dirty;
+    ds_entry_ptr->prefetch_image_addr           = HADDR_UNDEF;
+    ds_entry_ptr->prefetch_image_chksum         = 0;
 #ifndef NDEBUG  /* debugging field */
     ds_entry_ptr->serialization_count           = 0;
 #endif /* NDEBUG */
@@ -1018,6 +1124,46 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_image_stats() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__invalidate_cache_image
+ *
+ * Purpose:	Mark the incrementally maintained metadata cache image in
+ *		the file as stale, before an entry that appears in it is
+ *		written or its file space freed.  Only the status byte in
+ *		the image block header is written, and subsequent opens of
+ *		the file ignore the image until it is brought up to date
+ *		by a later flush.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__invalidate_cache_image(H5F_t *f, H5C_t *cache_ptr)
+{
+    uint8_t     status = H5C__MDCI_STATUS_STALE;        /* New image status */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->image_is_current);
+    HDassert(H5F_addr_defined(cache_ptr->image_addr));
+
+    /* The image is stale from now on, even if marking it so fails */
+    cache_ptr->image_is_current = FALSE;
+
+    if(H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr + H5C__MDCI_STATUS_OFFSET, (size_t)1, &status) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write metadata cache image status")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__invalidate_cache_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__read_cache_image
@@ -1106,6 +1252,13 @@ done:
  *		decode it, and insert its contents into the metadata
  *		cache.
  *
+ *		Version 1 images that are not about to be deleted are 
+ *		loaded lazily:  only the header and index are read here,
+ *		and the image of each entry is read when the entry is 
+ *		first used.  Stale version 1 images are not loaded at all.
+ *		If the image is maintained incrementally, it is kept in 
+ *		the file rather than deleted.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  John Mainzer
@@ -1138,31 +1291,90 @@ H5C__load_cache_image(H5F_t *f)
      * silently.  
      */
     if(H5F_addr_defined(cache_ptr->image_addr)) {
+        hbool_t stale = FALSE;          /* Whether the image is stale */
+        hbool_t lazy = FALSE;           /* Whether to load entry images on demand */
+
         /* Sanity checks */
         HDassert(cache_ptr->image_len > 0);
         HDassert(cache_ptr->image_buffer == NULL);
 
-        /* Allocate space for the image */
-        if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_len + 1)))
-            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+#ifdef H5_HAVE_PARALLEL
+        /* Parallel opens always read the whole image on process 0 and
+         * broadcast it.
+         */
+        if(NULL == cache_ptr->aux_ptr)
+#endif /* H5_HAVE_PARALLEL */
+        {
+            const uint8_t *p;           /* Pointer into header */
+            size_t header_len;          /* Length of the largest header */
+            size_t index_len;           /* Length of the header and index */
+            unsigned version;           /* Version of the image block */
+
+            /* Read the image header, to decide how to load the image */
+            header_len = H5C__cache_image_block_header_size(f, H5C__MDCI_BLOCK_VERSION_1);
+            if(NULL == (cache_ptr->image_buffer = H5MM_malloc(header_len)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+            if(H5F_block_read(f, H5FD_MEM_SUPER, cache_ptr->image_addr, MIN(header_len, cache_ptr->image_len), cache_ptr->image_buffer) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image header")
+            p = (const uint8_t *)cache_ptr->image_buffer;
+            if(H5C__decode_cache_image_header(f, cache_ptr, &p, &version, &stale, &index_len) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "cache image header decode failed")
+
+            if(version == H5C__MDCI_BLOCK_VERSION_1) {
+                /* Keep an incrementally maintained image in the file */
+                if(H5C__incremental_image(f, cache_ptr))
+                    cache_ptr->delete_image = FALSE;
+
+                lazy = !stale && !cache_ptr->delete_image;
+            } /* end if */
 
-        /* Load the image from file */
-        if(H5C__read_cache_image(f, cache_ptr) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image block")
+            /* Read the header and index of images loaded on demand */
+            if(lazy) {
+                void *new_buffer;       /* Enlarged buffer */
 
-        /* Reconstruct cache contents, from image */
-        if(H5C__reconstruct_cache_contents(f, cache_ptr) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
+                if(NULL == (new_buffer = H5MM_realloc(cache_ptr->image_buffer, index_len)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image index")
+                cache_ptr->image_buffer = new_buffer;
+                if(H5F_block_read(f, H5FD_MEM_SUPER, cache_ptr->image_addr, index_len, cache_ptr->image_buffer) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image index")
 
-        /* Free the image buffer */
-        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+                H5C__UPDATE_STATS_FOR_CACHE_IMAGE_READ(cache_ptr)
+            } /* end if */
+            else
+                cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+        } /* end block */
+
+        if(!stale) {
+            if(!lazy) {
+                /* Allocate space for the image */
+                if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_len + 1)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+
+                /* Load the image from file */
+                if(H5C__read_cache_image(f, cache_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read metadata cache image block")
+            } /* end if */
 
-        /* Update stats -- must do this now, as we are about
-         * to discard the size of the cache image.
-         */
-        H5C__UPDATE_STATS_FOR_CACHE_IMAGE_LOAD(cache_ptr)
+            /* Reconstruct cache contents, from image */
+            if(H5C__reconstruct_cache_contents(f, cache_ptr, lazy) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
+
+            /* Free the image buffer */
+            cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
 
-        cache_ptr->image_loaded = TRUE;
+            /* An image that is kept in a writable file describes the 
+             * cache contents until an entry in the image is written.
+             */
+            if(lazy && (H5F_INTENT(f) & H5F_ACC_RDWR))
+                cache_ptr->image_is_current = TRUE;
+
+            /* Update stats -- must do this now, as we are about
+             * to discard the size of the cache image.
+             */
+            H5C__UPDATE_STATS_FOR_CACHE_IMAGE_LOAD(cache_ptr)
+
+            cache_ptr->image_loaded = TRUE;
+        } /* end if */
     } /* end if */
 
     /* If directed, free the on disk metadata cache image */
@@ -1177,6 +1389,9 @@ H5C__load_cache_image(H5F_t *f)
     } /* end if */
 
 done:
+    if(ret_value < 0)
+        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__load_cache_image() */
 
@@ -1233,6 +1448,94 @@ H5C_load_cache_image_on_next_protect(H5F_t *f, haddr_t addr, hsize_t len,
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C_load_cache_image_on_next_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_prefetched_entry_image
+ *
+ * Purpose:     Read the image of a prefetched entry whose image was left
+ *		in the metadata cache image block when the image was 
+ *		loaded, and verify it against the checksum stored in the
+ *		image's index.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__load_prefetched_entry_image(H5F_t *f, H5C_cache_entry_t *entry_ptr)
+{
+    void *      image = NULL;           /* Buffer for the entry image */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(entry_ptr);
+    HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+    HDassert(entry_ptr->prefetched);
+    HDassert(entry_ptr->image_ptr == NULL);
+    HDassert(H5F_addr_defined(entry_ptr->prefetch_image_addr));
+    HDassert(entry_ptr->size > 0);
+
+    /* Allocate buffer for entry image */
+    if(NULL == (image = H5MM_malloc(entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+    HDmemcpy(((uint8_t *)image) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+
+    /* Read the entry image from the cache image block, and verify it */
+    if(H5F_block_read(f, H5FD_MEM_SUPER, entry_ptr->prefetch_image_addr, entry_ptr->size, image) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read prefetched entry image")
+    if(entry_ptr->prefetch_image_chksum != H5_checksum_metadata(image, entry_ptr->size, 0))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "incorrect metadata cache entry image checksum")
+
+    entry_ptr->image_ptr = image;
+    entry_ptr->prefetch_image_addr = HADDR_UNDEF;
+    image = NULL;
+
+done:
+    if(image)
+        image = H5MM_xfree(image);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_prefetched_entry_image() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_prefetched_entry_images
+ *
+ * Purpose:     Read the images of all prefetched entries that are still
+ *		in the metadata cache image block, before the block is
+ *		rewritten or freed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__load_prefetched_entry_images(H5F_t *f, H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t * entry_ptr;
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(entry_ptr->prefetched && NULL == entry_ptr->image_ptr)
+            if(H5C__load_prefetched_entry_image(f, entry_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read prefetched entry image")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_prefetched_entry_images() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__image_entry_cmp
@@ -1587,6 +1890,64 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__prep_image_for_file_close() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prep_incremental_image_for_file_close
+ *
+ * Purpose:     If the metadata cache image is maintained incrementally,
+ *		flush the cache and bring the image up to date, and then
+ *		cancel the generation of a cache image on file close.
+ *
+ *		This must be done before the close warning is processed,
+ *		as writing the image may allocate file space from the free
+ *		space managers, which is not permitted once they have been
+ *		settled for file close.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__prep_incremental_image_for_file_close(H5F_t *f)
+{
+    H5C_t *     cache_ptr;
+    herr_t	ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(!cache_ptr->close_warning_received);
+
+    if(!H5C__incremental_image(f, cache_ptr))
+        HGOTO_DONE(SUCCEED)
+
+    /* Load the existing image, if that hasn't happened yet, so that its
+     * contents are carried over into the updated image.
+     */
+    if(cache_ptr->load_image) {
+        cache_ptr->load_image = FALSE;
+        if(H5C__load_cache_image(f) < 0)
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load cache image")
+    } /* end if */
+
+    /* Flush the cache, and write the image */
+    if(H5C_flush_cache(f, H5C__NO_FLAGS_SET) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush cache")
+    if(H5C_update_cache_image(f) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to update metadata cache image")
+
+    /* The image in the file is final -- don't generate another */
+    cache_ptr->image_ctl.generate_image = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prep_incremental_image_for_file_close() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_set_cache_image_config
@@ -1679,6 +2040,135 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_set_cache_image_config() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_update_cache_image
+ *
+ * Purpose:	If the metadata cache image is maintained incrementally 
+ *		and is out of date, write an image of the current contents
+ *		of the cache to the file.
+ *
+ *		The image is written in place if it fits in the existing
+ *		image block.  Otherwise a larger block is allocated, the
+ *		cache image superblock extension message is updated (or
+ *		created) to point to it, and the old block is freed.
+ *
+ *		The image can only describe clean entries, so the update 
+ *		is skipped (leaving the image stale) if any entry that 
+ *		would appear in it is dirty or protected.  This is the 
+ *		case just after a flush of the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_update_cache_image(H5F_t *f)
+{
+    H5C_t *             cache_ptr;
+    H5C_cache_entry_t * entry_ptr;
+    hbool_t             building = FALSE;       /* Whether the image entries array & buffer are ours to release */
+    herr_t		ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    /* Check whether there is an image to update.  Once the close warning
+     * has been received, the image is managed by the file close code.
+     */
+    if(!H5C__incremental_image(f, cache_ptr) || cache_ptr->load_image
+            || cache_ptr->image_is_current || cache_ptr->close_warning_received)
+        HGOTO_DONE(SUCCEED)
+
+    /* Verify that the superblock supports superblock extension messages,
+     * and that the file's high_bound is at least release 1.10.x, as in
+     * H5C__prep_image_for_file_close().
+     */
+    if((NULL == f->shared->sblock) ||
+         (f->shared->sblock->super_vers < HDF5_SUPERBLOCK_VERSION_2) ||
+         (f->shared->high_bound < H5F_LIBVER_V110))
+        HGOTO_DONE(SUCCEED)
+
+    /* Wait for a later flush if the image can't describe the cache now */
+    if(cache_ptr->pl_len > 0)
+        HGOTO_DONE(SUCCEED)
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(entry_ptr->ring <= H5C_MAX_RING_IN_IMAGE &&
+                (entry_ptr->is_dirty || H5F_IS_TMP_ADDR(f, entry_ptr->addr)
+                 || !entry_ptr->image_up_to_date
+                 || (NULL == entry_ptr->image_ptr && !entry_ptr->prefetched)))
+            HGOTO_DONE(SUCCEED)
+
+    /* Read the images of prefetched entries still in the image block,
+     * as the block is about to be overwritten or freed.
+     */
+    if(H5C__load_prefetched_entry_images(f, cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read prefetched entry images")
+
+    /* Scan the cache, and compute the size of the image */
+    building = TRUE;
+    if(H5C__prep_for_file_close__scan_entries(f, cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C__prep_for_file_close__scan_entries failed")
+
+    if(cache_ptr->num_entries_in_image > 0) {
+        haddr_t old_addr = cache_ptr->image_addr;
+        hsize_t old_len = cache_ptr->image_len;
+
+        /* Setup, sort, and encode the image entries */
+        if(H5C__prep_for_file_close__setup_image_entries_array(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't setup image entries array.")
+        HDqsort(cache_ptr->image_entries, (size_t)cache_ptr->num_entries_in_image,
+                sizeof(H5C_image_entry_t), H5C__image_entry_cmp);
+        if(H5C__construct_incremental_cache_image(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't create metadata cache image")
+        if(H5C__release_incremental_image_entries(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTRELEASE, FAIL, "Can't release image entries array")
+
+        /* Allocate a larger image block, with room to grow, if needed */
+        if(!H5F_addr_defined(old_addr) || old_len < cache_ptr->image_data_len) {
+            hsize_t new_len = cache_ptr->image_data_len + (cache_ptr->image_data_len / 4);
+
+            if(HADDR_UNDEF == (cache_ptr->image_addr = H5MF_alloc(f, H5FD_MEM_SUPER, new_len))) {
+                cache_ptr->image_addr = old_addr;
+                HGOTO_ERROR(H5E_CACHE, H5E_NOSPACE, FAIL, "can't allocate file space for metadata cache image")
+            } /* end if */
+            cache_ptr->image_len = new_len;
+
+            /* Point the superblock extension message at the new block */
+            if(H5C__write_cache_image_superblock_msg(f, !H5F_addr_defined(old_addr)) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "update of cache image SB mesg failed")
+        } /* end if */
+
+        /* Write the image */
+        if(H5C__write_cache_image(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write metadata cache image block to file")
+        cache_ptr->image_is_current = TRUE;
+
+        H5C__UPDATE_STATS_FOR_CACHE_IMAGE_CREATE(cache_ptr);
+
+        /* Release the old image block, if it was replaced */
+        if(H5F_addr_defined(old_addr) && !H5F_addr_eq(old_addr, cache_ptr->image_addr))
+            if(H5MF_xfree(f, H5FD_MEM_SUPER, old_addr, old_len) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't free old metadata cache image block")
+    } /* end if */
+
+done:
+    if(building) {
+        if(cache_ptr->image_entries)
+            if(H5C__release_incremental_image_entries(cache_ptr) < 0)
+                HDONE_ERROR(H5E_CACHE, H5E_CANTRELEASE, FAIL, "Can't release image entries array")
+        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_update_cache_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_validate_cache_image_config()
@@ -1749,7 +2239,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static size_t
-H5C__cache_image_block_entry_header_size(const H5F_t * f)
+H5C__cache_image_block_entry_header_size(const H5F_t * f, unsigned version)
 {
     size_t ret_value = 0;       /* Return value */
 
@@ -1767,6 +2257,10 @@ H5C__cache_image_block_entry_header_size(const H5F_t * f)
 			  H5F_SIZEOF_ADDR(f) +  /* entry offset             */
 			  H5F_SIZEOF_SIZE(f) ); /* entry length             */
 
+    /* Version 1 entry headers also hold the checksum of the entry image */
+    if(version == H5C__MDCI_BLOCK_VERSION_1)
+        ret_value += H5F_SIZEOF_CHKSUM;
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__cache_image_block_entry_header_size() */
 
@@ -1786,7 +2280,7 @@ H5C__cache_image_block_entry_header_size(const H5F_t * f)
  *-------------------------------------------------------------------------
  */
 static size_t
-H5C__cache_image_block_header_size(const H5F_t * f)
+H5C__cache_image_block_header_size(const H5F_t * f, unsigned version)
 {
     size_t ret_value = 0;       /* Return value */
 
@@ -1799,6 +2293,11 @@ H5C__cache_image_block_header_size(const H5F_t * f)
 			  H5F_SIZEOF_SIZE(f) +	/* image data length   */
 			  4 );			/* num_entries         */
 
+    /* Version 1 headers also hold the status byte and the index length */
+    if(version == H5C__MDCI_BLOCK_VERSION_1)
+        ret_value += (size_t)( 1 +		/* status              */
+			       H5F_SIZEOF_SIZE(f) ); /* index length   */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__cache_image_block_header_size() */
 
@@ -1811,6 +2310,12 @@ H5C__cache_image_block_header_size(const H5F_t * f)
  *		of H5C_t.  Advances the buffer pointer to the first byte 
  *		after the header image, or unchanged on failure.
  *
+ *		The version of the image block is returned in *version.
+ *		For version 1 blocks, *stale is set if the image has been
+ *		marked stale, and *index_len is set to the length of the
+ *		header and index that precede the entry images.  For 
+ *		version 0 blocks, *stale is FALSE and *index_len is zero.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  John Mainzer
@@ -1820,9 +2325,8 @@ H5C__cache_image_block_header_size(const H5F_t * f)
  */
 static herr_t
 H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
-    const uint8_t **buf)
+    const uint8_t **buf, unsigned *version, hbool_t *stale, size_t *index_len)
 {
-    uint8_t		version;
     uint8_t		flags;
     hbool_t		have_resize_status = FALSE;
     size_t 		actual_header_len;
@@ -1837,6 +2341,9 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(buf);
     HDassert(*buf);
+    HDassert(version);
+    HDassert(stale);
+    HDassert(index_len);
 
     /* Point to buffer to decode */
     p = *buf;
@@ -1847,10 +2354,16 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
     p += H5C__MDCI_BLOCK_SIGNATURE_LEN;
 
     /* Check version */
-    version = *p++;
-    if(version != (uint8_t)H5C__MDCI_BLOCK_VERSION_0)
+    *version = (unsigned)*p++;
+    if(*version != H5C__MDCI_BLOCK_VERSION_0 && *version != H5C__MDCI_BLOCK_VERSION_1)
 	HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image version")
 
+    /* Decode status */
+    *stale = FALSE;
+    if(*version == H5C__MDCI_BLOCK_VERSION_1)
+        if(*p++ & H5C__MDCI_STATUS_STALE)
+            *stale = TRUE;
+
     /* Decode flags */
     flags = *p++;
     if(flags & H5C__MDCI_HEADER_HAVE_RESIZE_STATUS)	
@@ -1861,18 +2374,33 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
     /* Read image data length */
     H5F_DECODE_LENGTH(f, p, cache_ptr->image_data_len);
 
-    /* For now -- will become <= eventually */
-    if(cache_ptr->image_data_len != cache_ptr->image_len)
-	HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image data length")
+    /* Version 0 images fill their block exactly, while version 1 
+     * images may leave room in their block to grow.
+     */
+    if(*version == H5C__MDCI_BLOCK_VERSION_0) {
+        if(cache_ptr->image_data_len != cache_ptr->image_len)
+	    HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image data length")
+    } /* end if */
+    else
+        if(cache_ptr->image_data_len > cache_ptr->image_len)
+	    HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image data length")
 
     /* Read num entries */
     UINT32DECODE(p, cache_ptr->num_entries_in_image);
     if(cache_ptr->num_entries_in_image == 0) 
 	HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache entry count")
 
+    /* Read index length */
+    *index_len = 0;
+    if(*version == H5C__MDCI_BLOCK_VERSION_1) {
+        H5F_DECODE_LENGTH(f, p, *index_len);
+        if(*index_len >= cache_ptr->image_data_len)
+	    HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image index length")
+    } /* end if */
+
     /* Verify expected length of header */
     actual_header_len = (size_t)(p - *buf);
-    expected_header_len = H5C__cache_image_block_header_size(f);
+    expected_header_len = H5C__cache_image_block_header_size(f, *version);
     if(actual_header_len != expected_header_len)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad header image len")
 
@@ -1996,7 +2524,7 @@ H5C__decode_cache_image_entry(const H5F_t *f, const H5C_t *cache_ptr,
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "invalid entry size")
 
     /* Verify expected length of entry image */
-    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f))
+    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f, H5C__MDCI_BLOCK_VERSION_0))
         HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "Bad entry image len")
     
     /* If parent count greater than zero, allocate array for parent 
@@ -2185,6 +2713,10 @@ done:
  *		supplied buffer.  Updates buffer pointer to the first byte 
  *		after the header image in the buffer, or unchanged on failure.
  *
+ *		Version 1 headers are written with a clear status byte,
+ *		and record index_len, the length of the header and index
+ *		that precede the entry images.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  John Mainzer
@@ -2194,7 +2726,7 @@ done:
  */
 static herr_t
 H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
-    uint8_t **buf)
+    uint8_t **buf, unsigned version, size_t index_len)
 {
     size_t 	actual_header_len;
     size_t	expected_header_len;
@@ -2207,11 +2739,11 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
     /* Sanity checks */
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->close_warning_received);
+    HDassert(cache_ptr->close_warning_received || version == H5C__MDCI_BLOCK_VERSION_1);
     HDassert(cache_ptr->image_ctl.generate_image);
-    HDassert(cache_ptr->index_len == 0);
+    HDassert(cache_ptr->index_len == 0 || version == H5C__MDCI_BLOCK_VERSION_1);
     HDassert(cache_ptr->image_data_len > 0);
-    HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
+    HDassert(cache_ptr->image_data_len <= cache_ptr->image_len || version == H5C__MDCI_BLOCK_VERSION_1);
     HDassert(buf);
     HDassert(*buf);
 
@@ -2223,7 +2755,11 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
     p += H5C__MDCI_BLOCK_SIGNATURE_LEN;
 
     /* write version */
-    *p++ = (uint8_t)H5C__MDCI_BLOCK_VERSION_0;
+    *p++ = (uint8_t)version;
+
+    /* write status -- the image is current when it is written */
+    if(version == H5C__MDCI_BLOCK_VERSION_1)
+        *p++ = 0;
 
     /* setup and write flags */
 
@@ -2235,16 +2771,20 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
     *p++ = flags;
 
     /* Encode image data length */
-    /* this must be true at present */
-    HDassert(cache_ptr->image_len == cache_ptr->image_data_len);
+    /* this must be true at present for version 0 images */
+    HDassert(cache_ptr->image_len == cache_ptr->image_data_len || version == H5C__MDCI_BLOCK_VERSION_1);
     H5F_ENCODE_LENGTH(f, p, cache_ptr->image_data_len);
 
     /* write num entries */
     UINT32ENCODE(p, cache_ptr->num_entries_in_image);
 
+    /* write index length */
+    if(version == H5C__MDCI_BLOCK_VERSION_1)
+        H5F_ENCODE_LENGTH(f, p, index_len);
+
     /* verify expected length of header */
     actual_header_len = (size_t)(p - *buf);
-    expected_header_len = H5C__cache_image_block_header_size(f);
+    expected_header_len = H5C__cache_image_block_header_size(f, version);
     if(actual_header_len != expected_header_len)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad header image len")
 
@@ -2263,6 +2803,10 @@ done:
  *		supplied buffer.  Updates buffer pointer to the first byte 
  *		after the entry in the buffer, or unchanged on failure.
  *
+ *		Version 1 entries hold the checksum of the entry image in
+ *		place of the image itself, which is stored separately 
+ *		after the index.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  John Mainzer
@@ -2272,7 +2816,7 @@ done:
  */
 static herr_t
 H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf, 
-    unsigned entry_num)
+    unsigned entry_num, unsigned version)
 {
     H5C_image_entry_t *	ie_ptr;                 /* Pointer to entry to encode */
     uint8_t             flags = 0;              /* Flags for entry */
@@ -2288,9 +2832,9 @@ H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf,
     HDassert(cache_ptr == f->shared->cache);
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->close_warning_received);
+    HDassert(cache_ptr->close_warning_received || version == H5C__MDCI_BLOCK_VERSION_1);
     HDassert(cache_ptr->image_ctl.generate_image);
-    HDassert(cache_ptr->index_len == 0);
+    HDassert(cache_ptr->index_len == 0 || version == H5C__MDCI_BLOCK_VERSION_1);
     HDassert(buf);
     HDassert(*buf);
     HDassert(entry_num < cache_ptr->num_entries_in_image);
@@ -2346,8 +2890,15 @@ H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf,
     /* Encode entry length */
     H5F_ENCODE_LENGTH(f, p, ie_ptr->size);
 
+    /* Encode checksum of entry image */
+    if(version == H5C__MDCI_BLOCK_VERSION_1) {
+        uint32_t chksum = H5_checksum_metadata(ie_ptr->image_ptr, ie_ptr->size, 0);
+
+        UINT32ENCODE(p, chksum);
+    } /* end if */
+
     /* Verify expected length of entry image */
-    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f))
+    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f, version))
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad entry image len")
 
     /* Encode dependency parent offsets -- if any */
@@ -2355,8 +2906,10 @@ H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf,
 	H5F_addr_encode(f, &p, ie_ptr->fd_parent_addrs[u]);
 
     /* Copy entry image */
-    HDmemcpy(p, ie_ptr->image_ptr, ie_ptr->size);
-    p += ie_ptr->size;
+    if(version == H5C__MDCI_BLOCK_VERSION_0) {
+        HDmemcpy(p, ie_ptr->image_ptr, ie_ptr->size);
+        p += ie_ptr->size;
+    } /* end if */
 
     /* Update buffer pointer */
     *buf = p;
@@ -2365,6 +2918,48 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__encode_cache_image_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__incremental_image
+ *
+ * Purpose:     Determine whether the metadata cache image is maintained
+ *		incrementally -- that is, whether it is brought up to date
+ *		on each flush of the file instead of being generated on 
+ *		file close.
+ *
+ *		This requires that generation of the image is fully 
+ *		enabled, and is not supported with persistent free space
+ *		managers or parallel access.
+ *
+ * Return:      TRUE if the image is maintained incrementally, and FALSE
+ *		otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5C__incremental_image(const H5F_t *f, const H5C_t *cache_ptr)
+{
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    ret_value = cache_ptr->image_ctl.generate_image && cache_ptr->image_ctl.incremental
+            && (cache_ptr->image_ctl.flags == H5C_CI__ALL_FLAGS)
+            && !f->shared->fs_persist;
+#ifdef H5_HAVE_PARALLEL
+    if(cache_ptr->aux_ptr)
+        ret_value = FALSE;
+#endif /* H5_HAVE_PARALLEL */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__incremental_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__prep_for_file_close__compute_fd_heights
@@ -2722,7 +3317,7 @@ H5C__prep_for_file_close__setup_image_entries_array(H5C_t *cache_ptr)
     /* Sanity checks */
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->close_warning_received);
+    HDassert(cache_ptr->close_warning_received || cache_ptr->image_ctl.incremental);
     HDassert(cache_ptr->pl_len == 0);
     HDassert(cache_ptr->num_entries_in_image > 0);
     HDassert(cache_ptr->image_entries == NULL);
@@ -2858,6 +3453,7 @@ H5C__prep_for_file_close__scan_entries(const H5F_t *f, H5C_t *cache_ptr)
     size_t		image_len;
     size_t		entry_header_len;
     size_t		fd_parents_list_len;
+    unsigned            version;
     int			i;
     unsigned            j;
     herr_t		ret_value = SUCCEED;      /* Return value */
@@ -2870,14 +3466,17 @@ H5C__prep_for_file_close__scan_entries(const H5F_t *f, H5C_t *cache_ptr)
     HDassert(f->shared->sblock);
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->close_warning_received);
+    HDassert(cache_ptr->close_warning_received || H5C__incremental_image(f, cache_ptr));
     HDassert(cache_ptr->pl_len == 0);
 
+    /* Incrementally maintained images use the version 1 block format */
+    version = H5C__incremental_image(f, cache_ptr) ? H5C__MDCI_BLOCK_VERSION_1 : H5C__MDCI_BLOCK_VERSION_0;
+
     /* Initialize image len to the size of the metadata cache image block
      * header.
      */
-    image_len        = H5C__cache_image_block_header_size(f);
-    entry_header_len = H5C__cache_image_block_entry_header_size(f);
+    image_len        = H5C__cache_image_block_header_size(f, version);
+    entry_header_len = H5C__cache_image_block_entry_header_size(f, version);
 
     /* Scan each entry on the index list */
     entry_ptr = cache_ptr->il_head;
@@ -3089,11 +3688,15 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
+H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr, hbool_t lazy)
 {
     H5C_cache_entry_t *	pf_entry_ptr;   /* Pointer to prefetched entry */
     H5C_cache_entry_t *	parent_ptr;     /* Pointer to parent of prefetched entry */
     const uint8_t *	p;              /* Pointer into image buffer */
+    unsigned		version;        /* Version of the image block */
+    hbool_t		stale;          /* Whether the image is stale */
+    size_t		index_len;      /* Length of the image header and index */
+    size_t		image_off;      /* Offset of the next entry image */
     unsigned		u, v;           /* Local index variable */
     herr_t 		ret_value = SUCCEED;      /* Return value */
 
@@ -3110,21 +3713,40 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
 
     /* Decode metadata cache image header */
     p = (uint8_t *)cache_ptr->image_buffer;
-    if(H5C__decode_cache_image_header(f, cache_ptr, &p) < 0)
+    if(H5C__decode_cache_image_header(f, cache_ptr, &p, &version, &stale, &index_len) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "cache image header decode failed")
     HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_len);
+    HDassert(!lazy || version == H5C__MDCI_BLOCK_VERSION_1);
 
     /* The image_data_len and # of entries should be defined now */
     HDassert(cache_ptr->image_data_len > 0);
     HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
     HDassert(cache_ptr->num_entries_in_image > 0);
 
+    /* A stale image no longer describes the file's metadata -- ignore it */
+    if(stale)
+        HGOTO_DONE(SUCCEED)
+
+    /* Verify the checksum of the header and index of version 1 images.
+     * The entry images are checked individually, as they are loaded.
+     */
+    if(version == H5C__MDCI_BLOCK_VERSION_1) {
+        const uint8_t *chksum_image = (const uint8_t *)cache_ptr->image_buffer + H5C__MDCI_STATUS_OFFSET + 1;
+        const uint8_t *q = (const uint8_t *)cache_ptr->image_buffer + index_len - H5F_SIZEOF_CHKSUM;
+        uint32_t stored_chksum;
+
+        UINT32DECODE(q, stored_chksum);
+        if(stored_chksum != H5_checksum_metadata(chksum_image, (size_t)(index_len - H5F_SIZEOF_CHKSUM - (H5C__MDCI_STATUS_OFFSET + 1)), 0))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "incorrect metadata cache image index checksum")
+    } /* end if */
+    image_off = index_len;
+
     /* Reconstruct entries in image */
     for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
 	/* Create the prefetched entry described by the ith
          * entry in cache_ptr->image_entrise.
          */
-	if(NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p)))
+	if(NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p, version, lazy, &image_off)))
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of cache entry failed")
 
 	/* Note that we make no checks on available cache space before 
@@ -3181,6 +3803,9 @@ H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr)
 	    parent_ptr->is_protected = FALSE;
         } /* end for */
     } /* end for */
+    HDassert(version == H5C__MDCI_BLOCK_VERSION_0 ||
+        ((size_t)(p - (uint8_t *)cache_ptr->image_buffer) == index_len - H5F_SIZEOF_CHKSUM
+         && image_off == cache_ptr->image_data_len));
 
 #ifndef NDEBUG
     /* Scan the cache entries, and verify that each entry has
@@ -3289,6 +3914,12 @@ done:
  *		Return a pointer to the newly allocated cache entry,
  *		or NULL on failure.
  *
+ *		The images of entries in version 1 image blocks follow
+ *		the index, starting at *image_off, which is advanced past
+ *		the entry's image.  If lazy is TRUE, only the location and
+ *		checksum of the image are recorded, and the image is read 
+ *		when the entry is first used.
+ *
  * Return:      Pointer to the new instance of H5C_cache_entry on success, 
  *		or NULL on failure.
  *
@@ -3299,7 +3930,7 @@ done:
  */
 static H5C_cache_entry_t *
 H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
-    const uint8_t **buf)
+    const uint8_t **buf, unsigned version, hbool_t lazy, size_t *image_off)
 {
     H5C_cache_entry_t *pf_entry_ptr = NULL;     /* Reconstructed cache entry */
     uint8_t             flags = 0;
@@ -3310,6 +3941,7 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     hbool_t		is_fd_child = FALSE;
 #endif /* NDEBUG */ /* only used in assertions */
     const uint8_t *	p;
+    uint32_t            chksum = 0;
     hbool_t            file_is_rw;
     H5C_cache_entry_t *ret_value = NULL;        /* Return value */
 
@@ -3320,9 +3952,10 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(cache_ptr->num_entries_in_image > 0);
     HDassert(buf && *buf);
+    HDassert(image_off);
 
-    /* Key R/W access off of whether the image will be deleted */
-    file_is_rw = cache_ptr->delete_image;
+    /* Key R/W access off of the file's intent */
+    file_is_rw = (H5F_INTENT(f) & H5F_ACC_RDWR) != 0;
 
     /* Allocate space for the prefetched cache entry */
     if(NULL == (pf_entry_ptr = H5FL_CALLOC(H5C_cache_entry_t)))
@@ -3398,8 +4031,12 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     if(pf_entry_ptr->size == 0)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid entry size")
 
+    /* Decode checksum of entry image */
+    if(version == H5C__MDCI_BLOCK_VERSION_1)
+        UINT32DECODE(p, chksum);
+
     /* Verify expected length of entry image */
-    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f))
+    if((size_t)(p - *buf) != H5C__cache_image_block_entry_header_size(f, version))
         HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, NULL, "Bad entry image len")
     
     /* If parent count greater than zero, allocate array for parent 
@@ -3418,16 +4055,43 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
         } /* end for */
     } /* end if */
 
-    /* Allocate buffer for entry image */
-    if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(pf_entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
-	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+    if(lazy) {
+        /* Note the location of the entry image, to be read on demand */
+        if(*image_off + pf_entry_ptr->size > cache_ptr->image_data_len)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "entry image beyond end of cache image")
+        pf_entry_ptr->prefetch_image_addr = cache_ptr->image_addr + *image_off;
+        pf_entry_ptr->prefetch_image_chksum = chksum;
+        *image_off += pf_entry_ptr->size;
+    } /* end if */
+    else {
+        const uint8_t *image;       /* Entry image in the cache image block */
+
+        /* Locate the entry image in the cache image block */
+        if(version == H5C__MDCI_BLOCK_VERSION_0) {
+            image = p;
+            p += pf_entry_ptr->size;
+        } /* end if */
+        else {
+            if(*image_off + pf_entry_ptr->size > cache_ptr->image_data_len)
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "entry image beyond end of cache image")
+            image = (const uint8_t *)cache_ptr->image_buffer + *image_off;
+            *image_off += pf_entry_ptr->size;
+
+            if(chksum != H5_checksum_metadata(image, pf_entry_ptr->size, 0))
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "incorrect metadata cache entry image checksum")
+        } /* end else */
+
+        /* Allocate buffer for entry image */
+        if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(pf_entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
 #if H5C_DO_MEMORY_SANITY_CHECKS
-    HDmemcpy(((uint8_t *)pf_entry_ptr->image_ptr) + size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+        HDmemcpy(((uint8_t *)pf_entry_ptr->image_ptr) + size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
-    /* Copy the entry image from the cache image block */
-    HDmemcpy(pf_entry_ptr->image_ptr, p, pf_entry_ptr->size);
-    p += pf_entry_ptr->size;
+        /* Copy the entry image from the cache image block */
+        HDmemcpy(pf_entry_ptr->image_ptr, image, pf_entry_ptr->size);
+        pf_entry_ptr->prefetch_image_addr = HADDR_UNDEF;
+    } /* end else */
 
     /* Initialize the rest of the fields in the prefetched entry */
     /* (Only need to set non-zero/NULL/FALSE fields, due to calloc() above) */
@@ -3453,6 +4117,84 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__reconstruct_cache_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__release_incremental_image_entries
+ *
+ * Purpose:     Free the image entries array after an incremental update
+ *		of the metadata cache image, and reset the image related
+ *		fields of the entries, which remain in the cache.
+ *
+ *		Unlike H5C__free_image_entries_array(), the entry images
+ *		are not freed, as they still belong to the cache entries,
+ *		and the flush dependency parent addresses of prefetched 
+ *		entries are returned to them, as they are needed when the
+ *		entries are deserialized.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__release_incremental_image_entries(H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t * entry_ptr;
+    unsigned            u;                      /* Local index variable */
+    herr_t		ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->image_entries);
+
+    for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
+        H5C_image_entry_t *ie_ptr = &((cache_ptr->image_entries)[u]);
+
+        HDassert(ie_ptr->magic == H5C_IMAGE_ENTRY_T_MAGIC);
+
+        /* Look up the entry */
+        entry_ptr = NULL;
+        H5C__SEARCH_INDEX(cache_ptr, ie_ptr->addr, entry_ptr, FAIL)
+        if(NULL == entry_ptr) {
+            /* Free the remaining arrays before bailing out */
+            for(; u < cache_ptr->num_entries_in_image; u++)
+                (cache_ptr->image_entries)[u].fd_parent_addrs = (haddr_t *)H5MM_xfree((cache_ptr->image_entries)[u].fd_parent_addrs);
+            cache_ptr->image_entries = (H5C_image_entry_t *)H5MM_xfree(cache_ptr->image_entries);
+            HGOTO_ERROR(H5E_CACHE, H5E_NOTFOUND, FAIL, "image entry not in cache?!?")
+        } /* end if */
+
+        /* Return the parent addrs array to prefetched entries, or free it */
+        if(entry_ptr->prefetched) {
+            HDassert(entry_ptr->fd_parent_addrs == NULL);
+            entry_ptr->fd_parent_count = ie_ptr->fd_parent_count;
+            entry_ptr->fd_parent_addrs = ie_ptr->fd_parent_addrs;
+        } /* end if */
+        else if(ie_ptr->fd_parent_addrs)
+            H5MM_xfree(ie_ptr->fd_parent_addrs);
+        ie_ptr->fd_parent_addrs = NULL;
+        ie_ptr->fd_parent_count = 0;
+
+        ie_ptr->magic = H5C_IMAGE_ENTRY_T_BAD_MAGIC;
+    } /* end for */
+    cache_ptr->image_entries = (H5C_image_entry_t *)H5MM_xfree(cache_ptr->image_entries);
+
+    /* Reset the image related fields of the entries */
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next) {
+        entry_ptr->include_in_image = FALSE;
+        if(!entry_ptr->prefetched) {
+            HDassert(entry_ptr->fd_parent_count == 0);
+            HDassert(entry_ptr->fd_parent_addrs == NULL);
+            entry_ptr->fd_child_count = 0;
+            entry_ptr->fd_dirty_child_count = 0;
+        } /* end if */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__release_incremental_image_entries() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__write_cache_image_superblock_msg
@@ -3490,7 +4232,7 @@ H5C__write_cache_image_superblock_msg(H5F_t *f, hbool_t create)
     cache_ptr = f->shared->cache;
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->close_warning_received);
+    HDassert(cache_ptr->close_warning_received || H5C__incremental_image(f, cache_ptr));
 
     /* Write data into the metadata cache image superblock extension message.
      * Note that this data will be bogus when we first create the message.
@@ -3554,7 +4296,7 @@ H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr)
 #endif /* H5_HAVE_PARALLEL */
 
 	/* Write the buffer (if serial access, or rank 0 for parallel access) */
-	if(H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr, cache_ptr->image_len, cache_ptr->image_buffer) < 0)
+	if(H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr, cache_ptr->image_data_len, cache_ptr->image_buffer) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write metadata cache image block to file")
 #ifdef H5_HAVE_PARALLEL
     } /* end if */
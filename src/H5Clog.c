@@ -117,6 +117,10 @@ H5C_log_set_up(H5C_t *cache, const char log_location[], H5C_log_style_t style, h
         if(H5C_log_trace_set_up(cache->log_info, log_location, mpi_rank) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to set up trace logging")
     }
+    else if(H5C_LOG_STYLE_BINARY == style) {
+        if(H5C_log_binary_set_up(cache->log_info, log_location, mpi_rank) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to set up binary logging")
+    }
     else
         HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unknown logging style")
 
@@ -974,3 +978,35 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_log_write_remove_entry_msg() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_log_write_evict_entry_msg
+ *
+ * Purpose:     Write a log message for the eviction of a cache entry by
+ *              the cache itself, just before the entry is evicted.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_log_write_evict_entry_msg(H5C_t *cache, const H5C_cache_entry_t *entry,
+    H5C_log_evict_cause_t cause)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(cache);
+
+    /* Write a log message */
+    HDassert(entry);
+    if(cache->log_info->cls->write_evict_entry_log_msg)
+        if(cache->log_info->cls->write_evict_entry_log_msg(cache->log_info->udata, entry, cause) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "log-specific evict entry call failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_log_write_evict_entry_msg() */
+
@@ -25,6 +25,75 @@
 /* Package Private Macros */
 /**************************/
 
+/* Binary log file format (H5C_LOG_STYLE_BINARY)
+ *
+ * The file starts with a header of H5C_LOG_BIN_HEADER_SIZE bytes:
+ *
+ *      signature               8 bytes  "H5MDCLOG"
+ *      version                 1 byte   (H5C_LOG_BIN_VERSION)
+ *      record size             1 byte   (H5C_LOG_BIN_RECORD_SIZE)
+ *      reserved                2 bytes
+ *      MPI rank                4 bytes  (0xffffffff when serial)
+ *      start time              8 bytes  (microseconds since the epoch)
+ *      reserved                8 bytes
+ *
+ * followed by fixed size records, one per cache operation:
+ *
+ *      time                    8 bytes  (microseconds since start time)
+ *      address                 8 bytes  (all ones when undefined)
+ *      size                    8 bytes  (entry size, or the new address
+ *                                        of a move, the new size of a
+ *                                        resize, the child address of a
+ *                                        flush dependency, or the maximum
+ *                                        size of a cache configuration)
+ *      flags                   4 bytes  (H5C__*_FLAG values passed to
+ *                                        the operation)
+ *      event                   1 byte   (H5C_LOG_EVENT_*)
+ *      type id                 1 byte   (entry type id, or 0xff if none)
+ *      status                  1 byte   (0 if the operation succeeded)
+ *      cause                   1 byte   (H5C_LOG_EVICT_* for evictions)
+ *
+ * All values are little-endian.
+ */
+#define H5C_LOG_BIN_SIGNATURE           "H5MDCLOG"
+#define H5C_LOG_BIN_SIGNATURE_LEN       8
+#define H5C_LOG_BIN_VERSION             1
+#define H5C_LOG_BIN_HEADER_SIZE         40
+#define H5C_LOG_BIN_RECORD_SIZE         32
+#define H5C_LOG_BIN_NO_TYPE             0xff
+
+/* Binary log events */
+#define H5C_LOG_EVENT_START                     1
+#define H5C_LOG_EVENT_STOP                      2
+#define H5C_LOG_EVENT_CREATE_CACHE              3
+#define H5C_LOG_EVENT_DESTROY_CACHE             4
+#define H5C_LOG_EVENT_EVICT_CACHE               5
+#define H5C_LOG_EVENT_EXPUNGE_ENTRY             6
+#define H5C_LOG_EVENT_FLUSH_CACHE               7
+#define H5C_LOG_EVENT_INSERT_ENTRY              8
+#define H5C_LOG_EVENT_MARK_ENTRY_DIRTY          9
+#define H5C_LOG_EVENT_MARK_ENTRY_CLEAN          10
+#define H5C_LOG_EVENT_MARK_UNSERIALIZED_ENTRY   11
+#define H5C_LOG_EVENT_MARK_SERIALIZED_ENTRY     12
+#define H5C_LOG_EVENT_MOVE_ENTRY                13
+#define H5C_LOG_EVENT_PIN_ENTRY                 14
+#define H5C_LOG_EVENT_CREATE_FD                 15
+#define H5C_LOG_EVENT_PROTECT_ENTRY             16
+#define H5C_LOG_EVENT_RESIZE_ENTRY              17
+#define H5C_LOG_EVENT_UNPIN_ENTRY               18
+#define H5C_LOG_EVENT_DESTROY_FD                19
+#define H5C_LOG_EVENT_UNPROTECT_ENTRY           20
+#define H5C_LOG_EVENT_SET_CACHE_CONFIG          21
+#define H5C_LOG_EVENT_REMOVE_ENTRY              22
+#define H5C_LOG_EVENT_EVICT_ENTRY               23
+#define H5C_LOG_EVENT_NEVENTS                   24      /* Must be last */
+
+/* Log the eviction of an entry, just before it is evicted */
+#define H5C__LOG_EVICT_ENTRY(cache_ptr, entry_ptr, cause, fail_val)           \
+    if((cache_ptr)->log_info->logging)                                        \
+        if(H5C_log_write_evict_entry_msg((cache_ptr), (entry_ptr), (cause)) < 0) \
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, fail_val, "unable to emit log message")
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -32,6 +101,14 @@
 /* Forward declaration for class struct */
 typedef struct H5C_log_info_t H5C_log_info_t;
 
+/* Reasons for evicting an entry that aren't logged by other messages */
+typedef enum H5C_log_evict_cause_t {
+    H5C_LOG_EVICT_REPLACEMENT = 1,      /* Making space for another entry */
+    H5C_LOG_EVICT_AGEOUT,               /* Entry aged out of the cache */
+    H5C_LOG_EVICT_TAGGED,               /* Eviction of an object's entries */
+    H5C_LOG_EVICT_INVALIDATE            /* Flush invalidate of the cache */
+} H5C_log_evict_cause_t;
+
 /* Class for generating logging messages */
 typedef struct H5C_log_class_t {
     const char	*name;				/* String for debugging */
@@ -62,6 +139,7 @@ typedef struct H5C_log_class_t {
     herr_t (*write_unprotect_entry_log_msg)(void *udata, haddr_t address, int type_id, unsigned flags, herr_t fxn_ret_value);
     herr_t (*write_set_cache_config_log_msg)(void *udata, const H5AC_cache_config_t *config, herr_t fxn_ret_value);
     herr_t (*write_remove_entry_log_msg)(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+    herr_t (*write_evict_entry_log_msg)(void *udata, const H5C_cache_entry_t *entry, H5C_log_evict_cause_t cause);
 
 } H5C_log_class_t;
 
@@ -105,10 +183,12 @@ H5_DLL herr_t H5C_log_write_destroy_fd_msg(H5C_t *cache, const H5C_cache_entry_t
 H5_DLL herr_t H5C_log_write_unprotect_entry_msg(H5C_t *cache, haddr_t address, int type_id, unsigned flags, herr_t fxn_ret_value);
 H5_DLL herr_t H5C_log_write_set_cache_config_msg(H5C_t *cache, const H5AC_cache_config_t *config, herr_t fxn_ret_value);
 H5_DLL herr_t H5C_log_write_remove_entry_msg(H5C_t *cache, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+H5_DLL herr_t H5C_log_write_evict_entry_msg(H5C_t *cache, const H5C_cache_entry_t *entry, H5C_log_evict_cause_t cause);
 
 /* Logging-specific setup functions */
 H5_DLL herr_t H5C_log_json_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank);
 H5_DLL herr_t H5C_log_trace_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank);
+H5_DLL herr_t H5C_log_binary_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank);
 
 #endif /* _H5Clog_H */
 
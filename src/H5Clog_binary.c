@@ -0,0 +1,1123 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Clog_binary.c
+ *
+ * Purpose:     Cache log implementation that emits fixed size binary
+ *              records, cheap enough to leave on in production.  Records
+ *              are collected in a buffer and written to the log file
+ *              when the buffer fills up and when logging stops.  The
+ *              format is described in H5Clog.h, and the h5mdclog tool
+ *              analyzes the resulting logs.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+#include "H5Cmodule.h"         /* This source code file is part of the H5C module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Cpkg.h"             /* Cache                                    */
+#include "H5Clog.h"             /* Cache logging                            */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5MMprivate.h"        /* Memory management                        */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of records buffered before they are written to the log file */
+#define H5C_BINARY_LOG_BUF_NRECORDS 4096
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+typedef struct H5C_log_binary_udata_t {
+    FILE *outfile;
+    uint8_t *buf;               /* Records not written to the file yet */
+    size_t nrecords;            /* Number of records in buf */
+    double start_time;          /* Time the log was set up (in seconds) */
+} H5C_log_binary_udata_t;
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/* Internal message handling calls */
+static herr_t H5C__binary_write_record(H5C_log_binary_udata_t *binary_udata,
+    unsigned event, haddr_t address, int type_id, uint64_t size,
+    unsigned flags, herr_t fxn_ret_value, unsigned cause);
+static herr_t H5C__binary_flush_records(H5C_log_binary_udata_t *binary_udata);
+
+/* Log message callbacks */
+static herr_t H5C__binary_tear_down_logging(H5C_log_info_t *log_info);
+static herr_t H5C__binary_stop_logging(H5C_log_info_t *log_info);
+static herr_t H5C__binary_write_start_log_msg(void *udata);
+static herr_t H5C__binary_write_stop_log_msg(void *udata);
+static herr_t H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_cache_log_msg(void *udata);
+static herr_t H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags, size_t size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr, int type_id, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent, const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, int type_id, unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, size_t new_size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent, const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_set_cache_config_log_msg(void *udata, const H5AC_cache_config_t *config, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_evict_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, H5C_log_evict_cause_t cause);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Note that there's no cache set up call since that's the
+ * place where this struct is wired into the cache.
+ */
+static H5C_log_class_t H5C_binary_log_class_g = {
+    "binary",
+    H5C__binary_tear_down_logging,
+    NULL,                               /* start logging */
+    H5C__binary_stop_logging,
+    H5C__binary_write_start_log_msg,
+    H5C__binary_write_stop_log_msg,
+    H5C__binary_write_create_cache_log_msg,
+    H5C__binary_write_destroy_cache_log_msg,
+    H5C__binary_write_evict_cache_log_msg,
+    H5C__binary_write_expunge_entry_log_msg,
+    H5C__binary_write_flush_cache_log_msg,
+    H5C__binary_write_insert_entry_log_msg,
+    H5C__binary_write_mark_entry_dirty_log_msg,
+    H5C__binary_write_mark_entry_clean_log_msg,
+    H5C__binary_write_mark_unserialized_entry_log_msg,
+    H5C__binary_write_mark_serialized_entry_log_msg,
+    H5C__binary_write_move_entry_log_msg,
+    H5C__binary_write_pin_entry_log_msg,
+    H5C__binary_write_create_fd_log_msg,
+    H5C__binary_write_protect_entry_log_msg,
+    H5C__binary_write_resize_entry_log_msg,
+    H5C__binary_write_unpin_entry_log_msg,
+    H5C__binary_write_destroy_fd_log_msg,
+    H5C__binary_write_unprotect_entry_log_msg,
+    H5C__binary_write_set_cache_config_log_msg,
+    H5C__binary_write_remove_entry_log_msg,
+    H5C__binary_write_evict_entry_log_msg
+};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_flush_records
+ *
+ * Purpose:     Write the buffered records to the log file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_flush_records(H5C_log_binary_udata_t *binary_udata)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(binary_udata->outfile);
+    HDassert(binary_udata->buf);
+
+    /* Write the records */
+    if(binary_udata->nrecords > 0) {
+        if(binary_udata->nrecords != HDfwrite(binary_udata->buf, (size_t)H5C_LOG_BIN_RECORD_SIZE, binary_udata->nrecords, binary_udata->outfile))
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "error writing log records")
+        binary_udata->nrecords = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_flush_records() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_record
+ *
+ * Purpose:     Add a record to the buffered records, writing them to the
+ *              log file if the buffer is full.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_record(H5C_log_binary_udata_t *binary_udata, unsigned event,
+    haddr_t address, int type_id, uint64_t size, unsigned flags,
+    herr_t fxn_ret_value, unsigned cause)
+{
+    uint8_t *p;                     /* Pointer into the record buffer */
+    uint64_t timestamp;             /* Time of the record */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(binary_udata->buf);
+    HDassert(binary_udata->nrecords < H5C_BINARY_LOG_BUF_NRECORDS);
+
+    /* Get the time since the log was set up, in microseconds */
+    timestamp = (uint64_t)((H5_get_time() - binary_udata->start_time) * (double)1000000.0f);
+
+    /* Encode the record */
+    p = binary_udata->buf + (binary_udata->nrecords * H5C_LOG_BIN_RECORD_SIZE);
+    UINT64ENCODE(p, timestamp);
+    UINT64ENCODE(p, address);
+    UINT64ENCODE(p, size);
+    UINT32ENCODE(p, flags);
+    *p++ = (uint8_t)event;
+    *p++ = (uint8_t)((type_id < 0 || type_id >= H5C_LOG_BIN_NO_TYPE) ? H5C_LOG_BIN_NO_TYPE : type_id);
+    *p++ = (uint8_t)(fxn_ret_value < 0 ? 1 : 0);
+    *p++ = (uint8_t)cause;
+    binary_udata->nrecords++;
+
+    /* Write the records when the buffer is full */
+    if(binary_udata->nrecords == H5C_BINARY_LOG_BUF_NRECORDS)
+        if(H5C__binary_flush_records(binary_udata) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_log_binary_set_up
+ *
+ * Purpose:     Setup for metadata cache logging.
+ *
+ *              Opens the log file and writes its header.  See
+ *              H5C_log_trace_set_up() for a description of how logging
+ *              is enabled and disabled.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_log_binary_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    char *file_name = NULL;
+    uint8_t header[H5C_LOG_BIN_HEADER_SIZE];
+    uint8_t *p;
+    size_t n_chars;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(log_info);
+    HDassert(log_location);
+
+    /* Set up the class struct */
+    log_info->cls = &H5C_binary_log_class_g;
+
+    /* Allocate memory for the binary-specific data */
+    if(NULL == (log_info->udata = H5MM_calloc(sizeof(H5C_log_binary_udata_t))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Allocate memory for the record buffer */
+    if(NULL == (binary_udata->buf = (uint8_t *)H5MM_malloc((size_t)H5C_BINARY_LOG_BUF_NRECORDS * H5C_LOG_BIN_RECORD_SIZE)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Possibly fix up the log file name.
+     * The extra 39 characters are for adding the rank to the file name
+     * under parallel HDF5. 39 characters allows > 2^127 processes which
+     * should be enough for anybody.
+     *
+     * allocation size = <path length> + dot + <rank # length> + \0
+     */
+    n_chars = HDstrlen(log_location) + 1 + 39 + 1;
+    if(NULL == (file_name = (char *)H5MM_calloc(n_chars * sizeof(char))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate memory for mdc log file name manipulation")
+
+    /* Add the rank to the log file name when MPI is in use */
+    if(-1 == mpi_rank)
+        HDsnprintf(file_name, n_chars, "%s", log_location);
+    else
+        HDsnprintf(file_name, n_chars, "%s.%d", log_location, mpi_rank);
+
+    /* Open log file */
+    if(NULL == (binary_udata->outfile = HDfopen(file_name, "wb")))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't create mdc log file")
+
+    /* Write the header */
+    binary_udata->start_time = H5_get_time();
+    HDmemset(header, 0, sizeof(header));
+    p = header;
+    HDmemcpy(p, H5C_LOG_BIN_SIGNATURE, (size_t)H5C_LOG_BIN_SIGNATURE_LEN);
+    p += H5C_LOG_BIN_SIGNATURE_LEN;
+    *p++ = H5C_LOG_BIN_VERSION;
+    *p++ = H5C_LOG_BIN_RECORD_SIZE;
+    p += 2;
+    UINT32ENCODE(p, (uint32_t)mpi_rank);
+    UINT64ENCODE(p, (uint64_t)(binary_udata->start_time * (double)1000000.0f));
+    if(1 != HDfwrite(header, sizeof(header), (size_t)1, binary_udata->outfile))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't write mdc log file header")
+
+ done:
+    if(file_name)
+        H5MM_xfree(file_name);
+
+    /* Free and reset the log info struct on errors */
+    if(FAIL == ret_value) {
+        /* Free */
+        if(binary_udata && binary_udata->outfile)
+            HDfclose(binary_udata->outfile);
+        if(binary_udata && binary_udata->buf)
+            H5MM_xfree(binary_udata->buf);
+        if(binary_udata)
+            H5MM_xfree(binary_udata);
+
+        /* Reset */
+        log_info->udata = NULL;
+        log_info->cls = NULL;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_log_binary_set_up() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_tear_down_logging
+ *
+ * Purpose:     Tear-down for metadata cache logging.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_tear_down_logging(H5C_log_info_t *log_info)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(log_info);
+
+    /* Alias */
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Write any remaining records */
+    if(H5C__binary_flush_records(binary_udata) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+
+    /* Free the record buffer */
+    H5MM_xfree(binary_udata->buf);
+
+    /* Close log file */
+    if(EOF == HDfclose(binary_udata->outfile))
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "problem closing mdc log file")
+    binary_udata->outfile = NULL;
+
+    /* Free the udata */
+    H5MM_xfree(binary_udata);
+
+    /* Reset the log class info and udata */
+    log_info->cls = NULL;
+    log_info->udata = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_tear_down_logging() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_stop_logging
+ *
+ * Purpose:     Write the buffered records to the log file when logging
+ *              stops, so that the log is complete while logging is off.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_stop_logging(H5C_log_info_t *log_info)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(log_info);
+
+    /* Alias */
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Write the records and flush the file */
+    if(H5C__binary_flush_records(binary_udata) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records")
+    if(EOF == HDfflush(binary_udata->outfile))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "problem flushing mdc log file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_stop_logging() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_start_log_msg
+ *
+ * Purpose:     Write a log message when logging starts.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_start_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_START, HADDR_UNDEF, -1, (uint64_t)0, 0, SUCCEED, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_start_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_stop_log_msg
+ *
+ * Purpose:     Write a log message when logging ends.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_stop_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_STOP, HADDR_UNDEF, -1, (uint64_t)0, 0, SUCCEED, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_stop_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_cache_log_msg
+ *
+ * Purpose:     Write a log message for cache creation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_CREATE_CACHE, HADDR_UNDEF, -1, (uint64_t)0, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_cache_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_cache_log_msg
+ *
+ * Purpose:     Write a log message for cache destruction.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_cache_log_msg(void *udata)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_DESTROY_CACHE, HADDR_UNDEF, -1, (uint64_t)0, 0, SUCCEED, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_cache_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_evict_cache_log_msg
+ *
+ * Purpose:     Write a log message for eviction of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_EVICT_CACHE, HADDR_UNDEF, -1, (uint64_t)0, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_evict_cache_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_expunge_entry_log_msg
+ *
+ * Purpose:     Write a log message for expunge of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address,
+    int type_id, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_EXPUNGE_ENTRY, address, type_id, (uint64_t)0, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_expunge_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_flush_cache_log_msg
+ *
+ * Purpose:     Write a log message for cache flushes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_FLUSH_CACHE, HADDR_UNDEF, -1, (uint64_t)0, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_flush_cache_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_insert_entry_log_msg
+ *
+ * Purpose:     Write a log message for insertion of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address,
+    int type_id, unsigned flags, size_t size, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_INSERT_ENTRY, address, type_id, (uint64_t)size, flags, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_insert_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_dirty_log_msg
+ *
+ * Purpose:     Write a log message for marking cache entries as dirty.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_dirty_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_MARK_ENTRY_DIRTY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_dirty_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_clean_log_msg
+ *
+ * Purpose:     Write a log message for marking cache entries as clean.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_clean_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_MARK_ENTRY_CLEAN, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_clean_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_unserialized_entry_log_msg
+ *
+ * Purpose:     Write a log message for marking cache entries as unserialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_unserialized_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_MARK_UNSERIALIZED_ENTRY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_unserialized_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_serialized_entry_log_msg
+ *
+ * Purpose:     Write a log message for marking cache entries as serialize.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_serialized_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_MARK_SERIALIZED_ENTRY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_serialized_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_move_entry_log_msg
+ *
+ * Purpose:     Write a log message for moving a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr,
+    haddr_t new_addr, int type_id, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_MOVE_ENTRY, old_addr, type_id, (uint64_t)new_addr, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_move_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_pin_entry_log_msg
+ *
+ * Purpose:     Write a log message for pinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_pin_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_PIN_ENTRY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_pin_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_fd_log_msg
+ *
+ * Purpose:     Write a log message for creating a flush dependency between
+ *              two cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_fd_log_msg(void *udata,
+    const H5C_cache_entry_t *parent, const H5C_cache_entry_t *child,
+    herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(parent);
+    HDassert(child);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_CREATE_FD, parent->addr, parent->type->id, (uint64_t)child->addr, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_fd_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_protect_entry_log_msg
+ *
+ * Purpose:     Write a log message for protecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_protect_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, int type_id, unsigned flags,
+    herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record; the entry is NULL if the protect failed */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_PROTECT_ENTRY,
+            (entry ? entry->addr : HADDR_UNDEF), type_id,
+            (uint64_t)(entry ? entry->size : 0), flags, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_protect_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_resize_entry_log_msg
+ *
+ * Purpose:     Write a log message for resizing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_resize_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, size_t new_size, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_RESIZE_ENTRY, entry->addr, entry->type->id, (uint64_t)new_size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_resize_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unpin_entry_log_msg
+ *
+ * Purpose:     Write a log message for unpinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unpin_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_UNPIN_ENTRY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unpin_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_fd_log_msg
+ *
+ * Purpose:     Write a log message for destroying a flush dependency
+ *              between two cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_fd_log_msg(void *udata,
+    const H5C_cache_entry_t *parent, const H5C_cache_entry_t *child,
+    herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(parent);
+    HDassert(child);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_DESTROY_FD, parent->addr, parent->type->id, (uint64_t)child->addr, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_fd_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unprotect_entry_log_msg
+ *
+ * Purpose:     Write a log message for unprotecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address,
+    int type_id, unsigned flags, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_UNPROTECT_ENTRY, address, type_id, (uint64_t)0, flags, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unprotect_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_set_cache_config_log_msg
+ *
+ * Purpose:     Write a log message for setting the cache configuration.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_set_cache_config_log_msg(void *udata,
+    const H5AC_cache_config_t *config, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(config);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_SET_CACHE_CONFIG, HADDR_UNDEF, -1, (uint64_t)config->max_size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_set_cache_config_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_remove_entry_log_msg
+ *
+ * Purpose:     Write a log message for removing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_remove_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_REMOVE_ENTRY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, fxn_ret_value, 0) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_remove_entry_log_msg() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_evict_entry_log_msg
+ *
+ * Purpose:     Write a log message for the eviction of a cache entry by
+ *              the cache itself.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_evict_entry_log_msg(void *udata,
+    const H5C_cache_entry_t *entry, H5C_log_evict_cause_t cause)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(udata);
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(binary_udata);
+    HDassert(entry);
+
+    /* Write the log record */
+    if(H5C__binary_write_record(binary_udata, H5C_LOG_EVENT_EVICT_ENTRY, entry->addr, entry->type->id, (uint64_t)entry->size, 0, SUCCEED, (unsigned)cause) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_evict_entry_log_msg() */
+
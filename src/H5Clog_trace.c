@@ -130,7 +130,8 @@ static H5C_log_class_t H5C_trace_log_class_g = {
     H5C__trace_write_destroy_fd_log_msg,
     H5C__trace_write_unprotect_entry_log_msg,
     H5C__trace_write_set_cache_config_log_msg,
-    H5C__trace_write_remove_entry_log_msg
+    H5C__trace_write_remove_entry_log_msg,
+    NULL                                /* write evict entry message */
 };
 
 
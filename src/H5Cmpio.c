@@ -59,6 +59,8 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5C__assign_candidates_by_size(H5C_t *cache_ptr, unsigned num_candidates,
+    const haddr_t *candidates_list_ptr, int mpi_size, int *candidate_assignment_table);
 static herr_t H5C__collective_write(H5F_t *f);
 static herr_t H5C__flush_candidate_entries(H5F_t *f, unsigned entries_to_flush[H5C_RING_NTYPES], 
     unsigned entries_to_clear[H5C_RING_NTYPES]);
@@ -231,48 +233,60 @@ H5C_apply_candidate_list(H5F_t * f,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for entries")
     } /* end if */
 
-    n = num_candidates / mpi_size;
-    m = num_candidates % mpi_size;
-    HDassert(n >= 0);
     if(NULL == (candidate_assignment_table = (int *)H5MM_malloc(sizeof(int) * (size_t)(mpi_size + 1))))
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for candidate assignment table")
 
     candidate_assignment_table[0] = 0;
     candidate_assignment_table[mpi_size] = num_candidates;
 
-    if(m == 0) { /* mpi_size is an even divisor of num_candidates */
-        HDassert(n > 0);
-        for(i = 1; i < mpi_size; i++)
-            candidate_assignment_table[i] = candidate_assignment_table[i - 1] + n;
+    /* When the entries are written collectively, balance the number of
+     * bytes each process contributes to the collective write instead of
+     * the number of entries.  Each process still gets a contiguous range
+     * of the (sorted) candidate list.
+     */
+    if(f->coll_md_write) {
+        if(H5C__assign_candidates_by_size(cache_ptr, num_candidates, candidates_list_ptr, mpi_size, candidate_assignment_table) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't assign candidate entries")
     } /* end if */
-    else { 
-        for(i = 1; i <= m; i++)
-            candidate_assignment_table[i] = candidate_assignment_table[i - 1] + n + 1;
+    else {
+        n = num_candidates / mpi_size;
+        m = num_candidates % mpi_size;
+        HDassert(n >= 0);
 
-        if(num_candidates < mpi_size) {
-            for(i = m + 1; i < mpi_size; i++)
-                candidate_assignment_table[i] = num_candidates;
-        } /* end if */
-        else {
-            for(i = m + 1; i < mpi_size; i++)
+        if(m == 0) { /* mpi_size is an even divisor of num_candidates */
+            HDassert(n > 0);
+            for(i = 1; i < mpi_size; i++)
                 candidate_assignment_table[i] = candidate_assignment_table[i - 1] + n;
+        } /* end if */
+        else { 
+            for(i = 1; i <= m; i++)
+                candidate_assignment_table[i] = candidate_assignment_table[i - 1] + n + 1;
+
+            if(num_candidates < mpi_size) {
+                for(i = m + 1; i < mpi_size; i++)
+                    candidate_assignment_table[i] = num_candidates;
+            } /* end if */
+            else {
+                for(i = m + 1; i < mpi_size; i++)
+                    candidate_assignment_table[i] = candidate_assignment_table[i - 1] + n;
+            } /* end else */
         } /* end else */
-    } /* end else */
-    HDassert((candidate_assignment_table[mpi_size - 1] + n) == num_candidates);
+        HDassert((candidate_assignment_table[mpi_size - 1] + n) == num_candidates);
 
 #if H5C_DO_SANITY_CHECKS
-    /* Verify that the candidate assignment table has the expected form */
-    for(i = 1; i < mpi_size - 1; i++) {
-        int a, b;
+        /* Verify that the candidate assignment table has the expected form */
+        for(i = 1; i < mpi_size - 1; i++) {
+            int a, b;
 
-        a = candidate_assignment_table[i] - candidate_assignment_table[i - 1];
-        b = candidate_assignment_table[i + 1] - candidate_assignment_table[i];
+            a = candidate_assignment_table[i] - candidate_assignment_table[i - 1];
+            b = candidate_assignment_table[i + 1] - candidate_assignment_table[i];
 
-        HDassert( n + 1 >= a );
-        HDassert( a >= b );
-        HDassert( b >= n );
-    }
+            HDassert( n + 1 >= a );
+            HDassert( a >= b );
+            HDassert( b >= n );
+        }
 #endif /* H5C_DO_SANITY_CHECKS */
+    } /* end else */
 
     first_entry_to_flush = candidate_assignment_table[mpi_rank];
     last_entry_to_flush = candidate_assignment_table[mpi_rank + 1] - 1;
@@ -902,12 +916,97 @@ done:
 } /* H5C_clear_coll_entries */
 
 
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__assign_candidates_by_size
+ *
+ * Purpose:     Construct the candidate assignment table for a candidate
+ *              list which will be written collectively, so that each
+ *              process writes a contiguous range of the candidate list
+ *              holding (approximately) the same number of bytes.
+ *
+ *              Since the candidate list is sorted by address and the
+ *              dirty entries (and their sizes) are the same on all
+ *              processes, every process computes the same table, and
+ *              each process' share of the collective write is a set of
+ *              nearby regions of the file.
+ *
+ *              On entry, the first and last elements of the table must
+ *              be set to 0 and num_candidates.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__assign_candidates_by_size(H5C_t *cache_ptr, unsigned num_candidates,
+    const haddr_t *candidates_list_ptr, int mpi_size, int *candidate_assignment_table)
+{
+    H5C_cache_entry_t  *entry_ptr;
+    size_t             *entry_sizes = NULL;
+    hsize_t             total_size = 0;
+    hsize_t             assigned_size = 0;
+    unsigned            u;
+    int                 i;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cache_ptr != NULL);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(num_candidates > 0);
+    HDassert(candidates_list_ptr != NULL);
+    HDassert(mpi_size > 0);
+    HDassert(candidate_assignment_table != NULL);
+
+    if(NULL == (entry_sizes = (size_t *)H5MM_malloc(sizeof(size_t) * (size_t)num_candidates)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for candidate entry sizes")
+
+    /* Get the sizes of the candidate entries */
+    for(u = 0; u < num_candidates; u++) {
+        H5C__SEARCH_INDEX(cache_ptr, candidates_list_ptr[u], entry_ptr, FAIL)
+        if(entry_ptr == NULL)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "listed candidate entry not in cache?!?!?")
+
+        entry_sizes[u] = entry_ptr->size;
+        total_size += entry_ptr->size;
+    } /* end for */
+
+    /* Each process starts writing at the first entry beyond the bytes
+     * assigned to the lower ranks
+     */
+    u = 0;
+    for(i = 1; i < mpi_size; i++) {
+        hsize_t target_size = ((total_size / (hsize_t)mpi_size) * (hsize_t)i) +
+                (((total_size % (hsize_t)mpi_size) * (hsize_t)i) / (hsize_t)mpi_size);
+
+        while(u < num_candidates && assigned_size < target_size)
+            assigned_size += entry_sizes[u++];
+        candidate_assignment_table[i] = (int)u;
+    } /* end for */
+    HDassert(candidate_assignment_table[mpi_size] == (int)num_candidates);
+
+done:
+    H5MM_xfree(entry_sizes);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__assign_candidates_by_size() */
+
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C__collective_write
  *
  * Purpose:     Perform a collective write of a list of metadata entries.
  *
+ *              The entries are written in address order with a single
+ *              collective write.  Entries which are adjacent in the file
+ *              are merged into a single region of the file datatype, so
+ *              the MPI-IO layer sees a few large regions instead of many
+ *              small ones.  Processes with no entries to write still
+ *              take part in the collective write, with an empty request.
+ *
  * Return:      FAIL if error is detected, SUCCEED otherwise.
  *
  * Programmer:  Mohamad Chaarawi
@@ -921,8 +1020,10 @@ H5C__collective_write(H5F_t *f)
     H5AC_t              *cache_ptr;
     H5FD_mpio_xfer_t    orig_xfer_mode = H5FD_MPIO_COLLECTIVE;
     int                 count;
+    int                 file_count;
     int                 *length_array = NULL;
     MPI_Aint            *buf_array = NULL;
+    int                 *file_length_array = NULL;
     MPI_Aint            *offset_array = NULL;
     MPI_Datatype        btype;
     hbool_t             btype_created = FALSE;
@@ -962,6 +1063,8 @@ H5C__collective_write(H5F_t *f)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for collective write table length array")
         if(NULL == (buf_array = (MPI_Aint *)H5MM_malloc((size_t)count * sizeof(MPI_Aint))) )
             HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for collective buf table length array")
+        if(NULL == (file_length_array = (int *)H5MM_malloc((size_t)count * sizeof(int))) )
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for collective file table length array")
         if(NULL == (offset_array = (MPI_Aint *)H5MM_malloc((size_t)count * sizeof(MPI_Aint))) )
             HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for collective offset table length array")
 
@@ -975,7 +1078,9 @@ H5C__collective_write(H5F_t *f)
         length_array[0] = (int)entry_ptr->size;
         base_buf = entry_ptr->image_ptr;
         buf_array[0] = (MPI_Aint)0;
+        file_length_array[0] = (int)entry_ptr->size;
         offset_array[0] = (MPI_Aint)entry_ptr->addr;
+        file_count = 1;
 
         node = H5SL_next(node);
         i = 1;
@@ -987,7 +1092,18 @@ H5C__collective_write(H5F_t *f)
             /* Set up array position */
             length_array[i] = (int)entry_ptr->size;
             buf_array[i] = (MPI_Aint)entry_ptr->image_ptr - (MPI_Aint)base_buf;
-            offset_array[i] = (MPI_Aint)entry_ptr->addr;
+
+            /* Merge the entry with the previous file region if they are
+             * adjacent (the list is sorted by address)
+             */
+            if((offset_array[file_count - 1] + (MPI_Aint)file_length_array[file_count - 1]) == (MPI_Aint)entry_ptr->addr
+                    && ((size_t)file_length_array[file_count - 1] + entry_ptr->size) <= (size_t)INT_MAX)
+                file_length_array[file_count - 1] += (int)entry_ptr->size;
+            else {
+                file_length_array[file_count] = (int)entry_ptr->size;
+                offset_array[file_count] = (MPI_Aint)entry_ptr->addr;
+                file_count++;
+            } /* end else */
 
             /* Advance to next node & array location */
             node = H5SL_next(node);
@@ -1004,7 +1120,7 @@ H5C__collective_write(H5F_t *f)
             HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
 
         /* Create file MPI type */
-        if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(count, length_array, offset_array, MPI_BYTE, &ftype)))
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(file_count, file_length_array, offset_array, MPI_BYTE, &ftype)))
             HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
 
         ftype_created = TRUE;
@@ -1022,47 +1138,27 @@ H5C__collective_write(H5F_t *f)
 
     } /* end if */
     else {
-        MPI_Status mpi_stat;
-        MPI_File *mpi_fh_p;
-        MPI_File mpi_fh;
-        MPI_Info *info_p;
-        MPI_Info info;
-
-/* This should be rewritten to call H5F_block_write, with the correct
- *      buffer and file datatypes (null ones).  -QAK, 2018/02/21
- */
-        if(H5F_get_mpi_handle(f, (MPI_File **)&mpi_fh_p) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get mpi file handle")
-
-        mpi_fh = *(MPI_File*)mpi_fh_p;
-
-        if(H5F_get_mpi_info(f, &info_p) < 0)
-            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get mpi file info")
-
-        info = *info_p;
-
-        /* just to match up with the 1st MPI_File_set_view from 
-         * H5FD_mpio_write() 
-         */
-        if(MPI_SUCCESS != (mpi_code = MPI_File_set_view(mpi_fh, (MPI_Offset)0, MPI_BYTE, MPI_BYTE, "native", info)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+        H5FD_mpio_xfer_t    xfer_mode = H5FD_MPIO_COLLECTIVE;
+        uint8_t             unused;         /* (Non-NULL buffer for empty write) */
 
-        /* just to match up with MPI_File_write_at_all from H5FD_mpio_write() */
-        HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
-        if(MPI_SUCCESS != (mpi_code = MPI_File_write_at_all(mpi_fh, (MPI_Offset)0, NULL, 0, MPI_BYTE, &mpi_stat)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at_all failed", mpi_code)
+        /* Set new transfer mode */
+        if(H5CX_set_io_xfer_mode(xfer_mode) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
 
-        /* just to match up with the 2nd MPI_File_set_view (reset) in 
-         * H5FD_mpio_write() 
+        /* Participate in the collective write with an empty request, going
+         * through the file driver so it matches the other processes' writes
          */
-        if(MPI_SUCCESS != (mpi_code = MPI_File_set_view(mpi_fh, (MPI_Offset)0, MPI_BYTE, MPI_BYTE, "native", info)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+        if(H5CX_set_mpi_coll_datatypes(MPI_BYTE, MPI_BYTE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "can't set MPI-I/O properties")
+        if(H5F_block_write(f, H5FD_MEM_DEFAULT, (haddr_t)0, (size_t)0, &unused) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to write entries collectively")
     } /* end else */
 
 done:
     /* Free arrays */
     length_array = (int *)H5MM_xfree(length_array);
     buf_array = (MPI_Aint *)H5MM_xfree(buf_array);
+    file_length_array = (int *)H5MM_xfree(file_length_array);
     offset_array = (MPI_Aint *)H5MM_xfree(offset_array);
 
     /* Free MPI Types */
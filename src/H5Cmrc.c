@@ -0,0 +1,541 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Cmrc.c
+ *
+ * Purpose:     Functions in this file estimate the miss rate curves of
+ *              the metadata cache, which the H5C_incr__miss_rate_curve
+ *              and H5C_decr__miss_rate_curve automatic resize modes use
+ *              to choose the cache's size and the room reserved for each
+ *              type of entry.  See the description of H5C_mrc_t in
+ *              H5Cpkg.h.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Cmodule.h"          /* This source code file is part of the H5C module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Cpkg.h"		/* Cache				*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Hash function for the shadow stack's index.  Sampled addresses share the
+ * top H5C__MRC_SAMPLE_SHIFT bits of their hash, so use the bits below them.
+ */
+#define H5C__MRC_HASH_FCN(addr)                                              \
+    ((int)(((((uint64_t)(addr)) * (uint64_t)0x9E3779B97F4A7C15ULL)          \
+            >> 32) & (H5C__MRC_SHADOW_HASH_LEN - 1)))
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void H5C__mrc_reset(H5C_mrc_t *mrc);
+static void H5C__mrc_unlink(H5C_mrc_t *mrc, H5C_mrc_shadow_t *shadow);
+static H5C_mrc_shadow_t *H5C__mrc_search(const H5C_mrc_t *mrc, haddr_t addr);
+static size_t H5C__mrc_knee(const double hist[H5C__MRC_NBUCKETS],
+    double accesses, size_t bucket_size);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5C_mrc_t struct */
+H5FL_DEFINE_STATIC(H5C_mrc_t);
+
+/* Declare a free list to manage the H5C_mrc_shadow_t struct */
+H5FL_DEFINE_STATIC(H5C_mrc_shadow_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_configure
+ *
+ * Purpose:     Set up the miss rate curve estimation for the cache's
+ *              current automatic resize configuration: start it afresh
+ *              if either the incr_mode or the decr_mode is a miss rate
+ *              curve mode, and release it otherwise.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_configure(H5C_t *cache_ptr)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if((cache_ptr->resize_ctl).incr_mode == H5C_incr__miss_rate_curve ||
+            (cache_ptr->resize_ctl).decr_mode == H5C_decr__miss_rate_curve) {
+        if(NULL == cache_ptr->mrc) {
+            if(NULL == (cache_ptr->mrc = H5FL_CALLOC(H5C_mrc_t)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate miss rate curve info")
+        } /* end if */
+        else
+            H5C__mrc_reset(cache_ptr->mrc);
+
+        /* Divide the range of cache sizes among the histograms' buckets */
+        cache_ptr->mrc->bucket_size = (cache_ptr->resize_ctl).max_size / H5C__MRC_NBUCKETS;
+        if(cache_ptr->mrc->bucket_size == 0)
+            cache_ptr->mrc->bucket_size = 1;
+    } /* end if */
+    else if(cache_ptr->mrc)
+        if(H5C__mrc_dest(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTRELEASE, FAIL, "can't release miss rate curve info")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5C__mrc_configure() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_dest
+ *
+ * Purpose:     Release the cache's miss rate curve estimation, if any.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_dest(H5C_t *cache_ptr)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if(cache_ptr->mrc) {
+        H5C__mrc_reset(cache_ptr->mrc);
+        cache_ptr->mrc = H5FL_FREE(H5C_mrc_t, cache_ptr->mrc);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5C__mrc_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_reset
+ *
+ * Purpose:     Empty the shadow stack and clear the histograms and
+ *              reservations.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__mrc_reset(H5C_mrc_t *mrc)
+{
+    H5C_mrc_shadow_t *shadow;           /* Current shadow stack entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mrc);
+
+    shadow = mrc->head;
+    while(shadow) {
+        H5C_mrc_shadow_t *next = shadow->next;
+
+        shadow = H5FL_FREE(H5C_mrc_shadow_t, shadow);
+        shadow = next;
+    } /* end while */
+
+    HDmemset(mrc, 0, sizeof(H5C_mrc_t));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5C__mrc_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_search
+ *
+ * Purpose:     Look up an address in the shadow stack.
+ *
+ * Return:      The shadow stack entry for the address, or NULL if there
+ *              is none.
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5C_mrc_shadow_t *
+H5C__mrc_search(const H5C_mrc_t *mrc, haddr_t addr)
+{
+    H5C_mrc_shadow_t *shadow;           /* Current shadow stack entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    shadow = mrc->index[H5C__MRC_HASH_FCN(addr)];
+    while(shadow && !H5F_addr_eq(shadow->addr, addr))
+        shadow = shadow->ht_next;
+
+    FUNC_LEAVE_NOAPI(shadow)
+} /* end H5C__mrc_search() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_unlink
+ *
+ * Purpose:     Remove an entry from the shadow stack and its index.  The
+ *              entry itself is not freed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__mrc_unlink(H5C_mrc_t *mrc, H5C_mrc_shadow_t *shadow)
+{
+    H5C_mrc_shadow_t **ht_ptr;          /* Link to the entry in its hash bucket */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mrc);
+    HDassert(shadow);
+    HDassert(mrc->len > 0);
+    HDassert(mrc->size >= shadow->size);
+
+    /* Remove from the stack */
+    if(shadow->prev)
+        shadow->prev->next = shadow->next;
+    else
+        mrc->head = shadow->next;
+    if(shadow->next)
+        shadow->next->prev = shadow->prev;
+    else
+        mrc->tail = shadow->prev;
+    mrc->len--;
+    mrc->size -= shadow->size;
+
+    /* Remove from the index */
+    ht_ptr = &mrc->index[H5C__MRC_HASH_FCN(shadow->addr)];
+    while(*ht_ptr != shadow) {
+        HDassert(*ht_ptr);
+        ht_ptr = &(*ht_ptr)->ht_next;
+    } /* end while */
+    *ht_ptr = shadow->ht_next;
+
+    shadow->next = shadow->prev = shadow->ht_next = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5C__mrc_unlink() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_access
+ *
+ * Purpose:     Record an access to a cache entry for the miss rate curves.
+ *
+ *              If the entry's address is in the sample, its reuse
+ *              distance is added to the histograms (unless count is
+ *              FALSE, as for insertions of new entries, which are not
+ *              hits or misses), and the entry is moved to the top of
+ *              the shadow stack.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_access(H5C_t *cache_ptr, const H5C_cache_entry_t *entry_ptr,
+    hbool_t count)
+{
+    H5C_mrc_t *mrc;                     /* Miss rate curve info */
+    H5C_mrc_shadow_t *shadow;           /* Shadow stack entry for the entry */
+    int type_id;                        /* Entry's type */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->mrc);
+    HDassert(entry_ptr);
+    HDassert(entry_ptr->type);
+
+    /* Only sampled entries are tracked */
+    if(!H5C__MRC_SAMPLED(entry_ptr->addr))
+        HGOTO_DONE(SUCCEED)
+
+    mrc = cache_ptr->mrc;
+    type_id = entry_ptr->type->id;
+    HDassert(type_id >= 0 && type_id < H5C__MAX_NUM_TYPE_IDS);
+
+    if(NULL != (shadow = H5C__mrc_search(mrc, entry_ptr->addr))) {
+        if(count) {
+            H5C_mrc_shadow_t *curr;     /* Entry accessed more recently */
+            size_t dist = 0;            /* Reuse distance */
+            size_t type_dist = 0;       /* Reuse distance within the type */
+            size_t bucket;              /* Histogram bucket */
+
+            /* Sum the sizes of the sampled entries accessed since */
+            for(curr = mrc->head; curr != shadow; curr = curr->next) {
+                dist += curr->size;
+                if(curr->type_id == type_id)
+                    type_dist += curr->size;
+            } /* end for */
+
+            /* Scale by the sampling rate and add the entry's own size */
+            dist = (dist << H5C__MRC_SAMPLE_SHIFT) + entry_ptr->size;
+            type_dist = (type_dist << H5C__MRC_SAMPLE_SHIFT) + entry_ptr->size;
+
+            if((bucket = dist / mrc->bucket_size) < H5C__MRC_NBUCKETS)
+                mrc->hist[type_id][bucket] += (double)1.0f;
+            if((bucket = type_dist / mrc->bucket_size) < H5C__MRC_NBUCKETS)
+                mrc->type_hist[type_id][bucket] += (double)1.0f;
+            mrc->accesses[type_id] += (double)1.0f;
+        } /* end if */
+
+        H5C__mrc_unlink(mrc, shadow);
+    } /* end if */
+    else {
+        /* First access since the entry left the shadow stack: a miss at any size */
+        if(count)
+            mrc->accesses[type_id] += (double)1.0f;
+
+        if(NULL == (shadow = H5FL_MALLOC(H5C_mrc_shadow_t)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate shadow stack entry")
+        shadow->addr = entry_ptr->addr;
+    } /* end else */
+
+    /* Push the entry on top of the shadow stack */
+    shadow->size = entry_ptr->size;
+    shadow->type_id = type_id;
+    shadow->prev = NULL;
+    shadow->next = mrc->head;
+    if(mrc->head)
+        mrc->head->prev = shadow;
+    else
+        mrc->tail = shadow;
+    mrc->head = shadow;
+    shadow->ht_next = mrc->index[H5C__MRC_HASH_FCN(shadow->addr)];
+    mrc->index[H5C__MRC_HASH_FCN(shadow->addr)] = shadow;
+    mrc->len++;
+    mrc->size += shadow->size;
+
+    /* Drop the entries that are too far down the stack to hit in a cache
+     * of the maximum size.
+     */
+    while(mrc->tail && (mrc->len > H5C__MRC_MAX_SHADOW_ENTRIES ||
+            (mrc->size << H5C__MRC_SAMPLE_SHIFT) > (cache_ptr->resize_ctl).max_size)) {
+        H5C_mrc_shadow_t *tail = mrc->tail;
+
+        H5C__mrc_unlink(mrc, tail);
+        tail = H5FL_FREE(H5C_mrc_shadow_t, tail);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5C__mrc_access() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_remove
+ *
+ * Purpose:     Forget an address that no longer holds the entry tracked
+ *              in the shadow stack, e.g. because the entry was moved.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_remove(H5C_t *cache_ptr, haddr_t addr)
+{
+    H5C_mrc_shadow_t *shadow;           /* Shadow stack entry for the address */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->mrc);
+
+    if(H5C__MRC_SAMPLED(addr) && NULL != (shadow = H5C__mrc_search(cache_ptr->mrc, addr))) {
+        H5C__mrc_unlink(cache_ptr->mrc, shadow);
+        shadow = H5FL_FREE(H5C_mrc_shadow_t, shadow);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5C__mrc_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_knee
+ *
+ * Purpose:     Find the knee of a miss rate curve: the smallest cache
+ *              size whose estimated hits are within H5C__MRC_KNEE_SLACK
+ *              of all accesses of the estimated hits at the maximum size.
+ *
+ * Return:      The size of the knee
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5C__mrc_knee(const double hist[H5C__MRC_NBUCKETS], double accesses,
+    size_t bucket_size)
+{
+    double best = (double)0.0f;         /* Hits at the maximum size */
+    double hits = (double)0.0f;         /* Hits at the current size */
+    int knee = H5C__MRC_NBUCKETS - 1;   /* Bucket of the knee */
+    int i;                              /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(i = 0; i < H5C__MRC_NBUCKETS; i++)
+        best += hist[i];
+
+    for(i = 0; i < H5C__MRC_NBUCKETS - 1; i++) {
+        hits += hist[i];
+        if(hits >= best - (H5C__MRC_KNEE_SLACK * accesses)) {
+            knee = i;
+            break;
+        } /* end if */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI((size_t)(knee + 1) * bucket_size)
+} /* end H5C__mrc_knee() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_estimate_size
+ *
+ * Purpose:     At the end of an epoch, compute the cache size indicated
+ *              by the miss rate curve of all entries -- its knee, plus
+ *              the empty_reserve if enabled, clipped to [min_size,
+ *              max_size] -- and return it in *new_size_ptr, or return 0
+ *              there if too few accesses have been sampled so far.
+ *
+ *              When the decr_mode is H5C_decr__miss_rate_curve, the
+ *              room reserved for each entry type is also updated from
+ *              the knees of the types' own miss rate curves, scaled down
+ *              if needed to fit in H5C__MRC_MAX_RESERVED_FRACTION of the
+ *              new size.
+ *
+ *              The histograms are then decayed for the next epoch.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_estimate_size(H5C_t *cache_ptr, size_t *new_size_ptr)
+{
+    H5C_mrc_t *mrc;                     /* Miss rate curve info */
+    double hist[H5C__MRC_NBUCKETS];     /* Histogram of all entries */
+    double accesses = (double)0.0f;     /* Accesses to all entries */
+    size_t new_size;                    /* Estimated cache size */
+    int i, j;                           /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->mrc);
+    HDassert(new_size_ptr);
+
+    mrc = cache_ptr->mrc;
+    *new_size_ptr = 0;
+
+    /* Combine the histograms of all types */
+    HDmemset(hist, 0, sizeof(hist));
+    for(i = 0; i < H5C__MAX_NUM_TYPE_IDS; i++) {
+        accesses += mrc->accesses[i];
+        for(j = 0; j < H5C__MRC_NBUCKETS; j++)
+            hist[j] += mrc->hist[i][j];
+    } /* end for */
+
+    /* Wait for enough samples to draw the curve from */
+    if(accesses < (double)H5C__MRC_MIN_SAMPLES)
+        HGOTO_DONE(SUCCEED)
+
+    new_size = H5C__mrc_knee(hist, accesses, mrc->bucket_size);
+    if((cache_ptr->resize_ctl).apply_empty_reserve) {
+        HDassert((cache_ptr->resize_ctl).empty_reserve < (double)1.0f);
+        new_size = (size_t)((double)new_size / (1 - (cache_ptr->resize_ctl).empty_reserve));
+    } /* end if */
+    if(new_size < (cache_ptr->resize_ctl).min_size)
+        new_size = (cache_ptr->resize_ctl).min_size;
+    if(new_size > (cache_ptr->resize_ctl).max_size)
+        new_size = (cache_ptr->resize_ctl).max_size;
+    *new_size_ptr = new_size;
+
+    /* Update the per type reservations */
+    if((cache_ptr->resize_ctl).decr_mode == H5C_decr__miss_rate_curve) {
+        size_t max_reserved = (size_t)((double)new_size * H5C__MRC_MAX_RESERVED_FRACTION);
+        size_t total_reserved = 0;
+
+        for(i = 0; i < H5C__MAX_NUM_TYPE_IDS; i++) {
+            if(mrc->accesses[i] >= (double)1.0f)
+                mrc->reserved_size[i] = H5C__mrc_knee(mrc->type_hist[i], mrc->accesses[i], mrc->bucket_size);
+            else
+                mrc->reserved_size[i] = 0;
+            total_reserved += mrc->reserved_size[i];
+        } /* end for */
+
+        if(total_reserved > max_reserved)
+            for(i = 0; i < H5C__MAX_NUM_TYPE_IDS; i++)
+                mrc->reserved_size[i] = (size_t)((double)mrc->reserved_size[i] *
+                        ((double)max_reserved / (double)total_reserved));
+    } /* end if */
+
+    /* Decay the histograms, so that the curves follow changes in the workload */
+    for(i = 0; i < H5C__MAX_NUM_TYPE_IDS; i++) {
+        mrc->accesses[i] /= (double)2.0f;
+        for(j = 0; j < H5C__MRC_NBUCKETS; j++) {
+            mrc->hist[i][j] /= (double)2.0f;
+            mrc->type_hist[i][j] /= (double)2.0f;
+        } /* end for */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5C__mrc_estimate_size() */
+
@@ -54,6 +54,34 @@
 /* Initial allocated size of the "flush_dep_parent" array */
 #define H5C_FLUSH_DEP_PARENT_INIT 8
 
+/* Maximum ring allowed in image */
+#define H5C_MAX_RING_IN_IMAGE   H5C_RING_MDFSM
+
+/* Miss rate curve estimation settings */
+#define H5C__MRC_SAMPLE_SHIFT           4       /* Sample 1 in 2^4 addresses */
+#define H5C__MRC_SHADOW_HASH_LEN        1024    /* must be a power of 2 */
+#define H5C__MRC_MAX_SHADOW_ENTRIES     4096
+#define H5C__MRC_NBUCKETS               64
+#define H5C__MRC_MIN_SAMPLES            64
+#define H5C__MRC_KNEE_SLACK             ((double)0.01f)
+#define H5C__MRC_MAX_RESERVED_FRACTION  ((double)0.5f)
+
+/* Whether an entry's accesses are sampled for the miss rate curves.  The
+ * address is hashed first, as metadata addresses tend to be aligned.
+ */
+#define H5C__MRC_SAMPLED(addr)                                               \
+    (((((uint64_t)(addr)) * (uint64_t)0x9E3779B97F4A7C15ULL)                 \
+      >> (64 - H5C__MRC_SAMPLE_SHIFT)) == 0)
+
+/* Whether an entry's type is within the room reserved for it from its miss
+ * rate curve, in which case clean entries of the type are not evicted to
+ * make space while entries of other types can be.
+ */
+#define H5C__MRC_ENTRY_IS_RESERVED(cache_ptr, entry_ptr)                     \
+    ( ((cache_ptr)->mrc != NULL) &&                                          \
+      ((cache_ptr)->index_type_size[(entry_ptr)->type->id] <=                \
+       (cache_ptr)->mrc->reserved_size[(entry_ptr)->type->id]) )
+
 /****************************************************************************
  *
  * We maintain doubly linked lists of instances of H5C_cache_entry_t for a
@@ -1335,6 +1363,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])++;                        \
     ((cache_ptr)->index_ring_size[entry_ptr->ring])                          \
             += (entry_ptr)->size;                                            \
+    ((cache_ptr)->index_type_size[(entry_ptr)->type->id])                    \
+            += (entry_ptr)->size;                                            \
     if((entry_ptr)->is_dirty) {                                              \
         (cache_ptr)->dirty_index_size += (entry_ptr)->size;                  \
         ((cache_ptr)->dirty_index_ring_size[entry_ptr->ring])                \
@@ -1373,6 +1403,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])--;                        \
     ((cache_ptr)->index_ring_size[entry_ptr->ring])                          \
             -= (entry_ptr)->size;                                            \
+    ((cache_ptr)->index_type_size[(entry_ptr)->type->id])                    \
+            -= (entry_ptr)->size;                                            \
     if((entry_ptr)->is_dirty) {                                              \
         (cache_ptr)->dirty_index_size -= (entry_ptr)->size;                  \
         ((cache_ptr)->dirty_index_ring_size[entry_ptr->ring])                \
@@ -1481,6 +1513,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
     (cache_ptr)->index_size += (new_size);                                  \
     ((cache_ptr)->index_ring_size[entry_ptr->ring]) -= (old_size);          \
     ((cache_ptr)->index_ring_size[entry_ptr->ring]) += (new_size);          \
+    ((cache_ptr)->index_type_size[(entry_ptr)->type->id]) -= (old_size);    \
+    ((cache_ptr)->index_type_size[(entry_ptr)->type->id]) += (new_size);    \
     if(was_clean) {                                                         \
         (cache_ptr)->clean_index_size -= (old_size);                        \
         ((cache_ptr)->clean_index_ring_size[entry_ptr->ring])-= (old_size); \
@@ -3453,6 +3487,86 @@ typedef struct H5C_tag_info_t {
 } H5C_tag_info_t;
 
 
+/****************************************************************************
+ *
+ * structure H5C_mrc_t
+ *
+ * Structure used to estimate the cache's miss rate curves -- the hit rate
+ * the cache would have achieved over the current epoch at each size up to
+ * its maximum size -- for the H5C_incr__miss_rate_curve and
+ * H5C_decr__miss_rate_curve resize modes.
+ *
+ * The estimate follows the spatially hashed sampling approach: only
+ * entries whose hashed address falls in a 1 in 2^H5C__MRC_SAMPLE_SHIFT
+ * sample are tracked, in a "shadow" LRU stack that outlives their
+ * eviction from the cache.  The reuse distance of an access to a sampled
+ * entry -- the number of bytes of distinct entries accessed since its
+ * previous access, plus its own size -- is estimated by scaling the sizes
+ * of the more recent entries in the shadow stack by the sampling rate.
+ * An access hits in an LRU cache of any size at least its reuse distance.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * bucket_size: Number of bytes of cache size covered by each bucket of
+ *		the histograms below, i.e. max_size / H5C__MRC_NBUCKETS.
+ *
+ * head: Most recently used entry of the shadow stack.
+ *
+ * tail: Least recently used entry of the shadow stack.
+ *
+ * len: Number of entries in the shadow stack.
+ *
+ * size: Sum of the sizes of the entries in the shadow stack.  The
+ *		least recently used entries are dropped when this, scaled
+ *		by the sampling rate, exceeds max_size, or when len exceeds
+ *		H5C__MRC_MAX_SHADOW_ENTRIES.
+ *
+ * index: Hash table of the entries of the shadow stack by address.
+ *
+ * accesses: Array of the number of sampled accesses in the current epoch
+ *		by entry type.
+ *
+ * hist: Array of histograms of the sampled accesses' reuse distances by
+ *		entry type.  Bucket i counts accesses that would hit in a
+ *		cache of (i + 1) * bucket_size bytes, but not in a smaller
+ *		one.  Accesses that miss in a cache of max_size bytes are
+ *		only counted in accesses.
+ *
+ * type_hist: Array of histograms like hist, but counting only the
+ *		entries of the accessed entry's own type in the reuse
+ *		distances.
+ *
+ * Histograms are halved rather than cleared at the end of each epoch, so
+ * that the curves change smoothly from epoch to epoch.
+ *
+ * reserved_size: Array of the number of bytes of the cache reserved for
+ *		each entry type, computed at the end of each epoch from the
+ *		knees of the type's own miss rate curve.
+ *
+ ****************************************************************************/
+typedef struct H5C_mrc_shadow_t {
+    haddr_t addr;                       /* Address of the sampled entry */
+    size_t size;                        /* Size of the sampled entry */
+    int type_id;                        /* Type of the sampled entry */
+    struct H5C_mrc_shadow_t *next;      /* Next (less recently used) entry */
+    struct H5C_mrc_shadow_t *prev;      /* Previous (more recently used) entry */
+    struct H5C_mrc_shadow_t *ht_next;   /* Next entry in the hash bucket */
+} H5C_mrc_shadow_t;
+
+typedef struct H5C_mrc_t {
+    size_t bucket_size;
+    H5C_mrc_shadow_t *head;
+    H5C_mrc_shadow_t *tail;
+    uint32_t len;
+    size_t size;
+    H5C_mrc_shadow_t *index[H5C__MRC_SHADOW_HASH_LEN];
+    double accesses[H5C__MAX_NUM_TYPE_IDS];
+    double hist[H5C__MAX_NUM_TYPE_IDS][H5C__MRC_NBUCKETS];
+    double type_hist[H5C__MAX_NUM_TYPE_IDS][H5C__MRC_NBUCKETS];
+    size_t reserved_size[H5C__MAX_NUM_TYPE_IDS];
+} H5C_mrc_t;
+
+
 /****************************************************************************
  *
  * structure H5C_t
@@ -3616,6 +3730,11 @@ typedef struct H5C_tag_info_t {
  *		by ring.  Note that the sum of all cells in this array must
  *		equal the value stored in index_size above.
  *
+ * index_type_size: Array of size_t of length H5C__MAX_NUM_TYPE_IDS used
+ *		to maintain the sum of the sizes of all entries in the index
+ *		by entry type.  It is used to enforce the per type
+ *		reservations computed from the miss rate curves.
+ *
  * clean_index_size: Number of bytes of clean entries currently stored in
  * 		the hash table.  Note that the index_size field (above)
  *		is also the sum of the sizes of all entries in the cache.
@@ -4099,6 +4218,11 @@ typedef struct H5C_tag_info_t {
  * resize_ctl:	Instance of H5C_auto_size_ctl_t containing configuration
  * 		data for automatic cache resizing.
  *
+ * mrc:		Pointer to the instance of H5C_mrc_t used to estimate the
+ *		cache's miss rate curves when either the incr_mode or the
+ *		decr_mode in resize_ctl is a miss rate curve mode, and NULL
+ *		otherwise.
+ *
  * epoch_markers_active:  Integer field containing the number of epoch
  *		markers currently in use in the LRU list.  This value
  *		must be in the range [0, H5C__MAX_EPOCH_MARKERS - 1].
@@ -4218,6 +4342,19 @@ typedef struct H5C_tag_info_t {
  *		that are larger than the actual image.  Thus in all 
  *		cases image_data_len <= image_len.
  *
+ * image_is_current: Boolean flag indicating that the metadata cache image
+ *		block at image_addr was written (or read) in incremental
+ *		mode and still matches the file, i.e. no entry in a ring
+ *		included in the image has been written or had its file
+ *		space freed since.  The first such write or free marks the
+ *		on disk image stale and resets this flag, and the next
+ *		flush rewrites the image and sets it again.
+ *
+ *		This flag is only set in incremental mode (see the 
+ *		incremental field of H5C_cache_image_ctl_t), i.e. when the
+ *		image is written, or when a file opened R/W in that mode
+ *		loads an incremental image and keeps it in the file.
+ *
  * To create the metadata cache image, we must first serialize all the
  * entries in the metadata cache.  This is done by a scan of the index.
  * As entries must be serialized in increasing flush dependency height
@@ -4662,6 +4799,7 @@ struct H5C_t {
     size_t                      index_size;
     uint32_t			index_ring_len[H5C_RING_NTYPES];
     size_t			index_ring_size[H5C_RING_NTYPES];
+    size_t			index_type_size[H5C__MAX_NUM_TYPE_IDS];
     size_t 			clean_index_size;
     size_t			clean_index_ring_size[H5C_RING_NTYPES];
     size_t			dirty_index_size;
@@ -4748,6 +4886,7 @@ struct H5C_t {
     hbool_t			resize_in_progress;
     hbool_t			msic_in_progress;
     H5C_auto_size_ctl_t		resize_ctl;
+    H5C_mrc_t *			mrc;
 
     /* Fields for epoch markers used in automatic cache size adjustment */
     int32_t			epoch_markers_active;
@@ -4771,6 +4910,7 @@ struct H5C_t {
     haddr_t 			image_addr;
     hsize_t			image_len;
     hsize_t			image_data_len;
+    hbool_t			image_is_current;
     int64_t			entries_loaded_counter;
     int64_t			entries_inserted_counter;
     int64_t			entries_relocated_counter;
@@ -4889,6 +5029,7 @@ typedef int (*H5C_tag_iter_cb_t)(H5C_cache_entry_t *entry, void *ctx);
 /* Package Private Prototypes */
 /******************************/
 H5_DLL herr_t H5C__prep_image_for_file_close(H5F_t *f, hbool_t *image_generated);
+H5_DLL herr_t H5C__prep_incremental_image_for_file_close(H5F_t *f);
 H5_DLL herr_t H5C__deserialize_prefetched_entry(H5F_t *f, H5C_t * cache_ptr,
     H5C_cache_entry_t** entry_ptr_ptr, const H5C_class_t * type, haddr_t addr,
     void * udata);
@@ -4898,6 +5039,9 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, H5C_cache_entry_t *entry_ptr,
     unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f);
+H5_DLL herr_t H5C__load_prefetched_entry_image(H5F_t *f,
+    H5C_cache_entry_t *entry_ptr);
+H5_DLL herr_t H5C__invalidate_cache_image(H5F_t *f, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, size_t  space_needed,
@@ -4913,6 +5057,14 @@ H5_DLL herr_t H5C__iter_tagged_entries(H5C_t *cache, haddr_t tag, hbool_t match_
 H5_DLL herr_t H5C__tag_entry(H5C_t * cache_ptr, H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__untag_entry(H5C_t *cache, H5C_cache_entry_t *entry);
 
+/* Routines for estimating miss rate curves */
+H5_DLL herr_t H5C__mrc_configure(H5C_t *cache_ptr);
+H5_DLL herr_t H5C__mrc_dest(H5C_t *cache_ptr);
+H5_DLL herr_t H5C__mrc_access(H5C_t *cache_ptr,
+    const H5C_cache_entry_t *entry_ptr, hbool_t count);
+H5_DLL herr_t H5C__mrc_remove(H5C_t *cache_ptr, haddr_t addr);
+H5_DLL herr_t H5C__mrc_estimate_size(H5C_t *cache_ptr, size_t *new_size_ptr);
+
 /* Testing functions */
 #ifdef H5C_TESTING
 H5_DLL herr_t H5C__verify_cork_tag_test(hid_t fid, haddr_t tag, hbool_t status);
@@ -112,7 +112,7 @@
 /* Cache configuration versions */
 #define H5C__CURR_AUTO_SIZE_CTL_VER		1
 #define H5C__CURR_AUTO_RESIZE_RPT_FCN_VER	1
-#define H5C__CURR_CACHE_IMAGE_CTL_VER		1
+#define H5C__CURR_CACHE_IMAGE_CTL_VER		2
 
 /* Default configuration settings */
 #define H5C__DEF_AR_UPPER_THRESHHOLD		0.9999f
@@ -1544,6 +1544,22 @@ typedef int H5C_ring_t;
  *              potential interactions with Evict On Close -- at present,
  *              we deal with this by disabling EOC in the R/O case.
  *
+ * prefetch_image_addr:  Base address of the image of a prefetched entry
+ *		within the on disk metadata cache image block, or HADDR_UNDEF
+ *		if the image of the entry is held in memory.
+ *
+ *		Prefetched entries reconstructed from an incremental cache
+ *		image are inserted without their images, which are only
+ *		read from the cache image block when the entry is first
+ *		deserialized or its image is otherwise needed.  Thus this
+ *		field is only meaningful if prefetched is TRUE and
+ *		image_ptr is NULL.
+ *
+ * prefetch_image_chksum:  Checksum of the image of a prefetched entry as 
+ *		stored in the cache image block index, used to verify the
+ *		image when it is read from prefetch_image_addr.  Only 
+ *		meaningful under the same conditions as prefetch_image_addr.
+ *
  * serialization_count:  Integer field used to maintain a count of the 
  *		number of times each entry is serialized during cache 
  *		serialization.  While no entry should be serialized more than
@@ -1663,6 +1679,8 @@ typedef struct H5C_cache_entry_t {
     int                         prefetch_type_id;
     int32_t                     age;
     hbool_t			prefetched_dirty;
+    haddr_t			prefetch_image_addr;
+    uint32_t			prefetch_image_chksum;
 
 #ifndef NDEBUG	/* debugging field */
     int                         serialization_count;
@@ -1901,7 +1919,7 @@ typedef struct H5C_image_entry_t {
  *
  * incr_mode: Instance of the H5C_cache_incr_mode enumerated type whose
  *	value indicates how we determine whether the cache size should be
- *	increased.  At present there are two possible values:
+ *	increased.  At present there are three possible values:
  *
  *	H5C_incr__off:	Don't attempt to increase the size of the cache
  *		automatically.
@@ -1918,6 +1936,11 @@ typedef struct H5C_image_entry_t {
  *		at its maximum size, or if the cache is not already using
  *		all available space.
  *
+ *	H5C_incr__miss_rate_curve: At the end of each epoch, increase the
+ *		size of the cache to the knee of the miss rate curve
+ *		estimated from sampled reuse distances (see H5C_mrc_t in
+ *		H5Cpkg.h), plus the empty_reserve if enabled.
+ *
  * lower_hr_threshold: Lower hit rate threshold.  If the increment mode
  *	(incr_mode) is H5C_incr__threshold and the hit rate drops below the
  *	value supplied in this field in an epoch, increment the cache size by
@@ -2000,7 +2023,7 @@ typedef struct H5C_image_entry_t {
  *
  * decr_mode: Instance of the H5C_cache_decr_mode enumerated type whose
  *	value indicates how we determine whether the cache size should be
- *	decreased.  At present there are four possibilities.
+ *	decreased.  At present there are five possibilities.
  *
  *	H5C_decr__off:	Don't attempt to decrease the size of the cache
  *		automatically.
@@ -2026,6 +2049,11 @@ typedef struct H5C_image_entry_t {
  *		over the last epoch exceeds the value provided in the
  *		upper_hr_threshold field.
  *
+ *	H5C_decr__miss_rate_curve:  At the end of each epoch, decrease the
+ *		size of the cache to the knee of the estimated miss rate
+ *		curve, plus the empty_reserve if enabled, and reserve room
+ *		for each entry type from the knee of its own curve.
+ *
  * upper_hr_threshold: Upper hit rate threshold.  The use of this field
  *	varies according to the current decr_mode:
  *
@@ -2182,6 +2210,11 @@ typedef struct H5C_auto_size_ctl_t {
  *      current value, any value in excess of 255 will be the functional 
  *      equivalent of H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE.
  *
+ * incremental: Boolean flag indicating whether the cache image is to be
+ *      kept in the file and brought up to date on each flush, instead of
+ *      being written on file close and discarded on the next R/W open.
+ *      See the discussion of H5AC_cache_image_config_t in H5ACpublic.h.
+ *
  * flags: Unsigned integer containing flags controlling which aspects of the
  *	cache image functinality is actually executed.  The primary impetus 
  *	behind this field is to allow development of tests for partial 
@@ -2208,6 +2241,7 @@ typedef struct H5C_auto_size_ctl_t {
     /* generate_image     = */ FALSE,                                 \
     /* save_resize_status = */ FALSE,                                 \
     /* entry_ageout       = */ H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE, \
+    /* incremental        = */ FALSE,                                 \
     /* flags              = */ H5C_CI__ALL_FLAGS                      \
 }
 
@@ -2216,13 +2250,15 @@ typedef struct H5C_cache_image_ctl_t {
     hbool_t				generate_image;
     hbool_t                             save_resize_status;
     int32_t                             entry_ageout;
+    hbool_t                             incremental;
     unsigned				flags;
 } H5C_cache_image_ctl_t;
 
 /* The cache logging output style */
 typedef enum H5C_log_style_t {
     H5C_LOG_STYLE_JSON,
-    H5C_LOG_STYLE_TRACE
+    H5C_LOG_STYLE_TRACE,
+    H5C_LOG_STYLE_BINARY
 } H5C_log_style_t;
 
 /***************************************/
@@ -2296,6 +2332,7 @@ H5_DLL herr_t H5C_unpin_entry(void *thing);
 H5_DLL herr_t H5C_destroy_flush_dependency(void *parent_thing, void *child_thing);
 H5_DLL herr_t H5C_unprotect(H5F_t *f, haddr_t addr, void *thing,
     unsigned int flags);
+H5_DLL herr_t H5C_update_cache_image(H5F_t *f);
 H5_DLL herr_t H5C_validate_cache_image_config(H5C_cache_image_ctl_t * ctl_ptr);
 H5_DLL herr_t H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr,
     unsigned int tests);
@@ -36,7 +36,8 @@ extern "C" {
 enum H5C_cache_incr_mode
 {
     H5C_incr__off,
-    H5C_incr__threshold
+    H5C_incr__threshold,
+    H5C_incr__miss_rate_curve
 };
 
 enum H5C_cache_flash_incr_mode
@@ -50,7 +51,8 @@ enum H5C_cache_decr_mode
     H5C_decr__off,
     H5C_decr__threshold,
     H5C_decr__age_out,
-    H5C_decr__age_out_with_threshold
+    H5C_decr__age_out_with_threshold,
+    H5C_decr__miss_rate_curve
 };
 
 #ifdef __cplusplus
@@ -248,6 +248,9 @@ static herr_t H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *typ
 static herr_t H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
     H5D_chunk_map_t *fm);
+static ssize_t H5D__chunk_packed_writevv(const H5D_io_info_t *io_info,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_size_arr[], hsize_t dset_offset_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_size_arr[], hsize_t mem_offset_arr[]);
 static herr_t H5D__chunk_flush(H5D_t *dset);
 static herr_t H5D__chunk_io_term(const H5D_chunk_map_t *fm);
 static herr_t H5D__chunk_dest(H5D_t *dset);
@@ -268,6 +271,9 @@ static void *H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline);
 static void *H5D__chunk_mem_xfree(void *chk, const H5O_pline_t *pline);
 static void *H5D__chunk_mem_realloc(void *chk, size_t size,
     const H5O_pline_t *pline);
+static void H5D__chunk_mem_release_vlen(const H5D_t *dset, void *chk);
+static herr_t H5D__chunk_release_vlen_cb(void *elem, const H5T_t *type,
+    unsigned ndim, const hsize_t *point, void *op_data);
 static herr_t H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last);
 static herr_t H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last,
     const H5D_chunk_ud_t *udata);
@@ -873,6 +879,25 @@ H5D__chunk_construct(H5F_t H5_ATTR_UNUSED *f, H5D_t *dset)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "chunk size must be <= maximum dimension size for fixed-sized dimensions")
     } /* end for */
 
+    /* Check the restrictions on packing the VL data into the chunks */
+    if(H5Z_filter_in_pline(&dset->shared->dcpl_cache.pline, H5Z_FILTER_VLEN_PACK)) {
+        H5D_fill_value_t fill_status;   /* Whether the fill value is defined */
+
+        /* The other filters must operate on the packed chunks */
+        if(dset->shared->dcpl_cache.pline.filter[0].id != H5Z_FILTER_VLEN_PACK)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "VL pack filter must be the first filter in the pipeline")
+
+        /* Partial edge chunks can't hold pointers to VL data on disk */
+        if(dset->shared->layout.u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "VL pack filter can't be disabled for partial edge chunks")
+
+        /* Fill values would be shared by all the unwritten elements */
+        if(H5P_is_fill_value_defined(&dset->shared->dcpl_cache.fill, &fill_status) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+        if(fill_status == H5D_FILL_VALUE_USER_DEFINED)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "VL pack filter can't be used with a user-defined fill value")
+    } /* end if */
+
     /* Reset address and pointer of the array struct for the chunked storage index */
     if(H5D_chunk_idx_reset(&dset->shared->layout.storage.u.chunk, TRUE) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to reset chunked storage index")
@@ -930,6 +955,16 @@ H5D__chunk_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    /* Elements of a dataset that packs its VL data into its chunks point to
+     * their sequences while the chunks are in memory, so mark its datatype
+     * as held in the chunks.
+     */
+    if(H5Z_filter_in_pline(&dset->shared->dcpl_cache.pline, H5Z_FILTER_VLEN_PACK)) {
+        dset->shared->vlen_packed = TRUE;
+        if(H5T_set_loc(dset->shared->type, f, H5T_LOC_CHUNK) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't set datatype location")
+    } /* end if */
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -1408,6 +1443,56 @@ H5D__chunk_mem_realloc(void *chk, size_t size, const H5O_pline_t *pline)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_mem_realloc() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_mem_release_vlen
+ *
+ * Purpose:     Release the VL data owned by the elements of a chunk in
+ *              memory, for datasets that pack their VL data into their
+ *              chunks.  Must be called before the chunk is freed.
+ *
+ * Return:      None (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_mem_release_vlen(const H5D_t *dset, void *chk)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if(chk && dset->shared->vlen_packed) {
+        const H5O_layout_chunk_t *layout = &(dset->shared->layout.u.chunk);
+        size_t elmt_size = layout->dim[layout->ndims - 1];
+
+        H5T_vlen_chunk_free(chk, (size_t)layout->size / elmt_size, elmt_size);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5D__chunk_mem_release_vlen() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_release_vlen_cb
+ *
+ * Purpose:     Selection iterator callback to release the VL data owned by
+ *              an element of a chunk in memory.
+ *
+ * Return:      Non-negative (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_release_vlen_cb(void *elem, const H5T_t *type,
+    unsigned H5_ATTR_UNUSED ndim, const hsize_t H5_ATTR_UNUSED *point,
+    void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    H5T_vlen_chunk_free(elem, (size_t)1, H5T_GET_SIZE(type));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D__chunk_release_vlen_cb() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -2052,6 +2137,9 @@ htri_t
 H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_op)
 {
     const H5D_t *dataset = io_info->dset; /* Local pointer to dataset info */
+#ifdef H5D_DEFERRED_IO
+    H5D_deferred_io_t *deferred_io;     /* Deferred reads for the H5Dread() call */
+#endif /* H5D_DEFERRED_IO */
     hbool_t has_filters = FALSE;        /* Whether there are filters on the chunk or not */
     htri_t ret_value = FAIL;            /* Return value */
 
@@ -2079,6 +2167,15 @@ H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_
 
     if(has_filters)
         ret_value = TRUE;
+#ifdef H5D_DEFERRED_IO
+    /* If H5Dread() can perform the reads after releasing the library lock,
+     * bypass the chunk cache and read the elements requested directly.
+     * (The file is read-only, so the cache can't hold newer data.)
+     */
+    else if(!write_op && NULL != (deferred_io = H5CX_get_deferred_io())
+            && deferred_io->file == dataset->oloc.file)
+        ret_value = FALSE;
+#endif /* H5D_DEFERRED_IO */
     else {
 #ifdef H5_HAVE_PARALLEL
          /* If MPI based VFD is used and the file is opened for write access, must
@@ -2278,6 +2375,62 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_packed_writevv
+ *
+ * Purpose:	Writes elements into a locked chunk of a dataset that packs
+ *		its VL data into its chunks, releasing the VL data owned by
+ *		the elements being overwritten.  Each element is released
+ *		right before it's overwritten, so elements written more than
+ *		once by the same call are handled correctly.
+ *
+ * Return:	Non-negative # of bytes written on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5D__chunk_packed_writevv(const H5D_io_info_t *io_info,
+    size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_size_arr[], hsize_t dset_offset_arr[],
+    size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_size_arr[], hsize_t mem_offset_arr[])
+{
+    uint8_t *chunk = (uint8_t *)io_info->store->compact.buf;   /* Chunk buffer */
+    const uint8_t *wbuf = (const uint8_t *)io_info->u.wbuf;   /* Buffer of elements to write */
+    const H5O_layout_chunk_t *layout = &(io_info->dset->shared->layout.u.chunk);
+    size_t elmt_size = layout->dim[layout->ndims - 1];    /* Size of an element */
+    ssize_t ret_value = 0;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(io_info->dset->shared->vlen_packed);
+
+    while(*dset_curr_seq < dset_max_nseq && *mem_curr_seq < mem_max_nseq) {
+        size_t len = MIN(dset_size_arr[*dset_curr_seq], mem_size_arr[*mem_curr_seq]);
+
+        /* Sequences are made of whole elements */
+        HDassert(0 == len % elmt_size);
+
+        /* Release the elements' old VL data, then overwrite them */
+        H5T_vlen_chunk_free(chunk + dset_offset_arr[*dset_curr_seq], len / elmt_size, elmt_size);
+        HDmemcpy(chunk + dset_offset_arr[*dset_curr_seq], wbuf + mem_offset_arr[*mem_curr_seq], len);
+
+        /* Advance to the next sequences, as they're used up */
+        dset_offset_arr[*dset_curr_seq] += len;
+        if(0 == (dset_size_arr[*dset_curr_seq] -= len))
+            (*dset_curr_seq)++;
+        mem_offset_arr[*mem_curr_seq] += len;
+        if(0 == (mem_size_arr[*mem_curr_seq] -= len))
+            (*mem_curr_seq)++;
+
+        ret_value += (ssize_t)len;
+    } /* end while */
+
+    /* Mark the chunk's buffer as dirty */
+    *io_info->store->compact.dirty = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_packed_writevv() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_write
@@ -2325,6 +2478,8 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDmemcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
     cpt_io_info.store = &cpt_store;
     cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+    if(io_info->dset->shared->vlen_packed)
+        cpt_io_info.layout_ops.writevv = H5D__chunk_packed_writevv;
 
     /* Initialize temporary compact storage info */
     cpt_store.compact.dirty = &cpt_dirty;
@@ -3048,17 +3203,19 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             if(H5CX_get_filter_cb(&filter_cb) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
 
-            if(!reset) {
+            if(!reset || dset->shared->vlen_packed) {
                 /*
                  * Copy the chunk to a new buffer before running it through
                  * the pipeline because we'll want to save the original buffer
-                 * for later.
+                 * for later.  (When the VL data is packed into the chunks,
+                 * the original buffer holds the pointers to the VL data to
+                 * release when resetting.)
                  */
                 if(NULL == (buf = H5MM_malloc(alloc)))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
                 HDmemcpy(buf, ent->chunk, alloc);
             } /* end if */
-            else {
+            if(reset) {
                 /*
                  * If we are resetting and something goes wrong after this
                  * point then it's too late to recover because we may have
@@ -3067,8 +3224,9 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
                  * even if we can't write the data to disk.
                  */
                 point_of_no_return = TRUE;
-                ent->chunk = NULL;
-            } /* end else */
+                if(buf == ent->chunk)
+                    ent->chunk = NULL;
+            } /* end if */
             H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
             if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask),
                     err_detect, filter_cb, &nbytes, &alloc, &buf) < 0)
@@ -3151,10 +3309,12 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
         point_of_no_return = FALSE;
         if(buf == ent->chunk)
             buf = NULL;
-        if(ent->chunk != NULL)
+        if(ent->chunk != NULL) {
+            H5D__chunk_mem_release_vlen(dset, ent->chunk);
             ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
                     ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
                     : &(dset->shared->dcpl_cache.pline)));
+        } /* end if */
     } /* end if */
 
 done:
@@ -3169,10 +3329,12 @@ done:
      * list.
      */
     if(ret_value < 0 && point_of_no_return)
-        if(ent->chunk)
+        if(ent->chunk) {
+            H5D__chunk_mem_release_vlen(dset, ent->chunk);
             ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
                     ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
                     : &(dset->shared->dcpl_cache.pline)));
+        } /* end if */
 
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__chunk_flush_entry() */
@@ -3212,10 +3374,12 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
     } /* end if */
     else {
         /* Don't flush, just free chunk */
-        if(ent->chunk != NULL)
+        if(ent->chunk != NULL) {
+            H5D__chunk_mem_release_vlen(dset, ent->chunk);
             ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
                     ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
                     : &(dset->shared->dcpl_cache.pline)));
+        } /* end if */
     } /* end else */
 
     /* Unlink from list */
@@ -3761,8 +3925,10 @@ done:
 
     /* Release the chunk allocated, on error */
     if(!ret_value)
-        if(chunk)
+        if(chunk) {
+            H5D__chunk_mem_release_vlen(dset, chunk);
             chunk = H5D__chunk_mem_xfree(chunk, pline);
+        } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_lock() */
@@ -3844,9 +4010,11 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
         } /* end if */
         else {
-            if(chunk)
+            if(chunk) {
+                H5D__chunk_mem_release_vlen(io_info->dset, chunk);
                 chunk = H5D__chunk_mem_xfree(chunk, (is_unfiltered_edge_chunk ? NULL
 			: &(io_info->dset->shared->dcpl_cache.pline)));
+            } /* end if */
         } /* end else */
     } /* end if */
     else {
@@ -4816,6 +4984,18 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
     if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
+    /* Release the VL data of the elements being replaced, if it's packed into the chunk */
+    if(dset->shared->vlen_packed) {
+        H5S_sel_iter_op_t release_op;   /* Selection iteration operator */
+
+        release_op.op_type = H5S_SEL_ITER_OP_LIB;
+        release_op.u.lib_op = H5D__chunk_release_vlen_cb;
+        if(H5S_select_iterate(chunk, dset->shared->type, udata->chunk_space, &release_op, NULL) < 0) {
+            (void)H5D__chunk_unlock(io_info, &chk_udata, FALSE, chunk, (uint32_t)0);
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release VL data")
+        } /* end if */
+    } /* end if */
+
 
     /* Fill the selection in the memory buffer */
     /* Use the size of the elements in the chunk directly instead of */
@@ -5911,7 +6091,9 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register source file datatype")
 
     /* If there's a VLEN source datatype, set up type conversion information */
-    if(H5T_detect_class(dt_src, H5T_VLEN, FALSE) > 0) {
+    /* (VL data packed into the chunks is copied along with them) */
+    if(H5T_detect_class(dt_src, H5T_VLEN, FALSE) > 0
+            && !H5Z_filter_in_pline(pline, H5Z_FILTER_VLEN_PACK)) {
         H5T_t *dt_dst;              /* Destination datatype */
         H5T_t *dt_mem;              /* Memory datatype */
         size_t mem_dt_size;         /* Memory datatype size */
@@ -70,6 +70,15 @@ typedef struct H5D_contig_readvv_ud_t {
     unsigned char *rbuf;        /* Pointer to buffer to fill */
 } H5D_contig_readvv_ud_t;
 
+#ifdef H5D_DEFERRED_IO
+/* Callback info for readvv operation deferred until the library lock is released */
+typedef struct H5D_contig_readvv_deferred_ud_t {
+    H5D_deferred_io_t *deferred_io; /* Deferred reads for the H5Dread() call */
+    haddr_t dset_addr;          /* Address of dataset */
+    unsigned char *rbuf;        /* Pointer to buffer to fill */
+} H5D_contig_readvv_deferred_ud_t;
+#endif /* H5D_DEFERRED_IO */
+
 /* Callback info for sieve buffer writevv operation */
 typedef struct H5D_contig_writevv_sieve_ud_t {
     H5F_t *file;                /* File for dataset */
@@ -877,6 +886,38 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_readvv_cb() */
 
+#ifdef H5D_DEFERRED_IO
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_readvv_deferred_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_readvv() that records the
+ *              read for H5Dread() to perform after it releases the
+ *              library lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_readvv_deferred_cb(hsize_t dst_off, hsize_t src_off, size_t len,
+    void *_udata)
+{
+    H5D_contig_readvv_deferred_ud_t *udata = (H5D_contig_readvv_deferred_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Record the read */
+    if(H5D__deferred_io_add(udata->deferred_io, (udata->dset_addr + dst_off),
+            len, (udata->rbuf + src_off)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't defer block read")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_readvv_deferred_cb() */
+#endif /* H5D_DEFERRED_IO */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv
@@ -901,6 +942,9 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
+#ifdef H5D_DEFERRED_IO
+    H5D_deferred_io_t *deferred_io;     /* Deferred reads for the H5Dread() call */
+#endif /* H5D_DEFERRED_IO */
     ssize_t ret_value = -1;     /* Return value */
 
     FUNC_ENTER_STATIC
@@ -914,6 +958,25 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+#ifdef H5D_DEFERRED_IO
+    /* Check if the reads can be performed outside the library lock */
+    if(NULL != (deferred_io = H5CX_get_deferred_io())
+            && deferred_io->file == io_info->dset->oloc.file) {
+        H5D_contig_readvv_deferred_ud_t udata;  /* User data for H5VM_opvv() operator */
+
+        /* Set up user data for H5VM_opvv() */
+        udata.deferred_io = deferred_io;
+        udata.dset_addr = io_info->store->contig.dset_addr;
+        udata.rbuf = (unsigned char *)io_info->u.rbuf;
+
+        /* Call generic sequence operation routine */
+        if((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
+                mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                H5D__contig_readvv_deferred_cb, &udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't defer vectorized read")
+    } /* end if */
+    else
+#endif /* H5D_DEFERRED_IO */
     /* Check if data sieving is enabled */
     if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata;     /* User data for H5VM_opvv() operator */
@@ -25,6 +25,8 @@
 #include "H5CXprivate.h"        /* API Contexts                             */
 #include "H5Dpkg.h"             /* Dataset functions                        */
 #include "H5Eprivate.h"         /* Error handling                           */
+#include "H5Fprivate.h"         /* File access                              */
+#include "H5FDsec2.h"           /* Posix unbuffered I/O file driver         */
 #include "H5FLprivate.h"        /* Free Lists                               */
 #include "H5Iprivate.h"         /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
@@ -62,6 +64,11 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset,
     const H5S_t *file_space, const H5S_t *mem_space, const H5D_type_info_t *type_info);
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
+#ifdef H5D_DEFERRED_IO
+static herr_t H5D__deferred_io_init(H5D_deferred_io_t *deferred_io,
+    const H5D_t *dset, const H5D_type_info_t *type_info);
+static herr_t H5D__deferred_io_exec(hid_t dset_id, H5D_deferred_io_t *deferred_io);
+#endif /* H5D_DEFERRED_IO */
 
 
 /*********************/
@@ -166,6 +173,10 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     hid_t file_space_id, hid_t dxpl_id, void *buf/*out*/)
 {
     H5VL_object_t  *vol_obj     = NULL;
+#ifdef H5D_DEFERRED_IO
+    H5D_deferred_io_t  deferred_io_buf;     /* Raw data reads performed outside the library lock */
+    H5D_deferred_io_t *deferred_io = NULL;  /* Pointer to deferred reads, once initialized */
+#endif /* H5D_DEFERRED_IO */
     herr_t          ret_value   = SUCCEED;      /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -192,11 +203,29 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
+#ifdef H5D_DEFERRED_IO
+    /* Let the raw data reads be performed after releasing the library lock */
+    HDmemset(&deferred_io_buf, 0, sizeof(deferred_io_buf));
+    deferred_io = &deferred_io_buf;
+    H5CX_set_deferred_io(deferred_io);
+#endif /* H5D_DEFERRED_IO */
+
     /* Read the data */
     if ((ret_value = H5VL_dataset_read(vol_obj, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf, H5_REQUEST_NULL)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
+#ifdef H5D_DEFERRED_IO
+    /* Perform any reads that were deferred */
+    if (deferred_io->nreads > 0 && H5D__deferred_io_exec(dset_id, deferred_io) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+#endif /* H5D_DEFERRED_IO */
+
 done:
+#ifdef H5D_DEFERRED_IO
+    if (deferred_io)
+        H5MM_xfree(deferred_io->reads);
+#endif /* H5D_DEFERRED_IO */
+
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
@@ -490,8 +519,8 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
      * Note that in general, this requires us to touch up the memory buffer as 
      * well.
      */
-    if(TRUE == H5S_select_shape_same(mem_space, file_space) &&
-            H5S_GET_EXTENT_NDIMS(mem_space) != H5S_GET_EXTENT_NDIMS(file_space)) {
+    if(H5S_GET_EXTENT_NDIMS(mem_space) != H5S_GET_EXTENT_NDIMS(file_space) &&
+            TRUE == H5S_select_shape_same(mem_space, file_space)) {
         void *adj_buf = NULL;   /* Pointer to the location in buf corresponding  */
                                 /* to the beginning of the projected mem space.  */
 
@@ -568,6 +597,16 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
 #endif /*H5_HAVE_PARALLEL*/
 
+#ifdef H5D_DEFERRED_IO
+    /* Check if the raw data reads can be performed outside the library lock */
+    {
+        H5D_deferred_io_t *deferred_io = H5CX_get_deferred_io();
+
+        if(deferred_io && H5D__deferred_io_init(deferred_io, dataset, &type_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up deferred reads")
+    }
+#endif /* H5D_DEFERRED_IO */
+
     /* Invoke correct "high level" I/O routine */
     if((*io_info.io_ops.multi_read)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
@@ -723,8 +762,8 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
      * Note that in general, this requires us to touch up the memory buffer 
      * as well.
      */
-    if(TRUE == H5S_select_shape_same(mem_space, file_space) &&
-            H5S_GET_EXTENT_NDIMS(mem_space) != H5S_GET_EXTENT_NDIMS(file_space)) {
+    if(H5S_GET_EXTENT_NDIMS(mem_space) != H5S_GET_EXTENT_NDIMS(file_space) &&
+            TRUE == H5S_select_shape_same(mem_space, file_space)) {
         void *adj_buf = NULL;   /* Pointer to the location in buf corresponding  */
                                 /* to the beginning of the projected mem space.  */
 
@@ -987,8 +1026,11 @@ H5D__typeinfo_init(const H5D_t *dset, hid_t mem_type_id, hbool_t do_write,
         /* Check if the datatypes are compound subsets of one another */
         type_info->cmpd_subset = H5T_path_compound_subset(type_info->tpath);
 
-        /* Check if we need a background buffer */
-        if(do_write && H5T_detect_class(dset->shared->type, H5T_VLEN, FALSE))
+        /* Check if we need a background buffer (VL data packed into the
+         * chunks is released by the chunk code, rather than through the
+         * background buffer)
+         */
+        if(do_write && H5T_detect_class(dset->shared->type, H5T_VLEN, FALSE) && !dset->shared->vlen_packed)
             type_info->need_bkg = H5T_BKG_YES;
         else {
             H5T_bkg_t path_bkg;     /* Type conversion's background info */
@@ -1244,3 +1286,230 @@ H5D__typeinfo_term(const H5D_type_info_t *type_info)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5D__typeinfo_term() */
 
+
+#ifdef H5D_DEFERRED_IO
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__deferred_io_init
+ *
+ * Purpose:     Checks if the raw data reads for an H5Dread() call can be
+ *              performed after the library lock is released and, if so,
+ *              records the file to read from.
+ *
+ *              This is only possible when the bytes in the file go
+ *              straight into the application's buffer (no datatype
+ *              conversion or data transform), from contiguous storage or
+ *              unfiltered chunks, through the sec2 driver with no page
+ *              buffer, in a file that is opened read-only, so nothing the
+ *              library caches about the data can change under the reads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__deferred_io_init(H5D_deferred_io_t *deferred_io, const H5D_t *dset,
+    const H5D_type_info_t *type_info)
+{
+    H5F_t *f = dset->oloc.file;         /* File for dataset */
+    void *vfd_handle = NULL;            /* Pointer to the driver's file descriptor */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(deferred_io);
+    HDassert(dset);
+    HDassert(type_info);
+
+    /* Only the outermost read (i.e. not a virtual dataset's source datasets) is checked */
+    if(deferred_io->checked)
+        HGOTO_DONE(SUCCEED)
+    deferred_io->checked = TRUE;
+
+    /* Check for the raw data going directly into the application's buffer */
+    if(!type_info->is_conv_noop || !type_info->is_xform_noop)
+        HGOTO_DONE(SUCCEED)
+    if((dset->shared->layout.type != H5D_CONTIGUOUS && dset->shared->layout.type != H5D_CHUNKED)
+            || dset->shared->dcpl_cache.efl.nused > 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check the file */
+    if(H5F_INTENT(f) & H5F_ACC_RDWR)
+        HGOTO_DONE(SUCCEED)
+    if(H5F_DRIVER_ID(f) != H5FD_SEC2 || H5F_HAS_PAGE_BUF(f))
+        HGOTO_DONE(SUCCEED)
+
+    /* Get the file descriptor */
+    if(H5F_get_vfd_handle(f, H5P_FILE_ACCESS_DEFAULT, &vfd_handle) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get file descriptor")
+    deferred_io->fd = *(int *)vfd_handle;
+
+    /* Get the range of valid addresses, allowing reads past the EOA for
+     * SWMR readers, like H5FD_read()
+     */
+    deferred_io->base_addr = H5F_BASE_ADDR(f);
+    if(H5F_INTENT(f) & H5F_ACC_SWMR_READ)
+        deferred_io->eoa = HADDR_MAX;
+    else if(HADDR_UNDEF == (deferred_io->eoa = H5F_get_eoa(f, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get EOA")
+
+    /* Enable deferring reads for this file */
+    deferred_io->file = f;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__deferred_io_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__deferred_io_add
+ *
+ * Purpose:     Records a raw data read for H5Dread() to perform after it
+ *              releases the library lock.  Reads that continue the
+ *              previous one in both the file and memory are merged.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__deferred_io_add(H5D_deferred_io_t *deferred_io, haddr_t addr, size_t len,
+    void *buf)
+{
+    H5D_deferred_read_t *last;          /* Last read recorded */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(deferred_io);
+    HDassert(deferred_io->file);
+    HDassert(buf);
+
+    /* Check the read against the EOA, as H5FD_read() would */
+    if(H5F_addr_gt(addr + len, deferred_io->eoa))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addr + deferred_io->base_addr), (unsigned long long)len, (unsigned long long)(deferred_io->eoa + deferred_io->base_addr))
+    if(0 == len)
+        HGOTO_DONE(SUCCEED)
+    addr += deferred_io->base_addr;
+
+    /* Try to extend the last read */
+    if(deferred_io->nreads > 0) {
+        last = &deferred_io->reads[deferred_io->nreads - 1];
+        if(last->addr + last->len == addr && last->buf + last->len == (unsigned char *)buf) {
+            last->len += len;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
+    /* Make room for another read */
+    if(deferred_io->nreads == deferred_io->nalloc) {
+        size_t new_nalloc = MAX(16, 2 * deferred_io->nalloc);
+        H5D_deferred_read_t *new_reads;
+
+        if(NULL == (new_reads = (H5D_deferred_read_t *)H5MM_realloc(deferred_io->reads, new_nalloc * sizeof(H5D_deferred_read_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate deferred reads")
+        deferred_io->reads = new_reads;
+        deferred_io->nalloc = new_nalloc;
+    } /* end if */
+
+    /* Record the read */
+    last = &deferred_io->reads[deferred_io->nreads++];
+    last->addr = addr;
+    last->len = len;
+    last->buf = (unsigned char *)buf;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__deferred_io_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__deferred_io_exec
+ *
+ * Purpose:     Performs the raw data reads recorded for an H5Dread() call
+ *              without holding the library lock, so reads from several
+ *              threads can proceed concurrently.
+ *
+ *              An application reference on the dataset ID keeps the
+ *              dataset, and therefore the file descriptor, open while the
+ *              lock is released.  Nothing in the library is called until
+ *              the lock is reacquired.  (Closing the file with
+ *              H5F_CLOSE_STRONG while another thread is reading from it
+ *              is not supported.)
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__deferred_io_exec(hid_t dset_id, H5D_deferred_io_t *deferred_io)
+{
+    int myerrno = 0;                    /* Error from a failed read */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(deferred_io);
+    HDassert(deferred_io->nreads > 0);
+
+    /* Keep the dataset open while the lock is released */
+    if(H5I_inc_ref(dset_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset ID ref count")
+
+    H5_API_UNLOCK
+
+    /* Read data, being careful of interrupted system calls, partial
+     * results, and the end of the file, like the sec2 driver
+     */
+    for(u = 0; u < deferred_io->nreads && 0 == myerrno; u++) {
+        HDoff_t offset = (HDoff_t)deferred_io->reads[u].addr;
+        size_t size = deferred_io->reads[u].len;
+        unsigned char *buf = deferred_io->reads[u].buf;
+
+        while(size > 0) {
+            h5_posix_io_t       bytes_in;       /* # of bytes to read       */
+            h5_posix_io_ret_t   bytes_read;     /* # of bytes actually read */
+
+            if(size > H5_POSIX_MAX_IO_BYTES)
+                bytes_in = H5_POSIX_MAX_IO_BYTES;
+            else
+                bytes_in = (h5_posix_io_t)size;
+
+            do {
+                bytes_read = HDpread(deferred_io->fd, buf, bytes_in, offset);
+            } while(-1 == bytes_read && EINTR == errno);
+
+            if(-1 == bytes_read) {
+                myerrno = errno;
+                break;
+            } /* end if */
+
+            if(0 == bytes_read) {
+                /* end of file but not end of format address space */
+                HDmemset(buf, 0, size);
+                break;
+            } /* end if */
+
+            size -= (size_t)bytes_read;
+            offset += (HDoff_t)bytes_read;
+            buf += bytes_read;
+        } /* end while */
+    } /* end for */
+
+    H5_API_LOCK
+
+    /* Release the dataset */
+    if(H5I_dec_app_ref(dset_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataset ID ref count")
+
+    if(myerrno)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: file descriptor = %d, errno = %d, error message = '%s'", deferred_io->fd, myerrno, HDstrerror(myerrno))
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__deferred_io_exec() */
+#endif /* H5D_DEFERRED_IO */
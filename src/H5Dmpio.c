@@ -168,22 +168,17 @@ typedef enum H5D_mpio_no_rank0_bcast_cause_t {
  *            new_owner - The processor which has been selected to perform the write to this chunk.
  *
  *   async_info - In the case of dataset writes only, this struct is used by the owning processor of the
- *                chunk in order to manage the MPI send and receive calls made between it and all of
- *                the other processors which have this chunk selected in the I/O operation.
+ *                chunk in order to manage the MPI messages it receives from all of the other processors
+ *                which have this chunk selected in the I/O operation.
  *
  *                Its fields are as follows:
  *
- *                receive_requests_array - An array containing one MPI_Request for each of the
- *                                         asynchronous MPI receive calls the owning processor of this
- *                                         chunk makes to another processor in order to receive that
- *                                         processor's chunk modification data and selection in the chunk.
- *
- *                receive_buffer_array - An array of buffers into which the owning processor of this chunk
- *                                       will store chunk modification data and the selection in the chunk
- *                                       received from another processor.
- *
- *                num_receive_requests - The number of entries in the receive_request_array and
- *                                       receive_buffer_array fields.
+ *                num_receive_requests - The number of messages, each containing another processor's chunk
+ *                                       modification data and selection in the chunk, that the owning
+ *                                       processor of this chunk must receive before the chunk can be
+ *                                       filtered. The messages are only matched and received when the
+ *                                       chunk is processed, so that the owning processor can work on
+ *                                       its unshared chunks while the messages are still in flight.
  */
 typedef struct H5D_filtered_collective_io_info_t {
   hsize_t             index;
@@ -204,12 +199,58 @@ typedef struct H5D_filtered_collective_io_info_t {
   } owners;
 
   struct {
-      MPI_Request    *receive_requests_array;
-      unsigned char **receive_buffer_array;
       int             num_receive_requests;
   } async_info;
 } H5D_filtered_collective_io_info_t;
 
+/*
+ * Information about a single chunk selected by a process, exchanged with the
+ * "coordinator" process for that chunk when deciding which process will become
+ * the new owner of a shared chunk during a collective filtered write. The
+ * coordinator for a chunk is the process whose rank is the chunk's index modulo
+ * the number of processes, so the decision is spread across all processes
+ * instead of being serialized on rank 0.
+ *
+ * This struct's fields are as follows:
+ *
+ *   index - The "Index" of the chunk in the dataset.
+ *
+ *   io_size - The size in bytes of the contributing process' selection in the chunk.
+ *
+ *   num_writers - The total number of processes writing to the chunk, as determined
+ *                 by the coordinator.
+ *
+ *   local_idx - The index of the entry in the contributing process' local chunk list.
+ *               Only used by the contributing process and to return the entries to it
+ *               in the order they were sent.
+ *
+ *   original_owner - The contributing process.
+ *
+ *   new_owner - The process selected by the coordinator to write to the chunk.
+ */
+typedef struct H5D_filtered_collective_owner_info_t {
+  hsize_t             index;
+  size_t              io_size;
+  size_t              num_writers;
+  size_t              local_idx;
+  int                 original_owner;
+  int                 new_owner;
+} H5D_filtered_collective_owner_info_t;
+
+/*
+ * Compact record for a single modified chunk, gathered to all processes for the
+ * collective re-allocation of chunks in the file and their re-insertion into the
+ * chunk index. Each record is immediately followed by the chunk's scaled
+ * coordinates, with only as many coordinates as the chunk layout has dimensions,
+ * rather than carrying a full H5D_filtered_collective_io_info_t through the
+ * collective operations.
+ */
+typedef struct H5D_filtered_collective_alloc_info_t {
+  hsize_t             index;
+  H5F_block_t         chunk_current;
+  H5F_block_t         new_chunk;
+} H5D_filtered_collective_alloc_info_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -237,12 +278,20 @@ static herr_t H5D__mpio_get_sum_chunk(const H5D_io_info_t *io_info,
     const H5D_chunk_map_t *fm, int *sum_chunkf);
 static herr_t H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, const H5D_chunk_map_t *fm,
-    H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries);
+    H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries,
+    MPI_Request **send_requests, unsigned char ***send_bufs, size_t *num_send_requests);
 #if MPI_VERSION >= 3
 static herr_t H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info, const H5D_chunk_map_t *fm,
-    H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries);
+    H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries,
+    MPI_Request **send_requests, unsigned char ***send_bufs, size_t *num_send_requests);
 #endif
+static herr_t H5D__mpio_collective_filtered_chunk_alloc(H5D_filtered_collective_io_info_t *chunk_list,
+    size_t chunk_list_num_entries, const H5D_io_info_t *io_info, const H5D_chk_idx_info_t *index_info,
+    unsigned char **collective_list, size_t *collective_list_num_entries, size_t *collective_entry_size);
+static herr_t H5D__mpio_collective_filtered_chunk_reinsert(const unsigned char *collective_list,
+    size_t collective_list_num_entries, size_t collective_entry_size, const H5D_io_info_t *io_info,
+    const H5D_chk_idx_info_t *index_info);
 static herr_t H5D__mpio_array_gatherv(void *local_array, size_t local_array_num_entries,
     size_t array_entry_size, void **gathered_array, size_t *gathered_array_num_entries,
     hbool_t allgather, int root, MPI_Comm comm, int (*sort_func)(const void *, const void *));
@@ -256,8 +305,10 @@ static int H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_a
 static int H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_info_entry1,
     const void *filtered_collective_io_info_entry2);
 #if MPI_VERSION >= 3
-static int H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1,
-    const void *filtered_collective_io_info_entry2);
+static int H5D__cmp_filtered_collective_owner_info_index(const void *owner_info_entry1,
+    const void *owner_info_entry2);
+static int H5D__cmp_filtered_collective_owner_info_owner(const void *owner_info_entry1,
+    const void *owner_info_entry2);
 #endif
 
 
@@ -1275,12 +1326,13 @@ if(H5DEBUG(D))
  *              1. Construct a list of selected chunks in the collective IO
  *                 operation
  *                 A. If any chunk is being written to by more than 1
- *                    process, the process writing to the chunk which
- *                    currently has the least amount of chunks assigned
- *                    to it becomes the new owner (in the case of ties,
- *                    the lowest MPI rank becomes the new owner)
+ *                    process, the process writing the largest part of
+ *                    the chunk becomes the new owner, as decided by the
+ *                    chunk's coordinator process (see
+ *                    H5D__chunk_redistribute_shared_chunks)
  *              2. If the operation is a write operation
- *                 A. Loop through each chunk in the operation
+ *                 A. Loop through each chunk in the operation, starting
+ *                    with the chunks not shared with other processes
  *                    I. If this is not a full overwrite of the chunk
  *                       a) Read the chunk from file and pass the chunk
  *                          through the filter pipeline in reverse order
@@ -1318,17 +1370,20 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     H5D_chunk_map_t *fm)
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
-    H5D_filtered_collective_io_info_t *collective_chunk_list = NULL; /* The list of chunks used during collective operations */
+    unsigned char                     *collective_chunk_list = NULL; /* The list of chunks used during collective operations */
     H5D_storage_t                      ctg_store;                        /* Chunk storage information as contiguous dataset */
     MPI_Datatype                       mem_type = MPI_BYTE;
     MPI_Datatype                       file_type = MPI_BYTE;
+    MPI_Request                       *send_requests = NULL;             /* Chunk modification data send requests */
+    unsigned char                    **send_bufs = NULL;                 /* Chunk modification data send buffers */
     hbool_t                            mem_type_is_derived = FALSE;
     hbool_t                            file_type_is_derived = FALSE;
     size_t                             chunk_list_num_entries;
-    size_t                             collective_chunk_list_num_entries;
-    size_t                            *num_chunks_selected_array = NULL; /* Array of number of chunks selected on each process */
+    size_t                             collective_chunk_list_num_entries = 0;
+    size_t                             collective_chunk_entry_size = 0;
+    size_t                             num_send_requests = 0;
     size_t                             i;                                /* Local index variable */
-    int                                mpi_rank, mpi_size, mpi_code;
+    int                                mpi_rank, mpi_code;
     herr_t                             ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -1337,11 +1392,9 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     HDassert(type_info);
     HDassert(fm);
 
-    /* Obtain the current rank of the process and the number of processes */
+    /* Obtain the current rank of the process */
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
-    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
     /* Set the actual-chunk-opt-mode property. */
     H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_LINK_CHUNK);
@@ -1352,12 +1405,12 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
     H5CX_set_mpio_actual_io_mode(H5D_MPIO_CHUNK_COLLECTIVE);
 
     /* Build a list of selected chunks in the collective io operation */
-    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries) < 0)
+    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries,
+            &send_requests, &send_bufs, &num_send_requests) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "couldn't construct filtered I/O info list")
 
     if (io_info->op_type == H5D_IO_OP_WRITE) { /* Filtered collective write */
         H5D_chk_idx_info_t index_info;
-        H5D_chunk_ud_t     udata;
         hsize_t            mpi_buf_count;
 
         /* Construct chunked index info */
@@ -1366,65 +1419,41 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
         index_info.layout = &(io_info->dset->shared->layout.u.chunk);
         index_info.storage = &(io_info->dset->shared->layout.storage.u.chunk);
 
-        /* Set up chunk information for insertion to chunk index */
-        udata.common.layout = index_info.layout;
-        udata.common.storage = index_info.storage;
-        udata.filter_mask = 0;
-
         /* Iterate through all the chunks in the collective write operation,
          * updating each chunk with the data modifications from other processes,
-         * then re-filtering the chunk.
+         * then re-filtering the chunk. The chunks which aren't shared with other
+         * processes are processed first, so that their filtering overlaps with
+         * the delivery of the modification data for the shared chunks.
          */
         for (i = 0; i < chunk_list_num_entries; i++)
-            if (mpi_rank == chunk_list[i].owners.new_owner)
+            if (mpi_rank == chunk_list[i].owners.new_owner && !chunk_list[i].async_info.num_receive_requests)
                 if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
 
-        /* Gather the new chunk sizes to all processes for a collective reallocation
-         * of the chunks in the file.
-         */
-        if (H5D__mpio_array_gatherv(chunk_list, chunk_list_num_entries, sizeof(H5D_filtered_collective_io_info_t),
-                (void **) &collective_chunk_list, &collective_chunk_list_num_entries, true, 0, io_info->comm, NULL) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
-
-        /* Collectively re-allocate the modified chunks (from each process) in the file */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            hbool_t insert;
-
-            if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[i].chunk_states.chunk_current,
-                    &collective_chunk_list[i].chunk_states.new_chunk, &insert, collective_chunk_list[i].scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-        } /* end for */
+        for (i = 0; i < chunk_list_num_entries; i++)
+            if (mpi_rank == chunk_list[i].owners.new_owner && chunk_list[i].async_info.num_receive_requests)
+                if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
 
-        if (NULL == (num_chunks_selected_array = (size_t *) H5MM_malloc((size_t) mpi_size * sizeof(size_t))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
+        /* Wait for this process' modification data to be received by the new owners of its shared chunks */
+        if (num_send_requests) {
+            H5_CHECK_OVERFLOW(num_send_requests, size_t, int);
+            if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int) num_send_requests, send_requests, MPI_STATUSES_IGNORE)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+        } /* end if */
 
-        if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&chunk_list_num_entries, 1, MPI_UNSIGNED_LONG_LONG, num_chunks_selected_array,
-                1, MPI_UNSIGNED_LONG_LONG, io_info->comm)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+        /* Gather the new chunk sizes to all processes and collectively re-allocate
+         * the modified chunks (from each process) in the file
+         */
+        if (H5D__mpio_collective_filtered_chunk_alloc(chunk_list, chunk_list_num_entries, io_info, &index_info,
+                &collective_chunk_list, &collective_chunk_list_num_entries, &collective_chunk_entry_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't collectively re-allocate chunks")
 
         /* If this process has any chunks selected, create a MPI type for collectively
          * writing out the chunks to file. Otherwise, the process contributes to the
          * collective write with a none type.
          */
         if (chunk_list_num_entries) {
-            size_t offset;
-
-            /* During the collective re-allocation of chunks in the file, the record for each
-             * chunk is only updated in the collective array, not in the local copy of chunks on each
-             * process. However, each process needs the updated chunk records so that they can create
-             * a MPI type for the collective write that will write to the chunk's possible new locations
-             * in the file instead of the old ones. This ugly hack seems to be the best solution to
-             * copy the information back to the local array and avoid having to modify the collective
-             * write type function in an ugly way so that it will accept the collective array instead
-             * of the local array. This works correctly because the array gather function guarantees
-             * that the chunk data in the collective array is ordered in blocks by rank.
-             */
-            for (i = 0, offset = 0; i < (size_t) mpi_rank; i++)
-                offset += num_chunks_selected_array[i];
-
-            HDmemcpy(chunk_list, &collective_chunk_list[offset], num_chunks_selected_array[mpi_rank] * sizeof(H5D_filtered_collective_io_info_t));
-
             /* Create single MPI type encompassing each selection in the dataspace */
             if (H5D__mpio_filtered_collective_write_type(chunk_list, chunk_list_num_entries,
                     &mem_type, &mem_type_is_derived, &file_type, &file_type_is_derived) < 0)
@@ -1450,14 +1479,9 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
         /* Participate in the collective re-insertion of all chunks modified
          * in this iteration into the chunk index
          */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            udata.chunk_block = collective_chunk_list[i].chunk_states.new_chunk;
-            udata.common.scaled = collective_chunk_list[i].scaled;
-            udata.chunk_idx = collective_chunk_list[i].index;
-
-            if ((index_info.storage->ops->insert)(&index_info, &udata, io_info->dset) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk address into index")
-        } /* end for */
+        if (H5D__mpio_collective_filtered_chunk_reinsert(collective_chunk_list, collective_chunk_list_num_entries,
+                collective_chunk_entry_size, io_info, &index_info) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "couldn't collectively re-insert chunks into index")
     } /* end if */
 
 done:
@@ -1470,8 +1494,13 @@ done:
         H5MM_free(chunk_list);
     } /* end if */
 
-    if (num_chunks_selected_array)
-        H5MM_free(num_chunks_selected_array);
+    if (send_bufs) {
+        for (i = 0; i < num_send_requests; i++)
+            H5MM_free(send_bufs[i]);
+        H5MM_free(send_bufs);
+    } /* end if */
+    if (send_requests)
+        H5MM_free(send_requests);
     if (collective_chunk_list)
         H5MM_free(collective_chunk_list);
 
@@ -1696,10 +1725,10 @@ done:
  *              1. Construct a list of selected chunks in the collective IO
  *                 operation
  *                 A. If any chunk is being written to by more than 1
- *                    process, the process writing to the chunk which
- *                    currently has the least amount of chunks assigned
- *                    to it becomes the new owner (in the case of ties,
- *                    the lowest MPI rank becomes the new owner)
+ *                    process, the process writing the largest part of
+ *                    the chunk becomes the new owner, as decided by the
+ *                    chunk's coordinator process (see
+ *                    H5D__chunk_redistribute_shared_chunks)
  *              2. If the operation is a read operation
  *                 A. Loop through each chunk in the operation
  *                    I. Read the chunk from the file
@@ -1744,7 +1773,7 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     H5D_chunk_map_t *fm)
 {
     H5D_filtered_collective_io_info_t *chunk_list = NULL; /* The list of chunks being read/written */
-    H5D_filtered_collective_io_info_t *collective_chunk_list = NULL; /* The list of chunks used during collective operations */
+    unsigned char                     *collective_chunk_list = NULL; /* The list of chunks used during collective operations */
     H5D_storage_t                      store;                /* union of EFL and chunk pointer in file space */
     H5D_io_info_t                      ctg_io_info;          /* Contiguous I/O info object */
     H5D_storage_t                      ctg_store;            /* Chunk storage information as contiguous dataset */
@@ -1752,11 +1781,14 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     MPI_Datatype                      *mem_type_array = NULL;
     hbool_t                           *file_type_is_derived_array = NULL;
     hbool_t                           *mem_type_is_derived_array = NULL;
-    hbool_t                           *has_chunk_selected_array = NULL; /* Array of whether or not each process is contributing a chunk to each iteration */
+    MPI_Request                       *send_requests = NULL;     /* Chunk modification data send requests */
+    unsigned char                    **send_bufs = NULL;         /* Chunk modification data send buffers */
     size_t                             chunk_list_num_entries;
-    size_t                             collective_chunk_list_num_entries;
-    size_t                             i, j;                    /* Local index variable */
-    int                                mpi_rank, mpi_size, mpi_code;
+    size_t                             collective_chunk_list_num_entries = 0;
+    size_t                             collective_chunk_entry_size = 0;
+    size_t                             num_send_requests = 0;
+    size_t                             i;                       /* Local index variable */
+    int                                mpi_rank, mpi_code;
     herr_t                             ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -1765,11 +1797,9 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     HDassert(type_info);
     HDassert(fm);
 
-    /* Obtain the current rank of the process and the number of processes */
+    /* Obtain the current rank of the process */
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
-    if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
     /* Set the actual chunk opt mode property */
     H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_MULTI_CHUNK);
@@ -1780,7 +1810,8 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     H5CX_set_mpio_actual_io_mode(H5D_MPIO_CHUNK_COLLECTIVE);
 
     /* Build a list of selected chunks in the collective IO operation */
-    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries) < 0)
+    if (H5D__construct_filtered_io_info_list(io_info, type_info, fm, &chunk_list, &chunk_list_num_entries,
+            &send_requests, &send_bufs, &num_send_requests) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "couldn't construct filtered I/O info list")
 
     /* Set up contiguous I/O info object */
@@ -1802,7 +1833,6 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     } /* end if */
     else { /* Filtered collective write */
         H5D_chk_idx_info_t index_info;
-        H5D_chunk_ud_t     udata;
         size_t             max_num_chunks;
         hsize_t            mpi_buf_count;
 
@@ -1812,11 +1842,6 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
         index_info.layout = &(io_info->dset->shared->layout.u.chunk);
         index_info.storage = &(io_info->dset->shared->layout.storage.u.chunk);
 
-        /* Set up chunk information for insertion to chunk index */
-        udata.common.layout = index_info.layout;
-        udata.common.storage = index_info.storage;
-        udata.filter_mask = 0;
-
         /* Retrieve the maximum number of chunks being written among all processes */
         if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&chunk_list_num_entries, &max_num_chunks,
                 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, io_info->comm)))
@@ -1852,45 +1877,20 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
                 if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
 
-            /* Gather the new chunk sizes to all processes for a collective re-allocation
-             * of the chunks in the file
-             */
-            if (H5D__mpio_array_gatherv(&chunk_list[i], have_chunk_to_process ? 1 : 0, sizeof(H5D_filtered_collective_io_info_t),
-                    (void **) &collective_chunk_list, &collective_chunk_list_num_entries, true, 0, io_info->comm, NULL) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
-
-            /* Participate in the collective re-allocation of all chunks modified
-             * in this iteration.
+            /* Gather the new chunk sizes to all processes and collectively re-allocate
+             * all chunks modified in this iteration in the file
              */
-            for (j = 0; j < collective_chunk_list_num_entries; j++) {
-                hbool_t insert = FALSE;
-
-                if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[j].chunk_states.chunk_current,
-                        &collective_chunk_list[j].chunk_states.new_chunk, &insert, chunk_list[j].scaled) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-            } /* end for */
-
-            if (NULL == (has_chunk_selected_array = (hbool_t *) H5MM_malloc((size_t) mpi_size * sizeof(hbool_t))))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
-
-            if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&have_chunk_to_process, 1, MPI_C_BOOL, has_chunk_selected_array,
-                    1, MPI_C_BOOL, io_info->comm)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+            if (H5D__mpio_collective_filtered_chunk_alloc(have_chunk_to_process ? &chunk_list[i] : NULL,
+                    have_chunk_to_process ? 1 : 0, io_info, &index_info, &collective_chunk_list,
+                    &collective_chunk_list_num_entries, &collective_chunk_entry_size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't collectively re-allocate chunks")
 
             /* If this process has a chunk to work on, create a MPI type for the
              * memory and file for writing out the chunk
              */
             if (have_chunk_to_process) {
-                size_t offset;
                 int    mpi_type_count;
 
-                for (j = 0, offset = 0; j < (size_t) mpi_rank; j++)
-                    offset += has_chunk_selected_array[j];
-
-                /* Collect the new chunk info back to the local copy, since only the record in the
-                 * collective array gets updated by the chunk re-allocation */
-                HDmemcpy(&chunk_list[i].chunk_states.new_chunk, &collective_chunk_list[offset].chunk_states.new_chunk, sizeof(chunk_list[i].chunk_states.new_chunk));
-
                 H5_CHECKED_ASSIGN(mpi_type_count, int, chunk_list[i].chunk_states.new_chunk.length, hsize_t);
 
                 /* Create MPI memory type for writing to chunk */
@@ -1929,25 +1929,23 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
             /* Participate in the collective re-insertion of all chunks modified
              * in this iteration into the chunk index
              */
-            for (j = 0; j < collective_chunk_list_num_entries; j++) {
-                udata.chunk_block = collective_chunk_list[j].chunk_states.new_chunk;
-                udata.common.scaled = collective_chunk_list[j].scaled;
-                udata.chunk_idx = collective_chunk_list[j].index;
-
-                if ((index_info.storage->ops->insert)(&index_info, &udata, io_info->dset) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk address into index")
-            } /* end for */
+            if (H5D__mpio_collective_filtered_chunk_reinsert(collective_chunk_list, collective_chunk_list_num_entries,
+                    collective_chunk_entry_size, io_info, &index_info) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "couldn't collectively re-insert chunks into index")
 
             if (collective_chunk_list){
                 H5MM_free(collective_chunk_list);
                 collective_chunk_list = NULL;
             } /* end if */
-            if (has_chunk_selected_array){
-                H5MM_free(has_chunk_selected_array);
-                has_chunk_selected_array = NULL;
-            } /* end if */
         } /* end for */
 
+        /* Wait for this process' modification data to be received by the new owners of its shared chunks */
+        if (num_send_requests) {
+            H5_CHECK_OVERFLOW(num_send_requests, size_t, int);
+            if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int) num_send_requests, send_requests, MPI_STATUSES_IGNORE)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+        } /* end if */
+
         /* Free the MPI file and memory types, if they were derived */
         for (i = 0; i < max_num_chunks; i++) {
             if (file_type_is_derived_array[i])
@@ -1969,6 +1967,13 @@ done:
         H5MM_free(chunk_list);
     } /* end if */
 
+    if (send_bufs) {
+        for (i = 0; i < num_send_requests; i++)
+            H5MM_free(send_bufs[i]);
+        H5MM_free(send_bufs);
+    } /* end if */
+    if (send_requests)
+        H5MM_free(send_requests);
     if (collective_chunk_list)
         H5MM_free(collective_chunk_list);
     if (file_type_array)
@@ -2194,34 +2199,69 @@ H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_in
 #if MPI_VERSION >= 3
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__cmp_filtered_collective_io_info_entry_owner
+ * Function:    H5D__cmp_filtered_collective_owner_info_index
  *
- * Purpose:     Routine to compare filtered collective chunk io info
- *              entries's original owner fields
+ * Purpose:     Routine to compare chunk ownership info entries by chunk
+ *              index, then by contributing process
  *
- * Description: Callback for qsort() to compare filtered collective chunk
- *              io info entries's original owner fields
+ * Description: Callback for qsort() to group the chunk ownership info
+ *              entries received by a chunk's coordinator process by
+ *              chunk, with the writers of each chunk in rank order
  *
- * Return:      The difference between the two
- *              H5D_filtered_collective_io_info_t's original owner fields
+ * Return:      -1, 0, 1
  *
- * Programmer:  Jordan Henderson
- *              Monday, Apr. 10th, 2017
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__cmp_filtered_collective_owner_info_index(const void *owner_info_entry1, const void *owner_info_entry2)
+{
+    const H5D_filtered_collective_owner_info_t *entry1 = (const H5D_filtered_collective_owner_info_t *) owner_info_entry1;
+    const H5D_filtered_collective_owner_info_t *entry2 = (const H5D_filtered_collective_owner_info_t *) owner_info_entry2;
+    int ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (entry1->index != entry2->index)
+        ret_value = (entry1->index < entry2->index) ? -1 : 1;
+    else if (entry1->original_owner != entry2->original_owner)
+        ret_value = (entry1->original_owner < entry2->original_owner) ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_filtered_collective_owner_info_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cmp_filtered_collective_owner_info_owner
+ *
+ * Purpose:     Routine to compare chunk ownership info entries by
+ *              contributing process, then by position in that process'
+ *              local chunk list
+ *
+ * Description: Callback for qsort() to restore the order in which a
+ *              coordinator process received the chunk ownership info
+ *              entries, so that each contributing process gets its
+ *              entries back in exactly the order it sent them
+ *
+ * Return:      -1, 0, 1
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5D__cmp_filtered_collective_io_info_entry_owner(const void *filtered_collective_io_info_entry1, const void *filtered_collective_io_info_entry2)
+H5D__cmp_filtered_collective_owner_info_owner(const void *owner_info_entry1, const void *owner_info_entry2)
 {
-    int owner1 = -1, owner2 = -1;
+    const H5D_filtered_collective_owner_info_t *entry1 = (const H5D_filtered_collective_owner_info_t *) owner_info_entry1;
+    const H5D_filtered_collective_owner_info_t *entry2 = (const H5D_filtered_collective_owner_info_t *) owner_info_entry2;
+    int ret_value = 0;
 
     FUNC_ENTER_STATIC_NOERR
 
-    owner1 = ((const H5D_filtered_collective_io_info_t *) filtered_collective_io_info_entry1)->owners.original_owner;
-    owner2 = ((const H5D_filtered_collective_io_info_t *) filtered_collective_io_info_entry2)->owners.original_owner;
+    if (entry1->original_owner != entry2->original_owner)
+        ret_value = (entry1->original_owner < entry2->original_owner) ? -1 : 1;
+    else if (entry1->local_idx != entry2->local_idx)
+        ret_value = (entry1->local_idx < entry2->local_idx) ? -1 : 1;
 
-    FUNC_LEAVE_NOAPI(owner1 - owner2)
-} /* end H5D__cmp_filtered_collective_io_info_entry_owner() */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cmp_filtered_collective_owner_info_owner() */
 #endif
 
 
@@ -2569,6 +2609,12 @@ done:
  *              on every chunk, such as chunk re-allocation, insertion of
  *              chunks into the chunk index, etc.
  *
+ *              For write operations, the sends of chunk modification data
+ *              to the new owners of shared chunks are still in progress
+ *              when this function returns. The caller must complete the
+ *              requests returned in SEND_REQUESTS and then free them and
+ *              the buffers returned in SEND_BUFS.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -2578,7 +2624,8 @@ done:
  */
 static herr_t
 H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries)
+    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t **chunk_list, size_t *num_entries,
+    MPI_Request **send_requests, unsigned char ***send_bufs, size_t *num_send_requests)
 {
     H5D_filtered_collective_io_info_t *local_info_array = NULL; /* The list of initially selected chunks for this process */
     size_t                             num_chunks_selected;
@@ -2593,6 +2640,9 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
     HDassert(fm);
     HDassert(chunk_list);
     HDassert(num_entries);
+    HDassert(send_requests);
+    HDassert(send_bufs);
+    HDassert(num_send_requests);
 
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
@@ -2623,8 +2673,6 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
             local_info_array[i].buf = NULL;
             
             local_info_array[i].async_info.num_receive_requests = 0;
-            local_info_array[i].async_info.receive_buffer_array = NULL;
-            local_info_array[i].async_info.receive_requests_array = NULL;
 
             HDmemcpy(local_info_array[i].scaled, chunk_info->scaled, sizeof(chunk_info->scaled));
 
@@ -2652,7 +2700,8 @@ H5D__construct_filtered_io_info_list(const H5D_io_info_t *io_info, const H5D_typ
     /* Redistribute shared chunks to new owners as necessary */
     if (io_info->op_type == H5D_IO_OP_WRITE)
 #if MPI_VERSION >= 3
-        if (H5D__chunk_redistribute_shared_chunks(io_info, type_info, fm, local_info_array, &num_chunks_selected) < 0)
+        if (H5D__chunk_redistribute_shared_chunks(io_info, type_info, fm, local_info_array, &num_chunks_selected,
+                send_requests, send_bufs, num_send_requests) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to redistribute shared chunks")
 #else
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to redistribute shared chunks - MPI version < 3 (MPI_Mprobe and MPI_Imrecv missing)")
@@ -2678,26 +2727,33 @@ done:
  *
  *              The current implementation follows this 3-phase process:
  *
- *              - Collect everyone's list of chunks into one large list,
- *                sort the list in increasing order of chunk offset in the
- *                file and hand the list off to rank 0
- *
- *              - Rank 0 scans the list looking for matching runs of chunk
- *                offset in the file (corresponding to a shared chunk which
- *                has been selected by more than one rank in the I/O
- *                operation) and for each shared chunk, it redistributes
- *                the chunk to the process writing to the chunk which
- *                currently has the least amount of chunks assigned to it
- *                by modifying the "new_owner" field in each of the list
- *                entries corresponding to that chunk
- *
- *              - After the chunks have been redistributed, rank 0 re-sorts
- *                the list in order of previous owner so that each rank
- *                will get back exactly the array that they contributed to
- *                the redistribution operation, with the "new_owner" field
- *                of each chunk they are modifying having possibly been
- *                modified. Rank 0 then scatters each segment of the list
- *                back to its corresponding rank
+ *              - Each process sends a small record for each of its
+ *                selected chunks to that chunk's "coordinator" process,
+ *                the process whose rank is the chunk's index modulo the
+ *                number of processes, with a single MPI_Alltoallv call.
+ *                No single process has to collect or examine the list of
+ *                every chunk selected in the I/O operation.
+ *
+ *              - Each coordinator groups the records it received by chunk
+ *                and, for each shared chunk, chooses the new owner among
+ *                the processes writing to the chunk. The process with the
+ *                largest selection in the chunk becomes the new owner, as
+ *                that minimizes the amount of modification data that has
+ *                to be moved. Ties are broken by the chunk's index, so
+ *                that chunks evenly shared between the same processes are
+ *                spread across those processes. The records are returned
+ *                to the processes which contributed them with a second
+ *                MPI_Alltoallv call.
+ *
+ *              - Each process sends its modification data for chunks it
+ *                no longer owns to their new owners with non-blocking
+ *                sends and removes those chunks from its local list. The
+ *                new owner of a shared chunk only records how many
+ *                messages it expects for the chunk; the messages are
+ *                matched and received when the chunk is processed, which
+ *                allows the owner to work on its other chunks while the
+ *                messages are in flight. The send requests and buffers
+ *                are returned to the caller, which must complete them.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2708,23 +2764,26 @@ done:
  */
 static herr_t
 H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries)
+    const H5D_chunk_map_t *fm, H5D_filtered_collective_io_info_t *local_chunk_array, size_t *local_chunk_array_num_entries,
+    MPI_Request **_send_requests, unsigned char ***_send_bufs, size_t *_num_send_requests)
 {
-    H5D_filtered_collective_io_info_t  *shared_chunks_info_array = NULL; /* The list of all chunks selected in the operation by all processes */
-    H5S_sel_iter_t                     *mem_iter = NULL; /* Memory iterator for H5D__gather_mem */
-    unsigned char                     **mod_data = NULL; /* Array of chunk modification data buffers sent by a process to new chunk owners */
-    MPI_Request                        *send_requests = NULL; /* Array of MPI_Isend chunk modification data send requests */
-    MPI_Status                         *send_statuses = NULL; /* Array of MPI_Isend chunk modification send statuses */
-    hbool_t                             mem_iter_init = FALSE;
-    size_t                              shared_chunks_info_array_num_entries = 0;
-    size_t                              num_send_requests = 0;
-    size_t                             *num_assigned_chunks_array = NULL;
-    size_t                              i, last_assigned_idx;
-    int                                *send_counts = NULL;
-    int                                *send_displacements = NULL;
-    int                                 scatter_recvcount_int;
-    int                                 mpi_rank, mpi_size, mpi_code;
-    herr_t                              ret_value = SUCCEED;
+    H5D_filtered_collective_owner_info_t *send_owner_info = NULL; /* This process' chunks, ordered by coordinator process */
+    H5D_filtered_collective_owner_info_t *recv_owner_info = NULL; /* The chunks this process is the coordinator for */
+    H5S_sel_iter_t                       *mem_iter = NULL;  /* Memory iterator for H5D__gather_mem */
+    unsigned char                       **mod_data = NULL;  /* Array of chunk modification data buffers sent by a process to new chunk owners */
+    MPI_Request                          *send_requests = NULL; /* Array of MPI_Isend chunk modification data send requests */
+    MPI_Datatype                          owner_info_type = MPI_DATATYPE_NULL;
+    hbool_t                               owner_info_type_derived = FALSE;
+    hbool_t                               mem_iter_init = FALSE;
+    size_t                                num_recv_entries = 0;
+    size_t                                num_send_requests = 0;
+    size_t                                i, last_assigned_idx;
+    int                                  *send_counts = NULL;
+    int                                  *send_displacements = NULL;
+    int                                  *recv_counts = NULL;
+    int                                  *recv_displacements = NULL;
+    int                                   mpi_rank, mpi_size, mpi_code;
+    herr_t                                ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
 
@@ -2732,101 +2791,158 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
     HDassert(type_info);
     HDassert(fm);
     HDassert(local_chunk_array_num_entries);
+    HDassert(_send_requests);
+    HDassert(_send_bufs);
+    HDassert(_num_send_requests);
 
     if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
     if ((mpi_size = H5F_mpi_get_size(io_info->dset->oloc.file)) < 0)
         HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi size")
 
-    if (*local_chunk_array_num_entries)
-        if (NULL == (send_requests = (MPI_Request *) H5MM_malloc(*local_chunk_array_num_entries * sizeof(MPI_Request))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send requests buffer")
-
-    if (NULL == (mem_iter = (H5S_sel_iter_t *) H5MM_malloc(sizeof(H5S_sel_iter_t))))
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
-
-    /* Gather every rank's list of chunks to rank 0 to allow it to perform the redistribution operation. After this
-     * call, the gathered list will initially be sorted in increasing order of chunk offset in the file.
+    if (NULL == (send_counts = (int *) H5MM_calloc((size_t) mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send counts buffer")
+    if (NULL == (send_displacements = (int *) H5MM_malloc((size_t) mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send displacements buffer")
+    if (NULL == (recv_counts = (int *) H5MM_malloc((size_t) mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive counts buffer")
+    if (NULL == (recv_displacements = (int *) H5MM_malloc((size_t) mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate receive displacements buffer")
+
+    /* Build the list of ownership records for this process' chunks, ordered by the
+     * coordinator process of each chunk
      */
-    if (H5D__mpio_array_gatherv(local_chunk_array, *local_chunk_array_num_entries, sizeof(H5D_filtered_collective_io_info_t),
-            (void **) &shared_chunks_info_array, &shared_chunks_info_array_num_entries, false, 0,
-            io_info->comm, H5D__cmp_filtered_collective_io_info_entry) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather array")
-
-    /* Rank 0 redistributes any shared chunks to new owners as necessary */
-    if (mpi_rank == 0) {
-        if (NULL == (send_counts = (int *) H5MM_calloc((size_t) mpi_size * sizeof(int))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send counts buffer")
-
-        if (NULL == (send_displacements = (int *) H5MM_malloc((size_t) mpi_size * sizeof(int))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate send displacements buffer")
-
-        if (NULL == (num_assigned_chunks_array = (size_t *) H5MM_calloc((size_t) mpi_size * sizeof(size_t))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate number of assigned chunks array")
-
-        for (i = 0; i < shared_chunks_info_array_num_entries;) {
-            H5D_filtered_collective_io_info_t chunk_entry;
-            haddr_t                           last_seen_addr = shared_chunks_info_array[i].chunk_states.chunk_current.offset;
-            size_t                            set_begin_index = i;
-            size_t                            num_writers = 0;
-            int                               new_chunk_owner = shared_chunks_info_array[i].owners.original_owner;
-
-            /* Process each set of duplicate entries caused by another process writing to the same chunk */
-            do {
-                chunk_entry = shared_chunks_info_array[i];
+    for (i = 0; i < *local_chunk_array_num_entries; i++)
+        send_counts[local_chunk_array[i].index % (hsize_t) mpi_size]++;
+
+    send_displacements[0] = 0;
+    for (i = 1; i < (size_t) mpi_size; i++)
+        send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
+
+    if (*local_chunk_array_num_entries) {
+        if (NULL == (send_owner_info = (H5D_filtered_collective_owner_info_t *) H5MM_malloc(*local_chunk_array_num_entries * sizeof(H5D_filtered_collective_owner_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk ownership info buffer")
+
+        /* Use the receive displacements as the running insertion point for each coordinator */
+        HDmemcpy(recv_displacements, send_displacements, (size_t) mpi_size * sizeof(int));
+
+        for (i = 0; i < *local_chunk_array_num_entries; i++) {
+            H5D_filtered_collective_owner_info_t *owner_info;
+            int                                   coordinator = (int) (local_chunk_array[i].index % (hsize_t) mpi_size);
+
+            owner_info = &send_owner_info[recv_displacements[coordinator]++];
+            owner_info->index = local_chunk_array[i].index;
+            owner_info->io_size = local_chunk_array[i].io_size;
+            owner_info->num_writers = 0;
+            owner_info->local_idx = i;
+            owner_info->original_owner = owner_info->new_owner = mpi_rank;
+        } /* end for */
+    } /* end if */
 
-                send_counts[chunk_entry.owners.original_owner] += (int) sizeof(chunk_entry);
+    /* Exchange the number of records each process will send to each coordinator */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoall(send_counts, 1, MPI_INT, recv_counts, 1, MPI_INT, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
 
-                /* The new owner of the chunk is determined by the process
-                 * writing to the chunk which currently has the least amount
-                 * of chunks assigned to it
-                 */
-                if (num_assigned_chunks_array[chunk_entry.owners.original_owner] < num_assigned_chunks_array[new_chunk_owner])
-                    new_chunk_owner = chunk_entry.owners.original_owner;
+    recv_displacements[0] = 0;
+    for (i = 1; i < (size_t) mpi_size; i++)
+        recv_displacements[i] = recv_displacements[i - 1] + recv_counts[i - 1];
+    num_recv_entries = (size_t) recv_displacements[mpi_size - 1] + (size_t) recv_counts[mpi_size - 1];
+
+    if (num_recv_entries)
+        if (NULL == (recv_owner_info = (H5D_filtered_collective_owner_info_t *) H5MM_malloc(num_recv_entries * sizeof(H5D_filtered_collective_owner_info_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk ownership info receive buffer")
 
-                num_writers++;
-            } while (++i < shared_chunks_info_array_num_entries && shared_chunks_info_array[i].chunk_states.chunk_current.offset == last_seen_addr);
+    /* Create a datatype for the ownership records, so that the counts and displacements
+     * are in units of records rather than bytes
+     */
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_contiguous((int) sizeof(H5D_filtered_collective_owner_info_t), MPI_BYTE, &owner_info_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_contiguous failed", mpi_code)
+    owner_info_type_derived = TRUE;
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(&owner_info_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+    /* Send each chunk's record to the chunk's coordinator */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_owner_info, send_counts, send_displacements, owner_info_type,
+            recv_owner_info, recv_counts, recv_displacements, owner_info_type, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+    /* Choose the new owner for each chunk this process is the coordinator for */
+    if (num_recv_entries) {
+        HDqsort(recv_owner_info, num_recv_entries, sizeof(H5D_filtered_collective_owner_info_t),
+                H5D__cmp_filtered_collective_owner_info_index);
+
+        for (i = 0; i < num_recv_entries;) {
+            size_t set_begin_index = i;
+            size_t max_io_size = 0;
+            size_t num_max_writers = 0;
+            size_t num_writers;
+            size_t tie_break;
+            int    new_chunk_owner = -1;
+
+            /* Process each set of entries for the same chunk, finding the largest
+             * selection in the chunk and how many processes have a selection that size
+             */
+            do {
+                if (recv_owner_info[i].io_size > max_io_size || num_max_writers == 0) {
+                    max_io_size = recv_owner_info[i].io_size;
+                    num_max_writers = 1;
+                } /* end if */
+                else if (recv_owner_info[i].io_size == max_io_size)
+                    num_max_writers++;
+            } while (++i < num_recv_entries && recv_owner_info[i].index == recv_owner_info[set_begin_index].index);
+            num_writers = i - set_begin_index;
+
+            /* Choose one of the processes with the largest selection as the new owner */
+            tie_break = (size_t) (recv_owner_info[set_begin_index].index % (hsize_t) num_max_writers);
+            for (; set_begin_index < i; set_begin_index++)
+                if (recv_owner_info[set_begin_index].io_size == max_io_size && tie_break-- == 0) {
+                    new_chunk_owner = recv_owner_info[set_begin_index].original_owner;
+                    break;
+                } /* end if */
+            HDassert(new_chunk_owner >= 0);
 
             /* Set all of the chunk entries' "new_owner" fields */
-            for (; set_begin_index < i; set_begin_index++) {
-                shared_chunks_info_array[set_begin_index].owners.new_owner = new_chunk_owner;
-                shared_chunks_info_array[set_begin_index].num_writers = num_writers;
+            for (set_begin_index = i - num_writers; set_begin_index < i; set_begin_index++) {
+                recv_owner_info[set_begin_index].new_owner = new_chunk_owner;
+                recv_owner_info[set_begin_index].num_writers = num_writers;
             } /* end for */
-
-            num_assigned_chunks_array[new_chunk_owner]++;
         } /* end for */
 
-        /* Sort the new list in order of previous owner so that each original owner of a chunk
-         * entry gets that entry back, with the possibly newly-modified "new_owner" field
+        /* Restore the order the records were received in, so that each process
+         * gets back exactly the records it sent
          */
-        HDqsort(shared_chunks_info_array, shared_chunks_info_array_num_entries,
-                sizeof(H5D_filtered_collective_io_info_t), H5D__cmp_filtered_collective_io_info_entry_owner);
-
-        send_displacements[0] = 0;
-        for (i = 1; i < (size_t) mpi_size; i++)
-            send_displacements[i] = send_displacements[i - 1] + send_counts[i - 1];
+        HDqsort(recv_owner_info, num_recv_entries, sizeof(H5D_filtered_collective_owner_info_t),
+                H5D__cmp_filtered_collective_owner_info_owner);
     } /* end if */
 
-    /* Scatter the segments of the list back to each process */
-    H5_CHECKED_ASSIGN(scatter_recvcount_int, int, *local_chunk_array_num_entries * sizeof(H5D_filtered_collective_io_info_t), size_t);
-    if (MPI_SUCCESS != (mpi_code = MPI_Scatterv(shared_chunks_info_array, send_counts, send_displacements,
-            MPI_BYTE, local_chunk_array, scatter_recvcount_int, MPI_BYTE, 0, io_info->comm)))
-        HMPI_GOTO_ERROR(FAIL, "unable to scatter shared chunks info buffer", mpi_code)
+    /* Return the records to the processes which contributed them */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoallv(recv_owner_info, recv_counts, recv_displacements, owner_info_type,
+            send_owner_info, send_counts, send_displacements, owner_info_type, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
 
-    if (shared_chunks_info_array) {
-        H5MM_free(shared_chunks_info_array);
-        shared_chunks_info_array = NULL;
-    } /* end if */
+    for (i = 0; i < *local_chunk_array_num_entries; i++) {
+        H5D_filtered_collective_io_info_t *chunk_entry = &local_chunk_array[send_owner_info[i].local_idx];
+
+        HDassert(send_owner_info[i].index == chunk_entry->index);
+        chunk_entry->owners.new_owner = send_owner_info[i].new_owner;
+        chunk_entry->num_writers = send_owner_info[i].num_writers;
+    } /* end for */
 
     /* Now that the chunks have been redistributed, each process must send its modification data
-     * to the new owners of any of the chunks it previously possessed. Accordingly, each process
-     * must also issue asynchronous receives for any messages it may receive for each of the
-     * chunks it is assigned, in order to avoid potential deadlocking issues.
+     * to the new owners of any of the chunks it previously possessed. The sends are not completed
+     * here; the new owners only receive the data when they process each chunk.
      */
-    if (*local_chunk_array_num_entries)
+    if (*local_chunk_array_num_entries) {
+        if (NULL == (send_requests = (MPI_Request *) H5MM_malloc(*local_chunk_array_num_entries * sizeof(MPI_Request))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send requests buffer")
+
         if (NULL == (mod_data = (unsigned char **) H5MM_malloc(*local_chunk_array_num_entries * sizeof(unsigned char *))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate modification data buffer array")
 
+        if (NULL == (mem_iter = (H5S_sel_iter_t *) H5MM_malloc(sizeof(H5S_sel_iter_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
+    } /* end if */
+
     for (i = 0, last_assigned_idx = 0; i < *local_chunk_array_num_entries; i++) {
         H5D_filtered_collective_io_info_t *chunk_entry = &local_chunk_array[i];
 
@@ -2882,41 +2998,8 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
             num_send_requests++;
         } /* end if */
         else {
-            /* Allocate all necessary buffers for an asynchronous receive operation */
-            if (chunk_entry->num_writers > 1) {
-                MPI_Message message;
-                MPI_Status  status;
-                size_t      j;
-
-                chunk_entry->async_info.num_receive_requests = (int) chunk_entry->num_writers - 1;
-                if (NULL == (chunk_entry->async_info.receive_requests_array = (MPI_Request *) H5MM_malloc((size_t) chunk_entry->async_info.num_receive_requests * sizeof(MPI_Request))))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate async requests array")
-
-                if (NULL == (chunk_entry->async_info.receive_buffer_array = (unsigned char **) H5MM_malloc((size_t) chunk_entry->async_info.num_receive_requests * sizeof(unsigned char *))))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate async receive buffers")
-
-                for (j = 0; j < chunk_entry->num_writers - 1; j++) {
-                    int count = 0;
-
-                    /* Probe for a particular message from any process, removing that message
-                     * from the receive queue in the process and allocating that much memory
-                     * for the asynchronous receive
-                     */
-                    if (MPI_SUCCESS != (mpi_code = MPI_Mprobe(MPI_ANY_SOURCE, (int) chunk_entry->index, io_info->comm, &message, &status)))
-                        HMPI_GOTO_ERROR(FAIL, "MPI_Mprobe failed", mpi_code)
-
-                    if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&status, MPI_BYTE, &count)))
-                        HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
-
-                    HDassert(count >= 0);
-                    if (NULL == (chunk_entry->async_info.receive_buffer_array[j] = (unsigned char *) H5MM_malloc((size_t) count * sizeof(char *))))
-                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate modification data receive buffer")
-
-                    if (MPI_SUCCESS != (mpi_code = MPI_Imrecv(chunk_entry->async_info.receive_buffer_array[j], count, MPI_BYTE,
-                            &message, &chunk_entry->async_info.receive_requests_array[j])))
-                        HMPI_GOTO_ERROR(FAIL, "MPI_Imrecv failed", mpi_code)
-                } /* end for */
-            } /* end if */
+            /* Record the number of messages to receive from the other processes writing to the chunk */
+            chunk_entry->async_info.num_receive_requests = (int) chunk_entry->num_writers - 1;
 
             local_chunk_array[last_assigned_idx++] = local_chunk_array[i];
         } /* end else */
@@ -2924,43 +3007,42 @@ H5D__chunk_redistribute_shared_chunks(const H5D_io_info_t *io_info, const H5D_ty
 
     *local_chunk_array_num_entries = last_assigned_idx;
 
-    /* Wait for all async send requests to complete before returning */
-    if (num_send_requests) {
-        if (NULL == (send_statuses = (MPI_Status *) H5MM_malloc(num_send_requests * sizeof(MPI_Status))))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate send statuses buffer")
-
-        H5_CHECK_OVERFLOW(num_send_requests, size_t, int);
-        if (MPI_SUCCESS != (mpi_code = MPI_Waitall((int) num_send_requests, send_requests, send_statuses)))
-            HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
-    } /* end if */
+    /* Hand the in-progress send requests and their buffers off to the caller */
+    *_send_requests = send_requests;
+    *_send_bufs = mod_data;
+    *_num_send_requests = num_send_requests;
+    send_requests = NULL;
+    mod_data = NULL;
+    num_send_requests = 0;
 
 done:
-    /* Now that all async send requests have completed, free up the send
-     * buffers used in the async operations
-     */
-    for (i = 0; i < num_send_requests; i++) {
-        if (mod_data[i])
-            H5MM_free(mod_data[i]);
-    } /* end for */
+    if (mod_data) {
+        for (i = 0; i < num_send_requests; i++)
+            if (mod_data[i])
+                H5MM_free(mod_data[i]);
+        H5MM_free(mod_data);
+    } /* end if */
 
     if (send_requests)
         H5MM_free(send_requests);
-    if (send_statuses)
-        H5MM_free(send_statuses);
     if (send_counts)
         H5MM_free(send_counts);
     if (send_displacements)
         H5MM_free(send_displacements);
-    if (mod_data)
-        H5MM_free(mod_data);
+    if (recv_counts)
+        H5MM_free(recv_counts);
+    if (recv_displacements)
+        H5MM_free(recv_displacements);
+    if (send_owner_info)
+        H5MM_free(send_owner_info);
+    if (recv_owner_info)
+        H5MM_free(recv_owner_info);
+    if (owner_info_type_derived && MPI_SUCCESS != (mpi_code = MPI_Type_free(&owner_info_type)))
+        HMPI_DONE_ERROR(FAIL, "MPI_Type_free failed", mpi_code)
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
     if (mem_iter)
         H5MM_free(mem_iter);
-    if (num_assigned_chunks_array)
-        H5MM_free(num_assigned_chunks_array);
-    if (shared_chunks_info_array)
-        H5MM_free(shared_chunks_info_array);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_redistribute_shared_chunks() */
@@ -3055,6 +3137,170 @@ done:
 } /* end H5D__mpio_filtered_collective_write_type() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_collective_filtered_chunk_alloc
+ *
+ * Purpose:     Collectively re-allocates space in the file for the chunks
+ *              modified by all processes during a collective filtered
+ *              write, as their sizes may have changed after being
+ *              filtered.
+ *
+ *              Each process contributes a compact record for each of its
+ *              modified chunks, containing only the chunk's index, scaled
+ *              coordinates and file space information, and the records
+ *              are gathered to all processes in a single collective
+ *              operation. Every process then performs the same sequence
+ *              of allocations, so the file's free space stays consistent
+ *              across processes. On return, the new file space
+ *              information for this process' chunks has been copied back
+ *              into CHUNK_LIST, and the gathered records are returned to
+ *              the caller for the later re-insertion of the chunks into
+ *              the chunk index.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_collective_filtered_chunk_alloc(H5D_filtered_collective_io_info_t *chunk_list,
+    size_t chunk_list_num_entries, const H5D_io_info_t *io_info, const H5D_chk_idx_info_t *index_info,
+    unsigned char **_collective_list, size_t *_collective_list_num_entries, size_t *_collective_entry_size)
+{
+    unsigned char *local_list = NULL;      /* This process' records for its modified chunks */
+    unsigned char *collective_list = NULL; /* The records for every modified chunk */
+    size_t         collective_list_num_entries = 0;
+    size_t         entry_size;
+    size_t         scaled_size;
+    size_t         offset = 0;
+    size_t         i;
+    int            mpi_rank, mpi_code;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(chunk_list || 0 == chunk_list_num_entries);
+    HDassert(io_info);
+    HDassert(index_info);
+    HDassert(_collective_list);
+    HDassert(_collective_list_num_entries);
+    HDassert(_collective_entry_size);
+
+    if ((mpi_rank = H5F_mpi_get_rank(io_info->dset->oloc.file)) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_MPI, FAIL, "unable to obtain mpi rank")
+
+    /* Only the scaled coordinates for the dimensions of the chunk are sent */
+    scaled_size = index_info->layout->ndims * sizeof(hsize_t);
+    entry_size = sizeof(H5D_filtered_collective_alloc_info_t) + scaled_size;
+
+    if (chunk_list_num_entries) {
+        if (NULL == (local_list = (unsigned char *) H5MM_malloc(chunk_list_num_entries * entry_size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk allocation info buffer")
+
+        for (i = 0; i < chunk_list_num_entries; i++) {
+            H5D_filtered_collective_alloc_info_t *alloc_info = (H5D_filtered_collective_alloc_info_t *) (local_list + (i * entry_size));
+
+            alloc_info->index = chunk_list[i].index;
+            alloc_info->chunk_current = chunk_list[i].chunk_states.chunk_current;
+            alloc_info->new_chunk = chunk_list[i].chunk_states.new_chunk;
+            HDmemcpy(alloc_info + 1, chunk_list[i].scaled, scaled_size);
+        } /* end for */
+    } /* end if */
+
+    /* Determine where this process' records will be in the gathered list, which
+     * is ordered in blocks by rank
+     */
+    if (MPI_SUCCESS != (mpi_code = MPI_Exscan(&chunk_list_num_entries, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, io_info->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Exscan failed", mpi_code)
+    if (mpi_rank == 0)
+        offset = 0;
+
+    /* Gather the new chunk sizes to all processes */
+    if (H5D__mpio_array_gatherv(local_list, chunk_list_num_entries, entry_size, (void **) &collective_list,
+            &collective_list_num_entries, true, 0, io_info->comm, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
+
+    /* Collectively re-allocate the modified chunks (from each process) in the file */
+    for (i = 0; i < collective_list_num_entries; i++) {
+        H5D_filtered_collective_alloc_info_t *alloc_info = (H5D_filtered_collective_alloc_info_t *) (collective_list + (i * entry_size));
+        hbool_t                               insert;
+
+        if (H5D__chunk_file_alloc(index_info, &alloc_info->chunk_current, &alloc_info->new_chunk,
+                &insert, (hsize_t *) (alloc_info + 1)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+    } /* end for */
+
+    /* Copy the new file space information for this process' chunks back to the local list */
+    HDassert(offset + chunk_list_num_entries <= collective_list_num_entries);
+    for (i = 0; i < chunk_list_num_entries; i++) {
+        H5D_filtered_collective_alloc_info_t *alloc_info = (H5D_filtered_collective_alloc_info_t *) (collective_list + ((offset + i) * entry_size));
+
+        HDassert(alloc_info->index == chunk_list[i].index);
+        chunk_list[i].chunk_states.new_chunk = alloc_info->new_chunk;
+    } /* end for */
+
+    *_collective_list = collective_list;
+    *_collective_list_num_entries = collective_list_num_entries;
+    *_collective_entry_size = entry_size;
+    collective_list = NULL;
+
+done:
+    if (local_list)
+        H5MM_free(local_list);
+    if (collective_list)
+        H5MM_free(collective_list);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_collective_filtered_chunk_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_collective_filtered_chunk_reinsert
+ *
+ * Purpose:     Collectively re-inserts the chunks modified by all
+ *              processes during a collective filtered write into the
+ *              chunk index, using the records gathered by
+ *              H5D__mpio_collective_filtered_chunk_alloc().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_collective_filtered_chunk_reinsert(const unsigned char *collective_list,
+    size_t collective_list_num_entries, size_t collective_entry_size, const H5D_io_info_t *io_info,
+    const H5D_chk_idx_info_t *index_info)
+{
+    H5D_chunk_ud_t udata;
+    size_t         i;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(collective_list || 0 == collective_list_num_entries);
+    HDassert(io_info);
+    HDassert(index_info);
+
+    /* Set up chunk information for insertion to chunk index */
+    udata.common.layout = index_info->layout;
+    udata.common.storage = index_info->storage;
+    udata.filter_mask = 0;
+
+    for (i = 0; i < collective_list_num_entries; i++) {
+        const H5D_filtered_collective_alloc_info_t *alloc_info = (const H5D_filtered_collective_alloc_info_t *) (collective_list + (i * collective_entry_size));
+
+        udata.chunk_block = alloc_info->new_chunk;
+        udata.common.scaled = (const hsize_t *) (alloc_info + 1);
+        udata.chunk_idx = alloc_info->index;
+
+        if ((index_info->storage->ops->insert)(index_info, &udata, io_info->dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk address into index")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_collective_filtered_chunk_reinsert() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__filtered_collective_chunk_entry_io
  *
@@ -3088,6 +3334,7 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     size_t            buf_size;
     size_t            i;
     H5S_t            *dataspace = NULL; /* Other process' dataspace for the chunk */
+    unsigned char    *mod_data = NULL; /* Chunk modification data received from another process */
     void             *tmp_gath_buf = NULL; /* Temporary gather buffer to gather into from application buffer
                                               before scattering out to the chunk data buffer (when writing data),
                                               or vice versa (when reading data) */
@@ -3235,18 +3482,36 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "couldn't release selection iterator")
             mem_iter_init = FALSE;
 
-            if (MPI_SUCCESS != (mpi_code = MPI_Waitall(chunk_entry->async_info.num_receive_requests,
-                    chunk_entry->async_info.receive_requests_array, MPI_STATUSES_IGNORE)))
-                HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
-
-            /* For each asynchronous receive call previously posted, receive the chunk modification
-             * buffer from another rank and update the chunk data
+            /* Receive the chunk modification data from each of the other processes writing
+             * to this chunk and update the chunk data. The messages are only matched here,
+             * after this process has read the chunk and applied its own modifications, so
+             * that any data still in flight overlaps with that work.
              */
             for (i = 0; i < (size_t) chunk_entry->async_info.num_receive_requests; i++) {
                 const unsigned char *mod_data_p;
+                MPI_Message          message;
+                MPI_Status           status;
+                int                  count = 0;
+
+                /* Probe for a message for this chunk from any process, removing that message
+                 * from the receive queue in the process and allocating that much memory
+                 * for the receive
+                 */
+                if (MPI_SUCCESS != (mpi_code = MPI_Mprobe(MPI_ANY_SOURCE, (int) chunk_entry->index, io_info->comm, &message, &status)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Mprobe failed", mpi_code)
+
+                if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&status, MPI_BYTE, &count)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+
+                HDassert(count >= 0);
+                if (NULL == (mod_data = (unsigned char *) H5MM_malloc((size_t) count)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate modification data receive buffer")
+
+                if (MPI_SUCCESS != (mpi_code = MPI_Mrecv(mod_data, count, MPI_BYTE, &message, MPI_STATUS_IGNORE)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Mrecv failed", mpi_code)
 
                 /* Decode the process' chunk file dataspace */
-                mod_data_p = chunk_entry->async_info.receive_buffer_array[i];
+                mod_data_p = mod_data;
                 if (NULL == (dataspace = H5S_decode(&mod_data_p)))
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, FAIL, "unable to decode dataspace")
 
@@ -3269,7 +3534,8 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't close dataspace")
                     dataspace = NULL;
                 }
-                H5MM_free(chunk_entry->async_info.receive_buffer_array[i]);
+                H5MM_free(mod_data);
+                mod_data = NULL;
             } /* end for */
 
             /* Filter the chunk */
@@ -3290,10 +3556,8 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     } /* end switch */
 
 done:
-    if (chunk_entry->async_info.receive_buffer_array)
-        H5MM_free(chunk_entry->async_info.receive_buffer_array);
-    if (chunk_entry->async_info.receive_requests_array)
-        H5MM_free(chunk_entry->async_info.receive_requests_array);
+    if (mod_data)
+        H5MM_free(mod_data);
     if (tmp_gath_buf)
         H5MM_free(tmp_gath_buf);
     if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
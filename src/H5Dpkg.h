@@ -81,6 +81,13 @@
 #define H5D_BT2_SPLIT_PERC          100
 #define H5D_BT2_MERGE_PERC          40
 
+/* In thread-safe builds with positional I/O, H5Dread() may perform the raw
+ * data reads for a transfer after releasing the library lock.
+ */
+#if defined(H5_HAVE_THREADSAFE) && defined(H5_HAVE_PREADWRITE)
+#define H5D_DEFERRED_IO
+#endif /* H5_HAVE_THREADSAFE && H5_HAVE_PREADWRITE */
+
 
 /****************************/
 /* Package Private Typedefs */
@@ -439,6 +446,7 @@ typedef struct H5D_shared_t {
     H5D_dcpl_cache_t    dcpl_cache;     /* Cached DCPL values */
     H5O_layout_t        layout;         /* Data layout                  */
     hbool_t             checked_filters;/* TRUE if dataset passes can_apply check */
+    hbool_t             vlen_packed;    /* TRUE if VL data is packed into the chunks */
 
     /* Cached dataspace info */
     unsigned            ndims;                        /* The dataset's dataspace rank */
@@ -467,6 +475,53 @@ struct H5D_t {
     H5D_shared_t        *shared;        /* cached information from file */
 };
 
+/* Selection I/O plan, built by H5Pset_dataset_io_plan() and reused by
+ * H5Dread()/H5Dwrite() calls that pass H5S_PLIST for both dataspaces.
+ * The dataspaces are private copies, so the cached sequence lists stay
+ * valid for as long as the plan exists.
+ */
+struct H5D_io_plan_t {
+    unsigned            rc;             /* Reference count (shared by copied DXPLs) */
+    H5S_t               *mem_space;     /* Memory dataspace & selection */
+    H5S_t               *file_space;    /* File dataspace & selection */
+    size_t              nelmts;         /* # of elements in each selection */
+    hbool_t             cache_seq;      /* Whether to cache the sequence lists */
+
+    /* Sequence lists, generated on first use */
+    size_t              elmt_size;      /* Element size of sequences (0 when not generated yet) */
+    size_t              file_nseq;      /* # of sequences in file selection */
+    size_t              mem_nseq;       /* # of sequences in memory selection */
+    hsize_t             *file_off;      /* Offsets of file sequences */
+    size_t              *file_len;      /* Lengths of file sequences */
+    hsize_t             *mem_off;       /* Offsets of memory sequences */
+    size_t              *mem_len;       /* Lengths of memory sequences */
+};
+
+#ifdef H5D_DEFERRED_IO
+/* A raw data read recorded for H5D__deferred_io_exec() */
+typedef struct H5D_deferred_read_t {
+    haddr_t             addr;           /* Absolute offset in the file */
+    size_t              len;            /* # of bytes to read */
+    unsigned char       *buf;           /* Destination in the application's buffer */
+} H5D_deferred_read_t;
+
+/* Raw data reads for an H5Dread() call that are performed without holding
+ * the library lock.  Only set up by H5D__read() when the bytes in the file
+ * can be copied straight into the application's buffer by the sec2 driver
+ * of a file opened read-only, so the reads can't race with library state.
+ */
+typedef struct H5D_deferred_io_t {
+    hbool_t             checked;        /* Whether the outermost H5D__read() has checked the transfer */
+    const H5F_t         *file;          /* File the reads are for (NULL when disabled) */
+    int                 fd;             /* File descriptor to read from */
+    haddr_t             base_addr;      /* Base address of the file */
+    haddr_t             eoa;            /* End of allocated raw data space */
+    size_t              nreads;         /* # of reads recorded */
+    size_t              nalloc;         /* # of reads allocated */
+    H5D_deferred_read_t *reads;         /* Array of reads */
+} H5D_deferred_io_t;
+#endif /* H5D_DEFERRED_IO */
+
 /* Enumerated type for allocating dataset's storage */
 typedef enum {
     H5D_ALLOC_CREATE,           /* Dataset is being created */
@@ -590,6 +645,13 @@ H5_DLL herr_t H5D__select_write(const H5D_io_info_t *io_info,
     const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space);
 
+H5_DLL herr_t H5D__io_plan_get_spaces(const H5S_t **mem_space,
+    const H5S_t **file_space);
+#ifdef H5D_DEFERRED_IO
+H5_DLL herr_t H5D__deferred_io_add(H5D_deferred_io_t *deferred_io,
+    haddr_t addr, size_t len, void *buf);
+#endif /* H5D_DEFERRED_IO */
+
 /* Functions that perform scatter-gather serial I/O operations */
 H5_DLL herr_t H5D__scatter_mem(const void *_tscat_buf, const H5S_t *space,
     H5S_sel_iter_t *iter, size_t nelmts, void *_buf);
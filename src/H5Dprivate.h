@@ -83,6 +83,7 @@
 #define H5D_XFER_FILTER_CB_NAME         "filter_cb"      /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME           "type_conv_cb"   /* Type conversion callback function */
 #define H5D_XFER_XFORM_NAME             "data_transform" /* Data transform */
+#define H5D_XFER_IO_PLAN_NAME           "io_plan"        /* Pre-computed selection I/O plan */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME "coll_chunk_link_hard"
@@ -149,6 +150,9 @@ typedef struct H5D_append_flush_t {
     void *udata;            /* User data */
 } H5D_append_flush_t;
 
+/* Selection I/O plan (H5Pset_dataset_io_plan), defined in H5Dpkg.h */
+typedef struct H5D_io_plan_t H5D_io_plan_t;
+
 
 /*****************************/
 /* Library Private Variables */
@@ -174,6 +178,12 @@ H5_DLL hid_t H5D_get_access_plist(const H5D_t *dset);
 /* Functions that operate on vlen data */
 H5_DLL herr_t H5D_vlen_reclaim(hid_t type_id, H5S_t *space, void *buf);
 
+/* Functions that operate on selection I/O plans */
+H5_DLL H5D_io_plan_t *H5D_io_plan_create(const H5S_t *mem_space,
+    const H5S_t *file_space);
+H5_DLL H5D_io_plan_t *H5D_io_plan_copy(H5D_io_plan_t *plan);
+H5_DLL herr_t H5D_io_plan_close(H5D_io_plan_t *plan);
+
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
 
@@ -32,6 +32,7 @@
 #include "H5Dpkg.h"		/* Datasets				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5MMprivate.h"	/* Memory management			*/
 
 
 /****************/
@@ -50,6 +51,10 @@
 
 static herr_t H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
     size_t nelmts, const H5S_t *file_space, const H5S_t *mem_space);
+static herr_t H5D__io_plan_gen_seq(const H5S_t *space, unsigned flags,
+    size_t elmt_size, size_t nelmts, size_t *nseq, hsize_t **off, size_t **len);
+static htri_t H5D__io_plan_build_seq(H5D_io_plan_t *plan, size_t elmt_size);
+static void H5D__io_plan_reset_seq(H5D_io_plan_t *plan);
 
 
 /*********************/
@@ -70,6 +75,9 @@ H5FL_SEQ_DEFINE(hsize_t);
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
+/* Declare a free list to manage the H5D_io_plan_t struct */
+H5FL_DEFINE_STATIC(H5D_io_plan_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -103,6 +111,7 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
     size_t dxpl_vec_size;       /* Vector length from API context's DXPL */
     size_t vec_size;            /* Vector length */
     ssize_t tmp_file_len;       /* Temporary number of bytes in file sequence */
+    H5D_io_plan_t *plan = NULL; /* Selection I/O plan from API context's DXPL */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -113,6 +122,12 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
     HDassert(io_info->store);
     HDassert(io_info->u.rbuf);
 
+    /* Check for a selection I/O plan for these dataspaces */
+    if(H5CX_get_io_plan(&plan) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve selection I/O plan")
+    if(plan && (plan->file_space != file_space || plan->mem_space != mem_space))
+        plan = NULL;
+
     /* Get info from API context */
     if(H5CX_get_vec_size(&dxpl_vec_size) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve I/O vector size")
@@ -167,22 +182,36 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
     else {
         size_t mem_nelem;           /* Number of elements used in memory sequences */
         size_t file_nelem;          /* Number of elements used in file sequences */
+        size_t plan_file_seq = 0;   /* Next file sequence to use from I/O plan */
+        size_t plan_mem_seq = 0;    /* Next memory sequence to use from I/O plan */
 
-        /* Allocate the iterators */
-        if(NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
-        if(NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator")
+        /* Use the plan's cached sequences, when they are worth caching */
+        if(plan) {
+            htri_t use_plan;        /* Whether to use the plan's sequences */
 
-        /* Initialize file iterator */
-        if(H5S_select_iter_init(file_iter, file_space, elmt_size) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
-        file_iter_init = 1;	/* File selection iteration info has been initialized */
+            if((use_plan = H5D__io_plan_build_seq(plan, elmt_size)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate I/O plan sequences")
+            if(!use_plan)
+                plan = NULL;
+        } /* end if */
 
-        /* Initialize memory iterator */
-        if(H5S_select_iter_init(mem_iter, mem_space, elmt_size) < 0)
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
-        mem_iter_init = 1;	/* Memory selection iteration info has been initialized */
+        if(NULL == plan) {
+            /* Allocate the iterators */
+            if(NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator")
+            if(NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator")
+
+            /* Initialize file iterator */
+            if(H5S_select_iter_init(file_iter, file_space, elmt_size) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+            file_iter_init = 1;	/* File selection iteration info has been initialized */
+
+            /* Initialize memory iterator */
+            if(H5S_select_iter_init(mem_iter, mem_space, elmt_size) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+            mem_iter_init = 1;	/* Memory selection iteration info has been initialized */
+        } /* end if */
 
         /* Initialize sequence counts */
         curr_mem_seq = curr_file_seq = 0;
@@ -192,9 +221,19 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
         while(nelmts > 0) {
             /* Check if more file sequences are needed */
             if(curr_file_seq >= file_nseq) {
-                /* Get sequences for file selection */
-                if(H5S_SELECT_GET_SEQ_LIST(file_space, H5S_GET_SEQ_LIST_SORTED, file_iter, vec_size, nelmts, &file_nseq, &file_nelem, file_off, file_len) < 0)
-                    HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+                if(plan) {
+                    /* Copy the next batch of the plan's file sequences */
+                    /* (The layout's vector I/O callbacks modify the sequences) */
+                    file_nseq = MIN(vec_size, plan->file_nseq - plan_file_seq);
+                    HDassert(file_nseq > 0);
+                    HDmemcpy(file_off, plan->file_off + plan_file_seq, file_nseq * sizeof(hsize_t));
+                    HDmemcpy(file_len, plan->file_len + plan_file_seq, file_nseq * sizeof(size_t));
+                    plan_file_seq += file_nseq;
+                } /* end if */
+                else
+                    /* Get sequences for file selection */
+                    if(H5S_SELECT_GET_SEQ_LIST(file_space, H5S_GET_SEQ_LIST_SORTED, file_iter, vec_size, nelmts, &file_nseq, &file_nelem, file_off, file_len) < 0)
+                        HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
 
                 /* Start at the beginning of the sequences again */
                 curr_file_seq = 0;
@@ -202,9 +241,18 @@ H5D__select_io(const H5D_io_info_t *io_info, size_t elmt_size,
 
             /* Check if more memory sequences are needed */
             if(curr_mem_seq >= mem_nseq) {
-                /* Get sequences for memory selection */
-                if(H5S_SELECT_GET_SEQ_LIST(mem_space, 0, mem_iter, vec_size, nelmts, &mem_nseq, &mem_nelem, mem_off, mem_len) < 0)
-                    HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+                if(plan) {
+                    /* Copy the next batch of the plan's memory sequences */
+                    mem_nseq = MIN(vec_size, plan->mem_nseq - plan_mem_seq);
+                    HDassert(mem_nseq > 0);
+                    HDmemcpy(mem_off, plan->mem_off + plan_mem_seq, mem_nseq * sizeof(hsize_t));
+                    HDmemcpy(mem_len, plan->mem_len + plan_mem_seq, mem_nseq * sizeof(size_t));
+                    plan_mem_seq += mem_nseq;
+                } /* end if */
+                else
+                    /* Get sequences for memory selection */
+                    if(H5S_SELECT_GET_SEQ_LIST(mem_space, 0, mem_iter, vec_size, nelmts, &mem_nseq, &mem_nelem, mem_off, mem_len) < 0)
+                        HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
 
                 /* Start at the beginning of the sequences again */
                 curr_mem_seq = 0;
@@ -317,3 +365,337 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__select_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_io_plan_create
+ *
+ * Purpose:	Create a selection I/O plan for a memory and file dataspace.
+ *              A NULL memory dataspace indicates that the memory selection
+ *              is the same as the file selection.
+ *
+ * Return:	Success:	Pointer to new plan
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_io_plan_t *
+H5D_io_plan_create(const H5S_t *mem_space, const H5S_t *file_space)
+{
+    H5D_io_plan_t *plan = NULL;         /* New I/O plan */
+    hssize_t snelmts;                   /* # of elements selected (signed) */
+    H5D_io_plan_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Check args */
+    HDassert(file_space);
+
+    if(!mem_space)
+        mem_space = file_space;
+
+    /* Make sure that both selections are valid and the same size */
+    if(!(H5S_has_extent(file_space)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "file dataspace does not have extent set")
+    if(!(H5S_has_extent(mem_space)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "memory dataspace does not have extent set")
+    if(H5S_SELECT_VALID(file_space) != TRUE)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "file selection + offset not within extent")
+    if(H5S_SELECT_VALID(mem_space) != TRUE)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, NULL, "memory selection + offset not within extent")
+    if((snelmts = H5S_GET_SELECT_NPOINTS(mem_space)) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "memory dataspace has invalid selection")
+    if(snelmts != H5S_GET_SELECT_NPOINTS(file_space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "src and dest dataspaces have different number of elements selected")
+
+    /* Allocate the plan */
+    if(NULL == (plan = H5FL_CALLOC(H5D_io_plan_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    plan->rc = 1;
+    H5_CHECKED_ASSIGN(plan->nelmts, size_t, snelmts, hssize_t);
+
+    /* Keep private copies of the dataspaces, so the application can't
+     * change the selections out from under the cached sequences.
+     */
+    if(NULL == (plan->file_space = H5S_copy(file_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, NULL, "unable to copy file dataspace")
+    if(NULL == (plan->mem_space = H5S_copy(mem_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, NULL, "unable to copy memory dataspace")
+
+    /* Only irregular selections are worth caching the sequences for */
+    plan->cache_seq = !(H5S_SELECT_IS_REGULAR(file_space) && H5S_SELECT_IS_REGULAR(mem_space));
+
+    /* Set return value */
+    ret_value = plan;
+
+done:
+    if(!ret_value && plan)
+        if(H5D_io_plan_close(plan) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, NULL, "unable to release I/O plan")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_io_plan_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_io_plan_copy
+ *
+ * Purpose:	"Copy" a selection I/O plan.  Plans are never modified once
+ *              they are created (other than to cache their sequences), so
+ *              this just shares the plan.
+ *
+ * Return:	Pointer to the plan (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_io_plan_t *
+H5D_io_plan_copy(H5D_io_plan_t *plan)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(plan);
+
+    /* Increment the reference count */
+    plan->rc++;
+
+    FUNC_LEAVE_NOAPI(plan)
+} /* end H5D_io_plan_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_io_plan_close
+ *
+ * Purpose:	Release a reference to a selection I/O plan, freeing it
+ *              when the last reference is gone.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_io_plan_close(H5D_io_plan_t *plan)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(plan);
+    HDassert(plan->rc > 0);
+
+    /* Decrement the reference count and release the plan if it's unused */
+    if(--plan->rc == 0) {
+        if(plan->file_space && H5S_close(plan->file_space) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release file dataspace")
+        if(plan->mem_space && H5S_close(plan->mem_space) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release memory dataspace")
+        H5D__io_plan_reset_seq(plan);
+        plan = H5FL_FREE(H5D_io_plan_t, plan);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_io_plan_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_plan_get_spaces
+ *
+ * Purpose:	Retrieve the dataspaces for an I/O operation that uses the
+ *              H5S_PLIST dataspace IDs, from the API context's plan.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_plan_get_spaces(const H5S_t **mem_space, const H5S_t **file_space)
+{
+    H5D_io_plan_t *plan = NULL;     /* Selection I/O plan */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(mem_space);
+    HDassert(file_space);
+
+    /* Get the plan from the API context */
+    if(H5CX_get_io_plan(&plan) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve selection I/O plan")
+    if(NULL == plan)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no I/O plan set in dataset transfer property list")
+
+    /* (The selections were validated when the plan was created) */
+    *mem_space = plan->mem_space;
+    *file_space = plan->file_space;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_plan_get_spaces() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_plan_gen_seq
+ *
+ * Purpose:	Generate the complete sequence list for a selection.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_plan_gen_seq(const H5S_t *space, unsigned flags, size_t elmt_size,
+    size_t nelmts, size_t *nseq, hsize_t **off, size_t **len)
+{
+    H5S_sel_iter_t *iter = NULL;        /* Selection iteration info */
+    hbool_t iter_init = FALSE;          /* Selection iteration info has been initialized */
+    size_t alloc_seq = H5D_IO_VECTOR_SIZE;  /* # of sequences allocated */
+    size_t tot_seq = 0;                 /* # of sequences generated */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(nseq);
+    HDassert(off && NULL == *off);
+    HDassert(len && NULL == *len);
+
+    /* Allocate & initialize the iterator */
+    if(NULL == (iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate selection iterator")
+    if(H5S_select_iter_init(iter, space, elmt_size) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to initialize selection iterator")
+    iter_init = TRUE;
+
+    /* Allocate the sequence arrays */
+    if(NULL == (*off = (hsize_t *)H5MM_malloc(alloc_seq * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array")
+    if(NULL == (*len = (size_t *)H5MM_malloc(alloc_seq * sizeof(size_t))))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O length vector array")
+
+    /* Generate sequences until the selection is exhausted */
+    while(nelmts > 0) {
+        size_t curr_nseq;           /* # of sequences generated this time */
+        size_t curr_nelem;          /* # of elements used by sequences */
+
+        /* Grow the arrays when they are full */
+        if(tot_seq == alloc_seq) {
+            hsize_t *new_off;       /* Resized offset array */
+            size_t *new_len;        /* Resized length array */
+
+            alloc_seq *= 2;
+            if(NULL == (new_off = (hsize_t *)H5MM_realloc(*off, alloc_seq * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't reallocate I/O offset vector array")
+            *off = new_off;
+            if(NULL == (new_len = (size_t *)H5MM_realloc(*len, alloc_seq * sizeof(size_t))))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't reallocate I/O length vector array")
+            *len = new_len;
+        } /* end if */
+
+        if(H5S_SELECT_GET_SEQ_LIST(space, flags, iter, alloc_seq - tot_seq, nelmts, &curr_nseq, &curr_nelem, *off + tot_seq, *len + tot_seq) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+        HDassert(curr_nelem > 0);
+
+        tot_seq += curr_nseq;
+        nelmts -= curr_nelem;
+    } /* end while */
+
+    /* Set the # of sequences */
+    *nseq = tot_seq;
+
+done:
+    if(iter_init && H5S_SELECT_ITER_RELEASE(iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release selection iterator")
+    if(iter)
+        iter = H5FL_FREE(H5S_sel_iter_t, iter);
+    if(ret_value < 0) {
+        *off = (hsize_t *)H5MM_xfree(*off);
+        *len = (size_t *)H5MM_xfree(*len);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_plan_gen_seq() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_plan_build_seq
+ *
+ * Purpose:	Make certain that a plan's sequences are generated for an
+ *              element size.
+ *
+ * Return:	TRUE if the plan's sequences should be used, FALSE if
+ *              regenerating them from the selections is as cheap as
+ *              copying them / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__io_plan_build_seq(H5D_io_plan_t *plan, size_t elmt_size)
+{
+    htri_t ret_value = TRUE;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(plan);
+    HDassert(elmt_size > 0);
+
+    /* Sequences for regular selections are generated in closed form, so
+     * streaming them out of a cached copy would only cost memory bandwidth.
+     */
+    if(!plan->cache_seq)
+        HGOTO_DONE(FALSE)
+
+    /* Check for sequences already generated for this element size */
+    if(plan->elmt_size == elmt_size)
+        HGOTO_DONE(TRUE)
+
+    /* Release sequences for a different element size */
+    H5D__io_plan_reset_seq(plan);
+
+    /* Generate the sequences, using the same ordering as H5D__select_io() */
+    if(H5D__io_plan_gen_seq(plan->file_space, H5S_GET_SEQ_LIST_SORTED, elmt_size, plan->nelmts, &plan->file_nseq, &plan->file_off, &plan->file_len) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate file sequences")
+    if(H5D__io_plan_gen_seq(plan->mem_space, 0, elmt_size, plan->nelmts, &plan->mem_nseq, &plan->mem_off, &plan->mem_len) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequences")
+
+    /* Remember the element size the sequences are for */
+    plan->elmt_size = elmt_size;
+
+done:
+    if(ret_value < 0)
+        H5D__io_plan_reset_seq(plan);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_plan_build_seq() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_plan_reset_seq
+ *
+ * Purpose:	Release a plan's cached sequences.
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__io_plan_reset_seq(H5D_io_plan_t *plan)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(plan);
+
+    plan->file_off = (hsize_t *)H5MM_xfree(plan->file_off);
+    plan->file_len = (size_t *)H5MM_xfree(plan->file_len);
+    plan->mem_off = (hsize_t *)H5MM_xfree(plan->mem_off);
+    plan->mem_len = (size_t *)H5MM_xfree(plan->mem_len);
+    plan->file_nseq = plan->mem_nseq = 0;
+    plan->elmt_size = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__io_plan_reset_seq() */
+
@@ -68,8 +68,57 @@ typedef struct H5FD_mpio_t {
     haddr_t	eoa;		/*end-of-address marker			*/
     haddr_t	last_eoa;	/* Last known end-of-address marker	*/
     haddr_t	local_eof;	/* Local end-of-file address for each process */
+
+    /* Subfiling information.  When a file is subfiled, its logical address
+     * space is split into stripes of 'stripe_size' bytes which are assigned
+     * round-robin to 'nsubfiles' physical files.  Subfile 0 is the file
+     * named by the application (its MPIO handle is 'f'), the others are
+     * named "<name>.subfile_<n>".  The layout is recorded in a small map
+     * file, "<name>.subfile_map", so that the file is reassembled on open
+     * without the application having to know it was subfiled.
+     */
+    unsigned    nsubfiles;      /* Number of subfiles (0 if not subfiled) */
+    hsize_t     stripe_size;    /* Size of each stripe of the logical file */
+    unsigned    subfiling_ranks; /* Ranks per subfile requested when the file was created */
+    MPI_File   *subfiles;       /* MPIO file handles for each subfile */
+    int        *aggregators;    /* Rank of the process aggregating I/O for each subfile */
 } H5FD_mpio_t;
 
+/* Subfiling map file and subfile name suffixes */
+#define H5FD_MPIO_SUBFILING_MAP_SUFFIX  ".subfile_map"
+#define H5FD_MPIO_SUBFILE_SUFFIX        ".subfile_"
+
+/* Subfiling map file format: magic, version, # of subfiles, stripe size */
+#define H5FD_MPIO_SUBFILING_MAP_MAGIC   "HDF5SFMP"
+#define H5FD_MPIO_SUBFILING_MAP_VERSION 1
+#define H5FD_MPIO_SUBFILING_MAP_SIZE    (8 + 4 + 4 + 8)
+
+/* A contiguous region of the logical file, used when splitting I/O
+ * requests across subfiles
+ */
+typedef struct H5FD_mpio_seg_t {
+    MPI_Offset  off;            /* Offset of region in the logical file */
+    MPI_Offset  len;            /* Length of region */
+} H5FD_mpio_seg_t;
+
+/* A list of logical file regions, in the order of the data in memory */
+typedef struct H5FD_mpio_seg_list_t {
+    H5FD_mpio_seg_t *segs;      /* Array of regions */
+    size_t      nsegs;          /* Number of regions in use */
+    size_t      nalloc;         /* Number of regions allocated */
+} H5FD_mpio_seg_list_t;
+
+/* A piece of an I/O request which falls within a single stripe, sent to
+ * the aggregator for the piece's subfile during collective subfiled I/O
+ */
+typedef struct H5FD_mpio_piece_t {
+    MPI_Offset  off;            /* Offset of piece in its subfile */
+    MPI_Offset  len;            /* Length of piece */
+    MPI_Offset  buf_off;        /* Offset of piece in the requester's data buffer */
+    int         subfile;        /* Subfile containing the piece */
+    int         dest;           /* Aggregator for the subfile */
+} H5FD_mpio_piece_t;
+
 /* Private Prototypes */
 
 /* Callbacks */
@@ -96,6 +145,27 @@ static int H5FD__mpio_mpi_size(const H5FD_t *_file);
 static MPI_Comm H5FD__mpio_communicator(const H5FD_t *_file);
 static herr_t H5FD__mpio_get_info(H5FD_t *_file, void** mpi_info);
 
+/* Subfiling routines */
+static herr_t H5FD__mpio_subfiling_open(H5FD_mpio_t *file, const char *name,
+    unsigned flags, const H5FD_mpio_fapl_t *fa, MPI_Offset *size);
+static herr_t H5FD__mpio_subfiling_close(H5FD_mpio_t *file);
+static herr_t H5FD__mpio_subfiling_get_sizes(const H5FD_mpio_t *file, MPI_Offset *sizes);
+static haddr_t H5FD__mpio_subfiling_logical_eof(const H5FD_mpio_t *file, const MPI_Offset *sizes);
+static herr_t H5FD__mpio_subfiling_xfer(H5FD_mpio_t *file, H5FD_mem_t type, hbool_t do_write,
+    haddr_t addr, size_t size, void *buf, haddr_t *end_addr);
+static herr_t H5FD__mpio_subfiling_truncate(H5FD_mpio_t *file);
+static herr_t H5FD__mpio_seg_list_append(H5FD_mpio_seg_list_t *list, MPI_Offset off,
+    MPI_Offset len);
+static herr_t H5FD__mpio_seg_list_append_block(H5FD_mpio_seg_list_t *list,
+    const H5FD_mpio_seg_list_t *child, MPI_Aint child_extent, MPI_Offset disp, int blocklen);
+static herr_t H5FD__mpio_flatten_type(MPI_Datatype type, H5FD_mpio_seg_list_t *list);
+static herr_t H5FD__mpio_subfile_io(MPI_File fh, hbool_t do_write, MPI_Offset off,
+    unsigned char *buf, MPI_Offset len);
+static int H5FD__mpio_cmp_piece_dest(const void *_p1, const void *_p2);
+static int H5FD__mpio_cmp_piece_addr(const void *_p1, const void *_p2);
+static herr_t H5FD__mpio_subfiling_aggregate(const H5FD_mpio_t *file, hbool_t do_write,
+    H5FD_mpio_piece_t *pieces, size_t npieces, unsigned char *data);
+
 /* The MPIO file driver information */
 static const H5FD_class_mpi_t H5FD_mpio_g = {
     {   /* Start of superclass information */
@@ -411,6 +481,109 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_fapl_mpio() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_mpio_subfiling
+ *
+ * Purpose:	Enables subfiling for files created with the file access
+ *		property list FAPL_ID, which must already be set to use the
+ *		H5FD_MPIO driver.  The logical file is split into stripes of
+ *		STRIPE_SIZE bytes, which are distributed round-robin across
+ *		a set of subfiles.  Each subfile has a single aggregator
+ *		process through which all collective I/O to that subfile is
+ *		funneled.  RANKS_PER_SUBFILE is the number of processes that
+ *		share each subfile; when it is 0, one subfile is created per
+ *		node.
+ *
+ *		Subfiling only affects the creation of files: existing
+ *		subfiled files are detected and reassembled when they are
+ *		opened, even without this property.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mpio_subfiling(hid_t fapl_id, unsigned ranks_per_subfile, hsize_t stripe_size)
+{
+    H5FD_mpio_fapl_t	fa;
+    const H5FD_mpio_fapl_t *old_fa;     /* Current MPIO fapl info */
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuh", fapl_id, ranks_per_subfile, stripe_size);
+
+    /* Check arguments */
+    if(fapl_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list")
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_MPIO != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (old_fa = (const H5FD_mpio_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(0 == stripe_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size must be positive")
+    if(stripe_size > (hsize_t)INT_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size too large")
+
+    /* Update driver specific properties */
+    HDmemcpy(&fa, old_fa, sizeof(H5FD_mpio_fapl_t));
+    fa.subfiling_stripe_size = stripe_size;
+    fa.subfiling_ranks = ranks_per_subfile;
+
+    /* duplication is done during driver setting. */
+    ret_value = H5P_set_driver(plist, H5FD_MPIO, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mpio_subfiling() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_mpio_subfiling
+ *
+ * Purpose:	Retrieves the subfiling parameters set with
+ *		H5Pset_fapl_mpio_subfiling.  A stripe size of 0 indicates
+ *		that subfiling is not enabled.  For the file access property
+ *		list of an open file, the parameters describe the file's
+ *		actual layout.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_mpio_subfiling(hid_t fapl_id, unsigned *ranks_per_subfile/*out*/,
+    hsize_t *stripe_size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_mpio_fapl_t *fa;       /* MPIO fapl info */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, ranks_per_subfile, stripe_size);
+
+    /* Check arguments */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_MPIO != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_mpio_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if(ranks_per_subfile)
+        *ranks_per_subfile = fa->subfiling_ranks;
+    if(stripe_size)
+        *stripe_size = fa->subfiling_stripe_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_mpio_subfiling() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_dxpl_mpio
@@ -706,6 +879,10 @@ H5FD__mpio_fapl_get(H5FD_t *_file)
     if(FAIL == H5FD_mpi_comm_info_dup(file->comm, file->info, &fa->comm, &fa->info))
 	HGOTO_ERROR(H5E_INTERNAL, H5E_CANTCOPY, NULL, "Communicator/Info duplicate failed")
 
+    /* Subfiling parameters */
+    fa->subfiling_stripe_size = file->stripe_size;
+    fa->subfiling_ranks = file->subfiling_ranks;
+
     /* Set return value */
     ret_value = fa;
 
@@ -850,6 +1027,15 @@ H5FD_set_mpio_atomicity(H5FD_t *_file, hbool_t flag)
     if(MPI_SUCCESS != (mpi_code = MPI_File_set_atomicity(file->f, temp_flag)))
         HMPI_GOTO_ERROR(FAIL, "MPI_File_set_atomicity", mpi_code)
 
+    /* Subfiles share the file's atomicity mode */
+    if(file->nsubfiles > 0) {
+        unsigned u;
+
+        for(u = 1; u < file->nsubfiles; u++)
+            if(MPI_SUCCESS != (mpi_code = MPI_File_set_atomicity(file->subfiles[u], temp_flag)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_set_atomicity", mpi_code)
+    } /* end if */
+
 done:
 #ifdef H5FDmpio_DEBUG
     if(H5FD_mpio_Debug[(int)'t'])
@@ -956,6 +1142,7 @@ H5FD__mpio_open(const char *name, unsigned flags, hid_t fapl_id,
     if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
     if(H5P_FILE_ACCESS_DEFAULT == fapl_id || H5FD_MPIO != H5P_peek_driver(plist)) {
+	HDmemset(&_fa, 0, sizeof(H5FD_mpio_fapl_t));
 	_fa.comm = MPI_COMM_SELF; /*default*/
 	_fa.info = MPI_INFO_NULL; /*default*/
 	fa = &_fa;
@@ -1035,6 +1222,12 @@ H5FD__mpio_open(const char *name, unsigned flags, hid_t fapl_id,
         size = 0;
     } /* end if */
 
+    /* Set up subfiling, if the file is (or is being created) subfiled.
+     * This adjusts 'size' to the size of the logical file.
+     */
+    if(H5FD__mpio_subfiling_open(file, name, flags, fa, &size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "can't set up subfiling")
+
     /* Set the size of the file (from library's perspective) */
     file->eof = H5FD_mpi_MPIOff_to_haddr(size);
     file->local_eof = file->eof;
@@ -1050,8 +1243,11 @@ done:
 	    MPI_Comm_free(&comm_dup);
 	if(MPI_INFO_NULL != info_dup)
 	    MPI_Info_free(&info_dup);
-	if(file)
+	if(file) {
+            if(file->subfiles)
+                H5FD__mpio_subfiling_close(file);
 	    H5MM_xfree(file);
+        } /* end if */
     } /* end if */
 
 #ifdef H5FDmpio_DEBUG
@@ -1094,6 +1290,10 @@ H5FD__mpio_close(H5FD_t *_file)
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
+    /* Close the subfiles, if any */
+    if(file->subfiles && H5FD__mpio_subfiling_close(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close subfiles")
+
     /* MPI_File_close sets argument to MPI_FILE_NULL */
     if(MPI_SUCCESS != (mpi_code = MPI_File_close(&(file->f)/*in,out*/)))
         HMPI_GOTO_ERROR(FAIL, "MPI_File_close failed", mpi_code)
@@ -1384,6 +1584,13 @@ H5FD__mpio_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type,
         HDfprintf(stdout, "%s: mpi_off = %ld  size_i = %d\n", FUNC, (long)mpi_off, size_i);
 #endif
 
+    /* Subfiled files are read through their own path */
+    if(file->nsubfiles > 0) {
+        if(H5FD__mpio_subfiling_xfer(file, type, FALSE, addr, size, buf, NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read from subfiles")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Only look for MPI views for raw data transfers */
     if(type == H5FD_MEM_DRAW) {
         H5FD_mpio_xfer_t xfer_mode;   /* I/O transfer mode */
@@ -1604,6 +1811,21 @@ H5FD__mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id,
         HDfprintf(stdout, "%s: mpi_off = %ld  size_i = %d\n", FUNC, (long)mpi_off, size_i);
 #endif
 
+    /* Subfiled files are written through their own path */
+    if(file->nsubfiles > 0) {
+        haddr_t end_addr = HADDR_UNDEF;     /* End of the logical region written */
+
+        if(H5FD__mpio_subfiling_xfer(file, type, TRUE, addr, size, (void *)buf, &end_addr) < 0) /* Casting away const OK -QAK */
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to subfiles")
+
+        /* Track the local EOF, as below */
+        file->eof = HADDR_UNDEF;
+        if(H5F_addr_defined(end_addr) && end_addr > file->local_eof)
+            file->local_eof = end_addr;
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Get the transfer mode from the API context */
     if(H5CX_get_io_xfer_mode(&xfer_mode) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
@@ -1753,10 +1975,20 @@ H5FD__mpio_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
     /* Only sync the file if we are not going to immediately close it */
-    if(!closing)
+    if(!closing) {
         if(MPI_SUCCESS != (mpi_code = MPI_File_sync(file->f)))
             HMPI_GOTO_ERROR(FAIL, "MPI_File_sync failed", mpi_code)
 
+        /* Sync the other subfiles too */
+        if(file->nsubfiles > 0) {
+            unsigned u;
+
+            for(u = 1; u < file->nsubfiles; u++)
+                if(MPI_SUCCESS != (mpi_code = MPI_File_sync(file->subfiles[u])))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_File_sync failed", mpi_code)
+        } /* end if */
+    } /* end if */
+
 done:
 #ifdef H5FDmpio_DEBUG
     if(H5FD_mpio_Debug[(int)'t'])
@@ -1828,6 +2060,17 @@ H5FD__mpio_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR
             if(MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
                 HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
 
+        /* Subfiled files set the size of each subfile */
+        if(file->nsubfiles > 0) {
+            if(H5FD__mpio_subfiling_truncate(file) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "can't set size of subfiles")
+
+            /* Update the 'last' eoa value */
+            file->last_eoa = file->eoa;
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
         /* Only processor p0 will get the filesize and broadcast it. */
         /* (Note that throwing an error here will cause non-rank 0 processes
          *      to hang in following Bcast.  -QAK, 3/17/2018)
@@ -1992,5 +2235,1251 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5FD__mpio_get_info() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_open
+ *
+ * Purpose:     Sets up subfiling for a file which is being opened.
+ *
+ *              When a new file is created with subfiling enabled in its
+ *              file access properties, the number of subfiles and their
+ *              aggregators are chosen and a map file describing the
+ *              layout of the logical file is written next to the file.
+ *              When an existing file is opened, its map file is read (if
+ *              there is one), independent of the file access properties,
+ *              so that subfiled files are reassembled transparently.
+ *
+ *              On success, SIZE is set to the size of the logical file.
+ *              This is collective.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfiling_open(H5FD_mpio_t *file, const char *name, unsigned flags,
+    const H5FD_mpio_fapl_t *fa, MPI_Offset *size)
+{
+    char       *map_name = NULL;        /* Name of map file */
+    char       *subfile_name = NULL;    /* Name of a subfile */
+    size_t      name_len;               /* Length of name buffers */
+    hbool_t     new_file;               /* Whether the file is being created */
+    uint64_t    map_info[3];            /* Status, # of subfiles & stripe size, shared by rank 0 */
+    MPI_Offset *sizes = NULL;           /* Sizes of subfiles */
+    int        *is_leader = NULL;       /* Whether each rank is its node's leader */
+    MPI_Comm    node_comm = MPI_COMM_NULL;  /* Communicator for ranks on this node */
+    unsigned    nsubfiles = 0;          /* Number of subfiles */
+    unsigned    u;                      /* Local index variable */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(name);
+    HDassert(fa);
+    HDassert(size);
+
+    /* A file is new if it was truncated or just created */
+    new_file = (hbool_t)((flags & H5F_ACC_TRUNC) || ((flags & H5F_ACC_CREAT) && 0 == *size));
+
+    /* Build the map file name */
+    name_len = HDstrlen(name) + HDstrlen(H5FD_MPIO_SUBFILING_MAP_SUFFIX) + 1;
+    if(NULL == (map_name = (char *)H5MM_malloc(name_len)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for map file name")
+    HDsnprintf(map_name, name_len, "%s%s", name, H5FD_MPIO_SUBFILING_MAP_SUFFIX);
+
+    /* Determine the layout of the file */
+    map_info[0] = map_info[1] = map_info[2] = 0;
+    if(new_file) {
+        /* Don't bother with anything for regular files, except removing
+         * any stale map left over from a subfiled file of the same name
+         */
+        if(0 == fa->subfiling_stripe_size) {
+            if(0 == file->mpi_rank)
+                (void)MPI_File_delete(map_name, MPI_INFO_NULL);
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Choose the aggregators */
+        if(NULL == (file->aggregators = (int *)H5MM_malloc((size_t)file->mpi_size * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for aggregator list")
+#if MPI_VERSION >= 3
+        if(0 == fa->subfiling_ranks) {
+            int node_rank;          /* Rank of this process on its node */
+            int leader;             /* Whether this rank is its node's leader */
+            int i;                  /* Local index variable */
+
+            /* One subfile per node, aggregated by the lowest rank on the node */
+            if(MPI_SUCCESS != (mpi_code = MPI_Comm_split_type(file->comm, MPI_COMM_TYPE_SHARED, file->mpi_rank, MPI_INFO_NULL, &node_comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Comm_split_type failed", mpi_code)
+            if(MPI_SUCCESS != (mpi_code = MPI_Comm_rank(node_comm, &node_rank)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Comm_rank failed", mpi_code)
+            leader = (0 == node_rank);
+
+            if(NULL == (is_leader = (int *)H5MM_malloc((size_t)file->mpi_size * sizeof(int))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for node leader list")
+            if(MPI_SUCCESS != (mpi_code = MPI_Allgather(&leader, 1, MPI_INT, is_leader, 1, MPI_INT, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+
+            for(i = 0; i < file->mpi_size; i++)
+                if(is_leader[i])
+                    file->aggregators[nsubfiles++] = i;
+        } /* end if */
+        else
+#endif /* MPI_VERSION >= 3 */
+        {
+            unsigned ranks_per_subfile = fa->subfiling_ranks ? fa->subfiling_ranks : (unsigned)file->mpi_size;
+
+            /* One subfile for each group of ranks, aggregated by the
+             * first rank in the group
+             */
+            nsubfiles = ((unsigned)file->mpi_size + ranks_per_subfile - 1) / ranks_per_subfile;
+            for(u = 0; u < nsubfiles; u++)
+                file->aggregators[u] = (int)(u * ranks_per_subfile);
+        } /* end else */
+        HDassert(nsubfiles > 0);
+
+        /* Write the map file */
+        if(0 == file->mpi_rank) {
+            uint8_t     map_buf[H5FD_MPIO_SUBFILING_MAP_SIZE];  /* Encoded map */
+            uint8_t    *p = map_buf;                            /* Pointer into map */
+            uint64_t    stripe_size = (uint64_t)fa->subfiling_stripe_size;
+            MPI_File    map_fh;                                 /* Map file handle */
+            MPI_Status  mpi_stat;                               /* Status from I/O operation */
+
+            HDmemcpy(p, H5FD_MPIO_SUBFILING_MAP_MAGIC, (size_t)8);
+            p += 8;
+            UINT32ENCODE(p, H5FD_MPIO_SUBFILING_MAP_VERSION);
+            UINT32ENCODE(p, nsubfiles);
+            UINT64ENCODE(p, stripe_size);
+
+            /* (Errors are broadcast below, so other ranks don't hang) */
+            map_info[0] = 1;
+            if(MPI_SUCCESS == MPI_File_open(MPI_COMM_SELF, map_name, MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &map_fh)) {
+                if(MPI_SUCCESS == MPI_File_set_size(map_fh, (MPI_Offset)0) &&
+                        MPI_SUCCESS == MPI_File_write_at(map_fh, (MPI_Offset)0, map_buf, (int)sizeof(map_buf), MPI_BYTE, &mpi_stat))
+                    map_info[0] = 0;
+                if(MPI_SUCCESS != MPI_File_close(&map_fh))
+                    map_info[0] = 1;
+            } /* end if */
+        } /* end if */
+        if(MPI_SUCCESS != (mpi_code = MPI_Bcast(map_info, 1, MPI_UINT64_T, 0, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        if(map_info[0])
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't write subfiling map file")
+
+        file->stripe_size = fa->subfiling_stripe_size;
+        file->subfiling_ranks = fa->subfiling_ranks;
+    } /* end if */
+    else {
+        /* Look for a map file */
+        if(0 == file->mpi_rank) {
+            MPI_File    map_fh;                                 /* Map file handle */
+
+            /* (A missing map just means the file isn't subfiled) */
+            if(MPI_SUCCESS == MPI_File_open(MPI_COMM_SELF, map_name, MPI_MODE_RDONLY, MPI_INFO_NULL, &map_fh)) {
+                uint8_t     map_buf[H5FD_MPIO_SUBFILING_MAP_SIZE];  /* Encoded map */
+                const uint8_t *p = map_buf;                     /* Pointer into map */
+                MPI_Status  mpi_stat;                           /* Status from I/O operation */
+                int         nread = 0;                          /* # of bytes read */
+                unsigned    version;                            /* Map version */
+
+                /* Anything wrong with the map from here on is an error */
+                map_info[0] = 2;
+                HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+                if(MPI_SUCCESS == MPI_File_read_at(map_fh, (MPI_Offset)0, map_buf, (int)sizeof(map_buf), MPI_BYTE, &mpi_stat)
+                        && MPI_SUCCESS == MPI_Get_count(&mpi_stat, MPI_BYTE, &nread)
+                        && nread == (int)sizeof(map_buf)
+                        && !HDmemcmp(p, H5FD_MPIO_SUBFILING_MAP_MAGIC, (size_t)8)) {
+                    p += 8;
+                    UINT32DECODE(p, version);
+                    UINT32DECODE(p, nsubfiles);
+                    UINT64DECODE(p, map_info[2]);
+                    if(H5FD_MPIO_SUBFILING_MAP_VERSION == version && nsubfiles > 0 && map_info[2] > 0) {
+                        map_info[0] = 1;
+                        map_info[1] = nsubfiles;
+                    } /* end if */
+                } /* end if */
+                (void)MPI_File_close(&map_fh);
+            } /* end if */
+        } /* end if */
+        if(MPI_SUCCESS != (mpi_code = MPI_Bcast(map_info, 3, MPI_UINT64_T, 0, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        if(2 == map_info[0])
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "invalid subfiling map file")
+
+        /* Not subfiled */
+        if(0 == map_info[0])
+            HGOTO_DONE(SUCCEED)
+
+        nsubfiles = (unsigned)map_info[1];
+        file->stripe_size = (hsize_t)map_info[2];
+
+        /* Spread the aggregators evenly over the current processes */
+        if(NULL == (file->aggregators = (int *)H5MM_malloc((size_t)nsubfiles * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for aggregator list")
+        for(u = 0; u < nsubfiles; u++)
+            if(nsubfiles <= (unsigned)file->mpi_size)
+                file->aggregators[u] = (int)(((uint64_t)u * (uint64_t)file->mpi_size) / nsubfiles);
+            else
+                file->aggregators[u] = (int)(u % (unsigned)file->mpi_size);
+    } /* end else */
+
+    /* Open the subfiles.  Subfile 0 is the file itself.  The other subfiles
+     * are opened on the file's communicator, so that independent I/O can go
+     * directly to any subfile.
+     */
+    if(NULL == (file->subfiles = (MPI_File *)H5MM_malloc((size_t)nsubfiles * sizeof(MPI_File))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for subfile handles")
+    file->subfiles[0] = file->f;
+    for(u = 1; u < nsubfiles; u++)
+        file->subfiles[u] = MPI_FILE_NULL;
+    file->nsubfiles = nsubfiles;
+
+    name_len = HDstrlen(name) + HDstrlen(H5FD_MPIO_SUBFILE_SUFFIX) + 12;
+    if(NULL == (subfile_name = (char *)H5MM_malloc(name_len)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for subfile name")
+    for(u = 1; u < nsubfiles; u++) {
+        int mpi_amode;          /* MPI file access mode */
+
+        if(new_file)
+            mpi_amode = MPI_MODE_RDWR | MPI_MODE_CREATE;
+        else
+            mpi_amode = (flags & H5F_ACC_RDWR) ? MPI_MODE_RDWR : MPI_MODE_RDONLY;
+
+        HDsnprintf(subfile_name, name_len, "%s%s%u", name, H5FD_MPIO_SUBFILE_SUFFIX, u);
+        if(MPI_SUCCESS != (mpi_code = MPI_File_open(file->comm, subfile_name, mpi_amode, file->info, &file->subfiles[u])))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_open failed", mpi_code)
+
+        /* Discard any stale contents */
+        if(new_file)
+            if(MPI_SUCCESS != (mpi_code = MPI_File_set_size(file->subfiles[u], (MPI_Offset)0)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_set_size failed", mpi_code)
+    } /* end for */
+
+    /* Determine the size of the logical file */
+    if(NULL == (sizes = (MPI_Offset *)H5MM_malloc((size_t)nsubfiles * sizeof(MPI_Offset))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for subfile sizes")
+    if(H5FD__mpio_subfiling_get_sizes(file, sizes) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get subfile sizes")
+    if(H5FD_mpi_haddr_to_MPIOff(H5FD__mpio_subfiling_logical_eof(file, sizes), size) < 0)
+        HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from haddr to MPI off")
+
+done:
+    if(MPI_COMM_NULL != node_comm)
+        MPI_Comm_free(&node_comm);
+    H5MM_xfree(is_leader);
+    H5MM_xfree(sizes);
+    H5MM_xfree(subfile_name);
+    H5MM_xfree(map_name);
+
+    /* Cleanup on failure */
+    if(ret_value < 0) {
+        if(file->subfiles)
+            H5FD__mpio_subfiling_close(file);
+        file->aggregators = (int *)H5MM_xfree(file->aggregators);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfiling_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_close
+ *
+ * Purpose:     Closes the subfiles of a subfiled file (except subfile 0,
+ *              which is the file itself) and releases the subfiling
+ *              information.  This is collective.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfiling_close(H5FD_mpio_t *file)
+{
+    unsigned    u;                      /* Local index variable */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->subfiles);
+
+    /* Close all the subfiles, even if one fails */
+    for(u = 1; u < file->nsubfiles; u++)
+        if(MPI_FILE_NULL != file->subfiles[u])
+            if(MPI_SUCCESS != (mpi_code = MPI_File_close(&file->subfiles[u])))
+                HMPI_DONE_ERROR(FAIL, "MPI_File_close failed", mpi_code)
+
+    file->subfiles = (MPI_File *)H5MM_xfree(file->subfiles);
+    file->aggregators = (int *)H5MM_xfree(file->aggregators);
+    file->nsubfiles = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfiling_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_get_sizes
+ *
+ * Purpose:     Retrieves the size of each subfile into SIZES.  Rank 0
+ *              queries the sizes and broadcasts them.  This is
+ *              collective.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfiling_get_sizes(const H5FD_mpio_t *file, MPI_Offset *sizes)
+{
+    unsigned    u;                      /* Local index variable */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->nsubfiles > 0);
+    HDassert(sizes);
+
+    /* (A failure on rank 0 is flagged with a negative size, so the other
+     *  ranks don't hang in the broadcast)
+     */
+    if(0 == file->mpi_rank)
+        for(u = 0; u < file->nsubfiles; u++)
+            if(MPI_SUCCESS != MPI_File_get_size(file->subfiles[u], &sizes[u])) {
+                sizes[0] = -1;
+                break;
+            } /* end if */
+
+    if(MPI_SUCCESS != (mpi_code = MPI_Bcast(sizes, (int)(file->nsubfiles * sizeof(MPI_Offset)), MPI_BYTE, 0, file->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+    if(sizes[0] < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "MPI_File_get_size failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfiling_get_sizes() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_logical_eof
+ *
+ * Purpose:     Computes the size of the logical file from the sizes of
+ *              its subfiles: the largest logical address stored in any
+ *              subfile.
+ *
+ * Return:      The size of the logical file (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mpio_subfiling_logical_eof(const H5FD_mpio_t *file, const MPI_Offset *sizes)
+{
+    hsize_t     stripe_size;            /* Size of each stripe */
+    haddr_t     eof = 0;                /* Logical end of file */
+    unsigned    u;                      /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->stripe_size > 0);
+    HDassert(sizes);
+
+    stripe_size = file->stripe_size;
+    for(u = 0; u < file->nsubfiles; u++) {
+        hsize_t sub_size = (hsize_t)sizes[u];
+        hsize_t last_stripe;            /* Local index of last stripe in subfile */
+        hsize_t last_len;               /* # of bytes in the last stripe */
+        haddr_t end;                    /* Logical end of subfile's data */
+
+        if(0 == sub_size)
+            continue;
+
+        last_stripe = (sub_size - 1) / stripe_size;
+        last_len = sub_size - (last_stripe * stripe_size);
+        end = (((last_stripe * file->nsubfiles) + u) * stripe_size) + last_len;
+        if(end > eof)
+            eof = end;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(eof)
+} /* end H5FD__mpio_subfiling_logical_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_truncate
+ *
+ * Purpose:     Sets the size of each subfile so that the logical file
+ *              ends at the EOA.  This is collective.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfiling_truncate(H5FD_mpio_t *file)
+{
+    MPI_Offset *sizes = NULL;           /* Current sizes of subfiles */
+    hsize_t     full_stripes;           /* # of complete stripes in logical file */
+    hsize_t     rem;                    /* # of bytes in the partial stripe */
+    hbool_t     changed = FALSE;        /* Whether any subfile was resized */
+    unsigned    last_subfile;           /* Subfile holding the partial stripe */
+    unsigned    u;                      /* Local index variable */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->nsubfiles > 0);
+
+    if(NULL == (sizes = (MPI_Offset *)H5MM_malloc((size_t)file->nsubfiles * sizeof(MPI_Offset))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for subfile sizes")
+    if(H5FD__mpio_subfiling_get_sizes(file, sizes) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get subfile sizes")
+
+    full_stripes = (hsize_t)file->eoa / file->stripe_size;
+    rem = (hsize_t)file->eoa % file->stripe_size;
+    last_subfile = (unsigned)(full_stripes % file->nsubfiles);
+    for(u = 0; u < file->nsubfiles; u++) {
+        MPI_Offset needed;              /* Size needed for this subfile */
+
+        needed = (MPI_Offset)((full_stripes / file->nsubfiles) * file->stripe_size);
+        if(u < last_subfile)
+            needed += (MPI_Offset)file->stripe_size;
+        else if(u == last_subfile)
+            needed += (MPI_Offset)rem;
+
+        if(sizes[u] != needed) {
+            if(MPI_SUCCESS != (mpi_code = MPI_File_set_size(file->subfiles[u], needed)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_set_size failed", mpi_code)
+            changed = TRUE;
+        } /* end if */
+    } /* end for */
+
+    /* Wait for all processes to finish the truncate, as for a single file */
+    if(changed)
+        if(MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
+
+done:
+    H5MM_xfree(sizes);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfiling_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_seg_list_append
+ *
+ * Purpose:     Appends a region to a list of logical file regions,
+ *              merging it with the previous region when they are
+ *              adjacent.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_seg_list_append(H5FD_mpio_seg_list_t *list, MPI_Offset off, MPI_Offset len)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(list);
+
+    if(len <= 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Merge with the last region, if possible */
+    if(list->nsegs > 0 && (list->segs[list->nsegs - 1].off + list->segs[list->nsegs - 1].len) == off) {
+        list->segs[list->nsegs - 1].len += len;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Extend the list, if necessary */
+    if(list->nsegs == list->nalloc) {
+        size_t nalloc = MAX(64, 2 * list->nalloc);
+        H5FD_mpio_seg_t *segs;
+
+        if(NULL == (segs = (H5FD_mpio_seg_t *)H5MM_realloc(list->segs, nalloc * sizeof(H5FD_mpio_seg_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for region list")
+        list->segs = segs;
+        list->nalloc = nalloc;
+    } /* end if */
+
+    list->segs[list->nsegs].off = off;
+    list->segs[list->nsegs].len = len;
+    list->nsegs++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_seg_list_append() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_seg_list_append_block
+ *
+ * Purpose:     Appends BLOCKLEN consecutive copies of a flattened
+ *              datatype (CHILD, with extent CHILD_EXTENT) starting at
+ *              displacement DISP.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_seg_list_append_block(H5FD_mpio_seg_list_t *list, const H5FD_mpio_seg_list_t *child,
+    MPI_Aint child_extent, MPI_Offset disp, int blocklen)
+{
+    int         i;                      /* Local index variable */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(list);
+    HDassert(child);
+
+    /* A dense child makes the whole block a single region */
+    if(1 == child->nsegs && 0 == child->segs[0].off && (MPI_Offset)child_extent == child->segs[0].len) {
+        if(H5FD__mpio_seg_list_append(list, disp, (MPI_Offset)blocklen * child->segs[0].len) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append region")
+    } /* end if */
+    else
+        for(i = 0; i < blocklen; i++)
+            for(u = 0; u < child->nsegs; u++)
+                if(H5FD__mpio_seg_list_append(list, disp + ((MPI_Offset)i * child_extent) + child->segs[u].off, child->segs[u].len) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append region")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_seg_list_append_block() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_flatten_type
+ *
+ * Purpose:     Appends the regions covered by an MPI datatype, relative
+ *              to displacement 0 and in type map order, to a region list.
+ *              The datatypes built by H5S_mpio_space_type() and the
+ *              dataset I/O code are supported.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_flatten_type(MPI_Datatype type, H5FD_mpio_seg_list_t *list)
+{
+    H5FD_mpio_seg_list_t child;         /* Flattened child datatype */
+    int        *ints = NULL;            /* Integer arguments of constructor */
+    MPI_Aint   *aints = NULL;           /* Address arguments of constructor */
+    MPI_Datatype *types = NULL;         /* Datatype arguments of constructor */
+    int         nints, naints, ntypes;  /* # of arguments of constructor */
+    int         combiner;               /* Type constructor */
+    int         i;                      /* Local index variable */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(list);
+
+    HDmemset(&child, 0, sizeof(child));
+
+    if(MPI_SUCCESS != (mpi_code = MPI_Type_get_envelope(type, &nints, &naints, &ntypes, &combiner)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_envelope failed", mpi_code)
+
+    /* Predefined types are a single region */
+    if(MPI_COMBINER_NAMED == combiner) {
+        int type_size;
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_size(type, &type_size)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_size failed", mpi_code)
+        if(H5FD__mpio_seg_list_append(list, (MPI_Offset)0, (MPI_Offset)type_size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append region")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Get the constructor's arguments */
+    if(NULL == (ints = (int *)H5MM_malloc((size_t)MAX(nints, 1) * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (aints = (MPI_Aint *)H5MM_malloc((size_t)MAX(naints, 1) * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (types = (MPI_Datatype *)H5MM_malloc((size_t)MAX(ntypes, 1) * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(MPI_SUCCESS != (mpi_code = MPI_Type_get_contents(type, nints, naints, ntypes, ints, aints, types)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_contents failed", mpi_code)
+
+    /* Flatten the child datatype(s) */
+    switch(combiner) {
+        case MPI_COMBINER_DUP:
+        case MPI_COMBINER_RESIZED:
+            /* (Resizing only changes the bounds, not the type map) */
+            if(H5FD__mpio_flatten_type(types[0], list) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+            break;
+
+        case MPI_COMBINER_STRUCT:
+            for(i = 0; i < ints[0]; i++) {
+                MPI_Aint lb, extent;
+
+                child.nsegs = 0;
+                if(H5FD__mpio_flatten_type(types[i], &child) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                if(MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(types[i], &lb, &extent)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+                if(H5FD__mpio_seg_list_append_block(list, &child, extent, (MPI_Offset)aints[i], ints[i + 1]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append regions")
+            } /* end for */
+            break;
+
+        case MPI_COMBINER_CONTIGUOUS:
+        case MPI_COMBINER_VECTOR:
+        case MPI_COMBINER_HVECTOR:
+        case MPI_COMBINER_INDEXED:
+        case MPI_COMBINER_HINDEXED:
+        case MPI_COMBINER_INDEXED_BLOCK:
+#if MPI_VERSION >= 3
+        case MPI_COMBINER_HINDEXED_BLOCK:
+#endif
+            {
+                MPI_Aint lb, extent;        /* Bounds of child datatype */
+                int count = ints[0];        /* # of blocks */
+
+                if(H5FD__mpio_flatten_type(types[0], &child) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                if(MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(types[0], &lb, &extent)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+
+                for(i = 0; i < (MPI_COMBINER_CONTIGUOUS == combiner ? 1 : count); i++) {
+                    MPI_Offset disp;        /* Displacement of block */
+                    int blocklen;           /* # of children in block */
+
+                    switch(combiner) {
+                        case MPI_COMBINER_CONTIGUOUS:
+                            disp = 0;
+                            blocklen = count;
+                            break;
+
+                        case MPI_COMBINER_VECTOR:
+                            disp = (MPI_Offset)i * ints[2] * extent;
+                            blocklen = ints[1];
+                            break;
+
+                        case MPI_COMBINER_HVECTOR:
+                            disp = (MPI_Offset)i * aints[0];
+                            blocklen = ints[1];
+                            break;
+
+                        case MPI_COMBINER_INDEXED:
+                            disp = (MPI_Offset)ints[count + 1 + i] * extent;
+                            blocklen = ints[1 + i];
+                            break;
+
+                        case MPI_COMBINER_HINDEXED:
+                            disp = (MPI_Offset)aints[i];
+                            blocklen = ints[1 + i];
+                            break;
+
+                        case MPI_COMBINER_INDEXED_BLOCK:
+                            disp = (MPI_Offset)ints[2 + i] * extent;
+                            blocklen = ints[1];
+                            break;
+
+                        default:
+                            /* MPI_COMBINER_HINDEXED_BLOCK */
+                            disp = (MPI_Offset)aints[i];
+                            blocklen = ints[1];
+                            break;
+                    } /* end switch */
+
+                    if(H5FD__mpio_seg_list_append_block(list, &child, extent, disp, blocklen) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append regions")
+                } /* end for */
+            }
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "MPI datatype not supported for subfiling")
+    } /* end switch */
+
+done:
+    /* Release the datatypes returned by MPI_Type_get_contents */
+    if(types) {
+        for(i = 0; i < ntypes; i++) {
+            int ni, na, nt, comb;
+
+            if(MPI_SUCCESS == MPI_Type_get_envelope(types[i], &ni, &na, &nt, &comb) && MPI_COMBINER_NAMED != comb)
+                MPI_Type_free(&types[i]);
+        } /* end for */
+        H5MM_xfree(types);
+    } /* end if */
+    H5MM_xfree(aints);
+    H5MM_xfree(ints);
+    H5MM_xfree(child.segs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_flatten_type() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfile_io
+ *
+ * Purpose:     Reads or writes a contiguous region of a subfile.  Reads
+ *              past the end of the subfile return zeros.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfile_io(MPI_File fh, hbool_t do_write, MPI_Offset off, unsigned char *buf,
+    MPI_Offset len)
+{
+    MPI_Status  mpi_stat;               /* Status from I/O operation */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(buf || 0 == len);
+
+    /* (Large regions are transferred in pieces, since MPI counts are ints) */
+    while(len > 0) {
+        int io_len = (int)MIN(len, (MPI_Offset)(1 << 30));
+        int count = 0;
+
+        HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+        if(do_write) {
+            if(MPI_SUCCESS != (mpi_code = MPI_File_write_at(fh, off, buf, io_len, MPI_BYTE, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
+            if(MPI_SUCCESS != (mpi_code = MPI_Get_count(&mpi_stat, MPI_BYTE, &count)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+            if(count != io_len)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end if */
+        else {
+            if(MPI_SUCCESS != (mpi_code = MPI_File_read_at(fh, off, buf, io_len, MPI_BYTE, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at failed", mpi_code)
+            if(MPI_SUCCESS != (mpi_code = MPI_Get_count(&mpi_stat, MPI_BYTE, &count)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+            if(count < 0 || count > io_len)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+            /* This gives us zeroes beyond end of the subfile */
+            if(count < io_len)
+                HDmemset(buf + count, 0, (size_t)(io_len - count));
+        } /* end else */
+
+        off += io_len;
+        buf += io_len;
+        len -= io_len;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfile_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_cmp_piece_dest
+ *
+ * Purpose:     Callback for qsort() to sort pieces of an I/O request by
+ *              their destination aggregator, keeping the order of the
+ *              data otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mpio_cmp_piece_dest(const void *_p1, const void *_p2)
+{
+    const H5FD_mpio_piece_t *p1 = (const H5FD_mpio_piece_t *)_p1;
+    const H5FD_mpio_piece_t *p2 = (const H5FD_mpio_piece_t *)_p2;
+
+    if(p1->dest != p2->dest)
+        return (p1->dest < p2->dest) ? -1 : 1;
+    return (p1->buf_off < p2->buf_off) ? -1 : (p1->buf_off > p2->buf_off);
+} /* end H5FD__mpio_cmp_piece_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_cmp_piece_addr
+ *
+ * Purpose:     Callback for qsort() to sort pieces of I/O requests by
+ *              their location in the subfiles.  Pieces are sorted by
+ *              pointer, so that their original order can be kept.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mpio_cmp_piece_addr(const void *_p1, const void *_p2)
+{
+    const H5FD_mpio_piece_t *p1 = *(const H5FD_mpio_piece_t * const *)_p1;
+    const H5FD_mpio_piece_t *p2 = *(const H5FD_mpio_piece_t * const *)_p2;
+
+    if(p1->subfile != p2->subfile)
+        return (p1->subfile < p2->subfile) ? -1 : 1;
+    if(p1->off != p2->off)
+        return (p1->off < p2->off) ? -1 : 1;
+    return (p1 < p2) ? -1 : (p1 > p2);
+} /* end H5FD__mpio_cmp_piece_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_aggregate
+ *
+ * Purpose:     Performs the I/O for the pieces of collective requests
+ *              received by an aggregator.  Pieces are sorted by their
+ *              location in the subfiles and adjacent pieces are combined
+ *              into a single access.  DATA holds the pieces' data, in the
+ *              order the pieces were received.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfiling_aggregate(const H5FD_mpio_t *file, hbool_t do_write,
+    H5FD_mpio_piece_t *pieces, size_t npieces, unsigned char *data)
+{
+    H5FD_mpio_piece_t **sorted = NULL;  /* Pieces, sorted by location */
+    unsigned char *run_buf = NULL;      /* Buffer for combined accesses */
+    size_t      run_buf_size = 0;       /* Size of run buffer */
+    MPI_Offset  data_off;               /* Offset of piece's data */
+    size_t      first, last;            /* First & last pieces in a run */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(pieces || 0 == npieces);
+
+    if(0 == npieces)
+        HGOTO_DONE(SUCCEED)
+
+    /* Use the piece's buffer offset to locate its data in DATA */
+    data_off = 0;
+    for(u = 0; u < npieces; u++) {
+        pieces[u].buf_off = data_off;
+        data_off += pieces[u].len;
+    } /* end for */
+
+    if(NULL == (sorted = (H5FD_mpio_piece_t **)H5MM_malloc(npieces * sizeof(H5FD_mpio_piece_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for piece list")
+    for(u = 0; u < npieces; u++)
+        sorted[u] = &pieces[u];
+    HDqsort(sorted, npieces, sizeof(H5FD_mpio_piece_t *), H5FD__mpio_cmp_piece_addr);
+
+    /* Combine runs of pieces into single accesses.  Writes only combine
+     * adjacent pieces, so overlapping writes are applied in order; reads
+     * also combine overlapping pieces.
+     */
+    for(first = 0; first < npieces; first = last) {
+        MPI_Offset run_off = sorted[first]->off;
+        MPI_Offset run_end = run_off + sorted[first]->len;
+        MPI_Offset run_len;
+
+        for(last = first + 1; last < npieces; last++) {
+            if(sorted[last]->subfile != sorted[first]->subfile)
+                break;
+            if(do_write ? (sorted[last]->off != run_end) : (sorted[last]->off > run_end))
+                break;
+            run_end = MAX(run_end, sorted[last]->off + sorted[last]->len);
+        } /* end for */
+        run_len = run_end - run_off;
+
+        /* Single pieces are accessed in place */
+        if(last == first + 1) {
+            if(H5FD__mpio_subfile_io(file->subfiles[sorted[first]->subfile], do_write, run_off, data + sorted[first]->buf_off, run_len) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't access subfile")
+            continue;
+        } /* end if */
+
+        if((size_t)run_len > run_buf_size) {
+            unsigned char *tmp;
+
+            if(NULL == (tmp = (unsigned char *)H5MM_realloc(run_buf, (size_t)run_len)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for run buffer")
+            run_buf = tmp;
+            run_buf_size = (size_t)run_len;
+        } /* end if */
+
+        if(do_write) {
+            for(u = first; u < last; u++)
+                HDmemcpy(run_buf + (sorted[u]->off - run_off), data + sorted[u]->buf_off, (size_t)sorted[u]->len);
+            if(H5FD__mpio_subfile_io(file->subfiles[sorted[first]->subfile], TRUE, run_off, run_buf, run_len) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to subfile")
+        } /* end if */
+        else {
+            if(H5FD__mpio_subfile_io(file->subfiles[sorted[first]->subfile], FALSE, run_off, run_buf, run_len) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read from subfile")
+            for(u = first; u < last; u++)
+                HDmemcpy(data + sorted[u]->buf_off, run_buf + (sorted[u]->off - run_off), (size_t)sorted[u]->len);
+        } /* end else */
+    } /* end for */
+
+done:
+    H5MM_xfree(run_buf);
+    H5MM_xfree(sorted);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfiling_aggregate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_subfiling_xfer
+ *
+ * Purpose:     Reads or writes data in a subfiled file.
+ *
+ *              The logical file regions accessed are determined from the
+ *              file's MPI datatype (when collective I/O is in effect) and
+ *              split at stripe boundaries into pieces, each of which lies
+ *              within a single subfile.
+ *
+ *              For independent I/O, each piece is accessed directly.
+ *
+ *              For collective I/O, a two-phase scheme is used: the
+ *              pieces, with their data for writes, are exchanged with the
+ *              aggregators for their subfiles, which sort and combine
+ *              them into large contiguous accesses to the subfiles.  For
+ *              reads, the data is then returned to the requesting
+ *              processes.  Each subfile is only accessed by its
+ *              aggregator, so there is no lock contention between nodes.
+ *
+ *              For writes, END_ADDR is set to the end of the logical
+ *              region written.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_subfiling_xfer(H5FD_mpio_t *file, H5FD_mem_t type, hbool_t do_write,
+    haddr_t addr, size_t size, void *buf, haddr_t *end_addr)
+{
+    H5FD_mpio_seg_list_t segs;          /* Logical file regions accessed */
+    H5FD_mpio_piece_t *pieces = NULL;   /* Pieces of the request */
+    H5FD_mpio_piece_t *recv_pieces = NULL;  /* Pieces received by an aggregator */
+    size_t      npieces = 0;            /* # of pieces */
+    size_t      npieces_alloc = 0;      /* # of pieces allocated */
+    MPI_Datatype buf_type = MPI_BYTE;   /* MPI description of the selection in memory */
+    MPI_Datatype file_type = MPI_BYTE;  /* MPI description of the selection in the file */
+    MPI_Datatype piece_type = MPI_DATATYPE_NULL;    /* MPI type for a piece */
+    hbool_t     piece_type_derived = FALSE; /* Whether the piece type was created */
+    hbool_t     collective = FALSE;     /* Whether to use two-phase I/O */
+    hbool_t     use_view = FALSE;       /* Whether a file type is used */
+    unsigned char *data = NULL;         /* Contiguous data for the request */
+    unsigned char *pack_buf = NULL;     /* Buffer for (un)packing the memory type */
+    unsigned char *send_data = NULL;    /* Data sent to aggregators */
+    unsigned char *recv_data = NULL;    /* Data received by aggregator */
+    int        *counts = NULL;          /* Counts & displacements for exchanges */
+    MPI_Offset  total;                  /* # of bytes requested */
+    MPI_Offset  mpi_off;                /* Address as an MPI offset */
+    size_t      u;                      /* Local index variable */
+    int         mpi_code;               /* MPI return code */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->nsubfiles > 0);
+    HDassert(buf);
+
+    HDmemset(&segs, 0, sizeof(segs));
+
+    if(H5FD_mpi_haddr_to_MPIOff(addr, &mpi_off) < 0)
+        HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from haddr to MPI off")
+
+    /* Determine the I/O mode, in the same way as the regular I/O paths:
+     * reads only use the MPI datatypes for raw data.
+     */
+    if(do_write || type == H5FD_MEM_DRAW) {
+        H5FD_mpio_xfer_t xfer_mode;     /* I/O transfer mode */
+
+        if(H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+        if(xfer_mode == H5FD_MPIO_COLLECTIVE) {
+            H5FD_mpio_collective_opt_t coll_opt_mode;
+
+            use_view = TRUE;
+            if(H5CX_get_mpi_coll_datatypes(&buf_type, &file_type) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O datatypes")
+            if(H5CX_get_mpio_coll_opt(&coll_opt_mode) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+            collective = (hbool_t)(coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO);
+        } /* end if */
+    } /* end if */
+
+    /* Compute the number of bytes requested */
+    {
+        int type_size;
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_size(buf_type, &type_size)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_size failed", mpi_code)
+        total = (MPI_Offset)type_size * (MPI_Offset)size;
+    }
+
+    /* Determine the logical file regions accessed */
+    if(use_view && MPI_BYTE != file_type) {
+        H5FD_mpio_seg_list_t ftype_segs;    /* Regions of one file type */
+        MPI_Aint lb, extent;                /* Bounds of file type */
+        MPI_Offset remaining = total;       /* # of bytes left to place */
+        MPI_Offset tile;                    /* Offset of current tile */
+
+        HDmemset(&ftype_segs, 0, sizeof(ftype_segs));
+        if(H5FD__mpio_flatten_type(file_type, &ftype_segs) < 0) {
+            H5MM_xfree(ftype_segs.segs);
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten file datatype")
+        } /* end if */
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(file_type, &lb, &extent))) {
+            H5MM_xfree(ftype_segs.segs);
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+        } /* end if */
+
+        /* The file type is tiled to cover the data, as for a file view */
+        for(tile = mpi_off; remaining > 0 && ftype_segs.nsegs > 0; tile += extent)
+            for(u = 0; u < ftype_segs.nsegs && remaining > 0; u++) {
+                MPI_Offset len = MIN(ftype_segs.segs[u].len, remaining);
+
+                if(H5FD__mpio_seg_list_append(&segs, tile + ftype_segs.segs[u].off, len) < 0) {
+                    H5MM_xfree(ftype_segs.segs);
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append region")
+                } /* end if */
+                remaining -= len;
+            } /* end for */
+        H5MM_xfree(ftype_segs.segs);
+
+        if(remaining > 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file datatype doesn't cover data")
+    } /* end if */
+    else
+        if(H5FD__mpio_seg_list_append(&segs, mpi_off, total) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTAPPEND, FAIL, "can't append region")
+
+    /* Get the data into a contiguous buffer */
+    if(MPI_BYTE == buf_type)
+        data = (unsigned char *)buf;
+    else {
+        int pack_size;
+        int position = 0;
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Pack_size((int)size, buf_type, file->comm, &pack_size)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Pack_size failed", mpi_code)
+        if(NULL == (pack_buf = (unsigned char *)H5MM_malloc((size_t)MAX(pack_size, 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pack buffer")
+        if(do_write) {
+            if(MPI_SUCCESS != (mpi_code = MPI_Pack(buf, (int)size, buf_type, pack_buf, pack_size, &position, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Pack failed", mpi_code)
+            HDassert((MPI_Offset)position == total);
+        } /* end if */
+        data = pack_buf;
+    } /* end else */
+
+    /* Split the regions into pieces within single stripes */
+    for(u = 0; u < segs.nsegs; u++) {
+        MPI_Offset off = segs.segs[u].off;
+        MPI_Offset end = off + segs.segs[u].len;
+
+        while(off < end) {
+            hsize_t stripe = (hsize_t)off / file->stripe_size;
+            hsize_t within = (hsize_t)off % file->stripe_size;
+            MPI_Offset len = MIN(end - off, (MPI_Offset)(file->stripe_size - within));
+
+            if(npieces == npieces_alloc) {
+                H5FD_mpio_piece_t *tmp;
+
+                npieces_alloc = MAX(64, 2 * npieces_alloc);
+                if(NULL == (tmp = (H5FD_mpio_piece_t *)H5MM_realloc(pieces, npieces_alloc * sizeof(H5FD_mpio_piece_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for piece list")
+                pieces = tmp;
+            } /* end if */
+
+            pieces[npieces].subfile = (int)(stripe % file->nsubfiles);
+            pieces[npieces].off = (MPI_Offset)(((stripe / file->nsubfiles) * file->stripe_size) + within);
+            pieces[npieces].len = len;
+            pieces[npieces].buf_off = (npieces > 0) ? (pieces[npieces - 1].buf_off + pieces[npieces - 1].len) : 0;
+            pieces[npieces].dest = file->aggregators[pieces[npieces].subfile];
+            npieces++;
+
+            off += len;
+        } /* end while */
+    } /* end for */
+
+    if(!collective) {
+        /* Access each piece directly */
+        for(u = 0; u < npieces; u++)
+            if(H5FD__mpio_subfile_io(file->subfiles[pieces[u].subfile], do_write, pieces[u].off, data + pieces[u].buf_off, pieces[u].len) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't access subfile")
+    } /* end if */
+    else {
+        int        *send_counts, *send_displs;  /* Piece counts & displacements sent */
+        int        *recv_counts, *recv_displs;  /* Piece counts & displacements received */
+        int        *send_bytes, *send_bdispls;  /* Data sizes & displacements sent */
+        int        *recv_bytes, *recv_bdispls;  /* Data sizes & displacements received */
+        size_t      nrecv_pieces = 0;           /* # of pieces received */
+        MPI_Offset  send_total = 0, recv_total = 0; /* Total data sent & received */
+        int         mpi_size = file->mpi_size;
+        int         r;                          /* Local index variable */
+
+        if(NULL == (counts = (int *)H5MM_calloc(8 * (size_t)mpi_size * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for exchange counts")
+        send_counts = counts;
+        send_displs = send_counts + mpi_size;
+        recv_counts = send_displs + mpi_size;
+        recv_displs = recv_counts + mpi_size;
+        send_bytes = recv_displs + mpi_size;
+        send_bdispls = send_bytes + mpi_size;
+        recv_bytes = send_bdispls + mpi_size;
+        recv_bdispls = recv_bytes + mpi_size;
+
+        /* Order the pieces by aggregator */
+        if(npieces > 1)
+            HDqsort(pieces, npieces, sizeof(H5FD_mpio_piece_t), H5FD__mpio_cmp_piece_dest);
+        for(u = 0; u < npieces; u++)
+            send_total += pieces[u].len;
+        if(send_total > (MPI_Offset)INT_MAX)
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "too much data for subfiling exchange")
+        for(u = 0; u < npieces; u++) {
+            send_counts[pieces[u].dest]++;
+            send_bytes[pieces[u].dest] += (int)pieces[u].len;
+        } /* end for */
+
+        /* Exchange the piece counts */
+        if(MPI_SUCCESS != (mpi_code = MPI_Alltoall(send_counts, 1, MPI_INT, recv_counts, 1, MPI_INT, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
+
+        for(r = 0; r < mpi_size; r++) {
+            if(r > 0) {
+                send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+                recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+                send_bdispls[r] = send_bdispls[r - 1] + send_bytes[r - 1];
+            } /* end if */
+            nrecv_pieces += (size_t)recv_counts[r];
+        } /* end for */
+
+        /* Exchange the pieces */
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_contiguous((int)sizeof(H5FD_mpio_piece_t), MPI_BYTE, &piece_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_contiguous failed", mpi_code)
+        piece_type_derived = TRUE;
+        if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&piece_type)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+        if(NULL == (recv_pieces = (H5FD_mpio_piece_t *)H5MM_malloc(MAX(nrecv_pieces, 1) * sizeof(H5FD_mpio_piece_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for received pieces")
+        if(MPI_SUCCESS != (mpi_code = MPI_Alltoallv(pieces, send_counts, send_displs, piece_type,
+                recv_pieces, recv_counts, recv_displs, piece_type, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+        /* Determine the amount of data received from each process */
+        for(r = 0; r < mpi_size; r++) {
+            MPI_Offset nbytes = 0;
+            int i;
+
+            for(i = 0; i < recv_counts[r]; i++)
+                nbytes += recv_pieces[recv_displs[r] + i].len;
+            if(recv_total + nbytes > (MPI_Offset)INT_MAX)
+                HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "too much data for subfiling exchange")
+            recv_bytes[r] = (int)nbytes;
+            recv_bdispls[r] = (int)recv_total;
+            recv_total += nbytes;
+        } /* end for */
+
+        if(NULL == (send_data = (unsigned char *)H5MM_malloc((size_t)MAX(send_total, 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for send buffer")
+        if(NULL == (recv_data = (unsigned char *)H5MM_malloc((size_t)MAX(recv_total, 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for receive buffer")
+
+        if(do_write) {
+            MPI_Offset pos = 0;
+
+            /* Send the data to the aggregators, in piece order */
+            for(u = 0; u < npieces; u++) {
+                HDmemcpy(send_data + pos, data + pieces[u].buf_off, (size_t)pieces[u].len);
+                pos += pieces[u].len;
+            } /* end for */
+            if(MPI_SUCCESS != (mpi_code = MPI_Alltoallv(send_data, send_bytes, send_bdispls, MPI_BYTE,
+                    recv_data, recv_bytes, recv_bdispls, MPI_BYTE, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+
+            /* Write the received pieces to the subfiles */
+            if(H5FD__mpio_subfiling_aggregate(file, TRUE, recv_pieces, nrecv_pieces, recv_data) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to subfiles")
+        } /* end if */
+        else {
+            MPI_Offset pos = 0;
+
+            /* Read the requested pieces from the subfiles */
+            if(H5FD__mpio_subfiling_aggregate(file, FALSE, recv_pieces, nrecv_pieces, recv_data) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read from subfiles")
+
+            /* Return the data to the requesting processes */
+            if(MPI_SUCCESS != (mpi_code = MPI_Alltoallv(recv_data, recv_bytes, recv_bdispls, MPI_BYTE,
+                    send_data, send_bytes, send_bdispls, MPI_BYTE, file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Alltoallv failed", mpi_code)
+            for(u = 0; u < npieces; u++) {
+                HDmemcpy(data + pieces[u].buf_off, send_data + pos, (size_t)pieces[u].len);
+                pos += pieces[u].len;
+            } /* end for */
+        } /* end else */
+    } /* end else */
+
+    /* Unpack data read into the memory type */
+    if(!do_write && pack_buf) {
+        int position = 0;
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Unpack(pack_buf, (int)total, &position, buf, (int)size, buf_type, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Unpack failed", mpi_code)
+    } /* end if */
+
+    /* Determine the end of the logical region written */
+    if(end_addr) {
+        *end_addr = HADDR_UNDEF;
+        for(u = 0; u < segs.nsegs; u++) {
+            haddr_t seg_end = H5FD_mpi_MPIOff_to_haddr(segs.segs[u].off + segs.segs[u].len);
+
+            if(!H5F_addr_defined(*end_addr) || seg_end > *end_addr)
+                *end_addr = seg_end;
+        } /* end for */
+    } /* end if */
+
+done:
+    if(piece_type_derived)
+        MPI_Type_free(&piece_type);
+    H5MM_xfree(counts);
+    H5MM_xfree(recv_data);
+    H5MM_xfree(send_data);
+    H5MM_xfree(pack_buf);
+    H5MM_xfree(recv_pieces);
+    H5MM_xfree(pieces);
+    H5MM_xfree(segs.segs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_subfiling_xfer() */
+
+
 #endif /* H5_HAVE_PARALLEL */
 
@@ -48,6 +48,10 @@ H5_DLL hid_t H5FD_mpio_init(void);
 H5_DLL herr_t H5Pset_fapl_mpio(hid_t fapl_id, MPI_Comm comm, MPI_Info info);
 H5_DLL herr_t H5Pget_fapl_mpio(hid_t fapl_id, MPI_Comm *comm/*out*/,
 			MPI_Info *info/*out*/);
+H5_DLL herr_t H5Pset_fapl_mpio_subfiling(hid_t fapl_id, unsigned ranks_per_subfile,
+                        hsize_t stripe_size);
+H5_DLL herr_t H5Pget_fapl_mpio_subfiling(hid_t fapl_id, unsigned *ranks_per_subfile/*out*/,
+                        hsize_t *stripe_size/*out*/);
 H5_DLL herr_t H5Pset_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t xfer_mode);
 H5_DLL herr_t H5Pget_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t *xfer_mode/*out*/);
 H5_DLL herr_t H5Pset_dxpl_mpio_collective_opt(hid_t dxpl_id, H5FD_mpio_collective_opt_t opt_mode);
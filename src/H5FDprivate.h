@@ -100,6 +100,8 @@ typedef struct {
 typedef struct H5FD_mpio_fapl_t {
     MPI_Comm		comm;		/*communicator			*/
     MPI_Info		info;		/*file information		*/
+    hsize_t             subfiling_stripe_size;  /*stripe size when subfiling (0 if not subfiling) */
+    unsigned            subfiling_ranks;        /*ranks per subfile (0 for one subfile per node) */
 } H5FD_mpio_fapl_t;
 #endif /* H5_HAVE_PARALLEL */
 
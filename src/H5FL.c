@@ -34,6 +34,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5MMprivate.h"	/* Memory management			*/
+#include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 /*
  * Private type definitions
@@ -52,6 +53,29 @@ static size_t H5FL_blk_lst_mem_lim=1024*1024;   /* Default to 1024KB (1MB) limit
 static size_t H5FL_fac_glb_mem_lim=16*1024*1024; /* Default to 16MB limit on all factory free lists */
 static size_t H5FL_fac_lst_mem_lim=1024*1024;     /* Default to 1024KB (1MB) limit on each factory free list */
 
+/* Amount of memory a free list is trimmed down to when it exceeds its limit.
+ * Keeping part of the list avoids going straight back to malloc() for the
+ * next burst of allocations.
+ */
+#define H5FL_TRIM_TARGET(lim)   ((lim) / 2)
+
+/*
+    Size classes for block free lists.  Block sizes are rounded up to a
+    multiple of H5FL_BLK_SMALL_ALIGN bytes up to H5FL_BLK_SMALL_MAX bytes, and
+    to one of 2^H5FL_BLK_SUBCLASS_BITS evenly spaced sizes between each larger
+    pair of powers of two, so blocks of similar sizes share a free list and
+    at most 1/8th of a large block is wasted.  The free lists for blocks of
+    up to 2^H5FL_BLK_INDEXED_LOG2 bytes are found directly from the size
+    class, larger ones are searched for in the priority queue.
+ */
+#define H5FL_BLK_SMALL_LOG2     7
+#define H5FL_BLK_SMALL_MAX      ((size_t)1 << H5FL_BLK_SMALL_LOG2)
+#define H5FL_BLK_SMALL_ALIGN    16
+#define H5FL_BLK_SUBCLASS_BITS  3
+#define H5FL_BLK_INDEXED_LOG2   32
+#define H5FL_BLK_NCLASSES       ((H5FL_BLK_SMALL_MAX / H5FL_BLK_SMALL_ALIGN) + \
+        ((size_t)(H5FL_BLK_INDEXED_LOG2 - H5FL_BLK_SMALL_LOG2) << H5FL_BLK_SUBCLASS_BITS))
+
 /* A garbage collection node for regular free lists */
 typedef struct H5FL_reg_gc_node_t {
     H5FL_reg_head_t *list;              /* Pointer to the head of the list to garbage collect */
@@ -131,16 +155,18 @@ static H5FL_track_t *H5FL_out_head_g = NULL;
 
 /* Forward declarations of local static functions */
 static herr_t H5FL__reg_gc(void);
-static herr_t H5FL__reg_gc_list(H5FL_reg_head_t *head);
+static herr_t H5FL__reg_gc_list(H5FL_reg_head_t *head, size_t keep);
 static int H5FL__reg_term(void);
 static herr_t H5FL__arr_gc(void);
-static herr_t H5FL__arr_gc_list(H5FL_arr_head_t *head);
+static herr_t H5FL__arr_gc_list(H5FL_arr_head_t *head, size_t keep);
 static int H5FL__arr_term(void);
+static size_t H5FL__blk_size_class(size_t size, size_t *class_size);
 static herr_t H5FL__blk_gc(void);
 static herr_t H5FL__blk_gc_list(H5FL_blk_head_t *head);
+static herr_t H5FL__blk_trim_list(H5FL_blk_head_t *head, size_t keep);
 static int H5FL__blk_term(void);
 static herr_t H5FL__fac_gc(void);
-static herr_t H5FL__fac_gc_list(H5FL_fac_head_t *head);
+static herr_t H5FL__fac_gc_list(H5FL_fac_head_t *head, size_t keep);
 static int H5FL__fac_term_all(void);
 
 /* Declare a free list to manage the H5FL_blk_node_t struct */
@@ -379,7 +405,7 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->onlist * head->size > H5FL_reg_lst_mem_lim)
-        if(H5FL__reg_gc_list(head) < 0)
+        if(H5FL__reg_gc_list(head, H5FL_TRIM_TARGET(H5FL_reg_lst_mem_lim)) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on regular free lists */
@@ -510,7 +536,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5FL__reg_gc_list
  *
- * Purpose:	Garbage collect on a particular object free list
+ * Purpose:	Garbage collect on a particular object free list, releasing
+ *      objects until no more than KEEP bytes remain on it.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -521,37 +548,33 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__reg_gc_list(H5FL_reg_head_t *head)
+H5FL__reg_gc_list(H5FL_reg_head_t *head, size_t keep)
 {
     H5FL_reg_node_t *free_list; /* Pointer to nodes in free list being garbage collected */
-    size_t total_mem;   /* Total memory used on list */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Calculate the total memory used on this list */
-    total_mem = head->onlist * head->size;
-
-    /* For each free list being garbage collected, walk through the nodes and free them */
+    /* Walk through the nodes in the free list, freeing them */
     free_list = head->list;
-    while(free_list != NULL) {
+    while(free_list != NULL && head->onlist * head->size > keep) {
         void *tmp;          /* Temporary node pointer */
 
         tmp = free_list->next;
 
         /* Decrement the count of nodes allocated and free the node */
         head->allocated--;
+        head->onlist--;
+
+        /* Decrement global count of free memory on "regular" lists */
+        H5FL_reg_gc_head.mem_freed -= head->size;
 
         H5MM_free(free_list);
 
         free_list = (H5FL_reg_node_t *)tmp;
     } /* end while */
 
-    /* Indicate no free nodes on the free list */
-    head->list = NULL;
-    head->onlist = 0;
-
-    /* Decrement global count of free memory on "regular" lists */
-    H5FL_reg_gc_head.mem_freed -= total_mem;
+    /* Point the free list at the remaining nodes */
+    head->list = free_list;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* end H5FL__reg_gc_list() */
@@ -586,7 +609,7 @@ H5FL__reg_gc(void)
     gc_node = H5FL_reg_gc_head.first;
     while(gc_node != NULL) {
         /* Release the free nodes on the list */
-        if(H5FL__reg_gc_list(gc_node->list) < 0)
+        if(H5FL__reg_gc_list(gc_node->list, (size_t)0) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -668,13 +691,58 @@ printf("%s: head->name = %s, head->allocated = %d\n", FUNC, H5FL_reg_gc_head.fir
     FUNC_LEAVE_NOAPI(H5FL_reg_gc_head.first != NULL ? 1 : 0)
 }   /* end H5FL__reg_term() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_size_class
+ *
+ * Purpose:	Finds the size class for blocks of a given size.
+ *
+ * Return:	Index of the size class (which may be too large for the free
+ *      list index of a block free list), with the size of the blocks
+ *      in the class returned in CLASS_SIZE.
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5FL__blk_size_class(size_t size, size_t *class_size)
+{
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(size);
+    HDassert(class_size);
+
+    if(size <= H5FL_BLK_SMALL_MAX) {
+        ret_value = (size + (H5FL_BLK_SMALL_ALIGN - 1)) / H5FL_BLK_SMALL_ALIGN;
+        *class_size = ret_value * H5FL_BLK_SMALL_ALIGN;
+        ret_value--;
+    } /* end if */
+    else {
+        unsigned log2 = H5VM_log2_gen((uint64_t)(size - 1));   /* Power of two below the size */
+        unsigned shift = log2 - H5FL_BLK_SUBCLASS_BITS;    /* Log2 of the distance between classes */
+        size_t sub = ((size - 1) >> shift) & (((size_t)1 << H5FL_BLK_SUBCLASS_BITS) - 1);
+
+        *class_size = ((size_t)1 << log2) + ((sub + 1) << shift);
+        ret_value = (H5FL_BLK_SMALL_MAX / H5FL_BLK_SMALL_ALIGN) +
+                ((size_t)(log2 - H5FL_BLK_SMALL_LOG2) << H5FL_BLK_SUBCLASS_BITS) + sub;
+
+        /* Don't round sizes at the very top of the address space */
+        if(*class_size < size)
+            *class_size = size;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__blk_size_class() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FL_blk_find_list
  *
- * Purpose:	Finds the free list for blocks of a given size.  Also moves that
- *      free list node to the head of the priority queue (if it isn't there
- *      already).  This routine does not manage the actual free list, it just
+ * Purpose:	Finds the free list for blocks of a given size class.  Also
+ *      moves that free list node to the head of the priority queue (if it
+ *      isn't there already), which keeps the queue in most recently used
+ *      order.  This routine does not manage the actual free list, it just
  *      works with the priority queue.
  *
  * Return:	Success:	valid pointer to the free list node
@@ -689,43 +757,33 @@ printf("%s: head->name = %s, head->allocated = %d\n", FUNC, H5FL_reg_gc_head.fir
  *-------------------------------------------------------------------------
  */
 static H5FL_blk_node_t *
-H5FL_blk_find_list(H5FL_blk_node_t **head, size_t size)
+H5FL_blk_find_list(H5FL_blk_head_t *head, size_t size, size_t class_idx)
 {
     H5FL_blk_node_t *temp = NULL;  /* Temp. pointer to node in the native list */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     /* Find the correct free list */
-    temp=*head;
-
-    /* Check if the node is at the head of the list */
-    if(temp && temp->size!=size) {
-        temp=temp->next;
-
-        while(temp!=NULL) {
-            /* Check if we found the correct node */
-            if(temp->size==size) {
-                /* Take the node found out of it's current position */
-                if(temp->next==NULL) {
-                    temp->prev->next=NULL;
-                } /* end if */
-                else {
-                    temp->prev->next=temp->next;
-                    temp->next->prev=temp->prev;
-                } /* end else */
-
-                /* Move the found node to the head of the list */
-                temp->prev=NULL;
-                temp->next=*head;
-                (*head)->prev=temp;
-                *head=temp;
-
-                /* Get out */
-                break;
-            } /* end if */
-
-            temp=temp->next;
-        } /* end while */
+    if(class_idx < H5FL_BLK_NCLASSES)
+        temp = head->classes[class_idx];
+    else {
+        temp = head->head;
+        while(temp != NULL && temp->size != size)
+            temp = temp->next;
+    } /* end else */
+    HDassert(temp == NULL || temp->size == size);
+
+    /* Move the found node to the head of the queue */
+    if(temp && temp != head->head) {
+        /* Take the node found out of it's current position */
+        temp->prev->next = temp->next;
+        if(temp->next)
+            temp->next->prev = temp->prev;
+
+        temp->prev = NULL;
+        temp->next = head->head;
+        head->head->prev = temp;
+        head->head = temp;
     } /* end if */
 
     FUNC_LEAVE_NOAPI(temp)
@@ -735,8 +793,8 @@ H5FL_blk_find_list(H5FL_blk_node_t **head, size_t size)
 /*-------------------------------------------------------------------------
  * Function:	H5FL_blk_create_list
  *
- * Purpose:	Creates a new free list for blocks of the given size at the
- *      head of the priority queue.
+ * Purpose:	Creates a new free list for blocks of the given size class at
+ *      the head of the priority queue.
  *
  * Return:	Success:	valid pointer to the free list node
  *
@@ -750,7 +808,7 @@ H5FL_blk_find_list(H5FL_blk_node_t **head, size_t size)
  *-------------------------------------------------------------------------
  */
 static H5FL_blk_node_t *
-H5FL_blk_create_list(H5FL_blk_node_t **head, size_t size)
+H5FL_blk_create_list(H5FL_blk_head_t *head, size_t size, size_t class_idx)
 {
     H5FL_blk_node_t *temp;  /* Temp. pointer to node in the list */
     H5FL_blk_node_t *ret_value = NULL;          /* Return value */
@@ -766,16 +824,15 @@ H5FL_blk_create_list(H5FL_blk_node_t **head, size_t size)
     temp->list=NULL;
 
     /* Attach to head of priority queue */
-    if(*head==NULL) {
-        *head=temp;
-        temp->next=temp->prev=NULL;
-    } /* end if */
-    else {
-        temp->next=*head;
-        (*head)->prev=temp;
-        temp->prev=NULL;
-        *head=temp;
-    } /* end else */
+    temp->prev = NULL;
+    temp->next = head->head;
+    if(head->head)
+        head->head->prev = temp;
+    head->head = temp;
+
+    /* Index the free list by its size class */
+    if(class_idx < H5FL_BLK_NCLASSES)
+        head->classes[class_idx] = temp;
 
     ret_value=temp;
 
@@ -808,9 +865,15 @@ H5FL_blk_init(H5FL_blk_head_t *head)
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* Allocate the index of free lists by size class */
+    if(NULL == (head->classes = (H5FL_blk_node_t **)H5MM_calloc(H5FL_BLK_NCLASSES * sizeof(H5FL_blk_node_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
     /* Allocate a new garbage collection node */
-    if(NULL == (new_node = (H5FL_blk_gc_node_t *)H5MM_malloc(sizeof(H5FL_blk_gc_node_t))))
+    if(NULL == (new_node = (H5FL_blk_gc_node_t *)H5MM_malloc(sizeof(H5FL_blk_gc_node_t)))) {
+        head->classes = (H5FL_blk_node_t **)H5MM_xfree(head->classes);
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    } /* end if */
 
     /* Initialize the new garbage collection node */
     new_node->pq = head;
@@ -847,6 +910,8 @@ htri_t
 H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 {
     H5FL_blk_node_t *free_list; /* The free list of nodes of correct size */
+    size_t class_size;          /* Size of blocks in the size class */
+    size_t class_idx;           /* Index of the size class */
     htri_t ret_value = FAIL;    /* Return value */
 
     FUNC_ENTER_NOAPI_NOERR
@@ -856,7 +921,8 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
-    if((free_list = H5FL_blk_find_list(&(head->head), size)) != NULL && free_list->list != NULL)
+    class_idx = H5FL__blk_size_class(size, &class_size);
+    if(head->init && (free_list = H5FL_blk_find_list(head, class_size, class_idx)) != NULL && free_list->list != NULL)
         ret_value = TRUE;
     else
         ret_value = FALSE;
@@ -887,6 +953,7 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
 {
     H5FL_blk_node_t *free_list; /* The free list of nodes of correct size */
     H5FL_blk_list_t *temp;      /* Temp. ptr to the new native list allocated */
+    size_t class_idx;           /* Index of the size class */
     void *ret_value = NULL;     /* Pointer to the block to return to the user */
 
     FUNC_ENTER_NOAPI(NULL)
@@ -900,9 +967,12 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         if(H5FL_blk_init(head)<0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list")
 
+    /* Round the size up to its size class */
+    class_idx = H5FL__blk_size_class(size, &size);
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
-    if((free_list=H5FL_blk_find_list(&(head->head),size))!=NULL && free_list->list!=NULL) {
+    if((free_list=H5FL_blk_find_list(head,size,class_idx))!=NULL && free_list->list!=NULL) {
         /* Remove the first node from the free list */
         temp=free_list->list;
         free_list->list=free_list->list->next;
@@ -1021,6 +1091,8 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     H5FL_blk_node_t *free_list;      /* The free list of nodes of correct size */
     H5FL_blk_list_t *temp;      /* Temp. ptr to the new free list node allocated */
     size_t free_size;           /* Size of the block freed */
+    size_t class_size;          /* Size of blocks in the size class */
+    size_t class_idx;           /* Index of the size class */
     void *ret_value=NULL;       /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_blk_malloc/calloc
@@ -1065,9 +1137,12 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
 #endif /* H5FL_DEBUG */
 
     /* check if there is a free list for native blocks of this size */
-    if((free_list=H5FL_blk_find_list(&(head->head),free_size))==NULL) {
+    /* (The block's size is already a class size) */
+    class_idx = H5FL__blk_size_class(free_size, &class_size);
+    HDassert(class_size == free_size);
+    if((free_list=H5FL_blk_find_list(head,free_size,class_idx))==NULL) {
         /* No free list available, create a new list node and insert it to the queue */
-        free_list=H5FL_blk_create_list(&(head->head),free_size);
+        free_list=H5FL_blk_create_list(head,free_size,class_idx);
         HDassert(free_list);
     } /* end if */
 
@@ -1087,7 +1162,7 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->list_mem > H5FL_blk_lst_mem_lim)
-        if(H5FL__blk_gc_list(head) < 0)
+        if(H5FL__blk_trim_list(head, H5FL_TRIM_TARGET(H5FL_blk_lst_mem_lim)) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on block free lists */
@@ -1131,12 +1206,17 @@ H5FL_blk_realloc(H5FL_blk_head_t *head, void *block, size_t new_size H5FL_TRACK_
     /* Check if we are actually re-allocating a block */
     if(block!=NULL) {
         H5FL_blk_list_t *temp;      /* Temp. ptr to the new block node allocated */
+        size_t class_size;          /* Size of blocks in the new size's class */
 
         /* Get the pointer to the chunk info header in front of the chunk to free */
         temp=(H5FL_blk_list_t *)((unsigned char *)block - (sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE)); /*lint !e826 Pointer-to-pointer cast is appropriate here */
 
         /* check if we are actually changing the size of the buffer */
-        if(new_size!=temp->size) {
+        /* (blocks are allocated with the size of their size class, so the
+         *  block doesn't need to change if the new size is in the same class)
+         */
+        (void)H5FL__blk_size_class(new_size, &class_size);
+        if(class_size != temp->size) {
             size_t blk_size;           /* Temporary block size */
 
             if((ret_value=H5FL_blk_malloc(head,new_size H5FL_TRACK_INFO_INT))==NULL)
@@ -1230,6 +1310,8 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
     /* Indicate no free nodes on the free list */
     head->head = NULL;
     head->onlist = 0;
+    if(head->classes)
+        HDmemset(head->classes, 0, H5FL_BLK_NCLASSES * sizeof(H5FL_blk_node_t *));
 
     /* Double check that all the memory on this list is recycled */
     HDassert(0 == head->list_mem);
@@ -1237,6 +1319,76 @@ H5FL__blk_gc_list(H5FL_blk_head_t *head)
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* end H5FL__blk_gc_list() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_trim_list
+ *
+ * Purpose:	Releases blocks from a priority queue until no more than KEEP
+ *      bytes remain on it.  The blocks of the least recently used size
+ *      classes are released first, so block sizes that are still in use
+ *      stay on the free lists.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__blk_trim_list(H5FL_blk_head_t *head, size_t keep)
+{
+    H5FL_blk_node_t *node;      /* Free list for a size class */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Find the least recently used free list, at the tail of the queue */
+    node = head->head;
+    while(node != NULL && node->next != NULL)
+        node = node->next;
+
+    /* Walk back up the queue, freeing blocks */
+    while(node != NULL && head->list_mem > keep) {
+        H5FL_blk_node_t *prev = node->prev;    /* Next more recently used list */
+
+        while(node->list != NULL && head->list_mem > keep) {
+            H5FL_blk_list_t *next = node->list->next;   /* Next block on list */
+
+            /* Decrement the number of blocks & memory allocated from this PQ */
+            head->allocated--;
+            head->onlist--;
+            head->list_mem -= node->size;
+
+            /* Decrement global count of free memory on "block" lists */
+            H5FL_blk_gc_head.mem_freed -= node->size;
+
+            /* Free the block */
+            H5MM_free(node->list);
+            node->list = next;
+        } /* end while */
+
+        /* Release the free list node, if it's empty */
+        if(NULL == node->list) {
+            size_t class_size;      /* Size of blocks in the size class */
+            size_t class_idx;       /* Index of the size class */
+
+            if(prev)
+                prev->next = node->next;
+            else
+                head->head = node->next;
+            if(node->next)
+                node->next->prev = prev;
+
+            class_idx = H5FL__blk_size_class(node->size, &class_size);
+            if(class_idx < H5FL_BLK_NCLASSES)
+                head->classes[class_idx] = NULL;
+            node = H5FL_FREE(H5FL_blk_node_t, node);
+        } /* end if */
+
+        node = prev;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* end H5FL__blk_trim_list() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FL__blk_gc
@@ -1325,6 +1477,7 @@ printf("%s: head->name = %s, head->allocated = %d\n", FUNC, H5FL_blk_gc_head.fir
         else {
             /* Reset the "initialized" flag, in case we restart this list somehow (I don't know how..) */
             H5FL_blk_gc_head.first->pq->init = FALSE;
+            H5FL_blk_gc_head.first->pq->classes = (H5FL_blk_node_t **)H5MM_xfree(H5FL_blk_gc_head.first->pq->classes);
 
             /* Free the node from the garbage collection list */
             H5MM_free(H5FL_blk_gc_head.first);
@@ -1457,7 +1610,7 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->list_mem > H5FL_arr_lst_mem_lim)
-        if(H5FL__arr_gc_list(head) < 0)
+        if(H5FL__arr_gc_list(head, H5FL_TRIM_TARGET(H5FL_arr_lst_mem_lim)) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on array free lists */
@@ -1646,7 +1799,9 @@ H5FL_arr_realloc(H5FL_arr_head_t *head, void * obj, size_t new_elem)
 /*-------------------------------------------------------------------------
  * Function:	H5FL__arr_gc_list
  *
- * Purpose:	Garbage collect on an array object free list
+ * Purpose:	Garbage collect on an array object free list, releasing
+ *      arrays until no more than KEEP bytes remain on it.  The largest
+ *      arrays are released first.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -1657,49 +1812,36 @@ H5FL_arr_realloc(H5FL_arr_head_t *head, void * obj, size_t new_elem)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__arr_gc_list(H5FL_arr_head_t *head)
+H5FL__arr_gc_list(H5FL_arr_head_t *head, size_t keep)
 {
     unsigned u;     /* Counter for array of free lists */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Walk through the array of free lists */
-    for(u = 0; u < (unsigned)head->maxelem; u++) {
-        if(head->list_arr[u].onlist > 0) {
-            H5FL_arr_list_t *arr_free_list; /* Pointer to nodes in free list being garbage collected */
-            size_t total_mem;   /* Total memory used on list */
-
-            /* Calculate the total memory used on this list */
-            total_mem = head->list_arr[u].onlist * head->list_arr[u].size;
-
-            /* For each free list being garbage collected, walk through the nodes and free them */
-            arr_free_list = head->list_arr[u].list;
-            while(arr_free_list != NULL) {
-                void *tmp;      /* Temporary node pointer */
+    /* Walk through the array of free lists, from the largest arrays down */
+    for(u = (unsigned)head->maxelem; u > 0 && head->list_mem > keep; u--) {
+        H5FL_arr_node_t *arr_node = &head->list_arr[u - 1];   /* Free list for arrays of this size */
 
-                tmp = arr_free_list->next;
-
-                /* Decrement the count of nodes allocated and free the node */
-                head->allocated--;
-                H5MM_free(arr_free_list);
-
-                arr_free_list = (H5FL_arr_list_t *)tmp;
-            } /* end while */
+        /* For each free list being garbage collected, walk through the nodes and free them */
+        while(arr_node->list != NULL && head->list_mem > keep) {
+            H5FL_arr_list_t *tmp = arr_node->list->next;   /* Temporary node pointer */
 
-            /* Indicate no free nodes on the free list */
-            head->list_arr[u].list = NULL;
-            head->list_arr[u].onlist = 0;
+            /* Decrement the count of nodes allocated and free the node */
+            head->allocated--;
+            H5MM_free(arr_node->list);
+            arr_node->list = tmp;
+            arr_node->onlist--;
 
             /* Decrement count of free memory on this "array" list */
-            head->list_mem -= total_mem;
+            head->list_mem -= arr_node->size;
 
             /* Decrement global count of free memory on "array" lists */
-            H5FL_arr_gc_head.mem_freed -= total_mem;
-        } /* end if */
+            H5FL_arr_gc_head.mem_freed -= arr_node->size;
+        } /* end while */
     } /* end for */
 
-    /* Double check that all the memory on this list is recycled */
-    HDassert(head->list_mem == 0);
+    /* Double check that the memory on this list was recycled */
+    HDassert(head->list_mem <= keep);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* end H5FL__arr_gc_list() */
@@ -1730,7 +1872,7 @@ H5FL__arr_gc(void)
     gc_arr_node = H5FL_arr_gc_head.first;
     while(gc_arr_node != NULL) {
         /* Release the free nodes on the list */
-        if(H5FL__arr_gc_list(gc_arr_node->list) < 0)
+        if(H5FL__arr_gc_list(gc_arr_node->list, (size_t)0) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -2096,7 +2238,7 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if(head->onlist * head->size > H5FL_fac_lst_mem_lim)
-        if(H5FL__fac_gc_list(head) < 0)
+        if(H5FL__fac_gc_list(head, H5FL_TRIM_TARGET(H5FL_fac_lst_mem_lim)) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free")
 
     /* Then check the global amount memory on factory free lists */
@@ -2231,7 +2373,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5FL__fac_gc_list
  *
- * Purpose:	Garbage collect on a particular factory free list
+ * Purpose:	Garbage collect on a particular factory free list, releasing
+ *      blocks until no more than KEEP bytes remain on it.
  *
  * Return:	Success:	Non-negative
  * 		Failure:	Negative
@@ -2242,37 +2385,33 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FL__fac_gc_list(H5FL_fac_head_t *head)
+H5FL__fac_gc_list(H5FL_fac_head_t *head, size_t keep)
 {
     H5FL_fac_node_t *free_list; /* Pointer to nodes in free list being garbage collected */
-    size_t total_mem;   /* Total memory used on list */
 
     FUNC_ENTER_STATIC_NOERR
 
-    /* Calculate the total memory used on this list */
-    total_mem = head->onlist * head->size;
-
-    /* For each free list being garbage collected, walk through the nodes and free them */
+    /* Walk through the nodes in the free list, freeing them */
     free_list = head->list;
-    while(free_list != NULL) {
+    while(free_list != NULL && head->onlist * head->size > keep) {
         void *tmp;          /* Temporary node pointer */
 
         tmp = free_list->next;
 
         /* Decrement the count of nodes allocated and free the node */
         head->allocated--;
+        head->onlist--;
+
+        /* Decrement global count of free memory on "factory" lists */
+        H5FL_fac_gc_head.mem_freed -= head->size;
 
         H5MM_free(free_list);
 
         free_list = (H5FL_fac_node_t *)tmp;
     } /* end while */
 
-    /* Indicate no free nodes on the free list */
-    head->list = NULL;
-    head->onlist = 0;
-
-    /* Decrement global count of free memory on "factory" lists */
-    H5FL_fac_gc_head.mem_freed -= total_mem;
+    /* Point the free list at the remaining nodes */
+    head->list = free_list;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }   /* end H5FL__fac_gc_list() */
@@ -2303,7 +2442,7 @@ H5FL__fac_gc(void)
     gc_node = H5FL_fac_gc_head.first;
     while(gc_node != NULL) {
         /* Release the free nodes on the list */
-        if(H5FL__fac_gc_list(gc_node->list) < 0)
+        if(H5FL__fac_gc_list(gc_node->list, (size_t)0) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of list failed")
 
         /* Go on to the next free list to garbage collect */
@@ -2349,7 +2488,7 @@ H5FL_fac_term(H5FL_fac_head_t *factory)
     HDassert(factory);
 
     /* Garbage collect all the blocks in the factory's free list */
-    if(H5FL__fac_gc_list(factory) < 0)
+    if(H5FL__fac_gc_list(factory, (size_t)0) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of factory failed")
 
     /* Verify that all the blocks have been freed */
@@ -2531,3 +2670,44 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_set_free_list_limits() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_list_sizes
+ *
+ * Purpose:	Gets the current size of the different kinds of free lists that
+ *      the library uses to manage memory.  The free list sizes can be set with
+ *      H5FL_set_free_list_limits and garbage collected with
+ *      H5FL_garbage_coll.  These lists are global for the entire library.
+ *
+ * Parameters:
+ *  size_t *reg_size;    OUT: The current size of all "regular" free list memory used
+ *  size_t *arr_size;    OUT: The current size of all "array" free list memory used
+ *  size_t *blk_size;    OUT: The current size of all "block" free list memory used
+ *  size_t *fac_size;    OUT: The current size of all "factory" free list memory used
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size,
+    size_t *fac_size)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Retrieve the amount of memory on each kind of free list */
+    if(reg_size)
+        *reg_size = H5FL_reg_gc_head.mem_freed;
+    if(arr_size)
+        *arr_size = H5FL_arr_gc_head.mem_freed;
+    if(blk_size)
+        *blk_size = H5FL_blk_gc_head.mem_freed;
+    if(fac_size)
+        *fac_size = H5FL_fac_gc_head.mem_freed;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5FL_get_free_list_sizes() */
+
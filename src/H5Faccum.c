@@ -264,6 +264,85 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_prefetch
+ *
+ * Purpose:	Reads a range of metadata from the file into the metadata
+ *              accumulator with a single I/O operation, so that following
+ *              reads of pieces of the range are satisfied from memory.
+ *
+ *              Any dirty information in the accumulator is flushed before
+ *              its contents are replaced.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__accum_prefetch(H5F_t *f, H5FD_mem_t map_type, haddr_t addr, size_t size)
+{
+    H5F_meta_accum_t *accum;            /* Alias for file's metadata accumulator */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(size > 0);
+
+    /* Only metadata goes through the accumulator */
+    if(!(f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) || map_type == H5FD_MEM_DRAW
+            || size >= H5F_ACCUM_MAX_SIZE)
+        HGOTO_DONE(SUCCEED)
+
+    /* Set up alias for file's metadata accumulator info */
+    accum = &f->shared->accum;
+
+    /* Check if the range is already in the accumulator */
+    if(accum->size > 0 && H5F_addr_le(accum->loc, addr)
+            && H5F_addr_le(addr + size, accum->loc + accum->size))
+        HGOTO_DONE(SUCCEED)
+
+    /* Write out any dirty information before replacing it */
+    if(H5F__accum_flush(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't flush metadata accumulator")
+
+    /* Check if we need more buffer space */
+    if(size > accum->alloc_size) {
+        size_t new_alloc_size;          /* New size of accumulator */
+
+        /* Adjust the buffer size to be a power of 2 that is large enough to hold data */
+        new_alloc_size = (size_t)1 << (1 + H5VM_log2_gen((uint64_t)(size - 1)));
+
+        /* Reallocate the metadata accumulator buffer */
+        if(NULL == (accum->buf = H5FL_BLK_REALLOC(meta_accum, accum->buf, new_alloc_size))) {
+            accum->alloc_size = accum->size = 0;
+            accum->loc = HADDR_UNDEF;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
+        } /* end if */
+
+        /* Note the new buffer size */
+        accum->alloc_size = new_alloc_size;
+    } /* end if */
+
+    /* Invalidate the old contents, in case the read fails */
+    accum->size = 0;
+    accum->loc = HADDR_UNDEF;
+
+    /* Dispatch to driver */
+    if(H5FD_read(f->shared->lf, map_type, addr, size, accum->buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
+
+    /* Adjust the accumulator address & size */
+    accum->loc = addr;
+    accum->size = size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_prefetch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_adjust
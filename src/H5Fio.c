@@ -120,6 +120,52 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_prefetch
+ *
+ * Purpose:	Hints that a contiguous range of metadata will be read soon,
+ *		so that it can be brought into memory with one I/O
+ *		operation instead of one operation per piece.
+ *
+ *		This is only a hint: it does nothing when the range can't
+ *		be held by the metadata accumulator, when a page buffer is
+ *		in use, or when metadata reads must not be cached (SWMR
+ *		read and parallel access).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_prefetch(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Check for cases where prefetching doesn't apply */
+    if(0 == size || f->shared->page_buf || (H5F_INTENT(f) & H5F_ACC_SWMR_READ)
+            || H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if(H5F_addr_le(f->shared->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    /* Read the range into the metadata accumulator */
+    if(H5F__accum_prefetch(f, (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type, addr, size) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't prefetch metadata")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_prefetch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_write
@@ -291,13 +291,16 @@ struct H5F_file_t {
     hbool_t     start_mdc_log_on_access; /* set when mdc logging should  */
                                 /* begin on file access/create          */
     char        *mdc_log_location; /* location of mdc log               */
+    H5F_mdc_log_style_t mdc_log_style; /* format of mdc log             */
     hid_t       fcpl_id;	/* File creation property list ID 	*/
     H5F_close_degree_t fc_degree; /* File close behavior degree	*/
     hbool_t evict_on_close; /* If the file's objects should be evicted from the metadata cache on close */
+    hbool_t link_lookup_index; /* If open groups should keep an in-memory index of their links */
     size_t	rdcc_nslots;	/* Size of raw data chunk cache (slots)	*/
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
+    size_t      ohdr_read_size; /* Size of the speculative read of object headers (in bytes) */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
     unsigned	gc_ref;		/* Garbage-collect references?		*/
@@ -325,6 +328,8 @@ struct H5F_file_t {
     H5F_fs_state_t fs_state[H5F_MEM_PAGE_NTYPES];   /* State of free space manager for each type */
     haddr_t fs_addr[H5F_MEM_PAGE_NTYPES];   /* Address of free space manager info for each type */
     H5FS_t *fs_man[H5F_MEM_PAGE_NTYPES];    /* Free space manager for each file space type */
+    hbool_t fs_extent_tree;                 /* Whether free space is tracked with extent trees instead of free space managers */
+    struct H5MF_extent_tree_t *fs_tree[H5F_MEM_PAGE_NTYPES]; /* Extent tree for each file space type */
     hbool_t first_alloc_dealloc;            /* TRUE iff free space managers   */
                                             /* are persistent and have not    */
                                             /* been used accessed for either  */
@@ -432,6 +437,7 @@ H5_DLL herr_t H5F__super_ext_close(H5F_t *f, H5O_loc_t *ext_ptr, hbool_t was_cre
 
 /* Metadata accumulator routines */
 H5_DLL herr_t H5F__accum_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, void *buf);
+H5_DLL herr_t H5F__accum_prefetch(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size);
 H5_DLL herr_t H5F__accum_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
 H5_DLL herr_t H5F__accum_free(H5F_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size);
 H5_DLL herr_t H5F__accum_flush(H5F_t *f);
@@ -206,6 +206,13 @@ typedef enum H5F_file_space_type_t {
     H5F_FILE_SPACE_NTYPES	    /* must be last */
 } H5F_file_space_type_t;
 
+/* Metadata cache log formats */
+typedef enum H5F_mdc_log_style_t {
+    H5F_MDC_LOG_STYLE_JSON = 0,     /* One JSON text record per cache operation (default) */
+    H5F_MDC_LOG_STYLE_BINARY = 1,   /* Fixed size binary records, written in batches */
+    H5F_MDC_LOG_STYLE_NSTYLES       /* must be last */
+} H5F_mdc_log_style_t;
+
 /* Data structure to report the collection of read retries for metadata items with checksum */
 /* Used by public routine H5Fget_metadata_read_retry_info() */
 #define H5F_NUM_METADATA_READ_RETRY_TYPES	21
@@ -728,6 +728,29 @@ H5F_sieve_buf_size(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->sieve_buf_size)
 } /* end H5F_sieve_buf_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_ohdr_read_size
+ *
+ * Purpose:  Retrieve the number of bytes read from the file when an
+ *           object header is first loaded.
+ *
+ * Return:   Success:    The size of the speculative read.
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_ohdr_read_size(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->ohdr_read_size)
+} /* end H5F_ohdr_read_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_gc_ref
@@ -803,6 +826,30 @@ H5F_get_evict_on_close(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->evict_on_close)
 } /* end H5F_get_evict_on_close() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_get_link_lookup_index
+ *
+ * Purpose:     Checks if open groups in the file should keep an in-memory
+ *              index of their links.
+ *
+ * Return:      Success:    Flag indicating whether the link lookup index
+ *                          property was set for the file.
+ *              Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_get_link_lookup_index(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->link_lookup_index)
+} /* end H5F_get_link_lookup_index() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_store_msg_crt_idx
@@ -847,6 +894,27 @@ H5F_has_feature(const H5F_t *f, unsigned feature)
     FUNC_LEAVE_NOAPI((hbool_t)(f->shared->lf->feature_flags&feature))
 } /* end H5F_has_feature() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_has_page_buf
+ *
+ * Purpose:  Check if a file has a page buffer enabled
+ *
+ * Return:   TRUE/FALSE (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_has_page_buf(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI((hbool_t)(f->shared->page_buf != NULL))
+} /* end H5F_has_page_buf() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_driver_id
@@ -1102,6 +1170,30 @@ H5F_mdc_log_location(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->mdc_log_location)
 } /* end H5F_mdc_log_location() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_mdc_log_style
+ *
+ * Purpose:  Quick and dirty routine to retrieve the format of the MDC log
+ *           for this file.
+ *           (Mainly added to stop non-file routines from poking about in the
+ *           H5F_t data structure)
+ *
+ * Return:   The log format on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+H5F_mdc_log_style_t
+H5F_mdc_log_style(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_log_style)
+} /* end H5F_mdc_log_style() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_alignment
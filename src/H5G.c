@@ -89,6 +89,8 @@
 #include "H5Pprivate.h"         /* Property lists                           */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 
 /****************/
 /* Local Macros */
@@ -380,6 +382,82 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Gcreate2() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Gcreate_multi
+ *
+ * Purpose:     Creates COUNT new, empty groups in the group LOC_ID, with
+ *              the link names in NAMES.  All of the groups are created
+ *              with the creation property list GCPL_ID and the links to
+ *              them are created with LCPL_ID.
+ *
+ *              The names must be link names in LOC_ID (not paths), must
+ *              all be different and must not exist in LOC_ID already.
+ *              Creating the groups with one call is faster than calling
+ *              H5Gcreate2 for each of them, since the links are inserted
+ *              into the parent group in batches.
+ *
+ * Usage:       H5Gcreate_multi(loc_id, count, names, lcpl_id, gcpl_id, gapl_id)
+ *                  hid_t loc_id;	  IN: File or group identifier
+ *                  size_t count;	  IN: Number of groups to create
+ *                  const char *names[];  IN: Link names of the new groups
+ *                  hid_t lcpl_id;	  IN: Property list for link creation
+ *                  hid_t gcpl_id;	  IN: Property list for group creation
+ *                  hid_t gapl_id;	  IN: Property list for group access
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Gcreate_multi(hid_t loc_id, size_t count, const char *names[], hid_t lcpl_id,
+    hid_t gcpl_id, hid_t gapl_id)
+{
+    H5VL_object_t      *vol_obj = NULL;         /* object token of loc_id */
+    H5VL_loc_params_t   loc_params;
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iz**siii", loc_id, count, names, lcpl_id, gcpl_id, gapl_id);
+
+    /* Check arguments */
+    if(count > 0 && !names)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "names parameter cannot be NULL")
+
+    /* Check link creation property list */
+    if(H5P_DEFAULT == lcpl_id)
+        lcpl_id = H5P_LINK_CREATE_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(lcpl_id, H5P_LINK_CREATE))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a link creation property list")
+
+    /* Check group creation property list */
+    if(H5P_DEFAULT == gcpl_id)
+        gcpl_id = H5P_GROUP_CREATE_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(gcpl_id, H5P_GROUP_CREATE))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a group creation property list")
+
+    /* Verify access property list and set up collective metadata if appropriate */
+    if(H5CX_set_apl(&gapl_id, H5P_CLS_GACC, loc_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set access property list info")
+
+    /* Get the location object */
+    if(NULL == (vol_obj = (H5VL_object_t *)H5I_object(loc_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier")
+
+    /* Set the location parameters */
+    loc_params.type         = H5VL_OBJECT_BY_SELF;
+    loc_params.obj_type     = H5I_get_type(loc_id);
+
+    /* Create the groups */
+    if(H5VL_group_optional(vol_obj, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL, H5VL_NATIVE_GROUP_CREATE_MULTI, &loc_params, count, names, lcpl_id, gcpl_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create groups")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Gcreate_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Gcreate_anon
@@ -65,6 +65,9 @@
 /* Size of stack buffer for serialized link */
 #define H5G_LINK_BUF_SIZE               128
 
+/* Number of links read from the fractal heap at once when iterating */
+#define H5G_DENSE_ITER_BATCH_SIZE       128
+
 
 /******************/
 /* Local Typedefs */
@@ -91,6 +94,10 @@ typedef struct {
     H5G_lib_iterate_t op;               /* Callback for each link            */
     void        *op_data;               /* Callback data for each link       */
 
+    /* batch of links to read from the fractal heap */
+    size_t      nbatch;                 /* # of links in batch               */
+    uint8_t     batch_id[H5G_DENSE_ITER_BATCH_SIZE][H5G_DENSE_FHEAP_ID_LEN]; /* Heap IDs of links in batch */
+
     /* upward */
     int         op_ret;                 /* Return value from callback        */
 } H5G_bt2_ud_it_t;
@@ -215,6 +222,18 @@ typedef struct {
     H5O_link_t  *lnk;                   /* Pointer to link                   */
 } H5G_fh_ud_lbi_t;
 
+/* Link to insert in a batch, with the hash value of its name */
+typedef struct {
+    uint32_t    name_hash;              /* Hash value of link name           */
+    const H5O_link_t *lnk;              /* Pointer to link                   */
+} H5G_dense_ins_t;
+
+/* Stream of link records for bulk-loading an index */
+typedef struct {
+    H5G_bt2_ud_ins_t **recs;            /* Records, in index order           */
+    size_t      next;                   /* Index of next record to load      */
+} H5G_dense_bulk_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -225,6 +244,11 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 
+static int H5G__dense_ins_cmp(const void *_ins1, const void *_ins2);
+static int H5G__dense_corder_cmp(const void *_rec1, const void *_rec2);
+static herr_t H5G__dense_bulk_cb(const void **udata, void *_op_data);
+static herr_t H5G__dense_iterate_batch(H5G_bt2_ud_it_t *bt2_udata);
+
 
 /*********************/
 /* Package Variables */
@@ -470,6 +494,235 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__dense_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_ins_cmp
+ *
+ * Purpose:	Callback routine for sorting a batch of links to insert by
+ *              the hash values of their names.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__dense_ins_cmp(const void *_ins1, const void *_ins2)
+{
+    const H5G_dense_ins_t *ins1 = (const H5G_dense_ins_t *)_ins1;
+    const H5G_dense_ins_t *ins2 = (const H5G_dense_ins_t *)_ins2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(ins1->name_hash < ins2->name_hash ? -1 :
+            (ins1->name_hash > ins2->name_hash ? 1 :
+             HDstrcmp(ins1->lnk->name, ins2->lnk->name)))
+} /* end H5G__dense_ins_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_corder_cmp
+ *
+ * Purpose:	Callback routine for sorting link records in a batch by
+ *              creation order.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__dense_corder_cmp(const void *_rec1, const void *_rec2)
+{
+    const H5G_bt2_ud_ins_t *rec1 = *(const H5G_bt2_ud_ins_t * const *)_rec1;
+    const H5G_bt2_ud_ins_t *rec2 = *(const H5G_bt2_ud_ins_t * const *)_rec2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(rec1->common.corder < rec2->common.corder ? -1 :
+            (rec1->common.corder > rec2->common.corder ? 1 : 0))
+} /* end H5G__dense_corder_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_bulk_cb
+ *
+ * Purpose:	v2 B-tree bulk-load callback, returning the next link record
+ *              of a batch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__dense_bulk_cb(const void **udata, void *_op_data)
+{
+    H5G_dense_bulk_t *op_data = (H5G_dense_bulk_t *)_op_data;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    *udata = op_data->recs[op_data->next++];
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__dense_bulk_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_insert_multi
+ *
+ * Purpose:	Insert a batch of links into the dense link storage
+ *              structures for a group.
+ *
+ *              The fractal heap and v2 B-trees are opened once for the
+ *              whole batch, and the links are inserted in the order of
+ *              their name hashes, so that successive insertions into the
+ *              name index go to the same or neighboring leaf nodes.
+ *              When the indices are empty, as they are right after the
+ *              group is converted to dense storage, they are bulk-loaded
+ *              instead.
+ *
+ *              The caller must have checked that none of the names are
+ *              already in the group.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__dense_insert_multi(H5F_t *f, const H5O_linfo_t *linfo, size_t nlinks,
+    const H5O_link_t *lnks)
+{
+    H5G_dense_ins_t *ins = NULL;        /* Links sorted by name hash */
+    H5G_bt2_ud_ins_t *recs = NULL;      /* v2 B-tree records for links */
+    H5G_bt2_ud_ins_t **order = NULL;    /* v2 B-tree records, in index order */
+    H5HF_t *fheap = NULL;               /* Fractal heap handle */
+    H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
+    H5B2_t *bt2_corder = NULL;          /* v2 B-tree handle for creation order index */
+    H5WB_t *wb = NULL;                  /* Wrapped buffer for link data */
+    uint8_t link_buf[H5G_LINK_BUF_SIZE];        /* Buffer for serializing link */
+    hsize_t nrec;                       /* # of links already indexed */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(linfo);
+    HDassert(lnks || 0 == nlinks);
+
+    if(0 == nlinks)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the links by the hash values of their names */
+    if(NULL == (ins = (H5G_dense_ins_t *)H5MM_malloc(nlinks * sizeof(H5G_dense_ins_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for link batch")
+    for(u = 0; u < nlinks; u++) {
+        ins[u].name_hash = H5_checksum_lookup3(lnks[u].name, HDstrlen(lnks[u].name), 0);
+        ins[u].lnk = &lnks[u];
+    } /* end for */
+    HDqsort(ins, nlinks, sizeof(H5G_dense_ins_t), H5G__dense_ins_cmp);
+
+    /* Allocate the v2 B-tree records */
+    if(NULL == (recs = (H5G_bt2_ud_ins_t *)H5MM_malloc(nlinks * sizeof(H5G_bt2_ud_ins_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for link batch")
+    if(NULL == (order = (H5G_bt2_ud_ins_t **)H5MM_malloc(nlinks * sizeof(H5G_bt2_ud_ins_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for link batch")
+
+    /* Wrap the local buffer for serialized links */
+    if(NULL == (wb = H5WB_wrap(link_buf, sizeof(link_buf))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+
+    /* Open the fractal heap & v2 B-trees */
+    if(NULL == (fheap = H5HF_open(f, linfo->fheap_addr)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+    if(NULL == (bt2_name = H5B2_open(f, linfo->name_bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+    if(linfo->index_corder) {
+        HDassert(H5F_addr_defined(linfo->corder_bt2_addr));
+        if(NULL == (bt2_corder = H5B2_open(f, linfo->corder_bt2_addr, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for creation order index")
+    } /* end if */
+
+    /* Insert the links into the fractal heap */
+    for(u = 0; u < nlinks; u++) {
+        const H5O_link_t *lnk = ins[u].lnk;    /* Link to insert */
+        size_t link_size;               /* Size of serialized link in the heap */
+        void *link_ptr;                 /* Pointer to serialized link */
+
+        /* Create serialized form of link */
+        if((link_size = H5O_msg_raw_size(f, H5O_LINK_ID, FALSE, lnk)) == 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+        if(NULL == (link_ptr = H5WB_actual(wb, link_size)))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+        if(H5O_msg_encode(f, H5O_LINK_ID, FALSE, (unsigned char *)link_ptr, lnk) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't encode link")
+
+        /* Insert the serialized link into the fractal heap */
+        if(H5HF_insert(fheap, link_size, link_ptr, recs[u].id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into fractal heap")
+
+        /* Set up the v2 B-tree record for the link */
+        recs[u].common.f = f;
+        recs[u].common.fheap = fheap;
+        recs[u].common.name = lnk->name;
+        recs[u].common.name_hash = ins[u].name_hash;
+        recs[u].common.corder = lnk->corder;
+        recs[u].common.found_op = NULL;
+        recs[u].common.found_op_data = NULL;
+        order[u] = &recs[u];
+    } /* end for */
+
+    /* Check if the indices are empty */
+    if(H5B2_get_nrec(bt2_name, &nrec) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOUNT, FAIL, "can't retrieve # of records in index")
+
+    /* Insert the links into the v2 B-tree indices */
+    if(0 == nrec) {
+        H5G_dense_bulk_t bulk;          /* Stream of records to bulk-load */
+
+        /* The records are already in name index order */
+        bulk.recs = order;
+        bulk.next = 0;
+        if(H5B2_bulk_load(bt2_name, (hsize_t)nlinks, H5G__dense_bulk_cb, &bulk) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to bulk load v2 B-tree for name index")
+
+        if(bt2_corder) {
+            HDqsort(order, nlinks, sizeof(H5G_bt2_ud_ins_t *), H5G__dense_corder_cmp);
+            bulk.next = 0;
+            if(H5B2_bulk_load(bt2_corder, (hsize_t)nlinks, H5G__dense_bulk_cb, &bulk) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to bulk load v2 B-tree for creation order index")
+        } /* end if */
+    } /* end if */
+    else
+        for(u = 0; u < nlinks; u++) {
+            if(H5B2_insert(bt2_name, &recs[u]) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+            if(bt2_corder && H5B2_insert(bt2_corder, &recs[u]) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+        } /* end for */
+
+done:
+    /* Release resources */
+    if(fheap && H5HF_close(fheap) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if(bt2_name && H5B2_close(bt2_name) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+    if(bt2_corder && H5B2_close(bt2_corder) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for creation order index")
+    if(wb && H5WB_unwrap(wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    H5MM_xfree(order);
+    H5MM_xfree(recs);
+    H5MM_xfree(ins);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_insert_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_dense_lookup_cb
@@ -894,11 +1147,72 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_dense_iterate_fh_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_iterate_batch
+ *
+ * Purpose:	Read the batch of links gathered while iterating over dense
+ *              link storage from the fractal heap at once, then make the
+ *              callback for each of them
+ *
+ * Return:	H5_ITER_ERROR/H5_ITER_CONT/H5_ITER_STOP
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__dense_iterate_batch(H5G_bt2_ud_it_t *bt2_udata)
+{
+    H5G_fh_ud_it_t fh_udata[H5G_DENSE_ITER_BATCH_SIZE];    /* User data for fractal heap 'op' callbacks */
+    const void *ids[H5G_DENSE_ITER_BATCH_SIZE];     /* Heap IDs of links */
+    void *op_data[H5G_DENSE_ITER_BATCH_SIZE];       /* Pointers to user data for 'op' callbacks */
+    size_t nbatch = bt2_udata->nbatch;  /* # of links in batch */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Prepare user data for callbacks */
+    for(u = 0; u < nbatch; u++) {
+        fh_udata[u].f = bt2_udata->f;
+        fh_udata[u].lnk = NULL;
+        ids[u] = bt2_udata->batch_id[u];
+        op_data[u] = &fh_udata[u];
+    } /* end for */
+    bt2_udata->nbatch = 0;
+
+    /* Call fractal heap 'op' routine, to copy the links' information */
+    if(H5HF_op_batch(bt2_udata->fheap, nbatch, ids, H5G_dense_iterate_fh_cb, op_data) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPERATE, H5_ITER_ERROR, "heap op callback failed")
+
+    /* Make the callbacks, in iteration order */
+    for(u = 0; u < nbatch && ret_value == H5_ITER_CONT; u++) {
+        ret_value = (bt2_udata->op)(fh_udata[u].lnk, bt2_udata->op_data);
+
+        /* Increment the number of entries passed through */
+        bt2_udata->count++;
+    } /* end for */
+
+    /* Check for callback failure and pass along return value */
+    if(ret_value < 0)
+        HERROR(H5E_SYM, H5E_CANTNEXT, "iteration operator failed");
+
+done:
+    /* Release the space allocated for the links */
+    for(u = 0; u < nbatch; u++)
+        if(fh_udata[u].lnk)
+            H5O_msg_free(H5O_LINK_ID, fh_udata[u].lnk);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_iterate_batch() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_dense_iterate_bt2_cb
  *
- * Purpose:	v2 B-tree callback for dense link storage iterator
+ * Purpose:	v2 B-tree callback for dense link storage iterator.  Links
+ *              are gathered into a batch, which is read from the fractal
+ *              heap (and the user's callback made) when it fills up.
  *
  * Return:	H5_ITER_ERROR/H5_ITER_CONT/H5_ITER_STOP
  *
@@ -915,38 +1229,25 @@ H5G_dense_iterate_bt2_cb(const void *_record, void *_bt2_udata)
     H5G_bt2_ud_it_t *bt2_udata = (H5G_bt2_ud_it_t *)_bt2_udata;         /* User data for callback */
     herr_t ret_value = H5_ITER_CONT;         /* Return value */
 
-    FUNC_ENTER_NOAPI_NOINIT
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     /* Check for skipping links */
-    if(bt2_udata->skip > 0)
+    if(bt2_udata->skip > 0) {
         --bt2_udata->skip;
-    else {
-        H5G_fh_ud_it_t fh_udata;       /* User data for fractal heap 'op' callback */
-
-        /* Prepare user data for callback */
-        /* down */
-        fh_udata.f = bt2_udata->f;
 
-        /* Call fractal heap 'op' routine, to copy the link information */
-        if(H5HF_op(bt2_udata->fheap, record->id, H5G_dense_iterate_fh_cb, &fh_udata) < 0)
-            HGOTO_ERROR(H5E_SYM, H5E_CANTOPERATE, H5_ITER_ERROR, "heap op callback failed")
-
-        /* Make the callback */
-        ret_value = (bt2_udata->op)(fh_udata.lnk, bt2_udata->op_data);
+        /* Increment the number of entries passed through */
+        bt2_udata->count++;
+    } /* end if */
+    else {
+        /* Add the link to the batch */
+        HDmemcpy(bt2_udata->batch_id[bt2_udata->nbatch], record->id, (size_t)H5G_DENSE_FHEAP_ID_LEN);
+        bt2_udata->nbatch++;
 
-        /* Release the space allocated for the link */
-        H5O_msg_free(H5O_LINK_ID, fh_udata.lnk);
+        /* Make the callbacks for the links in the batch, when it's full */
+        if(bt2_udata->nbatch == H5G_DENSE_ITER_BATCH_SIZE)
+            ret_value = H5G__dense_iterate_batch(bt2_udata);
     } /* end else */
 
-    /* Increment the number of entries passed through */
-    /* (whether we skipped them or not) */
-    bt2_udata->count++;
-
-    /* Check for callback failure and pass along return value */
-    if(ret_value < 0)
-        HERROR(H5E_SYM, H5E_CANTNEXT, "iteration operator failed");
-
-done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_dense_iterate_bt2_cb() */
 
@@ -1033,12 +1334,18 @@ H5G__dense_iterate(H5F_t *f, const H5O_linfo_t *linfo, H5_index_t idx_type,
         udata.count = 0;
         udata.op = op;
         udata.op_data = op_data;
+        udata.nbatch = 0;
 
         /* Iterate over the records in the v2 B-tree's "native" order */
         /* (by hash of name) */
         if((ret_value = H5B2_iterate(bt2, H5G_dense_iterate_bt2_cb, &udata)) < 0)
             HERROR(H5E_SYM, H5E_BADITER, "link iteration failed");
 
+        /* Make the callbacks for the links left in the batch */
+        else if(ret_value == H5_ITER_CONT && udata.nbatch > 0)
+            if((ret_value = H5G__dense_iterate_batch(&udata)) < 0)
+                HERROR(H5E_SYM, H5E_BADITER, "link iteration failed");
+
         /* Update the last link examined, if requested */
         if(last_lnk)
             *last_lnk = udata.count;
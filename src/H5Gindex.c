@@ -0,0 +1,454 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gindex.c
+ *
+ * Purpose:		In-memory index of the links in open groups, by name.
+ *
+ *                      When the file was opened with the link lookup index
+ *                      property set, a group that is open and has its
+ *                      links looked up by name repeatedly gets a hash
+ *                      table of copies of all its links.  Later lookups
+ *                      are answered from the table, instead of searching
+ *                      the group's B-tree and heap (or its object header
+ *                      messages) again.  The index is discarded whenever
+ *                      the group's links are modified, and rebuilt after
+ *                      enough lookups have been made again.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Gmodule.h"          /* This source code file is part of the H5G module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5FOprivate.h"        /* File objects                         */
+#include "H5Gpkg.h"		/* Groups		  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of name lookups in an open group before its links are indexed */
+#define H5G_INDEX_LOOKUP_THRESHOLD      16
+
+/* Initial number of buckets in a link index (must be a power of 2) */
+#define H5G_INDEX_MIN_BUCKETS           64
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A link in the index */
+typedef struct H5G_link_index_ent_t {
+    H5O_link_t lnk;                     /* Copy of the link */
+    uint32_t hash;                      /* Hash value of the link's name */
+    struct H5G_link_index_ent_t *next;  /* Next link in the same bucket */
+} H5G_link_index_ent_t;
+
+/* The index of a group's links */
+struct H5G_link_index_t {
+    size_t nbuckets;                    /* Number of buckets (a power of 2) */
+    size_t nlinks;                      /* Number of links in the index */
+    H5G_link_index_ent_t **buckets;     /* Hash buckets */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static H5G_shared_t *H5G__index_get_shared(const H5O_loc_t *grp_oloc);
+static herr_t H5G__index_add(H5G_link_index_t *idx, const H5O_link_t *lnk);
+static herr_t H5G__index_build_cb(const H5O_link_t *lnk, void *_udata);
+static H5G_link_index_t *H5G__index_build(const H5O_loc_t *grp_oloc);
+static void H5G__index_destroy(H5G_link_index_t *idx);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the index structs */
+H5FL_DEFINE_STATIC(H5G_link_index_t);
+H5FL_DEFINE_STATIC(H5G_link_index_ent_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_get_shared
+ *
+ * Purpose:	Finds the shared information for a group, if the group is
+ *              open and its links may be indexed.
+ *
+ * Return:	Success:	Pointer to the group's shared info
+ *		Not open:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5G_shared_t *
+H5G__index_get_shared(const H5O_loc_t *grp_oloc)
+{
+    H5G_shared_t *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(grp_oloc);
+    HDassert(grp_oloc->file);
+
+    /* Check if the file's groups should index their links.  (Another
+     * process may change the links in a file opened for SWMR reading.)
+     */
+    if(H5F_LINK_LOOKUP_INDEX(grp_oloc->file) && !(H5F_INTENT(grp_oloc->file) & H5F_ACC_SWMR_READ)) {
+        /* Look for the group in the file's open objects */
+        if(NULL == (ret_value = (H5G_shared_t *)H5FO_opened(grp_oloc->file, grp_oloc->addr))) {
+            H5G_t *root_grp = H5G_rootof(grp_oloc->file);  /* The file's root group */
+
+            /* The root group isn't in the list of open objects */
+            if(root_grp && root_grp->oloc.addr == grp_oloc->addr
+                    && H5F_SAME_SHARED(root_grp->oloc.file, grp_oloc->file))
+                ret_value = root_grp->shared;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__index_get_shared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_add
+ *
+ * Purpose:	Adds a copy of a link to an index, growing the index's
+ *              hash table when it's full.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__index_add(H5G_link_index_t *idx, const H5O_link_t *lnk)
+{
+    H5G_link_index_ent_t *ent = NULL;   /* New entry in the index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(idx);
+    HDassert(lnk);
+
+    /* Grow the hash table, so there's at most one link per bucket on average */
+    if(idx->nlinks >= idx->nbuckets) {
+        H5G_link_index_ent_t **new_buckets;     /* New hash table */
+        size_t new_nbuckets = idx->nbuckets * 2;    /* New number of buckets */
+        size_t u;                               /* Local index variable */
+
+        if(NULL == (new_buckets = (H5G_link_index_ent_t **)H5MM_calloc(new_nbuckets * sizeof(H5G_link_index_ent_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate link index buckets")
+
+        /* Move the links to the new buckets */
+        for(u = 0; u < idx->nbuckets; u++)
+            while(idx->buckets[u]) {
+                H5G_link_index_ent_t *move = idx->buckets[u];   /* Link to move */
+                size_t bucket = move->hash & (new_nbuckets - 1);   /* New bucket for link */
+
+                idx->buckets[u] = move->next;
+                move->next = new_buckets[bucket];
+                new_buckets[bucket] = move;
+            } /* end while */
+
+        H5MM_xfree(idx->buckets);
+        idx->buckets = new_buckets;
+        idx->nbuckets = new_nbuckets;
+    } /* end if */
+
+    /* Copy the link */
+    if(NULL == (ent = H5FL_CALLOC(H5G_link_index_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate link index entry")
+    if(NULL == H5O_msg_copy(H5O_LINK_ID, lnk, &ent->lnk))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link")
+
+    /* Add the link to its bucket */
+    ent->hash = H5_hash_string(lnk->name);
+    ent->next = idx->buckets[ent->hash & (idx->nbuckets - 1)];
+    idx->buckets[ent->hash & (idx->nbuckets - 1)] = ent;
+    idx->nlinks++;
+
+done:
+    if(ret_value < 0 && ent)
+        ent = H5FL_FREE(H5G_link_index_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__index_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_build_cb
+ *
+ * Purpose:	Callback routine for adding each of a group's links to its
+ *              index.
+ *
+ * Return:	H5_ITER_CONT on success/H5_ITER_ERROR on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__index_build_cb(const H5O_link_t *lnk, void *_udata)
+{
+    H5G_link_index_t *idx = (H5G_link_index_t *)_udata;    /* Index being built */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5G__index_add(idx, lnk) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, H5_ITER_ERROR, "can't add link to index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__index_build_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_build
+ *
+ * Purpose:	Builds the index of a group's links, visiting the links in
+ *              their native order.
+ *
+ * Return:	Success:	Pointer to the new index
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5G_link_index_t *
+H5G__index_build(const H5O_loc_t *grp_oloc)
+{
+    H5G_link_index_t *idx = NULL;       /* New index */
+    H5G_link_index_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(grp_oloc);
+
+    /* Allocate the index */
+    if(NULL == (idx = H5FL_CALLOC(H5G_link_index_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate link index")
+    idx->nbuckets = H5G_INDEX_MIN_BUCKETS;
+    if(NULL == (idx->buckets = (H5G_link_index_ent_t **)H5MM_calloc(idx->nbuckets * sizeof(H5G_link_index_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate link index buckets")
+
+    /* Add each of the group's links */
+    if(H5G__obj_iterate(grp_oloc, H5_INDEX_NAME, H5_ITER_NATIVE, (hsize_t)0, NULL, H5G__index_build_cb, idx) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, NULL, "can't iterate over links")
+
+    /* Set return value */
+    ret_value = idx;
+
+done:
+    if(!ret_value && idx)
+        H5G__index_destroy(idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__index_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_lookup
+ *
+ * Purpose:	Looks up a link by name in the in-memory index of an open
+ *              group's links, building the index if the group has had
+ *              enough lookups.
+ *
+ *              If the group's links aren't indexed, *INDEXED is set to
+ *              FALSE and the caller must look the link up in the group.
+ *
+ * Return:	Success:	TRUE/FALSE whether the link was found (and
+ *                              copied into LNK), when *INDEXED is TRUE
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__index_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk,
+    hbool_t *indexed)
+{
+    H5G_shared_t *shared;               /* Shared info for the open group */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(grp_oloc);
+    HDassert(name && *name);
+    HDassert(lnk);
+    HDassert(indexed);
+
+    *indexed = FALSE;
+
+    /* Check if the group is open and may be indexed */
+    if(NULL == (shared = H5G__index_get_shared(grp_oloc)))
+        HGOTO_DONE(FALSE)
+
+    /* Build the index once the group has had enough lookups */
+    if(NULL == shared->link_index) {
+        if(++shared->nlookups < H5G_INDEX_LOOKUP_THRESHOLD)
+            HGOTO_DONE(FALSE)
+        if(NULL == (shared->link_index = H5G__index_build(grp_oloc)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't build link index")
+    } /* end if */
+
+    /* Look the link up */
+    {
+        H5G_link_index_t *idx = shared->link_index;    /* Group's link index */
+        uint32_t hash = H5_hash_string(name);   /* Hash value of name */
+        H5G_link_index_ent_t *ent;      /* Entry in the index */
+
+        *indexed = TRUE;
+        for(ent = idx->buckets[hash & (idx->nbuckets - 1)]; ent; ent = ent->next)
+            if(ent->hash == hash && !HDstrcmp(ent->lnk.name, name)) {
+                /* Give the caller a copy of the link */
+                if(NULL == H5O_msg_copy(H5O_LINK_ID, &ent->lnk, lnk))
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link")
+                HGOTO_DONE(TRUE)
+            } /* end if */
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__index_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_invalidate
+ *
+ * Purpose:	Discards the in-memory index of a group's links, if the
+ *              group is open and has one, before its links are modified.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__index_invalidate(const H5O_loc_t *grp_oloc)
+{
+    H5G_shared_t *shared;               /* Shared info for the open group */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(grp_oloc);
+
+    if(NULL != (shared = H5G__index_get_shared(grp_oloc))) {
+        H5G__index_free(shared);
+
+        /* Start counting lookups again */
+        shared->nlookups = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__index_invalidate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_destroy
+ *
+ * Purpose:	Releases an index and the copies of the links in it.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__index_destroy(H5G_link_index_t *idx)
+{
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(idx);
+
+    /* Release the links */
+    if(idx->buckets) {
+        for(u = 0; u < idx->nbuckets; u++)
+            while(idx->buckets[u]) {
+                H5G_link_index_ent_t *ent = idx->buckets[u];   /* Entry to release */
+
+                idx->buckets[u] = ent->next;
+                H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+                ent = H5FL_FREE(H5G_link_index_ent_t, ent);
+            } /* end while */
+        H5MM_xfree(idx->buckets);
+    } /* end if */
+
+    idx = H5FL_FREE(H5G_link_index_t, idx);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__index_destroy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__index_free
+ *
+ * Purpose:	Releases the in-memory index of a group's links, if it has
+ *              one.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__index_free(H5G_shared_t *shared)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(shared);
+
+    if(shared->link_index) {
+        H5G__index_destroy(shared->link_index);
+        shared->link_index = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__index_free() */
+
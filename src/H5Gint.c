@@ -45,6 +45,22 @@
 /* Local Macros */
 /****************/
 
+/* Max. # of groups created and linked together by H5G__create_multi() */
+#define H5G_CREATE_MULTI_BATCH          1024
+
+/* # of object headers loaded together while visiting a group's links */
+#define H5G_VISIT_PREFETCH_NOBJS        128
+
+/* Initial # of slots in the set of visited objects */
+#define H5G_VISITED_INIT_NSLOTS         64
+
+/* Slot for an object "position" in a set of visited objects with NSLOTS slots
+ * (Fibonacci hashing of the address & file number)
+ */
+#define H5G_VISITED_HASH(P, NSLOTS)                                         \
+    ((size_t)((((uint64_t)(P)->addr ^ ((uint64_t)(P)->fileno << 40))        \
+            * (uint64_t)0x9E3779B97F4A7C15ULL) >> 32) & ((NSLOTS) - 1))
+
 
 /******************/
 /* Local Typedefs */
@@ -62,20 +78,41 @@ typedef struct {
     void *op_data;              /* Application's op data */
 } H5G_iter_appcall_ud_t;
 
+/* Set of the objects visited during a recursive traversal, kept as an
+ * open-addressing hash table of object "positions" (undefined addresses mark
+ * empty slots)
+ */
+typedef struct {
+    size_t      nslots;         /* # of slots in table (a power of two) */
+    size_t      nobjs;          /* # of objects in table */
+    H5_obj_t   *slots;          /* Table of objects */
+} H5G_visited_t;
+
 /* User data for recursive traversal over links from a group */
 typedef struct {
     hid_t       gid;            /* The group ID for the starting group */
     H5G_loc_t	*curr_loc;      /* Location of starting group */
     H5_index_t  idx_type;       /* Index to use */
     H5_iter_order_t order;      /* Iteration order within index */
-    H5SL_t     *visited;        /* Skip list for tracking visited nodes */
+    H5G_visited_t visited;      /* Set of objects visited */
     char       *path;           /* Path name of the link */
     size_t      curr_path_len;  /* Current length of the path in the buffer */
     size_t      path_buf_size;  /* Size of path buffer */
-    H5L_iterate_t op;           /* Application callback */
+    H5L_iterate_t op;           /* Application callback for each link */
+    H5G_visit_obj_t obj_op;     /* Callback for each object */
     void       *op_data;        /* Application's op data */
+    haddr_t    *child_addrs;    /* Addresses of the objects linked to from the current group */
+    size_t      nchildren;      /* # of links in the current group */
+    size_t      child_idx;      /* Index of the next link in the current group */
 } H5G_iter_visit_ud_t;
 
+/* User data for gathering the addresses of the objects linked to from a group */
+typedef struct {
+    haddr_t    *addrs;          /* Addresses of objects (undefined for soft & external links) */
+    size_t      naddrs;         /* # of addresses gathered */
+    size_t      alloc_naddrs;   /* # of addresses allocated */
+} H5G_iter_addrs_ud_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -87,6 +124,11 @@ typedef struct {
 /********************/
 
 static herr_t H5G__open_oid(H5G_t *grp);
+static int H5G__create_multi_cmp(const void *_name1, const void *_name2);
+static hbool_t H5G__visited_find(const H5G_visited_t *visited, const H5_obj_t *obj_pos);
+static herr_t H5G__visited_insert(H5G_visited_t *visited, const H5_obj_t *obj_pos);
+static herr_t H5G__visit_iterate(H5G_iter_visit_ud_t *udata, const H5O_loc_t *grp_oloc,
+    H5_index_t idx_type);
 
 
 /*********************/
@@ -97,9 +139,6 @@ static herr_t H5G__open_oid(H5G_t *grp);
 H5FL_DEFINE(H5G_t);
 H5FL_DEFINE(H5G_shared_t);
 
-/* Declare the free list to manage H5_obj_t's */
-H5FL_DEFINE(H5_obj_t);
-
 
 /*****************************/
 /* Library Private Variables */
@@ -240,6 +279,174 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__create() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__create_multi_cmp
+ *
+ * Purpose:	Callback routine for sorting the names of groups to create,
+ *              to find repeated names.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__create_multi_cmp(const void *_name1, const void *_name2)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(HDstrcmp(*(const char * const *)_name1, *(const char * const *)_name2))
+} /* end H5G__create_multi_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__create_multi
+ *
+ * Purpose:	Creates COUNT new empty groups, linked into the group at
+ *              LOC with the names in NAMES.
+ *
+ *              The groups are created and linked in batches, so that
+ *              the links in each batch are inserted into the parent
+ *              group together.  The names must be link names in the
+ *              parent group, not paths, and none of them may exist
+ *              already; this is checked before any group is created.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__create_multi(const H5G_loc_t *loc, size_t count, const char **names,
+    hid_t lcpl_id, hid_t gcpl_id)
+{
+    H5P_genplist_t *lc_plist;           /* Link creation property list */
+    H5T_cset_t cset;                    /* Character set of link names */
+    H5O_type_t obj_type;                /* Type of parent object */
+    const char **sorted = NULL;         /* Names, sorted */
+    H5G_obj_create_t *gcrt_info = NULL; /* Group creation info for each group */
+    H5O_link_t *lnks = NULL;            /* Links to new groups */
+    H5G_t **grps = NULL;                /* New groups */
+    size_t nbatch = 0;                  /* # of groups in current batch */
+    size_t u, v;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(names || 0 == count);
+    HDassert(lcpl_id != H5P_DEFAULT);
+    HDassert(gcpl_id != H5P_DEFAULT);
+
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* The location must be a group */
+    if(H5O_obj_type(loc->oloc, &obj_type) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get object type")
+    if(H5O_TYPE_GROUP != obj_type)
+        HGOTO_ERROR(H5E_SYM, H5E_BADTYPE, FAIL, "location is not a group")
+
+    /* Get the character set for the link names */
+    if(NULL == (lc_plist = (H5P_genplist_t *)H5I_object(lcpl_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "not a property list")
+    if(H5P_get(lc_plist, H5P_STRCRT_CHAR_ENCODING_NAME, &cset) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get character encoding")
+
+    /* Check the names, and that none of them is repeated or exists already */
+    if(NULL == (sorted = (const char **)H5MM_malloc(count * sizeof(char *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    for(u = 0; u < count; u++) {
+        if(!names[u] || !*names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no name given")
+        if(HDstrchr(names[u], '/') || !HDstrcmp(names[u], "."))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "name is not a link name")
+        sorted[u] = names[u];
+    } /* end for */
+    HDqsort(sorted, count, sizeof(char *), H5G__create_multi_cmp);
+    for(u = 0; u < count; u++) {
+        htri_t exists;                  /* Whether the name exists already */
+        H5O_link_t lnk;                 /* Existing link */
+
+        if(u > 0 && !HDstrcmp(sorted[u - 1], sorted[u]))
+            HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name is repeated")
+        if((exists = H5G__obj_lookup(loc->oloc, sorted[u], &lnk)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't look up name")
+        if(exists) {
+            H5O_msg_reset(H5O_LINK_ID, &lnk);
+            HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name already exists")
+        } /* end if */
+    } /* end for */
+
+    /* Allocate space for a batch of groups */
+    nbatch = MIN(count, H5G_CREATE_MULTI_BATCH);
+    if(NULL == (gcrt_info = (H5G_obj_create_t *)H5MM_malloc(nbatch * sizeof(H5G_obj_create_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (lnks = (H5O_link_t *)H5MM_calloc(nbatch * sizeof(H5O_link_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (grps = (H5G_t **)H5MM_calloc(nbatch * sizeof(H5G_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    for(u = 0; u < count; u += nbatch) {
+        nbatch = MIN(count - u, H5G_CREATE_MULTI_BATCH);
+
+        /* Create the groups */
+        for(v = 0; v < nbatch; v++) {
+            gcrt_info[v].gcpl_id = gcpl_id;
+            gcrt_info[v].cache_type = H5G_NOTHING_CACHED;
+            HDmemset(&gcrt_info[v].cache, 0, sizeof(gcrt_info[v].cache));
+            if(NULL == (grps[v] = H5G__create(loc->oloc->file, &gcrt_info[v])))
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create group")
+
+            /* Set up the link to the group */
+            /* (Casting away const OK - QAK) */
+            lnks[v].type = H5L_TYPE_HARD;
+            lnks[v].cset = cset;
+            lnks[v].corder = 0;
+            lnks[v].corder_valid = FALSE;
+            lnks[v].name = (char *)names[u + v];
+            lnks[v].u.hard.addr = grps[v]->oloc.addr;
+        } /* end for */
+
+        /* Link the groups into the parent group */
+        if(H5G__obj_insert_multi(loc->oloc, nbatch, lnks, gcrt_info) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to link groups")
+
+        /* Close the groups */
+        for(v = 0; v < nbatch; v++) {
+            H5G_t *grp = grps[v];       /* Group to close */
+
+            grps[v] = NULL;
+            if(H5O_dec_rc_by_loc(&(grp->oloc)) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTDEC, FAIL, "unable to decrement refcount on newly created object")
+            if(H5G_close(grp) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to close group")
+        } /* end for */
+    } /* end for */
+
+done:
+    /* Release any groups left open by an error.  (Groups that were not
+     *  linked into the parent group are deleted when they're closed.)
+     */
+    if(grps) {
+        for(v = 0; v < nbatch; v++)
+            if(grps[v]) {
+                if(H5O_dec_rc_by_loc(&(grps[v]->oloc)) < 0)
+                    HDONE_ERROR(H5E_SYM, H5E_CANTDEC, FAIL, "unable to decrement refcount on newly created object")
+                if(H5G_close(grps[v]) < 0)
+                    HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to close group")
+            } /* end if */
+        H5MM_xfree(grps);
+    } /* end if */
+    H5MM_xfree(lnks);
+    H5MM_xfree(gcrt_info);
+    H5MM_xfree(sorted);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__create_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G__open_name
@@ -502,6 +709,7 @@ H5G_close(H5G_t *grp)
         } /* end if */
 
         /* Free memory */
+        H5G__index_free(grp->shared);
         grp->shared = H5FL_FREE(H5G_shared_t, grp->shared);
     } else {
         /* Decrement the ref. count for this object in the top file */
@@ -833,28 +1041,146 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5G_free_visit_visited
+ * Function:    H5G__visited_find
  *
- * Purpose:     Free the key for an object visited during a group traversal
+ * Purpose:     Check if an object has been visited during a group traversal
  *
- * Return:      Non-negative on success, negative on failure
+ * Return:      TRUE if the object is in the set of visited objects, FALSE
+ *              otherwise
  *
- * Programmer:  Quincey Koziol
- *	        Nov  4, 2007
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5G__visited_find(const H5G_visited_t *visited, const H5_obj_t *obj_pos)
+{
+    size_t u;                           /* Slot to probe */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(visited);
+    HDassert(obj_pos);
+
+    /* Probe the table, until the object or an empty slot is found */
+    if(visited->nslots > 0)
+        for(u = H5G_VISITED_HASH(obj_pos, visited->nslots); H5F_addr_defined(visited->slots[u].addr);
+                u = (u + 1) & (visited->nslots - 1))
+            if(visited->slots[u].addr == obj_pos->addr && visited->slots[u].fileno == obj_pos->fileno)
+                HGOTO_DONE(TRUE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visited_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__visited_insert
+ *
+ * Purpose:     Add an object which hasn't been visited yet to the set of
+ *              objects visited during a group traversal, doubling the
+ *              size of the set's table when it becomes half full
+ *
+ * Return:      Non-negative on success, negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5G_free_visit_visited(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *operator_data/*in,out*/)
+H5G__visited_insert(H5G_visited_t *visited, const H5_obj_t *obj_pos)
 {
-    FUNC_ENTER_NOAPI_NOINIT_NOERR
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
 
-    item = H5FL_FREE(H5_obj_t, item);
+    FUNC_ENTER_STATIC
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
-} /* end H5G_free_visit_visited() */
+    /* Sanity check */
+    HDassert(visited);
+    HDassert(obj_pos);
+    HDassert(H5F_addr_defined(obj_pos->addr));
+    HDassert(!H5G__visited_find(visited, obj_pos));
+
+    /* Check if the table needs to grow */
+    if(2 * (visited->nobjs + 1) > visited->nslots) {
+        H5_obj_t *old_slots = visited->slots;   /* Previous table */
+        size_t old_nslots = visited->nslots;    /* # of slots in previous table */
+        size_t new_nslots = old_nslots ? (2 * old_nslots) : H5G_VISITED_INIT_NSLOTS;
+        H5_obj_t *new_slots;                    /* New table */
+
+        /* Allocate the new table and mark its slots empty */
+        if(NULL == (new_slots = (H5_obj_t *)H5MM_malloc(new_nslots * sizeof(H5_obj_t))))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate visited object table")
+        for(u = 0; u < new_nslots; u++)
+            new_slots[u].addr = HADDR_UNDEF;
+        visited->slots = new_slots;
+        visited->nslots = new_nslots;
+
+        /* Move the objects from the previous table */
+        for(u = 0; u < old_nslots; u++)
+            if(H5F_addr_defined(old_slots[u].addr)) {
+                size_t v;               /* Slot to probe */
+
+                for(v = H5G_VISITED_HASH(&old_slots[u], new_nslots); H5F_addr_defined(new_slots[v].addr);
+                        v = (v + 1) & (new_nslots - 1))
+                    ;
+                new_slots[v] = old_slots[u];
+            } /* end if */
+        H5MM_xfree(old_slots);
+    } /* end if */
+
+    /* Store the object in the first empty slot from its hash */
+    for(u = H5G_VISITED_HASH(obj_pos, visited->nslots); H5F_addr_defined(visited->slots[u].addr);
+            u = (u + 1) & (visited->nslots - 1))
+        ;
+    visited->slots[u] = *obj_pos;
+    visited->nobjs++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visited_insert() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5G__visit_addrs_cb
+ *
+ * Purpose:     Callback function for gathering the addresses of the objects
+ *              linked to from a group
+ *
+ * Return:	Success:        H5_ITER_CONT
+ *		Failure:	H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__visit_addrs_cb(const H5O_link_t *lnk, void *_udata)
+{
+    H5G_iter_addrs_ud_t *udata = (H5G_iter_addrs_ud_t *)_udata;     /* User data for callback */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(lnk);
+    HDassert(udata);
+
+    /* Check if we need more space for the addresses */
+    if(udata->naddrs == udata->alloc_naddrs) {
+        size_t new_alloc = MAX(udata->alloc_naddrs * 2, H5G_VISIT_PREFETCH_NOBJS);
+        haddr_t *new_addrs;
+
+        if(NULL == (new_addrs = (haddr_t *)H5MM_realloc(udata->addrs, new_alloc * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, H5_ITER_ERROR, "can't allocate object addresses")
+        udata->addrs = new_addrs;
+        udata->alloc_naddrs = new_alloc;
+    } /* end if */
+
+    /* Record the object's address, for hard links */
+    udata->addrs[udata->naddrs++] = (lnk->type == H5L_TYPE_HARD) ? lnk->u.hard.addr : HADDR_UNDEF;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visit_addrs_cb() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5G_visit_cb
  *
@@ -872,7 +1198,6 @@ static herr_t
 H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
 {
     H5G_iter_visit_ud_t *udata = (H5G_iter_visit_ud_t *)_udata;     /* User data for callback */
-    H5L_info_t info;                    /* Link info */
     H5G_loc_t   obj_loc;                /* Location of object */
     H5G_name_t  obj_path;            	/* Object's group hier. path */
     H5O_loc_t   obj_oloc;            	/* Object's object location */
@@ -888,6 +1213,16 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
     HDassert(lnk);
     HDassert(udata);
 
+    /* Load the next batch of the group's objects' headers together */
+    if(udata->child_idx < udata->nchildren) {
+        if((udata->child_idx % H5G_VISIT_PREFETCH_NOBJS) == 0)
+            if(H5O_prefetch(udata->curr_loc->oloc->file,
+                    MIN(H5G_VISIT_PREFETCH_NOBJS, udata->nchildren - udata->child_idx),
+                    &udata->child_addrs[udata->child_idx]) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTLOAD, H5_ITER_ERROR, "unable to prefetch object headers")
+        udata->child_idx++;
+    } /* end if */
+
     /* Check if we will need more space to store this link's relative path */
     /* ("+2" is for string terminator and possible '/' for group separator later) */
     link_name_len = HDstrlen(lnk->name);
@@ -907,34 +1242,49 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
     HDstrncpy(&(udata->path[old_path_len]), lnk->name, link_name_len + 1);
     udata->curr_path_len += link_name_len;
 
-    /* Construct the link info from the link message */
-    if(H5G_link_to_info(lnk, &info) < 0)
-        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, H5_ITER_ERROR, "unable to get info for link")
+    /* Make the application callback for the link, if there is one */
+    if(udata->op) {
+        H5L_info_t info;                /* Link info */
 
-    /* Make the application callback */
-    ret_value = (udata->op)(udata->gid, udata->path, &info, udata->op_data);
+        /* Construct the link info from the link message */
+        if(H5G_link_to_info(lnk, &info) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, H5_ITER_ERROR, "unable to get info for link")
+
+        ret_value = (udata->op)(udata->gid, udata->path, &info, udata->op_data);
+    } /* end if */
 
     /* Check for doing more work */
     if(ret_value == H5_ITER_CONT && lnk->type == H5L_TYPE_HARD) {
         H5_obj_t obj_pos;       /* Object "position" for this object */
 
-        /* Set up opened group location to fill in */
+        /* Set up the object's location from the link, without looking the
+         *      link up again by name in the group
+         */
         obj_loc.oloc = &obj_oloc;
         obj_loc.path = &obj_path;
         H5G_loc_reset(&obj_loc);
-
-        /* Find the object using the LAPL passed in */
-        /* (Correctly handles mounted files) */
-        if(H5G_loc_find(udata->curr_loc, lnk->name, &obj_loc/*out*/) < 0)
-            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, H5_ITER_ERROR, "object not found")
+        obj_oloc.file = udata->curr_loc->oloc->file;
+        obj_oloc.addr = lnk->u.hard.addr;
         obj_found = TRUE;
 
+        /* Resolve the object to the root group of a file mounted on it */
+        if(H5F_traverse_mount(&obj_oloc) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, H5_ITER_ERROR, "mount point traversal failed")
+
+        /* Hold the file open while the object's location is in use, if the
+         *      group's location is the only thing holding it open
+         *      (as H5G_loc_find would)
+         */
+        if(udata->curr_loc->oloc->holding_file && udata->curr_loc->oloc->file == obj_oloc.file)
+            if(H5O_loc_hold_file(&obj_oloc) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, H5_ITER_ERROR, "unable to hold file open")
+
         /* Construct unique "position" for this object */
         H5F_GET_FILENO(obj_oloc.file, obj_pos.fileno);
         obj_pos.addr = obj_oloc.addr;
 
         /* Check if we've seen the object the link references before */
-        if(NULL == H5SL_search(udata->visited, &obj_pos)) {
+        if(!H5G__visited_find(&udata->visited, &obj_pos)) {
             H5O_type_t otype;       /* Basic object type (group, dataset, etc.) */
             unsigned rc;		/* Reference count of object    */
 
@@ -944,23 +1294,16 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
 
             /* If its ref count is > 1, we add it to the list of visited objects */
             /* (because it could come up again during traversal) */
-            if(rc > 1) {
-                H5_obj_t *new_node;                  /* New object node for visited list */
-
-                /* Allocate new object "position" node */
-                if((new_node = H5FL_MALLOC(H5_obj_t)) == NULL)
-                    HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, H5_ITER_ERROR, "can't allocate object node")
-
-                /* Set node information */
-                *new_node = obj_pos;
-
-                /* Add to list of visited objects */
-                if(H5SL_insert(udata->visited, new_node, new_node) < 0)
+            if(rc > 1)
+                if(H5G__visited_insert(&udata->visited, &obj_pos) < 0)
                     HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, H5_ITER_ERROR, "can't insert object node into visited list")
-            } /* end if */
+
+            /* Make the callback for the object, if there is one */
+            if(udata->obj_op)
+                ret_value = (udata->obj_op)(udata->path, &obj_oloc, otype, rc, udata->op_data);
 
             /* If it's a group, we recurse into it */
-            if(otype == H5O_TYPE_GROUP) {
+            if(ret_value == H5_ITER_CONT && otype == H5O_TYPE_GROUP) {
                 H5G_loc_t *old_loc = udata->curr_loc;       /* Pointer to previous group location info */
                 H5_index_t idx_type = udata->idx_type;      /* Type of index to use */
                 H5O_linfo_t	linfo;		        /* Link info message */
@@ -996,7 +1339,7 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
                 udata->curr_loc = &obj_loc;
 
                 /* Iterate over links in group */
-                ret_value = H5G__obj_iterate(&obj_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G_visit_cb, udata);
+                ret_value = H5G__visit_iterate(udata, &obj_oloc, idx_type);
 
                 /* Restore location */
                 udata->curr_loc = old_loc;
@@ -1016,21 +1359,71 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_visit_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__visit_iterate
+ *
+ * Purpose:     Visit the links in one group during a recursive traversal.
+ *
+ *              The addresses of the objects linked to from the group are
+ *              gathered first, so that the objects' headers can be loaded
+ *              in batches, in address order (see H5O_prefetch), before
+ *              the links are visited.
+ *
+ * Return:	Success:        The return value of the last callback
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__visit_iterate(H5G_iter_visit_ud_t *udata, const H5O_loc_t *grp_oloc,
+    H5_index_t idx_type)
+{
+    H5G_iter_addrs_ud_t addrs_udata;    /* User data for gathering addresses */
+    haddr_t *old_child_addrs = udata->child_addrs;  /* Parent group's objects' addresses */
+    size_t old_nchildren = udata->nchildren;    /* # of links in parent group */
+    size_t old_child_idx = udata->child_idx;    /* Index of next link in parent group */
+    herr_t ret_value = FAIL;            /* Return value */
+
+    /* Portably clear udata struct (before FUNC_ENTER) */
+    HDmemset(&addrs_udata, 0, sizeof(addrs_udata));
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(udata);
+    HDassert(grp_oloc);
+
+    /* Gather the addresses of the group's objects, in the order visited */
+    if(H5G__obj_iterate(grp_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G__visit_addrs_cb, &addrs_udata) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't gather object addresses")
+
+    /* Point to this group's objects */
+    udata->child_addrs = addrs_udata.addrs;
+    udata->nchildren = addrs_udata.naddrs;
+    udata->child_idx = 0;
+
+    /* Iterate over links in group */
+    ret_value = H5G__obj_iterate(grp_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G_visit_cb, udata);
+
+done:
+    /* Restore the parent group's objects */
+    udata->child_addrs = old_child_addrs;
+    udata->nchildren = old_nchildren;
+    udata->child_idx = old_child_idx;
+    H5MM_xfree(addrs_udata.addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visit_iterate() */
+
 
 /*-------------------------------------------------------------------------
- * Function:    H5G_visit
+ * Function:    H5G__visit
  *
  * Purpose:     Recursively visit all the links in a group and all
- *              the groups that are linked to from that group.  Links within
- *              each group are visited according to the order within the
- *              specified index (unless the specified index does not exist for
- *              a particular group, then the "name" index is used).
- *
- *              NOTE: Each _link_ reachable from the initial group will only be
- *              visited once.  However, because an object may be reached from
- *              more than one link, the visitation may call the application's
- *              callback with more than one link that points to a particular
- *              _object_.
+ *              the groups that are linked to from that group, making the
+ *              link callback (if any) for each link and the object callback
+ *              (if any) for the first link found to each object.
  *
  * Return:      Success:    The return value of the first operator that
  *                          returns non-zero, or zero if all members were
@@ -1042,9 +1435,9 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
-    H5_iter_order_t order, H5L_iterate_t op, void *op_data)
+static herr_t
+H5G__visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
+    H5_iter_order_t order, H5L_iterate_t op, H5G_visit_obj_t obj_op, void *op_data)
 {
     H5G_iter_visit_ud_t udata;      /* User data for callback */
     H5O_linfo_t	linfo;		    /* Link info message */
@@ -1058,7 +1451,7 @@ H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
     /* Portably clear udata struct (before FUNC_ENTER) */
     HDmemset(&udata, 0, sizeof(udata));
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_STATIC
 
     /* Check args */
     if(!loc)
@@ -1082,6 +1475,7 @@ H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
     udata.idx_type = idx_type;
     udata.order = order;
     udata.op = op;
+    udata.obj_op = obj_op;
     udata.op_data = op_data;
 
     /* Allocate space for the path name */
@@ -1090,10 +1484,6 @@ H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
     udata.path_buf_size = 1;
     udata.curr_path_len = 0;
 
-    /* Create skip list to store visited object information */
-    if((udata.visited = H5SL_create(H5SL_TYPE_OBJ, NULL)) == NULL)
-        HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create skip list for visited objects")
-
     /* Get the group's reference count */
     if(H5O_get_rc_and_type(&grp->oloc, &rc, NULL) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to get object info")
@@ -1101,18 +1491,14 @@ H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
     /* If its ref count is > 1, we add it to the list of visited objects */
     /* (because it could come up again during traversal) */
     if(rc > 1) {
-        H5_obj_t *obj_pos;                  /* New object node for visited list */
-
-        /* Allocate new object "position" node */
-        if((obj_pos = H5FL_MALLOC(H5_obj_t)) == NULL)
-            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't allocate object node")
+        H5_obj_t obj_pos;                   /* Object "position" for this object */
 
         /* Construct unique "position" for this object */
-        H5F_GET_FILENO(grp->oloc.file, obj_pos->fileno);
-        obj_pos->addr = grp->oloc.addr;
+        H5F_GET_FILENO(grp->oloc.file, obj_pos.fileno);
+        obj_pos.addr = grp->oloc.addr;
 
-        /* Add to list of visited objects */
-        if(H5SL_insert(udata.visited, obj_pos, obj_pos) < 0)
+        /* Add to set of visited objects */
+        if(H5G__visited_insert(&udata.visited, &obj_pos) < 0)
             HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert object node into visited list")
     } /* end if */
 
@@ -1138,14 +1524,13 @@ H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
     } /* end if */
 
     /* Call the link iteration routine */
-    if((ret_value = H5G__obj_iterate(&(grp->oloc), idx_type, order, (hsize_t)0, NULL, H5G_visit_cb, &udata)) < 0)
+    if((ret_value = H5G__visit_iterate(&udata, &(grp->oloc), idx_type)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't visit links")
 
 done:
     /* Release user data resources */
     H5MM_xfree(udata.path);
-    if(udata.visited)
-        H5SL_destroy(udata.visited, H5G_free_visit_visited, NULL);
+    H5MM_xfree(udata.visited.slots);
 
     /* Release the group opened */
     if(gid != H5I_INVALID_HID) {
@@ -1155,9 +1540,99 @@ done:
     else if(grp && H5G_close(grp) < 0)
         HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "unable to release group")
 
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__visit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_visit
+ *
+ * Purpose:     Recursively visit all the links in a group and all
+ *              the groups that are linked to from that group.  Links within
+ *              each group are visited according to the order within the
+ *              specified index (unless the specified index does not exist for
+ *              a particular group, then the "name" index is used).
+ *
+ *              NOTE: Each _link_ reachable from the initial group will only be
+ *              visited once.  However, because an object may be reached from
+ *              more than one link, the visitation may call the application's
+ *              callback with more than one link that points to a particular
+ *              _object_.
+ *
+ * Return:      Success:    The return value of the first operator that
+ *                          returns non-zero, or zero if all members were
+ *                          processed with no operator returning non-zero.
+ *
+ *              Failure:    Negative if something goes wrong within the
+ *                          library, or the negative value returned by one
+ *                          of the operators.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_visit(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
+    H5_iter_order_t order, H5L_iterate_t op, void *op_data)
+{
+    herr_t ret_value = FAIL;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(op);
+
+    /* Visit the links */
+    if((ret_value = H5G__visit(loc, group_name, idx_type, order, op, NULL, op_data)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "link visitation failed")
+
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_visit() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_visit_objs
+ *
+ * Purpose:     Recursively visit all the objects linked to from a group
+ *              and the groups below it, in the same order as H5G_visit
+ *              visits their links, making the callback once per object
+ *              with the path of the first link found to it.
+ *
+ *              The callback is given the object's location, type and
+ *              reference count, which the traversal needs anyway, so
+ *              callers which need nothing more don't have to look the
+ *              object up again or decode any more of its header.
+ *
+ *              NOTE: Soft links and user-defined links are not followed.
+ *
+ * Return:      Success:    The return value of the first operator that
+ *                          returns non-zero, or zero if all objects were
+ *                          processed with no operator returning non-zero.
+ *
+ *              Failure:    Negative if something goes wrong within the
+ *                          library, or the negative value returned by one
+ *                          of the operators.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_visit_objs(H5G_loc_t *loc, const char *group_name, H5_index_t idx_type,
+    H5_iter_order_t order, H5G_visit_obj_t op, void *op_data)
+{
+    herr_t ret_value = FAIL;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(op);
+
+    /* Visit the objects */
+    if((ret_value = H5G__visit(loc, group_name, idx_type, order, NULL, op, op_data)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "object visitation failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_visit_objs() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_get_create_plist
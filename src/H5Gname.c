@@ -1071,6 +1071,11 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file,
     /* Check arguments */
     HDassert(src_file);
 
+    /* Discard cached paths that may no longer resolve to the same objects */
+    H5G__path_cache_invalidate(src_file);
+    if(dst_file)
+        H5G__path_cache_invalidate(dst_file);
+
     /* Check if the object we are manipulating has a path */
     if(src_full_path_r) {
         hbool_t search_group = FALSE;  /* Flag to indicate that groups are to be searched */
@@ -54,15 +54,6 @@
 /* User data for object header iterator when converting link messages to dense
  * link storage
  */
-typedef struct {
-    H5F_t      *f;              /* Pointer to file for insertion */
-    haddr_t     oh_addr;        /* Address of the object header */
-    H5O_linfo_t *linfo;         /* Pointer to link info */
-} H5G_obj_oh_it_ud1_t;
-
-/* User data for link iterator when converting dense link storage to link
- * messages
- */
 typedef struct {
     H5O_link_t *lnk_table;              /* Array of links to convert */
     size_t nlinks;                      /* Number of links converted */
@@ -88,6 +79,8 @@ typedef struct {
 static herr_t H5G_obj_compact_to_dense_cb(const void *_mesg, unsigned idx,
     void *_udata);
 static herr_t H5G__obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *linfo);
+static herr_t H5G__obj_compact_to_dense(const H5O_loc_t *grp_oloc,
+    H5O_linfo_t *linfo, size_t nlinks, const H5O_link_t *lnks);
 
 
 /*********************/
@@ -363,7 +356,7 @@ done:
  * Function:	H5G_obj_compact_to_dense_cb
  *
  * Purpose:	Callback routine for converting "compact" to "dense"
- *              link storage form.
+ *              link storage form, collecting the group's links.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -377,23 +370,140 @@ static herr_t
 H5G_obj_compact_to_dense_cb(const void *_mesg, unsigned H5_ATTR_UNUSED idx, void *_udata)
 {
     const H5O_link_t *lnk = (const H5O_link_t *)_mesg;  /* Pointer to link */
-    H5G_obj_oh_it_ud1_t *udata = (H5G_obj_oh_it_ud1_t *)_udata;     /* 'User data' passed in */
+    H5G_obj_lnk_it_ud1_t *udata = (H5G_obj_lnk_it_ud1_t *)_udata;     /* 'User data' passed in */
     herr_t ret_value = H5_ITER_CONT;   /* Return value */
 
-    FUNC_ENTER_NOAPI_NOINIT_TAG(udata->oh_addr)
+    FUNC_ENTER_NOAPI_NOINIT
 
     /* check arguments */
     HDassert(lnk);
     HDassert(udata);
 
-    /* Insert link into dense link storage */
-    if(H5G__dense_insert(udata->f, udata->linfo, lnk) < 0)
-        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into dense storage")
+    /* Check for needing to increase the size of the link table */
+    if(udata->nlinks >= udata->alloc_links) {
+        size_t na = udata->alloc_links * 2;    /* New # of links allocated */
+        H5O_link_t *x;          /* Pointer to larger link table */
+
+        if(NULL == (x = (H5O_link_t *)H5MM_realloc(udata->lnk_table, sizeof(H5O_link_t) * na)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed")
+        udata->alloc_links = na;
+        udata->lnk_table = x;
+    } /* end if */
+
+    /* Copy link into the table, for inserting into dense link storage */
+    if(NULL == H5O_msg_copy(H5O_LINK_ID, lnk, &(udata->lnk_table[udata->nlinks])))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, H5_ITER_ERROR, "can't copy link message")
+    udata->nlinks++;
 
 done:
-    FUNC_LEAVE_NOAPI_TAG(ret_value)
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G_obj_compact_to_dense_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__obj_compact_to_dense
+ *
+ * Purpose:	Converts a "new format" group from "compact" to "dense"
+ *              link storage, moving its 'link' messages into the dense
+ *              storage.
+ *
+ *              NLINKS more links from LNKS are inserted along with the
+ *              'link' messages, so that the empty indices of the new
+ *              dense storage are bulk-loaded with all of them at once.
+ *              Updating the link info message for them is left to the
+ *              caller.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__obj_compact_to_dense(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo,
+    size_t nlinks, const H5O_link_t *lnks)
+{
+    H5O_pline_t tmp_pline;      /* Pipeline message */
+    H5O_pline_t *pline = NULL;  /* Pointer to pipeline message */
+    htri_t pline_exists;        /* Whether the pipeline message exists */
+    H5G_obj_lnk_it_ud1_t udata; /* User data for iteration */
+    H5O_mesg_operator_t op;     /* Message operator */
+    size_t ncopied = 0;         /* # of links copied from 'link' messages */
+    herr_t status;              /* Status from iteration */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(linfo);
+    HDassert(lnks || 0 == nlinks);
+
+    /* Set up user data for object header message iteration */
+    udata.alloc_links = (size_t)linfo->nlinks + nlinks;
+    udata.nlinks = 0;
+    if(NULL == (udata.lnk_table = (H5O_link_t *)H5MM_malloc(sizeof(H5O_link_t) * MAX(udata.alloc_links, 1))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    udata.alloc_links = MAX(udata.alloc_links, 1);
+
+    /* Get the pipeline message, if it exists */
+    if((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
+    if(pline_exists) {
+        if(NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
+        pline = &tmp_pline;
+    } /* end if */
+
+    /* The group doesn't currently have "dense" storage for links */
+    if(H5G__dense_create(grp_oloc->file, linfo, pline) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+    /* Iterate over the 'link' messages, collecting them */
+    op.op_type = H5O_MESG_OP_APP;
+    op.u.app_op = H5G_obj_compact_to_dense_cb;
+    status = H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata);
+    ncopied = udata.nlinks;
+    if(status < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
+
+    /* Add the extra links to the table (they are not copied) */
+    if(nlinks > 0) {
+        if((udata.nlinks + nlinks) > udata.alloc_links) {
+            H5O_link_t *x;      /* Pointer to larger link table */
+
+            if(NULL == (x = (H5O_link_t *)H5MM_realloc(udata.lnk_table, sizeof(H5O_link_t) * (udata.nlinks + nlinks))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+            udata.alloc_links = udata.nlinks + nlinks;
+            udata.lnk_table = x;
+        } /* end if */
+        HDmemcpy(&udata.lnk_table[udata.nlinks], lnks, sizeof(H5O_link_t) * nlinks);
+        udata.nlinks += nlinks;
+    } /* end if */
+
+    /* Insert all the links into the dense link storage */
+    if(H5G__dense_insert_multi(grp_oloc->file, linfo, udata.nlinks, udata.lnk_table) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+
+    /* Remove all the 'link' messages */
+    if(H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
+
+done:
+    /* Free any space used by the pipeline message */
+    if(pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
+
+    /* Release the copies of the 'link' messages */
+    if(udata.lnk_table) {
+        for(u = 0; u < ncopied; u++)
+            if(H5O_msg_reset(H5O_LINK_ID, &(udata.lnk_table[u])) < 0)
+                HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "unable to release link message")
+        H5MM_xfree(udata.lnk_table);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__obj_compact_to_dense() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_obj_stab_to_new_cb
@@ -452,8 +562,6 @@ herr_t
 H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     hbool_t adj_link, H5O_type_t obj_type, const void *crt_info)
 {
-    H5O_pline_t tmp_pline;      /* Pipeline message */
-    H5O_pline_t *pline = NULL;  /* Pointer to pipeline message */
     H5O_linfo_t linfo;		/* Link info message */
     htri_t linfo_exists;        /* Whether the link info message exists */
     hbool_t use_old_format;     /* Whether to use 'old format' (symbol table) for insertions or not */
@@ -467,6 +575,9 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     HDassert(name && *name);
     HDassert(obj_lnk);
 
+    /* Discard the group's in-memory index of its links, if it has one */
+    H5G__index_invalidate(grp_oloc);
+
     /* Check if we have information about the number of objects in this group */
     /* (by attempting to get the link info message for this group) */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
@@ -505,37 +616,9 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
         else if(linfo.nlinks < ginfo.max_compact && link_msg_size < H5O_MESG_MAX_SIZE)
             use_new_dense = FALSE;
         else {
-            htri_t              pline_exists;   /* Whether the pipeline message exists */
-            H5G_obj_oh_it_ud1_t	udata;          /* User data for iteration */
-            H5O_mesg_operator_t op;             /* Message operator */
-
-            /* Get the pipeline message, if it exists */
-            if((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
-            if(pline_exists) {
-                if(NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
-                    HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
-                pline = &tmp_pline;
-            } /* end if */
-
             /* The group doesn't currently have "dense" storage for links */
-            if(H5G__dense_create(grp_oloc->file, &linfo, pline) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
-
-            /* Set up user data for object header message iteration */
-            udata.f = grp_oloc->file;
-            udata.oh_addr = grp_oloc->addr;
-            udata.linfo = &linfo;
-
-            /* Iterate over the 'link' messages, inserting them into the dense link storage  */
-            op.op_type = H5O_MESG_OP_APP;
-            op.u.app_op = H5G_obj_compact_to_dense_cb;
-            if(H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
-
-            /* Remove all the 'link' messages */
-            if(H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
+            if(H5G__obj_compact_to_dense(grp_oloc, &linfo, (size_t)0, NULL) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to convert group to 'dense' link storage")
 
             use_new_dense = TRUE;
         } /* end else */
@@ -623,13 +706,147 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     } /* end if */
 
 done:
-    /* Free any space used by the pipeline message */
-    if(pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
-        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
-
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G_obj_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__obj_insert_multi
+ *
+ * Purpose:	Insert a batch of hard links to newly created groups into
+ *              the group described by GRP_OLOC, and increment the
+ *              reference count of each new group.
+ *
+ *              For "new format" groups, the link info message is only
+ *              updated once for the whole batch, a group that will have
+ *              too many links for "compact" storage is converted to
+ *              "dense" storage before any of the links are inserted, and
+ *              the links are inserted into "dense" storage together.
+ *
+ *              The caller must have checked that none of the link names
+ *              are already in the group, or repeated in the batch.  All
+ *              the links must have the same character set.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__obj_insert_multi(const H5O_loc_t *grp_oloc, size_t nlinks, H5O_link_t *lnks,
+    const H5G_obj_create_t *gcrt_info)
+{
+    H5O_linfo_t linfo;		/* Link info message */
+    htri_t linfo_exists;        /* Whether the link info message exists */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(grp_oloc->addr)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(lnks || 0 == nlinks);
+    HDassert(gcrt_info || 0 == nlinks);
+
+    if(0 == nlinks)
+        HGOTO_DONE(SUCCEED)
+#ifndef NDEBUG
+    for(u = 1; u < nlinks; u++)
+        HDassert(lnks[u].cset == lnks[0].cset);
+#endif /* NDEBUG */
+
+    /* Discard the group's in-memory index of its links, if it has one */
+    H5G__index_invalidate(grp_oloc);
+
+    /* Check if we have information about the number of objects in this group */
+    if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if(linfo_exists) {
+        H5O_ginfo_t ginfo;	/* Group info message */
+        hbool_t use_new_dense;  /* Whether to use "dense" form of 'new format' group */
+
+        /* Get the group info */
+        if(NULL == H5O_msg_read(grp_oloc, H5O_GINFO_ID, &ginfo))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get group info")
+
+        /* Set the creation order for the new links, and check whether they
+         * all fit in the 'link' messages
+         */
+        use_new_dense = H5F_addr_defined(linfo.fheap_addr) || (linfo.nlinks + nlinks) > ginfo.max_compact;
+        for(u = 0; u < nlinks; u++) {
+            if(linfo.track_corder) {
+                lnks[u].corder = linfo.max_corder++;
+                lnks[u].corder_valid = TRUE;
+            } /* end if */
+
+            if(!use_new_dense) {
+                size_t link_msg_size;   /* Size of new link message in the file */
+
+                if((link_msg_size = H5O_msg_raw_size(grp_oloc->file, H5O_LINK_ID, FALSE, &lnks[u])) == 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+                if(link_msg_size >= H5O_MESG_MAX_SIZE)
+                    use_new_dense = TRUE;
+            } /* end if */
+        } /* end for */
+
+        if(use_new_dense) {
+            /* Convert the group to "dense" storage along with the new links,
+             * or insert them into its existing dense link storage
+             */
+            if(!H5F_addr_defined(linfo.fheap_addr)) {
+                if(H5G__obj_compact_to_dense(grp_oloc, &linfo, nlinks, lnks) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to convert group to 'dense' link storage")
+            } /* end if */
+            else
+                if(H5G__dense_insert_multi(grp_oloc->file, &linfo, nlinks, lnks) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+        } /* end if */
+        else
+            /* Insert with link messages */
+            for(u = 0; u < nlinks; u++)
+                if(H5G__compact_insert(grp_oloc, &lnks[u]) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link as link message")
+
+        /* Update the number of objects in this group */
+        linfo.nlinks += nlinks;
+        if(H5O_msg_write(grp_oloc, H5O_LINFO_ID, 0, H5O_UPDATE_TIME, &linfo) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't update link info message")
+    } /* end if */
+    else if(lnks[0].cset != H5T_CSET_ASCII) {
+        /* Let the first insertion convert the group to the "new format",
+         * to hold the link's character set, then insert the rest together
+         */
+        if(H5G_obj_insert(grp_oloc, lnks[0].name, &lnks[0], FALSE, H5O_TYPE_GROUP, &gcrt_info[0]) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into group")
+        if(nlinks > 1 && H5G__obj_insert_multi(grp_oloc, nlinks - 1, lnks + 1, gcrt_info + 1) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into group")
+
+        /* Increment the reference count of the first group (the others
+         *  were done by the recursive call)
+         */
+        nlinks = 1;
+    } /* end if */
+    else
+        /* Insert into symbol table */
+        for(u = 0; u < nlinks; u++)
+            if(H5G__stab_insert(grp_oloc, lnks[u].name, &lnks[u], H5O_TYPE_GROUP, &gcrt_info[u]) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert entry into symbol table")
+
+    /* Increment the reference count of each new group */
+    for(u = 0; u < nlinks; u++) {
+        H5O_loc_t obj_oloc;             /* Object location */
+
+        HDassert(lnks[u].type == H5L_TYPE_HARD);
+        H5O_loc_reset(&obj_oloc);
+        obj_oloc.file = grp_oloc->file;
+        obj_oloc.addr = lnks[u].u.hard.addr;
+        if(H5O_link(&obj_oloc, 1) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_LINKCOUNT, FAIL, "unable to increment hard link count")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5G__obj_insert_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G__obj_iterate
@@ -981,6 +1198,12 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Discard the group's in-memory index of its links, if it has one,
+     * and any cached paths that may go through the link
+     */
+    H5G__index_invalidate(oloc);
+    H5G__path_cache_invalidate(oloc->file);
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1045,6 +1268,12 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r,
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Discard the group's in-memory index of its links, if it has one,
+     * and any cached paths that may go through the link
+     */
+    H5G__index_invalidate(grp_oloc);
+    H5G__path_cache_invalidate(grp_oloc->file);
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1112,6 +1341,7 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk)
 {
     H5O_linfo_t linfo;		        /* Link info message */
     htri_t linfo_exists;                /* Whether the link info message exists */
+    hbool_t indexed = FALSE;            /* Whether the group's links are indexed in memory */
     htri_t     ret_value = FALSE;       /* Return value */
 
     FUNC_ENTER_PACKAGE_TAG(grp_oloc->addr)
@@ -1120,6 +1350,12 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk)
     HDassert(grp_oloc && grp_oloc->file);
     HDassert(name && *name);
 
+    /* Check the group's in-memory index of its links first, if it has one */
+    if((ret_value = H5G__index_lookup(grp_oloc, name, lnk, &indexed)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't search link index")
+    if(indexed)
+        HGOTO_DONE(ret_value)
+
     /* Attempt to get the link info message for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
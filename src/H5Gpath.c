@@ -0,0 +1,454 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gpath.c
+ *
+ * Purpose:		Cache of resolved absolute path prefixes.
+ *
+ *                      Each file's root group keeps a small LRU cache that
+ *                      maps the absolute paths of groups reached during
+ *                      path traversal (e.g. "/run42/step0001/field") to
+ *                      their object header addresses, so later traversals
+ *                      of paths in the same groups only have to look up
+ *                      the components after the longest cached prefix.
+ *
+ *                      Only prefixes made up of hard links within the
+ *                      root group's file (i.e. not crossing soft, external
+ *                      or user-defined links or mount points) are cached.
+ *                      The cache is emptied whenever a link is removed or
+ *                      moved in the file, or a file is mounted or unmounted.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+#include "H5Gmodule.h"          /* This source code file is part of the H5G module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5Gpkg.h"		/* Groups		  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Maximum number of paths in a file's cache */
+#define H5G_PATH_CACHE_NENTRIES         128
+
+/* Number of hash buckets in a file's cache (must be a power of 2) */
+#define H5G_PATH_CACHE_NBUCKETS         256
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* A cached path */
+typedef struct H5G_path_cache_ent_t {
+    char *path;                         /* Absolute path of group */
+    size_t len;                         /* Length of path */
+    uint32_t hash;                      /* Hash value of path */
+    haddr_t addr;                       /* Address of group's object header */
+    struct H5G_path_cache_ent_t *next;  /* Next path in the same bucket */
+    struct H5G_path_cache_ent_t *lru_prev;  /* Previous (more recently used) path */
+    struct H5G_path_cache_ent_t *lru_next;  /* Next (less recently used) path */
+} H5G_path_cache_ent_t;
+
+/* A file's path cache */
+struct H5G_path_cache_t {
+    size_t nentries;                    /* Number of cached paths */
+    H5G_path_cache_ent_t *lru_head;     /* Most recently used path */
+    H5G_path_cache_ent_t *lru_tail;     /* Least recently used path */
+    H5G_path_cache_ent_t *buckets[H5G_PATH_CACHE_NBUCKETS];    /* Hash buckets */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static H5G_path_cache_ent_t *H5G__path_cache_find(H5G_path_cache_t *cache,
+    const char *path, size_t len, uint32_t hash);
+static void H5G__path_cache_remove(H5G_path_cache_t *cache,
+    H5G_path_cache_ent_t *ent);
+static void H5G__path_cache_clear(H5G_path_cache_t *cache);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the cache structs */
+H5FL_DEFINE_STATIC(H5G_path_cache_t);
+H5FL_DEFINE_STATIC(H5G_path_cache_ent_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_find
+ *
+ * Purpose:	Finds a path in a cache and makes it the most recently used.
+ *
+ * Return:	Success:	Pointer to the cached path
+ *		Not cached:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5G_path_cache_ent_t *
+H5G__path_cache_find(H5G_path_cache_t *cache, const char *path, size_t len,
+    uint32_t hash)
+{
+    H5G_path_cache_ent_t *ent;          /* Cached path */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(ent = cache->buckets[hash & (H5G_PATH_CACHE_NBUCKETS - 1)]; ent; ent = ent->next)
+        if(ent->hash == hash && ent->len == len && !HDmemcmp(ent->path, path, len))
+            break;
+
+    /* Move the path to the front of the LRU list */
+    if(ent && ent != cache->lru_head) {
+        ent->lru_prev->lru_next = ent->lru_next;
+        if(ent->lru_next)
+            ent->lru_next->lru_prev = ent->lru_prev;
+        else
+            cache->lru_tail = ent->lru_prev;
+        ent->lru_prev = NULL;
+        ent->lru_next = cache->lru_head;
+        cache->lru_head->lru_prev = ent;
+        cache->lru_head = ent;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ent)
+} /* end H5G__path_cache_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_remove
+ *
+ * Purpose:	Removes a path from a cache and releases it.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__path_cache_remove(H5G_path_cache_t *cache, H5G_path_cache_ent_t *ent)
+{
+    H5G_path_cache_ent_t **prev;        /* Pointer to link to path in bucket */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Unlink the path from its bucket */
+    for(prev = &cache->buckets[ent->hash & (H5G_PATH_CACHE_NBUCKETS - 1)]; *prev != ent; prev = &(*prev)->next)
+        HDassert(*prev);
+    *prev = ent->next;
+
+    /* Unlink the path from the LRU list */
+    if(ent->lru_prev)
+        ent->lru_prev->lru_next = ent->lru_next;
+    else
+        cache->lru_head = ent->lru_next;
+    if(ent->lru_next)
+        ent->lru_next->lru_prev = ent->lru_prev;
+    else
+        cache->lru_tail = ent->lru_prev;
+    cache->nentries--;
+
+    H5MM_xfree(ent->path);
+    ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__path_cache_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_clear
+ *
+ * Purpose:	Removes all the paths from a cache.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__path_cache_clear(H5G_path_cache_t *cache)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    while(cache->lru_head)
+        H5G__path_cache_remove(cache, cache->lru_head);
+    HDassert(0 == cache->nentries);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__path_cache_clear() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_enabled
+ *
+ * Purpose:	Checks if traversals of absolute paths from a root group
+ *              may use the path cache.  (Another process may change the
+ *              links in a file opened for SWMR reading.)
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5G__path_cache_enabled(const H5G_t *root_grp)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(root_grp);
+
+    FUNC_LEAVE_NOAPI(!(H5F_INTENT(root_grp->oloc.file) & H5F_ACC_SWMR_READ))
+} /* end H5G__path_cache_enabled() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_lookup
+ *
+ * Purpose:	Looks up the longest prefix of an absolute path NAME,
+ *              leaving out its last component, in a root group's path
+ *              cache.
+ *
+ *              The canonical form of the prefix (components separated by
+ *              single '/' characters, without any '.' components) is
+ *              built in CANON, which must hold at least strlen(NAME) + 2
+ *              characters.  On a hit, CANON holds the cached path,
+ *              *CANON_LEN its length, *NCOMPS the number of (non-'.')
+ *              components of NAME it covers, and *ADDR the address of
+ *              the group; otherwise *NCOMPS and *CANON_LEN are 0.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_lookup(H5G_t *root_grp, const char *name, char *canon,
+    size_t *canon_len, size_t *ncomps, haddr_t *addr)
+{
+    H5G_path_cache_t *cache;            /* Root group's path cache */
+    const char *s;                      /* Current component of name */
+    size_t nchars;                      /* Length of component */
+    size_t len = 0, dir_len = 0;        /* Length of canonical path & prefix */
+    size_t ncomp = 0, dir_ncomp = 0;    /* # of components in path & prefix */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(root_grp);
+    HDassert(name && '/' == *name);
+    HDassert(canon);
+    HDassert(canon_len);
+    HDassert(ncomps);
+    HDassert(addr);
+
+    *canon_len = 0;
+    *ncomps = 0;
+    *canon = '\0';
+
+    if(NULL == (cache = root_grp->shared->path_cache) || 0 == cache->nentries)
+        HGOTO_DONE(SUCCEED)
+
+    /* Build the canonical path, remembering where its last component starts */
+    for(s = name; (s = H5G__component(s, &nchars)) && *s; s += nchars) {
+        dir_len = len;
+        dir_ncomp = ncomp;
+        if(!('.' == *s && 1 == nchars)) {
+            canon[len++] = '/';
+            HDmemcpy(canon + len, s, nchars);
+            len += nchars;
+            ncomp++;
+        } /* end if */
+    } /* end for */
+
+    /* Look for the longest cached prefix */
+    len = dir_len;
+    ncomp = dir_ncomp;
+    while(ncomp > 0) {
+        H5G_path_cache_ent_t *ent;      /* Cached path */
+
+        canon[len] = '\0';
+        if(NULL != (ent = H5G__path_cache_find(cache, canon, len, H5_hash_string(canon)))) {
+            *canon_len = len;
+            *ncomps = ncomp;
+            *addr = ent->addr;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Drop the last component */
+        while(canon[--len] != '/')
+            ;
+        ncomp--;
+    } /* end while */
+    *canon = '\0';
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_insert
+ *
+ * Purpose:	Adds the canonical absolute path of a group to a root
+ *              group's path cache, evicting the least recently used path
+ *              if the cache is full.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_insert(H5G_t *root_grp, const char *path, size_t len, haddr_t addr)
+{
+    H5G_path_cache_t *cache;            /* Root group's path cache */
+    H5G_path_cache_ent_t *ent = NULL;   /* Cached path */
+    uint32_t hash;                      /* Hash value of path */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(root_grp);
+    HDassert(path && '/' == *path);
+    HDassert(HDstrlen(path) == len);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Create the cache, the first time it's used */
+    if(NULL == (cache = root_grp->shared->path_cache))
+        if(NULL == (cache = root_grp->shared->path_cache = H5FL_CALLOC(H5G_path_cache_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate path cache")
+
+    /* Update the path, if it's already cached */
+    hash = H5_hash_string(path);
+    if(NULL != (ent = H5G__path_cache_find(cache, path, len, hash))) {
+        ent->addr = addr;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Make room for the path */
+    if(cache->nentries >= H5G_PATH_CACHE_NENTRIES)
+        H5G__path_cache_remove(cache, cache->lru_tail);
+
+    /* Add the path */
+    if(NULL == (ent = H5FL_CALLOC(H5G_path_cache_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate path cache entry")
+    if(NULL == (ent->path = H5MM_strdup(path))) {
+        ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't copy path")
+    } /* end if */
+    ent->len = len;
+    ent->hash = hash;
+    ent->addr = addr;
+    ent->next = cache->buckets[hash & (H5G_PATH_CACHE_NBUCKETS - 1)];
+    cache->buckets[hash & (H5G_PATH_CACHE_NBUCKETS - 1)] = ent;
+    ent->lru_next = cache->lru_head;
+    if(cache->lru_head)
+        cache->lru_head->lru_prev = ent;
+    else
+        cache->lru_tail = ent;
+    cache->lru_head = ent;
+    cache->nentries++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_invalidate
+ *
+ * Purpose:	Empties the path caches that may hold paths in a file,
+ *              when links in it are removed or moved, or files are
+ *              mounted on it or unmounted from it.
+ *
+ *              These are the caches of the file's own root group and of
+ *              the root groups of the files it's mounted on.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_invalidate(H5F_t *f)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+
+    for(; f; f = f->parent)
+        if(f->shared->root_grp && f->shared->root_grp->shared->path_cache)
+            H5G__path_cache_clear(f->shared->root_grp->shared->path_cache);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__path_cache_invalidate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__path_cache_free
+ *
+ * Purpose:	Releases a root group's path cache, if it has one.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_free(H5G_shared_t *shared)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(shared);
+
+    if(shared->path_cache) {
+        H5G__path_cache_clear(shared->path_cache);
+        shared->path_cache = H5FL_FREE(H5G_path_cache_t, shared->path_cache);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G__path_cache_free() */
+
@@ -127,6 +127,9 @@ typedef struct H5G_node_t {
 struct H5G_shared_t {
     int fo_count;                   /* open file object count */
     hbool_t mounted;                /* Group is mount point */
+    unsigned nlookups;              /* # of name lookups since links changed */
+    struct H5G_link_index_t *link_index;    /* In-memory index of links by name */
+    struct H5G_path_cache_t *path_cache;    /* Cache of resolved paths (root group only) */
 };
 
 /*
@@ -139,6 +142,12 @@ struct H5G_t {
     H5G_name_t path;                    /* Group hierarchy path   */
 };
 
+/* In-memory index of a group's links by name (defined in H5Gindex.c) */
+typedef struct H5G_link_index_t H5G_link_index_t;
+
+/* Cache of a file's resolved absolute paths (defined in H5Gpath.c) */
+typedef struct H5G_path_cache_t H5G_path_cache_t;
+
 /* Link iteration operator for internal library callbacks */
 typedef herr_t (*H5G_lib_iterate_t)(const H5O_link_t *lnk, void *op_data);
 
@@ -329,6 +338,8 @@ H5FL_EXTERN(H5G_shared_t);
  * General group routines
  */
 H5_DLL H5G_t *H5G__create(H5F_t *file, H5G_obj_create_t *gcrt_info);
+H5_DLL herr_t H5G__create_multi(const H5G_loc_t *loc, size_t count,
+    const char **names, hid_t lcpl_id, hid_t gcpl_id);
 H5_DLL H5G_t *H5G__create_named(const H5G_loc_t *loc, const char *name,
     hid_t lcpl_id, hid_t gcpl_id);
 H5_DLL H5G_t *H5G__open_name(const H5G_loc_t *loc, const char *name);
@@ -453,6 +464,8 @@ H5_DLL herr_t H5G__dense_create(H5F_t *f, H5O_linfo_t *linfo,
     const H5O_pline_t *pline);
 H5_DLL herr_t H5G__dense_insert(H5F_t *f, const H5O_linfo_t *linfo,
     const H5O_link_t *lnk);
+H5_DLL herr_t H5G__dense_insert_multi(H5F_t *f, const H5O_linfo_t *linfo,
+    size_t nlinks, const H5O_link_t *lnks);
 H5_DLL htri_t H5G__dense_lookup(H5F_t *f, const H5O_linfo_t *linfo,
     const char *name, H5O_link_t *lnk);
 H5_DLL herr_t H5G__dense_lookup_by_idx(H5F_t *f, const H5O_linfo_t *linfo,
@@ -470,6 +483,21 @@ H5_DLL herr_t H5G__dense_remove_by_idx(H5F_t *f, const H5O_linfo_t *linfo,
     hsize_t n);
 H5_DLL herr_t H5G__dense_delete(H5F_t *f, H5O_linfo_t *linfo, hbool_t adj_link);
 
+/* Functions that understand the in-memory index of open groups' links */
+H5_DLL htri_t H5G__index_lookup(const H5O_loc_t *grp_oloc, const char *name,
+    H5O_link_t *lnk, hbool_t *indexed);
+H5_DLL herr_t H5G__index_invalidate(const H5O_loc_t *grp_oloc);
+H5_DLL herr_t H5G__index_free(H5G_shared_t *shared);
+
+/* Functions that understand the cache of resolved paths */
+H5_DLL hbool_t H5G__path_cache_enabled(const H5G_t *root_grp);
+H5_DLL herr_t H5G__path_cache_lookup(H5G_t *root_grp, const char *name,
+    char *canon, size_t *canon_len, size_t *ncomps, haddr_t *addr);
+H5_DLL herr_t H5G__path_cache_insert(H5G_t *root_grp, const char *path,
+    size_t len, haddr_t addr);
+H5_DLL herr_t H5G__path_cache_invalidate(H5F_t *f);
+H5_DLL herr_t H5G__path_cache_free(H5G_shared_t *shared);
+
 /* Functions that understand group objects */
 H5_DLL herr_t H5G__obj_create(H5F_t *f, H5G_obj_create_t *gcrt_info,
     H5O_loc_t *oloc/*out*/);
@@ -477,6 +505,8 @@ H5_DLL herr_t H5G__obj_create_real(H5F_t *f, const H5O_ginfo_t *ginfo,
     const H5O_linfo_t *linfo, const H5O_pline_t *pline, H5G_obj_create_t *gcrt_info,
     H5O_loc_t *oloc/*out*/);
 H5_DLL htri_t H5G__obj_get_linfo(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo);
+H5_DLL herr_t H5G__obj_insert_multi(const H5O_loc_t *grp_oloc, size_t nlinks,
+    H5O_link_t *lnks, const H5G_obj_create_t *gcrt_info);
 H5_DLL herr_t H5G__obj_iterate(const H5O_loc_t *grp_oloc,
     H5_index_t idx_type, H5_iter_order_t order, hsize_t skip, hsize_t *last_lnk,
     H5G_lib_iterate_t op, void *op_data);
@@ -178,6 +178,10 @@ typedef struct {
     } op_func;
 } H5G_link_iterate_t;
 
+/* Callback for each object visited by H5G_visit_objs() */
+typedef herr_t (*H5G_visit_obj_t)(const char *path, const struct H5O_loc_t *obj_oloc,
+    H5O_type_t obj_type, unsigned rc, void *op_data);
+
 typedef struct H5G_t H5G_t;
 typedef struct H5G_shared_t H5G_shared_t;
 typedef struct H5G_entry_t H5G_entry_t;
@@ -214,6 +218,8 @@ H5_DLL herr_t H5G_iterate(H5G_loc_t *loc, const char *group_name,
     const H5G_link_iterate_t *lnk_op, void *op_data);
 H5_DLL herr_t H5G_visit(H5G_loc_t *loc, const char *group_name,
     H5_index_t idx_type, H5_iter_order_t order, H5L_iterate_t op, void *op_data);
+H5_DLL herr_t H5G_visit_objs(H5G_loc_t *loc, const char *group_name,
+    H5_index_t idx_type, H5_iter_order_t order, H5G_visit_obj_t op, void *op_data);
 
 /* 
  * Functions that understand links in groups
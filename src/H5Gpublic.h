@@ -74,6 +74,8 @@ extern "C" {
 H5_DLL hid_t H5Gcreate2(hid_t loc_id, const char *name, hid_t lcpl_id,
     hid_t gcpl_id, hid_t gapl_id);
 H5_DLL hid_t H5Gcreate_anon(hid_t loc_id, hid_t gcpl_id, hid_t gapl_id);
+H5_DLL herr_t H5Gcreate_multi(hid_t loc_id, size_t count, const char *names[],
+    hid_t lcpl_id, hid_t gcpl_id, hid_t gapl_id);
 H5_DLL hid_t H5Gopen2(hid_t loc_id, const char *name, hid_t gapl_id);
 H5_DLL hid_t H5Gget_create_plist(hid_t group_id);
 H5_DLL herr_t H5Gget_info(hid_t loc_id, H5G_info_t *ginfo);
@@ -354,6 +354,8 @@ H5G_root_free(H5G_t *grp)
     /* Free the path */
     H5G_name_free(&(grp->path));
 
+    H5G__index_free(grp->shared);
+    H5G__path_cache_free(grp->shared);
     grp->shared = H5FL_FREE(H5G_shared_t, grp->shared);
     grp = H5FL_FREE(H5G_t, grp);
 
@@ -485,6 +485,11 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     char                comp_buf[1024];     /* Temporary buffer for path components */
     char                *comp;          /* Pointer to buffer for path components */
     H5WB_t              *wb = NULL;     /* Wrapped buffer for temporary buffer */
+    H5G_t               *cache_grp = NULL;  /* Root group whose path cache is used */
+    char                canon_buf[1024];    /* Temporary buffer for canonical path */
+    char                *canon = NULL;  /* Canonical form of absolute path traversed */
+    size_t              canon_len = 0;  /* Length of canonical path */
+    H5WB_t              *canon_wb = NULL;   /* Wrapped buffer for canonical path */
     hbool_t last_comp = FALSE;          /* Flag to indicate that a component is the last component in the name */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
@@ -510,6 +515,10 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
         /* Set the location entry to the root group's info */
         loc.oloc = &(root_grp->oloc);
         loc.path = &(root_grp->path);
+
+        /* Check if the file's cache of resolved paths may be used */
+        if(H5G__path_cache_enabled(root_grp))
+            cache_grp = root_grp;
     } /* end if */
     else {
         loc.oloc = _loc->oloc;
@@ -545,6 +554,36 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     if(NULL == (comp = (char *)H5WB_actual(wb, (HDstrlen(name) + 1))))
         HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
 
+    /* Start an absolute path's traversal from its longest cached prefix */
+    if(cache_grp) {
+        size_t ncomps;                  /* # of components in cached prefix */
+        haddr_t addr;                   /* Address of cached group */
+
+        /* Get a buffer for the canonical path */
+        if(NULL == (canon_wb = H5WB_wrap(canon_buf, sizeof(canon_buf))))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+        if(NULL == (canon = (char *)H5WB_actual(canon_wb, (HDstrlen(name) + 2))))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+
+        if(H5G__path_cache_lookup(cache_grp, name, canon, &canon_len, &ncomps, &addr) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't look up path prefix")
+        if(ncomps > 0) {
+            /* Move the group location to the cached group */
+            grp_loc.oloc->addr = addr;
+            H5G_name_free(grp_loc.path);
+            if(H5G__name_init(grp_loc.path, canon) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't set group path")
+
+            /* Skip the prefix's components of the name */
+            while(ncomps > 0) {
+                name = H5G__component(name, &nchars);
+                if(!('.' == *name && 1 == nchars))
+                    ncomps--;
+                name += nchars;
+            } /* end while */
+        } /* end if */
+    } /* end if */
+
     /* Traverse the path */
     while((name = H5G__component(name, &nchars)) && *name) {
         const char *s;                  /* Temporary string pointer */
@@ -740,6 +779,24 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
                 HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "component not found")
         } /* end if */
 
+        /* Cache the group's canonical path, while the path has only
+         * gone through hard links in the root group's file
+         */
+        if(cache_grp) {
+            if(lookup_status && H5L_TYPE_HARD == lnk.type
+                    && obj_loc.oloc->file == grp_loc.oloc->file
+                    && H5F_addr_eq(obj_loc.oloc->addr, lnk.u.hard.addr)) {
+                canon[canon_len++] = '/';
+                HDmemcpy(canon + canon_len, comp, nchars);
+                canon_len += nchars;
+                canon[canon_len] = '\0';
+                if(H5G__path_cache_insert(cache_grp, canon, canon_len, obj_loc.oloc->addr) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't cache path")
+            } /* end if */
+            else
+                cache_grp = NULL;
+        } /* end if */
+
 	/*
 	 * Advance to the next component of the path.
 	 */
@@ -791,6 +848,8 @@ done:
     /* Release temporary component buffer */
     if(wb && H5WB_unwrap(wb) < 0)
         HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release wrapped buffer")
+    if(canon_wb && H5WB_unwrap(canon_wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release wrapped buffer")
 
    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__traverse_real() */
@@ -735,6 +735,85 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5HF_op() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HF_op_batch
+ *
+ * Purpose:	Perform a read-only operation directly on each object of a
+ *              batch of heap IDs, without copying the objects.  Managed
+ *              objects are visited in order of their offset in the heap,
+ *              with each direct block holding them protected once for all
+ *              of its objects, so the order 'op' is called in isn't the
+ *              order of IDS.  OP_DATA holds the 'op' callback's user data
+ *              for each object.
+ *
+ * Note:	As with H5HF_op, the 'op' callback is called with direct blocks
+ *              of the heap protected, so it must not call routines that
+ *              could access the heap.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HF_op_batch(H5HF_t *fh, size_t nids, const void * const *ids, H5HF_operator_t op,
+    void * const *op_data)
+{
+    size_t nman = 0;                    /* Number of managed objects in batch */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /*
+     * Check arguments.
+     */
+    HDassert(fh);
+    HDassert(ids || nids == 0);
+    HDassert(op);
+    HDassert(op_data || nids == 0);
+
+    /* Set the shared heap header's file context for this operation */
+    fh->hdr->f = fh->f;
+
+    /* Operate on the 'huge' & 'tiny' objects, counting the managed ones */
+    for(u = 0; u < nids; u++) {
+        const uint8_t *id = (const uint8_t *)ids[u];   /* Object ID */
+        uint8_t id_flags;               /* Heap ID flag bits */
+
+        /* Get the ID flags */
+        id_flags = *id;
+
+        /* Check for correct heap ID version */
+        if((id_flags & H5HF_ID_VERS_MASK) != H5HF_ID_VERS_CURR)
+            HGOTO_ERROR(H5E_HEAP, H5E_VERSION, FAIL, "incorrect heap ID version")
+
+        /* Check type of object in heap */
+        if((id_flags & H5HF_ID_TYPE_MASK) == H5HF_ID_TYPE_MAN)
+            nman++;
+        else if((id_flags & H5HF_ID_TYPE_MASK) == H5HF_ID_TYPE_HUGE) {
+            /* Operate on 'huge' object from file */
+            if(H5HF__huge_op(fh->hdr, id, op, op_data[u]) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTOPERATE, FAIL, "can't operate on 'huge' object from fractal heap")
+        } /* end if */
+        else if((id_flags & H5HF_ID_TYPE_MASK) == H5HF_ID_TYPE_TINY) {
+            /* Operate on 'tiny' object from file */
+            if(H5HF_tiny_op(fh->hdr, id, op, op_data[u]) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTOPERATE, FAIL, "can't operate on 'tiny' object from fractal heap")
+        } /* end if */
+        else
+            HGOTO_ERROR(H5E_HEAP, H5E_UNSUPPORTED, FAIL, "heap ID type not supported yet")
+    } /* end for */
+
+    /* Operate on the objects from managed heap blocks */
+    if(nman > 0)
+        if(H5HF__man_op_batch(fh->hdr, nids, ids, op, op_data) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTOPERATE, FAIL, "can't operate on objects from fractal heap")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HF_op_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HF_remove
@@ -61,6 +61,13 @@
 /* Local Typedefs */
 /******************/
 
+/* Managed object in a batch of heap IDs to operate on */
+typedef struct H5HF_man_batch_ent_t {
+    hsize_t obj_off;            /* Object's offset in heap */
+    size_t obj_len;             /* Object's length in heap */
+    size_t idx;                 /* Index of object's heap ID in batch */
+} H5HF_man_batch_ent_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -70,6 +77,11 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5HF__man_obj_decode(const H5HF_hdr_t *hdr, const uint8_t *id,
+    hsize_t *obj_off_p, size_t *obj_len_p);
+static H5HF_direct_t *H5HF__man_obj_dblock_protect(H5HF_hdr_t *hdr, hsize_t obj_off,
+    unsigned dblock_access_flags, haddr_t *dblock_addr_p, size_t *dblock_size_p);
+static int H5HF__man_batch_cmp(const void *_ent1, const void *_ent2);
 static herr_t H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
     H5HF_operator_t op, void *op_data, unsigned op_flags);
 
@@ -288,36 +300,21 @@ H5HF__man_get_obj_off(const H5HF_hdr_t *hdr, const uint8_t *id, hsize_t *obj_off
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5HF__man_op_real
+ * Function:	H5HF__man_obj_decode
  *
- * Purpose:	Internal routine to perform an operation on a managed heap
- *              object
+ * Purpose:	Decode & check the offset and length of a managed heap
+ *              object from its heap ID
  *
  * Return:	SUCCEED/FAIL
  *
- * Programmer:	Quincey Koziol
- *		koziol@ncsa.uiuc.edu
- *		Mar 17 2006
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
-    H5HF_operator_t op, void *op_data, unsigned op_flags)
+H5HF__man_obj_decode(const H5HF_hdr_t *hdr, const uint8_t *id, hsize_t *obj_off_p,
+    size_t *obj_len_p)
 {
-    H5HF_direct_t *dblock = NULL;       /* Pointer to direct block to query */
-    unsigned dblock_access_flags;       /* Access method for direct block */
-                                        /* must equal either 
-                                         * H5AC__NO_FLAGS_SET or 
-                                         * H5AC__READ_ONLY_FLAG
-                                         */
-    haddr_t dblock_addr;                /* Direct block address */
-    size_t dblock_size;                 /* Direct block size */
-    unsigned dblock_cache_flags;        /* Flags for unprotecting direct block */
     hsize_t obj_off;                    /* Object's offset in heap */
     size_t obj_len;                     /* Object's length in heap */
-    size_t blk_off;                     /* Offset of object in block */
-    uint8_t *p;                         /* Temporary pointer to obj info in block */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -327,20 +324,8 @@ H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
      */
     HDassert(hdr);
     HDassert(id);
-    HDassert(op);
-
-    /* Set the access mode for the direct block */
-    if(op_flags & H5HF_OP_MODIFY) {
-        /* Check pipeline */
-        H5HF_MAN_WRITE_CHECK_PLINE(hdr)
-
-        dblock_access_flags = H5AC__NO_FLAGS_SET;
-        dblock_cache_flags = H5AC__DIRTIED_FLAG;
-    } /* end if */
-    else {
-        dblock_access_flags = H5AC__READ_ONLY_FLAG;
-        dblock_cache_flags = H5AC__NO_FLAGS_SET;
-    } /* end else */
+    HDassert(obj_off_p);
+    HDassert(obj_len_p);
 
     /* Skip over the flag byte */
     id++;
@@ -361,6 +346,43 @@ H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
     if(obj_len > hdr->max_man_size)
         HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, FAIL, "fractal heap object should be standalone")
 
+    /* Set return values */
+    *obj_off_p = obj_off;
+    *obj_len_p = obj_len;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HF__man_obj_decode() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HF__man_obj_dblock_protect
+ *
+ * Purpose:	Locate & protect the direct block holding the managed heap
+ *              object at an offset in the heap
+ *
+ * Return:	Pointer to direct block on success, NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5HF_direct_t *
+H5HF__man_obj_dblock_protect(H5HF_hdr_t *hdr, hsize_t obj_off,
+    unsigned dblock_access_flags, haddr_t *dblock_addr_p, size_t *dblock_size_p)
+{
+    haddr_t dblock_addr;                /* Direct block address */
+    size_t dblock_size;                 /* Direct block size */
+    H5HF_direct_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /*
+     * Check arguments.
+     */
+    HDassert(hdr);
+    HDassert(dblock_addr_p);
+    HDassert(dblock_size_p);
+
     /* Check for root direct block */
     if(hdr->man_dtable.curr_root_rows == 0) {
         /* Set direct block info */
@@ -368,8 +390,8 @@ H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
         dblock_size = hdr->man_dtable.cparam.start_block_size;
 
         /* Lock direct block */
-        if(NULL == (dblock = H5HF__man_dblock_protect(hdr, dblock_addr, dblock_size, NULL, 0, dblock_access_flags)))
-            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect fractal heap direct block")
+        if(NULL == (ret_value = H5HF__man_dblock_protect(hdr, dblock_addr, dblock_size, NULL, 0, dblock_access_flags)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, NULL, "unable to protect fractal heap direct block")
     } /* end if */
     else {
         H5HF_indirect_t *iblock;        /* Pointer to indirect block */
@@ -378,7 +400,7 @@ H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
 
         /* Look up indirect block containing direct block */
         if(H5HF__man_dblock_locate(hdr, obj_off, &iblock, &entry, &did_protect, H5AC__READ_ONLY_FLAG) < 0)
-            HGOTO_ERROR(H5E_HEAP, H5E_CANTCOMPUTE, FAIL, "can't compute row & column of section")
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTCOMPUTE, NULL, "can't compute row & column of section")
 
         /* Set direct block info */
         dblock_addr =  iblock->ents[entry].addr;
@@ -389,26 +411,101 @@ H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
         if(!H5F_addr_defined(dblock_addr)) {
             /* Unlock indirect block */
             if(H5HF__man_iblock_unprotect(iblock, H5AC__NO_FLAGS_SET, did_protect) < 0)
-                HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release fractal heap indirect block")
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, NULL, "unable to release fractal heap indirect block")
 
-            HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, FAIL, "fractal heap ID not in allocated direct block")
+            HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, NULL, "fractal heap ID not in allocated direct block")
         } /* end if */
 
         /* Lock direct block */
-        if(NULL == (dblock = H5HF__man_dblock_protect(hdr, dblock_addr, dblock_size, iblock, entry, dblock_access_flags))) {
+        if(NULL == (ret_value = H5HF__man_dblock_protect(hdr, dblock_addr, dblock_size, iblock, entry, dblock_access_flags))) {
             /* Unlock indirect block */
             if(H5HF__man_iblock_unprotect(iblock, H5AC__NO_FLAGS_SET, did_protect) < 0)
-                HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release fractal heap indirect block")
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, NULL, "unable to release fractal heap indirect block")
 
-            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect fractal heap direct block")
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, NULL, "unable to protect fractal heap direct block")
         } /* end if */
 
         /* Unlock indirect block */
-        if(H5HF__man_iblock_unprotect(iblock, H5AC__NO_FLAGS_SET, did_protect) < 0)
-            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release fractal heap indirect block")
-        iblock = NULL;
+        if(H5HF__man_iblock_unprotect(iblock, H5AC__NO_FLAGS_SET, did_protect) < 0) {
+            if(H5AC_unprotect(hdr->f, H5AC_FHEAP_DBLOCK, dblock_addr, ret_value, H5AC__NO_FLAGS_SET) < 0)
+                HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, NULL, "unable to release fractal heap direct block")
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, NULL, "unable to release fractal heap indirect block")
+        } /* end if */
     } /* end else */
 
+    /* Set return values */
+    *dblock_addr_p = dblock_addr;
+    *dblock_size_p = dblock_size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HF__man_obj_dblock_protect() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HF__man_op_real
+ *
+ * Purpose:	Internal routine to perform an operation on a managed heap
+ *              object
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ * Programmer:	Quincey Koziol
+ *		koziol@ncsa.uiuc.edu
+ *		Mar 17 2006
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5HF__man_op_real(H5HF_hdr_t *hdr, const uint8_t *id,
+    H5HF_operator_t op, void *op_data, unsigned op_flags)
+{
+    H5HF_direct_t *dblock = NULL;       /* Pointer to direct block to query */
+    unsigned dblock_access_flags;       /* Access method for direct block */
+                                        /* must equal either 
+                                         * H5AC__NO_FLAGS_SET or 
+                                         * H5AC__READ_ONLY_FLAG
+                                         */
+    haddr_t dblock_addr = HADDR_UNDEF;  /* Direct block address */
+    size_t dblock_size;                 /* Direct block size */
+    unsigned dblock_cache_flags;        /* Flags for unprotecting direct block */
+    hsize_t obj_off;                    /* Object's offset in heap */
+    size_t obj_len;                     /* Object's length in heap */
+    size_t blk_off;                     /* Offset of object in block */
+    uint8_t *p;                         /* Temporary pointer to obj info in block */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /*
+     * Check arguments.
+     */
+    HDassert(hdr);
+    HDassert(id);
+    HDassert(op);
+
+    /* Set the access mode for the direct block */
+    if(op_flags & H5HF_OP_MODIFY) {
+        /* Check pipeline */
+        H5HF_MAN_WRITE_CHECK_PLINE(hdr)
+
+        dblock_access_flags = H5AC__NO_FLAGS_SET;
+        dblock_cache_flags = H5AC__DIRTIED_FLAG;
+    } /* end if */
+    else {
+        dblock_access_flags = H5AC__READ_ONLY_FLAG;
+        dblock_cache_flags = H5AC__NO_FLAGS_SET;
+    } /* end else */
+
+    /* Decode the object offset within the heap & its length */
+    if(H5HF__man_obj_decode(hdr, id, &obj_off, &obj_len) < 0)
+        HGOTO_ERROR(H5E_HEAP, H5E_CANTDECODE, FAIL, "can't decode fractal heap object ID")
+
+    /* Lock the direct block holding the object */
+    if(NULL == (dblock = H5HF__man_obj_dblock_protect(hdr, obj_off, dblock_access_flags, &dblock_addr, &dblock_size)))
+        HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect fractal heap direct block")
+
     /* Compute offset of object within block */
     HDassert((obj_off - dblock->block_off) < (hsize_t)dblock_size);
     blk_off = (size_t)(obj_off - dblock->block_off);
@@ -545,6 +642,141 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5HF__man_op() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HF__man_batch_cmp
+ *
+ * Purpose:	Compare two managed objects in a batch by their offset in
+ *              the heap, for sorting the batch
+ *
+ * Return:	-1, 0, 1 (like strcmp)
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5HF__man_batch_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5HF_man_batch_ent_t *ent1 = (const H5HF_man_batch_ent_t *)_ent1;
+    const H5HF_man_batch_ent_t *ent2 = (const H5HF_man_batch_ent_t *)_ent2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(ent1->obj_off < ent2->obj_off)
+        ret_value = -1;
+    else if(ent1->obj_off > ent2->obj_off)
+        ret_value = 1;
+    else if(ent1->idx < ent2->idx)
+        ret_value = -1;
+    else if(ent1->idx > ent2->idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HF__man_batch_cmp() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HF__man_op_batch
+ *
+ * Purpose:	Operate directly on the managed objects among a batch of
+ *              heap IDs, in order of their offset in the heap, so that each
+ *              direct block holding objects in the batch is only located
+ *              and protected once.  (Heap IDs for other types of objects
+ *              are skipped.)
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HF__man_op_batch(H5HF_hdr_t *hdr, size_t nids, const void * const *ids,
+    H5HF_operator_t op, void * const *op_data)
+{
+    H5HF_man_batch_ent_t *ents = NULL;  /* Managed objects in batch */
+    H5HF_direct_t *dblock = NULL;       /* Pointer to current direct block */
+    haddr_t dblock_addr = HADDR_UNDEF;  /* Current direct block address */
+    size_t dblock_size = 0;             /* Current direct block size */
+    size_t nents = 0;                   /* Number of managed objects in batch */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(hdr);
+    HDassert(ids);
+    HDassert(op);
+    HDassert(op_data);
+
+    /* Allocate space for the managed objects */
+    if(NULL == (ents = (H5HF_man_batch_ent_t *)H5MM_malloc(nids * sizeof(H5HF_man_batch_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for heap ID batch")
+
+    /* Decode the offsets & lengths of the managed objects */
+    for(u = 0; u < nids; u++) {
+        const uint8_t *id = (const uint8_t *)ids[u];
+
+        if((*id & H5HF_ID_TYPE_MASK) == H5HF_ID_TYPE_MAN) {
+            if(H5HF__man_obj_decode(hdr, id, &ents[nents].obj_off, &ents[nents].obj_len) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTDECODE, FAIL, "can't decode fractal heap object ID")
+            ents[nents].idx = u;
+            nents++;
+        } /* end if */
+    } /* end for */
+
+    /* Sort the objects by their offset in the heap */
+    if(nents > 1)
+        HDqsort(ents, nents, sizeof(H5HF_man_batch_ent_t), H5HF__man_batch_cmp);
+
+    /* Operate on each object, keeping the direct block holding the
+     * current run of objects protected
+     */
+    for(u = 0; u < nents; u++) {
+        size_t blk_off;                 /* Offset of object in block */
+
+        /* Switch to the direct block holding this object, if necessary */
+        if(NULL == dblock || ents[u].obj_off < dblock->block_off
+                || (ents[u].obj_off - dblock->block_off) >= (hsize_t)dblock_size) {
+            if(dblock) {
+                if(H5AC_unprotect(hdr->f, H5AC_FHEAP_DBLOCK, dblock_addr, dblock, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release fractal heap direct block")
+                dblock = NULL;
+            } /* end if */
+            if(NULL == (dblock = H5HF__man_obj_dblock_protect(hdr, ents[u].obj_off, H5AC__READ_ONLY_FLAG, &dblock_addr, &dblock_size)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect fractal heap direct block")
+        } /* end if */
+
+        /* Compute offset of object within block */
+        HDassert((ents[u].obj_off - dblock->block_off) < (hsize_t)dblock_size);
+        blk_off = (size_t)(ents[u].obj_off - dblock->block_off);
+
+        /* Check for object's offset in the direct block prefix information */
+        if(blk_off < (size_t)H5HF_MAN_ABS_DIRECT_OVERHEAD(hdr))
+            HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, FAIL, "object located in prefix of direct block")
+
+        /* Check for object's length overrunning the end of the direct block */
+        if((blk_off + ents[u].obj_len) > dblock_size)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, FAIL, "object overruns end of direct block")
+
+        /* Call the user's 'op' callback */
+        if(op(dblock->blk + blk_off, ents[u].obj_len, op_data[ents[u].idx]) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTOPERATE, FAIL, "application's callback failed")
+    } /* end for */
+
+done:
+    /* Unlock direct block */
+    if(dblock && H5AC_unprotect(hdr->f, H5AC_FHEAP_DBLOCK, dblock_addr, dblock, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release fractal heap direct block")
+    if(ents)
+        ents = (H5HF_man_batch_ent_t *)H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HF__man_op_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HF__man_remove
@@ -701,6 +701,8 @@ H5_DLL herr_t H5HF__man_read(H5HF_hdr_t *fh, const uint8_t *id, void *obj);
 H5_DLL herr_t H5HF__man_write(H5HF_hdr_t *hdr, const uint8_t *id, const void *obj);
 H5_DLL herr_t H5HF__man_op(H5HF_hdr_t *hdr, const uint8_t *id, H5HF_operator_t op,
     void *op_data);
+H5_DLL herr_t H5HF__man_op_batch(H5HF_hdr_t *hdr, size_t nids, const void * const *ids,
+    H5HF_operator_t op, void * const *op_data);
 H5_DLL herr_t H5HF__man_remove(H5HF_hdr_t *hdr, const uint8_t *id);
 
 /* 'Huge' object routines */
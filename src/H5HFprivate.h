@@ -114,6 +114,8 @@ H5_DLL herr_t H5HF_read(H5HF_t *fh, const void *id, void *obj/*out*/);
 H5_DLL herr_t H5HF_write(H5HF_t *fh, void *id, hbool_t *id_changed,
     const void *obj);
 H5_DLL herr_t H5HF_op(H5HF_t *fh, const void *id, H5HF_operator_t op, void *op_data);
+H5_DLL herr_t H5HF_op_batch(H5HF_t *fh, size_t nids, const void * const *ids,
+    H5HF_operator_t op, void * const *op_data);
 H5_DLL herr_t H5HF_remove(H5HF_t *fh, const void *id);
 H5_DLL herr_t H5HF_close(H5HF_t *fh);
 H5_DLL herr_t H5HF_delete(H5F_t *f, haddr_t fh_addr);
@@ -57,6 +57,9 @@
 /* Local Macros */
 /****************/
 
+/* Largest collection created to hold the objects of a batch of insertions */
+#define H5HG_BATCH_MAXSIZE      (1024 * 1024)
+
 /*
  * The maximum number of links allowed to a global heap object.
  */
@@ -646,6 +649,281 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5HG_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_batch_init
+ *
+ * Purpose:	Initialize a batch of global heap operations.  A batch keeps
+ *		the collection it last used protected, so that many objects
+ *		can be inserted or read without going through the metadata
+ *		cache and the CWFS list for each of them.
+ *
+ *		Objects reserved with H5HG_batch_reserve() before they are
+ *		inserted are placed in collections sized for all of them,
+ *		instead of in the minimum sized collections that H5HG_insert()
+ *		would create.
+ *
+ *		Nothing else may access the batch's collection until
+ *		H5HG_batch_end() is called.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_batch_init(H5HG_batch_t *batch, H5F_t *f)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(batch);
+    HDassert(f);
+
+    batch->f = f;
+    batch->heap = NULL;
+    batch->heap_flags = H5AC__NO_FLAGS_SET;
+    batch->nobjs = 0;
+    batch->need = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5HG_batch_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_batch_reserve
+ *
+ * Purpose:	Account for an object of SIZE bytes that will be inserted
+ *		with the batch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_batch_reserve(H5HG_batch_t *batch, size_t size)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(batch);
+    HDassert(batch->f);
+
+    batch->nobjs++;
+    batch->need += H5HG_SIZEOF_OBJHDR(batch->f) + H5HG_ALIGN(size);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5HG_batch_reserve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG__batch_release
+ *
+ * Purpose:	Release the collection the batch has protected, if any.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5HG__batch_release(H5HG_batch_t *batch)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(batch);
+
+    if(batch->heap) {
+        H5HG_heap_t *heap = batch->heap;        /* Collection to release */
+        unsigned heap_flags = batch->heap_flags;        /* Flags for unprotecting collection */
+
+        batch->heap = NULL;
+        batch->heap_flags = H5AC__NO_FLAGS_SET;
+        if(H5AC_unprotect(batch->f, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5HG__batch_release() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_batch_insert
+ *
+ * Purpose:	Insert a new object into the global heap, as part of a batch.
+ *		Reserved objects are appended to a collection created for
+ *		the batch, other objects are inserted with H5HG_insert().
+ *
+ * Return:	Success:	Non-negative, and a heap object handle returned
+ *				through the HOBJ pointer.
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_batch_insert(H5HG_batch_t *batch, size_t size, void *obj, H5HG_t *hobj/*out*/)
+{
+    H5F_t       *f;             /* File for the batch */
+    size_t	need;		/* Total space needed for object */
+    size_t	idx;            /* Index of the new object */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(batch);
+    HDassert(batch->f);
+    HDassert(0 == size || obj);
+    HDassert(hobj);
+
+    f = batch->f;
+    need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size);
+
+    /* Objects that weren't reserved go through the CWFS list */
+    if(need > batch->need) {
+        if(H5HG__batch_release(batch) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+        if(H5HG_insert(f, size, obj, hobj) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTINSERT, FAIL, "unable to insert object into global heap")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Release the current collection, if the object doesn't fit in it */
+    if(batch->heap && (batch->heap->obj[0].size < need || batch->heap->nused > H5HG_MAXIDX
+            || batch->heap_flags & H5AC__READ_ONLY_FLAG))
+        if(H5HG__batch_release(batch) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+
+    /* Create a collection for the reserved objects, if there isn't one */
+    if(NULL == batch->heap) {
+        size_t nobjs;           /* # of objects for the new collection */
+        size_t heap_size;       /* Size of the new collection */
+        haddr_t addr;           /* Address of the new collection */
+
+        if(0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+            HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+        /* Size the collection for as many of the remaining objects as it
+         * may index, assuming they are of average size.
+         */
+        HDassert(batch->nobjs > 0);
+        nobjs = MIN(batch->nobjs, H5HG_MAXIDX);
+        if(nobjs == batch->nobjs)
+            heap_size = batch->need;
+        else
+            heap_size = (batch->need / batch->nobjs) * nobjs;
+        heap_size = MAX(MIN(heap_size, H5HG_BATCH_MAXSIZE), need);
+
+        if(!H5F_addr_defined(addr = H5HG__create(f, heap_size + H5HG_SIZEOF_HDR(f))))
+	    HGOTO_ERROR(H5E_HEAP, H5E_CANTINIT, FAIL, "unable to allocate a global heap collection")
+        if(NULL == (batch->heap = H5HG__protect(f, addr, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+        batch->heap_flags = H5AC__NO_FLAGS_SET;
+    } /* end if */
+
+    /* Split the free space to make room for the new object */
+    if(0 == (idx = H5HG__alloc(f, batch->heap, size, &batch->heap_flags)))
+        HGOTO_ERROR(H5E_HEAP, H5E_CANTALLOC, FAIL, "unable to allocate global heap object")
+
+    /* Copy data into the heap */
+    if(size > 0)
+        HDmemcpy(batch->heap->obj[idx].begin + H5HG_SIZEOF_OBJHDR(f), obj, size);
+
+    /* Update the reservation */
+    batch->nobjs--;
+    batch->need -= need;
+
+    /* Return value */
+    hobj->addr = batch->heap->addr;
+    hobj->idx = idx;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_batch_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_batch_read
+ *
+ * Purpose:	Reads the specified global heap object into the buffer
+ *		OBJECT, as part of a batch.  The object's collection is
+ *		kept protected for reading the next objects.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_batch_read(H5HG_batch_t *batch, const H5HG_t *hobj, void *object/*out*/)
+{
+    H5HG_heap_t *heap;          /* Pointer to global heap object */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(batch);
+    HDassert(batch->f);
+    HDassert(hobj);
+    HDassert(object);
+
+    /* Switch to the object's collection, if needed */
+    if(batch->heap && batch->heap->addr != hobj->addr)
+        if(H5HG__batch_release(batch) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+    if(NULL == batch->heap) {
+        if(NULL == (batch->heap = H5HG__protect(batch->f, hobj->addr, H5AC__READ_ONLY_FLAG)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+        batch->heap_flags = H5AC__READ_ONLY_FLAG;
+
+        /* Advance the heap in the CWFS list, as H5HG_read() does */
+        if(batch->heap->obj[0].begin)
+            if(H5F_cwfs_advance_heap(batch->f, batch->heap, FALSE) < 0)
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, FAIL, "can't adjust file's CWFS")
+    } /* end if */
+    heap = batch->heap;
+
+    HDassert(hobj->idx < heap->nused);
+    HDassert(heap->obj[hobj->idx].begin);
+    HDmemcpy(object, heap->obj[hobj->idx].begin + H5HG_SIZEOF_OBJHDR(batch->f), heap->obj[hobj->idx].size);
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_batch_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_batch_end
+ *
+ * Purpose:	Finish a batch of global heap operations, releasing the
+ *		collection it has protected.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_batch_end(H5HG_batch_t *batch)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(batch);
+
+    if(H5HG__batch_release(batch) < 0)
+        HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+    batch->nobjs = 0;
+    batch->need = 0;
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5HG_batch_end() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HG_link
@@ -30,6 +30,15 @@ typedef struct H5HG_t {
 /* Typedef for heap in memory (defined in H5HGpkg.h) */
 typedef struct H5HG_heap_t H5HG_heap_t;
 
+/* Batch of global heap operations (see H5HG_batch_init) */
+typedef struct H5HG_batch_t {
+    H5F_t       *f;             /* File the objects are in */
+    H5HG_heap_t *heap;          /* Collection currently protected, or NULL */
+    unsigned    heap_flags;     /* Flags for unprotecting the collection */
+    size_t      nobjs;          /* # of objects reserved for insertion */
+    size_t      need;           /* Heap space reserved for insertion */
+} H5HG_batch_t;
+
 
 /*
  * Limit global heap collections to the some reasonable size.  This is
@@ -57,6 +66,13 @@ H5_DLL int H5HG_link(H5F_t *f, const H5HG_t *hobj, int adjust);
 H5_DLL herr_t H5HG_get_obj_size(H5F_t *f, H5HG_t *hobj, size_t *obj_size);
 H5_DLL herr_t H5HG_remove(H5F_t *f, H5HG_t *hobj);
 
+/* Batched insertion and read routines */
+H5_DLL herr_t H5HG_batch_init(H5HG_batch_t *batch, H5F_t *f);
+H5_DLL herr_t H5HG_batch_reserve(H5HG_batch_t *batch, size_t size);
+H5_DLL herr_t H5HG_batch_insert(H5HG_batch_t *batch, size_t size, void *obj, H5HG_t *hobj/*out*/);
+H5_DLL herr_t H5HG_batch_read(H5HG_batch_t *batch, const H5HG_t *hobj, void *object/*out*/);
+H5_DLL herr_t H5HG_batch_end(H5HG_batch_t *batch);
+
 /* Support routines */
 H5_DLL herr_t H5HG_extend(H5F_t *f, haddr_t addr, size_t need);
 
@@ -40,7 +40,6 @@
 #include "H5Ipkg.h"             /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Oprivate.h"         /* Object headers                           */
-#include "H5SLprivate.h"        /* Skip Lists                               */
 #include "H5Tpkg.h"             /* Datatypes                                */
 #include "H5VLprivate.h"        /* Virtual Object Layer                     */
 
@@ -51,6 +50,20 @@
 #define H5I_MAKE(g,i)	((((hid_t)(g) & TYPE_MASK) << ID_BITS) |	  \
 			     ((hid_t)(i) & ID_MASK))
 
+/* Initial (and minimum) # of slots in a type's hash table of IDs */
+#define H5I_HASH_MIN_SIZE       64
+
+/* Home slot for an ID in a type's hash table.  IDs within a type are handed
+ * out sequentially, so the atom index itself spreads them over the slots.
+ */
+#define H5I_HASH_SLOT(type_ptr, i) ((size_t)((i) & ID_MASK) & ((type_ptr)->ids_size - 1))
+
+/* Marker for a hash table slot whose ID was removed.  Since the IDs in a type
+ * occupy long runs of consecutive slots, removed IDs aren't filled in by
+ * moving later IDs back, which would have to scan the whole run.
+ */
+#define H5I_HASH_REMOVED (&H5I_hash_removed_g)
+
 /* Local typedefs */
 
 /* Atom information structure used */
@@ -59,6 +72,9 @@ typedef struct H5I_id_info_t {
     unsigned	count;		/* ref. count for this atom		    */
     unsigned    app_count;      /* ref. count of application visible atoms  */
     const void	*obj_ptr;	/* pointer associated with the atom	    */
+    hbool_t     marked;         /* Removed while the type is being iterated over */
+    struct H5I_id_info_t *prev; /* Previous atom in ID order                */
+    struct H5I_id_info_t *next; /* Next atom in ID order                    */
 } H5I_id_info_t;
 
 /* ID type structure used */
@@ -67,9 +83,19 @@ typedef struct {
     unsigned	init_count;	/* # of times this type has been initialized*/
     uint64_t	id_count;	/* Current number of IDs held		    */
     uint64_t	nextid;		/* ID to use for the next atom		    */
-    H5SL_t      *ids;           /* Pointer to skip list that stores IDs     */
+    H5I_id_info_t **ids;        /* Open-addressing hash table of IDs        */
+    size_t      ids_size;       /* # of slots in hash table (a power of 2)  */
+    size_t      ids_used;       /* # of slots holding IDs or removed markers */
+    H5I_id_info_t *first;       /* First atom, for iterating in ID order    */
+    H5I_id_info_t *last;        /* Last atom                                */
+    H5I_id_info_t *last_found;  /* Atom found by the last lookup            */
+    unsigned    iter_depth;     /* # of iterations over the type in progress */
+    hbool_t     has_marked;     /* Whether removed atoms are still linked in */
 } H5I_id_type_t;
 
+/* Callback for iterating over the IDs in a type */
+typedef int (*H5I_id_op_t)(H5I_id_info_t *id_ptr, void *udata);
+
 typedef struct {
     H5I_search_func_t   app_cb;     /* Application's callback routine */
     void               *app_key;    /* Application's "key" (user data) */
@@ -108,6 +134,9 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
 
 /*-------------------- Locally scoped variables -----------------------------*/
 
+/* Target of H5I_HASH_REMOVED */
+static H5I_id_info_t H5I_hash_removed_g;
+
 /* Array of pointers to atomic types */
 static H5I_id_type_t *H5I_id_type_list_g[H5I_MAX_NUM_TYPES];
 
@@ -131,8 +160,14 @@ H5FL_DEFINE_STATIC(H5I_class_t);
 H5FL_EXTERN(H5VL_object_t);
 
 /*--------------------- Local function prototypes ---------------------------*/
+static void H5I__rehash_ids(H5I_id_type_t *type_ptr, H5I_id_info_t **new_ids, size_t new_size);
+static herr_t H5I__resize_ids(H5I_id_type_t *type_ptr, size_t new_size);
+static herr_t H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static H5I_id_info_t *H5I__lookup_id(H5I_id_type_t *type_ptr, hid_t id);
+static void H5I__delete_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static int H5I__iterate_ids(H5I_id_type_t *type_ptr, H5I_id_op_t op, void *udata);
 static void *H5I__unwrap(void *obj_ptr, H5I_type_t type);
-static htri_t H5I__clear_type_cb(void *_id, void *key, void *udata);
+static int H5I__clear_type_cb(H5I_id_info_t *id_ptr, void *udata);
 static int H5I__destroy_type(H5I_type_t type);
 static void *H5I__remove_verify(hid_t id, H5I_type_t id_type);
 static void *H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id);
@@ -141,8 +176,9 @@ static int H5I__get_type_ref(H5I_type_t type);
 static int H5I__search_cb(void *obj, hid_t id, void *_udata);
 static H5I_id_info_t *H5I__find_id(hid_t id);
 static int H5I__iterate_pub_cb(void *obj, hid_t id, void *udata);
-static int H5I__find_id_cb(void *_item, void *_key, void *_udata);
-static int H5I__id_dump_cb(void *_item, void *_key, void *_udata);
+static int H5I__iterate_cb(H5I_id_info_t *item, void *_udata);
+static int H5I__find_id_cb(H5I_id_info_t *item, void *_udata);
+static int H5I__id_dump_cb(H5I_id_info_t *item, void *_udata);
 
 
 /*-------------------------------------------------------------------------
@@ -317,8 +353,13 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->cls = cls;
         type_ptr->id_count = 0;
         type_ptr->nextid = cls->reserved;
-        if(NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        if(NULL == (type_ptr->ids = (H5I_id_info_t **)H5MM_calloc(H5I_HASH_MIN_SIZE * sizeof(H5I_id_info_t *))))
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "ID hash table creation failed")
+        type_ptr->ids_size = H5I_HASH_MIN_SIZE;
+        type_ptr->ids_used = 0;
+        type_ptr->first = type_ptr->last = type_ptr->last_found = NULL;
+        type_ptr->iter_depth = 0;
+        type_ptr->has_marked = FALSE;
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -327,8 +368,7 @@ H5I_register_type(const H5I_class_t *cls)
 done:
     if(ret_value < 0) {	/* Clean up on error */
         if(type_ptr) {
-            if(type_ptr->ids)
-                H5SL_close(type_ptr->ids);
+            type_ptr->ids = (H5I_id_info_t **)H5MM_xfree(type_ptr->ids);
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -451,6 +491,316 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_nmembers() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__rehash_ids
+ *
+ * Purpose:     Moves a type's IDs into a new, empty hash table, dropping
+ *              the markers for removed IDs, and frees the previous table.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__rehash_ids(H5I_id_type_t *type_ptr, H5I_id_info_t **new_ids, size_t new_size)
+{
+    H5I_id_info_t **old_ids = type_ptr->ids;    /* Previous hash table */
+    size_t old_size = type_ptr->ids_size;       /* # of slots in previous table */
+    size_t u;                                   /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(new_ids);
+    HDassert(new_size >= H5I_HASH_MIN_SIZE);
+    HDassert(0 == (new_size & (new_size - 1)));
+    HDassert(type_ptr->id_count < new_size);
+
+    type_ptr->ids = new_ids;
+    type_ptr->ids_size = new_size;
+    type_ptr->ids_used = (size_t)type_ptr->id_count;
+
+    /* Re-insert the IDs */
+    for(u = 0; u < old_size; u++)
+        if(old_ids[u] && old_ids[u] != H5I_HASH_REMOVED) {
+            size_t slot = H5I_HASH_SLOT(type_ptr, old_ids[u]->id);
+
+            while(type_ptr->ids[slot])
+                slot = (slot + 1) & (new_size - 1);
+            type_ptr->ids[slot] = old_ids[u];
+        } /* end if */
+
+    H5MM_xfree(old_ids);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__rehash_ids() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__resize_ids
+ *
+ * Purpose:     Rebuilds a type's hash table of IDs with a new number of
+ *              slots, dropping the markers for removed IDs.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__resize_ids(H5I_id_type_t *type_ptr, size_t new_size)
+{
+    H5I_id_info_t **new_ids;                    /* New hash table */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (new_ids = (H5I_id_info_t **)H5MM_calloc(new_size * sizeof(H5I_id_info_t *))))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "can't allocate ID hash table")
+    H5I__rehash_ids(type_ptr, new_ids, new_size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__resize_ids() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__insert_id
+ *
+ * Purpose:     Adds an ID to a type's hash table and links it into the
+ *              type's list of IDs, which is kept in ID order.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    H5I_id_info_t *prev;                /* ID to link the new ID after */
+    size_t slot;                        /* Hash table slot for the ID */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+
+    /* Keep the table at most half full, counting removed IDs.  Grow it
+     * if it's more than a quarter full of IDs, otherwise just drop the
+     * removed IDs.
+     */
+    if(2 * (type_ptr->ids_used + 1) > type_ptr->ids_size) {
+        size_t new_size = type_ptr->ids_size;
+
+        if(4 * (type_ptr->id_count + 1) > new_size)
+            new_size *= 2;
+        if(H5I__resize_ids(type_ptr, new_size) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTRESIZE, FAIL, "can't grow ID hash table")
+    } /* end if */
+
+    /* Insert into the hash table, re-using a removed ID's slot if possible */
+    slot = H5I_HASH_SLOT(type_ptr, id_ptr->id);
+    while(type_ptr->ids[slot] && type_ptr->ids[slot] != H5I_HASH_REMOVED)
+        slot = (slot + 1) & (type_ptr->ids_size - 1);
+    if(NULL == type_ptr->ids[slot])
+        type_ptr->ids_used++;
+    type_ptr->ids[slot] = id_ptr;
+
+    /* Link into the list of IDs.  New IDs are normally the largest, so
+     * search backward from the end of the list.
+     */
+    prev = type_ptr->last;
+    while(prev && prev->id > id_ptr->id)
+        prev = prev->prev;
+    id_ptr->marked = FALSE;
+    id_ptr->prev = prev;
+    id_ptr->next = prev ? prev->next : type_ptr->first;
+    if(id_ptr->next)
+        id_ptr->next->prev = id_ptr;
+    else
+        type_ptr->last = id_ptr;
+    if(prev)
+        prev->next = id_ptr;
+    else
+        type_ptr->first = id_ptr;
+
+    type_ptr->id_count++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__insert_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__lookup_id
+ *
+ * Purpose:     Finds an ID in a type's hash table, checking the ID found
+ *              by the previous lookup first.
+ *
+ * Return:      Success:    Pointer to the ID's info struct
+ *              Failure:    NULL (not found)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__lookup_id(H5I_id_type_t *type_ptr, hid_t id)
+{
+    H5I_id_info_t *id_ptr;              /* Current ID */
+    size_t slot;                        /* Hash table slot */
+    H5I_id_info_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+
+    /* Check for looking up the same ID again */
+    if(type_ptr->last_found && type_ptr->last_found->id == id)
+        HGOTO_DONE(type_ptr->last_found)
+
+    /* Probe the hash table */
+    slot = H5I_HASH_SLOT(type_ptr, id);
+    while(NULL != (id_ptr = type_ptr->ids[slot])) {
+        if(id_ptr != H5I_HASH_REMOVED && id_ptr->id == id) {
+            type_ptr->last_found = id_ptr;
+            HGOTO_DONE(id_ptr)
+        } /* end if */
+        slot = (slot + 1) & (type_ptr->ids_size - 1);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__lookup_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__delete_id
+ *
+ * Purpose:     Removes an ID from a type and releases its info struct.
+ *
+ *              While the type is being iterated over, the info struct
+ *              stays linked into the type's list of IDs, marked as
+ *              removed, so the iteration can continue past it.  It is
+ *              released when the last iteration finishes.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__delete_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    size_t slot;                        /* Hash table slot */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+    HDassert(!id_ptr->marked);
+
+    /* Find the ID's slot and mark it as removed */
+    slot = H5I_HASH_SLOT(type_ptr, id_ptr->id);
+    while(type_ptr->ids[slot] != id_ptr) {
+        HDassert(type_ptr->ids[slot]);
+        slot = (slot + 1) & (type_ptr->ids_size - 1);
+    } /* end while */
+    type_ptr->ids[slot] = H5I_HASH_REMOVED;
+
+    if(type_ptr->last_found == id_ptr)
+        type_ptr->last_found = NULL;
+    type_ptr->id_count--;
+
+    /* Unlink the ID, unless the type is being iterated over */
+    if(type_ptr->iter_depth > 0) {
+        id_ptr->marked = TRUE;
+        type_ptr->has_marked = TRUE;
+    } /* end if */
+    else {
+        if(id_ptr->prev)
+            id_ptr->prev->next = id_ptr->next;
+        else
+            type_ptr->first = id_ptr->next;
+        if(id_ptr->next)
+            id_ptr->next->prev = id_ptr->prev;
+        else
+            type_ptr->last = id_ptr->prev;
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+
+        /* Shrink the table when it's mostly empty.  This may happen while
+         * an error is being reported, so it mustn't touch the error stack:
+         * if the smaller table can't be allocated, keep the current one.
+         */
+        if(type_ptr->ids_size > H5I_HASH_MIN_SIZE && 8 * type_ptr->id_count < type_ptr->ids_size) {
+            size_t new_size = type_ptr->ids_size / 2;
+            H5I_id_info_t **new_ids;
+
+            if(NULL != (new_ids = (H5I_id_info_t **)H5MM_calloc(new_size * sizeof(H5I_id_info_t *))))
+                H5I__rehash_ids(type_ptr, new_ids, new_size);
+        } /* end if */
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__delete_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__iterate_ids
+ *
+ * Purpose:     Invokes a callback for each ID in a type, in ID order.
+ *              The callback may remove any IDs from the type (including
+ *              the current one) or register new ones.
+ *
+ * Return:      Last value returned from the callback: H5_ITER_CONT,
+ *              H5_ITER_STOP or H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5I__iterate_ids(H5I_id_type_t *type_ptr, H5I_id_op_t op, void *udata)
+{
+    H5I_id_info_t *id_ptr;              /* Current ID */
+    int ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(type_ptr);
+    HDassert(op);
+
+    /* Visit the IDs, keeping removed ones linked in meanwhile */
+    type_ptr->iter_depth++;
+    for(id_ptr = type_ptr->first; id_ptr && H5_ITER_CONT == ret_value; id_ptr = id_ptr->next)
+        if(!id_ptr->marked)
+            ret_value = (*op)(id_ptr, udata);
+    type_ptr->iter_depth--;
+
+    /* Release the IDs removed during the iteration */
+    if(0 == type_ptr->iter_depth && type_ptr->has_marked) {
+        H5I_id_info_t *next;            /* Next ID */
+
+        for(id_ptr = type_ptr->first; id_ptr; id_ptr = next) {
+            next = id_ptr->next;
+            if(id_ptr->marked) {
+                if(id_ptr->prev)
+                    id_ptr->prev->next = next;
+                else
+                    type_ptr->first = next;
+                if(next)
+                    next->prev = id_ptr->prev;
+                else
+                    type_ptr->last = id_ptr->prev;
+                id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+            } /* end if */
+        } /* end for */
+        type_ptr->has_marked = FALSE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__iterate_ids() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5I__unwrap
@@ -562,7 +912,7 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.app_ref = app_ref;
 
     /* Attempt to free all ids in the type */
-    if(H5SL_try_free_safe(udata.type_ptr->ids, H5I__clear_type_cb, &udata) < 0)
+    if(H5I__iterate_ids(udata.type_ptr, H5I__clear_type_cb, &udata) < 0)
         HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, FAIL, "can't free ids in type")
 
 done:
@@ -576,19 +926,18 @@ done:
  * Purpose:     Attempts to free the specified ID, calling the free
  *              function for the object.
  *
- * Return:      TRUE/FALSE/FAIL
+ * Return:      H5_ITER_CONT (always)
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
  *
  *-------------------------------------------------------------------------
  */
-static htri_t
-H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
+static int
+H5I__clear_type_cb(H5I_id_info_t *id, void *_udata)
 {
-    H5I_id_info_t       *id = (H5I_id_info_t *)_id; /* Current ID being worked with */
     H5I_clear_type_ud_t *udata = (H5I_clear_type_ud_t *)_udata; /* udata struct */
-    htri_t              ret_value = FALSE;    /* Return value */
+    hbool_t             remove_id = FALSE; /* Whether to remove the ID */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -614,25 +963,20 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
 #endif /*H5I_DEBUG*/
 
                 /* Indicate node should be removed from list */
-                ret_value = TRUE;
+                remove_id = TRUE;
             } /* end if */
         } /* end if */
         else {
             /* Indicate node should be removed from list */
-            ret_value = TRUE;
+            remove_id = TRUE;
         } /* end else */
 
-        /* Remove ID if requested */
-        if(ret_value) {
-            /* Free ID info */
-            id = H5FL_FREE(H5I_id_info_t, id);
-
-            /* Decrement the number of IDs in the type */
-            udata->type_ptr->id_count--;
-        } /* end if */
+        /* Remove ID if requested (and the free function didn't already) */
+        if(remove_id && !id->marked)
+            H5I__delete_id(udata->type_ptr, id);
     } /* end if */
 
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
 } /* end H5I__clear_type_cb() */
 
 
@@ -709,9 +1053,10 @@ H5I__destroy_type(H5I_type_t type)
     if(type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    if(H5SL_close(type_ptr->ids) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
-    type_ptr->ids = NULL;
+    /* Release the hash table (all IDs were removed above) */
+    HDassert(0 == type_ptr->id_count);
+    HDassert(NULL == type_ptr->first);
+    type_ptr->ids = (H5I_id_info_t **)H5MM_xfree(type_ptr->ids);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
@@ -792,9 +1137,10 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->obj_ptr     = object;
 
     /* Insert into the type */
-    if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if (H5I__insert_id(type_ptr, id_ptr) < 0) {
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into hash table")
+    } /* end if */
     type_ptr->nextid++;
 
     /* Sanity check for the 'nextid' getting too large and wrapping around */
@@ -867,9 +1213,10 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
     id_ptr->obj_ptr     = object;
 
     /* Insert into the type */
-    if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if(H5I__insert_id(type_ptr, id_ptr) < 0) {
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into hash table")
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1175,15 +1522,14 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     HDassert(type_ptr);
 
     /* Get the ID node for the ID */
-    if(NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    if(NULL == (curr_id = H5I__lookup_id(type_ptr, id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from hash table")
 
     /* (Casting away const OK -QAK) */
     ret_value = (void *)curr_id->obj_ptr;
-    curr_id = H5FL_FREE(H5I_id_info_t, curr_id);
 
-    /* Decrement the number of IDs in the type */
-    (type_ptr->id_count)--;
+    /* Remove the ID node from the type */
+    H5I__delete_id(type_ptr, curr_id);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1838,7 +2184,7 @@ H5I__search_cb(void *obj, hid_t id, void *_udata)
 {
     H5I_search_ud_t    *udata = (H5I_search_ud_t *)_udata;  /* User data for callback */
     herr_t              cb_ret_val;                         /* User callback return value */
-    int                 ret_value = H5_ITER_ERROR;          /* Callback return value */
+    int                 ret_value = H5_ITER_CONT;           /* Callback return value */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -1928,7 +2274,7 @@ H5I__iterate_pub_cb(void H5_ATTR_UNUSED *obj, hid_t id, void *_udata)
 {
     H5I_iterate_pub_ud_t   *udata = (H5I_iterate_pub_ud_t *)_udata; /* User data for callback */
     herr_t                  cb_ret_val;                             /* User callback return value */
-    int                     ret_value = H5_ITER_ERROR;              /* Callback return value */
+    int                     ret_value = H5_ITER_CONT;               /* Callback return value */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -2005,9 +2351,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_iterate_ud_t *udata = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int ret_value = H5_ITER_CONT;     /* Callback return value */
 
@@ -2090,7 +2435,7 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
         iter_udata.obj_type     = type;
 
         /* Iterate over IDs */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        if ((iter_status = H5I__iterate_ids(type_ptr, H5I__iterate_cb, &iter_udata)) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
     } /* end if */
 
@@ -2130,7 +2475,7 @@ H5I__find_id(hid_t id)
         HGOTO_DONE(NULL)
 
     /* Locate the ID node for the ID */
-    ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+    ret_value = H5I__lookup_id(type_ptr, id);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2237,9 +2582,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__find_id_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__find_id_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_get_id_ud_t *udata = (H5I_get_id_ud_t *)_udata;     /* Pointer to user data */
     H5I_type_t type = udata->obj_type;
     const void *obj_ptr = NULL;
@@ -2302,7 +2646,7 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
         udata.ret_id    = H5I_INVALID_HID;
 
         /* Iterate over IDs for the ID type */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__find_id_cb, &udata)) < 0)
+        if ((iter_status = H5I__iterate_ids(type_ptr, H5I__find_id_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
 
         *id = udata.ret_id;
@@ -2323,9 +2667,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__id_dump_cb(H5I_id_info_t *item, void *_udata)
 {
-    H5I_id_info_t  *item    = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
     H5I_type_t      type    = *(H5I_type_t *)_udata;        /* User data */
     H5G_name_t     *path    = NULL;                         /* Path to file object */
     const void     *obj_ptr = NULL;                         /* Pointer to VOL connector object */
@@ -2425,7 +2768,7 @@ H5I_dump_ids_for_type(H5I_type_t type)
         /* List */
         if(type_ptr->id_count > 0) {
             HDfprintf(stderr, "	 List:\n");
-            H5SL_iterate(type_ptr->ids, H5I__id_dump_cb, &type);
+            H5I__iterate_ids(type_ptr, H5I__id_dump_cb, &type);
         }
     }
     else
@@ -61,13 +61,6 @@ typedef enum {
     H5MF_AGGR_MERGE_TOGETHER            /* Metadata & raw data in one free list */
 } H5MF_aggr_merge_t;
 
-/* User data for section info iterator callback for iterating over free space sections */
-typedef struct {
-    H5F_sect_info_t *sects;     /* section info to be retrieved */
-    size_t sect_count;          /* # of sections requested */
-    size_t sect_idx;            /* the current count of sections */
-} H5MF_sect_iter_ud_t;
-
 
 /********************/
 /* Package Typedefs */
@@ -813,8 +806,14 @@ HDfprintf(stderr, "%s: Check 1.0\n", FUNC);
         fsm_ring = H5AC_RING_RDFSM;
     H5AC_set_ring(fsm_ring, &orig_ring);
 
+    /* Check if the file's free space is tracked with extent trees */
+    if(f->shared->fs_extent_tree) {
+        /* Search for large enough space in the extent tree */
+        if(H5MF__tree_find(f, fs_type, size, &ret_value) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF, "error locating free space in extent tree")
+    } /* end if */
     /* Check if we are using the free space manager for this file */
-    if(H5F_HAVE_FREE_SPACE_MANAGER(f)) {
+    else if(H5F_HAVE_FREE_SPACE_MANAGER(f)) {
         /* We are about to change the contents of the free space manager --
          * notify metadata cache that the associated fsm ring is
          * unsettled
@@ -1144,6 +1143,13 @@ HDfprintf(stderr, "%s: Entering - alloc_type = %u, addr = %a, size = %Hu\n", FUN
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't check free space intersection w/metadata accumulator")
     } /* end if */
 
+    /* Return the space to the extent tree, if the file uses them */
+    if(f->shared->fs_extent_tree) {
+        if(H5MF__tree_add(f, alloc_type, fs_type, addr, size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't add space to extent tree")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Check if the free space manager for the file has been initialized */
     if(!f->shared->fs_man[fs_type]) {
         /* If there's no free space manager for objects of this type,
@@ -1402,6 +1408,11 @@ HDfprintf(stderr, "%s: H5MF__aggr_try_extend = %t\n", FUNC, ret_value);
             udata.f = f;
             udata.alloc_type = alloc_type;
 
+            /* Try to extend the block into a free extent */
+            if(f->shared->fs_extent_tree)
+                if((ret_value = H5MF__tree_try_extend(f, fs_type, end, extra_requested)) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTEXTEND, FAIL, "error extending block in extent tree")
+
             /* Check if the free space for the file has been initialized */
             if(!f->shared->fs_man[fs_type] && H5F_addr_defined(f->shared->fs_addr[fs_type]))
                 /* Open the free-space manager */
@@ -1909,6 +1920,11 @@ HDfprintf(stderr, "%s: Entering\n", FUNC);
     if(H5MF__close_shrink_eoa(f) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTSHRINK, FAIL, "can't shrink eoa")
 
+    /* Release the extent trees (their free space isn't kept in the file) */
+    for(type = H5FD_MEM_DEFAULT; type < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, type))
+        if(H5MF__tree_close(f, (H5F_mem_page_t)type) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't close extent tree")
+
 done:
     /* Reset the ring in the API context */
     if(orig_ring != H5AC_RING_INV)
@@ -2184,6 +2200,14 @@ H5MF__close_shrink_eoa(H5F_t *f)
                 else if(status > 0)
                     eoa_shrank = TRUE;
                 } /* end if */
+
+                /* Check the last extent of each extent tree */
+                if(f->shared->fs_tree[type]) {
+                    if((status = H5MF__tree_try_shrink_eoa(f, type, (H5F_mem_page_t)type)) < 0)
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTSHRINK, FAIL, "can't check for shrinking eoa")
+                    else if(status > 0)
+                        eoa_shrank = TRUE;
+                } /* end if */
             } /* end for */
 
             /* check the two aggregators */
@@ -2312,6 +2336,10 @@ H5MF_get_freespace(H5F_t *f, hsize_t *tot_space, hsize_t *meta_size)
             tot_fs_size += type_fs_size;
             tot_meta_size += type_meta_size;
         } /* end if */
+
+        /* Add the free space in the extent tree of this type */
+        if(f->shared->fs_tree[type])
+            tot_fs_size += f->shared->fs_tree[type]->tot_space;
     } /* end for */
 
     /* Close the free-space managers if they were opened earlier in this routine */
@@ -2455,6 +2483,11 @@ H5MF_get_free_sections(H5F_t *f, H5FD_mem_t type, size_t nsects, H5F_sect_info_t
             if(H5MF__get_free_sects(f, f->shared->fs_man[ty], &sect_udata, &nums) < 0)
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, (-1), "can't get section info for the free space manager")
 
+        /* Check if there's free extents of this type */
+        if(f->shared->fs_tree[ty])
+            if(H5MF__tree_get_sects(f, ty, &sect_udata, &nums) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, (-1), "can't get section info for the extent tree")
+
         /* Increment total # of sections */
         total_sects += nums;
 
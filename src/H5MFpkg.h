@@ -31,6 +31,7 @@
 
 /* Other private headers needed by this file */
 #include "H5FSprivate.h"	/* File free space                      */
+#include "H5SLprivate.h"	/* Skip lists				*/
 
 
 /**************************/
@@ -164,6 +165,49 @@ typedef struct H5MF_fs_t {
     hsize_t     alignment;      /* Alignment                            */
 } H5MF_fs_t;
 
+/* User data for section info iterator callback for iterating over free space sections */
+typedef struct H5MF_sect_iter_ud_t {
+    H5F_sect_info_t *sects;     /* section info to be retrieved */
+    size_t sect_count;          /* # of sections requested */
+    size_t sect_idx;            /* the current count of sections */
+} H5MF_sect_iter_ud_t;
+
+/* A free extent in an extent tree */
+typedef struct H5MF_extent_t {
+    haddr_t addr;               /* Address of the extent (key in the address list) */
+    hsize_t size;               /* Size of the extent */
+} H5MF_extent_t;
+
+/* Extent tree, which tracks the free space of one file space type when
+ * the file was created with H5Pset_file_space_extent_tree(), in place of
+ * a free-space manager.
+ *
+ * The free extents are kept in two skip lists, which hold the same
+ * H5MF_extent_t structs:
+ *
+ * addr_list:   Extents ordered by address.  Freed space is merged with
+ *              the extents that end where it starts and start where it
+ *              ends as soon as it is freed, so no two extents in the tree
+ *              are adjacent.
+ *
+ * size_list:   Extents ordered by size, then address.  An allocation takes
+ *              the first extent that is at least as large as the request,
+ *              which is the best fit, and the lowest-addressed one among
+ *              equally good fits.
+ *
+ * Both lookups take O(log n) time in the number of extents, whereas the
+ * section bins of a free-space manager hold address-ordered lists of
+ * sections whose sizes fall in a power-of-two range, and merging freed
+ * space with its neighbors is done there by separate callbacks.
+ *
+ * The extent trees are never stored in the file.
+ */
+typedef struct H5MF_extent_tree_t {
+    H5SL_t *addr_list;          /* Extents ordered by address */
+    H5SL_t *size_list;          /* Extents ordered by size, then address */
+    hsize_t tot_space;          /* Total size of the extents */
+} H5MF_extent_tree_t;
+
 
 /*****************************/
 /* Package Private Variables */
@@ -196,6 +240,19 @@ H5_DLL H5MF_free_section_t *H5MF__sect_new(unsigned ctype, haddr_t sect_off,
 H5_DLL herr_t H5MF__sect_free(H5FS_section_info_t *sect);
 
 
+/* Extent tree routines */
+H5_DLL htri_t H5MF__tree_find(H5F_t *f, H5F_mem_page_t fs_type, hsize_t size,
+    haddr_t *addr);
+H5_DLL herr_t H5MF__tree_add(H5F_t *f, H5FD_mem_t alloc_type,
+    H5F_mem_page_t fs_type, haddr_t addr, hsize_t size);
+H5_DLL htri_t H5MF__tree_try_extend(H5F_t *f, H5F_mem_page_t fs_type,
+    haddr_t end, hsize_t extra_requested);
+H5_DLL htri_t H5MF__tree_try_shrink_eoa(H5F_t *f, H5FD_mem_t alloc_type,
+    H5F_mem_page_t fs_type);
+H5_DLL herr_t H5MF__tree_get_sects(const H5F_t *f, H5F_mem_page_t fs_type,
+    H5MF_sect_iter_ud_t *sect_udata, size_t *nums);
+H5_DLL herr_t H5MF__tree_close(H5F_t *f, H5F_mem_page_t fs_type);
+
 /* Block aggregator routines */
 H5_DLL htri_t H5MF__aggr_try_extend(H5F_t *f, H5F_blk_aggr_t *aggr,
     H5FD_mem_t type, haddr_t abs_blk_end, hsize_t extra_requested);
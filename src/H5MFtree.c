@@ -0,0 +1,611 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5MFtree.c
+ *
+ * Purpose:     Routines for tracking the free space of a file with extent
+ *              trees, instead of with free-space managers, when the file
+ *              was created with H5Pset_file_space_extent_tree().  See the
+ *              description of H5MF_extent_tree_t in H5MFpkg.h.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+#include "H5MFmodule.h"         /* This source code file is part of the H5MF module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5MFpkg.h"		/* File memory management		*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static int H5MF__tree_size_cmp(const void *_ext1, const void *_ext2);
+static herr_t H5MF__tree_insert(H5MF_extent_tree_t *tree, H5MF_extent_t *ext);
+static herr_t H5MF__tree_remove(H5MF_extent_tree_t *tree, H5MF_extent_t *ext);
+static herr_t H5MF__tree_free_cb(void *item, void *key, void *op_data);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5MF_extent_tree_t struct */
+H5FL_DEFINE_STATIC(H5MF_extent_tree_t);
+
+/* Declare a free list to manage the H5MF_extent_t struct */
+H5FL_DEFINE_STATIC(H5MF_extent_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_size_cmp
+ *
+ * Purpose:     Compare two extents by size, then by address, for the
+ *              size-ordered skip list of an extent tree.
+ *
+ * Return:      Negative, zero or positive, as for strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5MF__tree_size_cmp(const void *_ext1, const void *_ext2)
+{
+    const H5MF_extent_t *ext1 = (const H5MF_extent_t *)_ext1;
+    const H5MF_extent_t *ext2 = (const H5MF_extent_t *)_ext2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(ext1->size < ext2->size)
+        ret_value = -1;
+    else if(ext1->size > ext2->size)
+        ret_value = 1;
+    else if(H5F_addr_lt(ext1->addr, ext2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(ext1->addr, ext2->addr))
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_size_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_insert
+ *
+ * Purpose:     Insert an extent into both skip lists of an extent tree.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5MF__tree_insert(H5MF_extent_tree_t *tree, H5MF_extent_t *ext)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(tree);
+    HDassert(ext);
+    HDassert(ext->size > 0);
+
+    if(H5SL_insert(tree->addr_list, ext, &ext->addr) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert extent into address list")
+    if(H5SL_insert(tree->size_list, ext, ext) < 0) {
+        (void)H5SL_remove(tree->addr_list, &ext->addr);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert extent into size list")
+    } /* end if */
+    tree->tot_space += ext->size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_remove
+ *
+ * Purpose:     Remove an extent from both skip lists of an extent tree.
+ *              The extent itself is not released.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5MF__tree_remove(H5MF_extent_tree_t *tree, H5MF_extent_t *ext)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(tree);
+    HDassert(ext);
+
+    if(NULL == H5SL_remove(tree->addr_list, &ext->addr))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from address list")
+    if(NULL == H5SL_remove(tree->size_list, ext))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from size list")
+    HDassert(tree->tot_space >= ext->size);
+    tree->tot_space -= ext->size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_free_cb
+ *
+ * Purpose:     Skip list callback to release an extent when an extent
+ *              tree is closed.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5MF__tree_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(item);
+
+    item = H5FL_FREE(H5MF_extent_t, item);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5MF__tree_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_find
+ *
+ * Purpose:     Take SIZE bytes from the extent tree of FS_TYPE, if one of
+ *              its extents is large enough.  The smallest such extent is
+ *              used, with the lowest address among extents of the same
+ *              size, and any space left in it stays in the tree.
+ *
+ *              When the file has an alignment that applies to SIZE, an
+ *              extent is only used if its aligned part is large enough,
+ *              and the fragment before the aligned address stays in the
+ *              tree.  Any extent of at least SIZE + alignment - 1 bytes
+ *              fits, so the search looks at no larger extents than that.
+ *
+ * Return:      Success:        TRUE (space found, returned in *ADDR) or
+ *                              FALSE (no extent large enough)
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5MF__tree_find(H5F_t *f, H5F_mem_page_t fs_type, hsize_t size, haddr_t *addr)
+{
+    H5MF_extent_tree_t *tree;           /* Extent tree to search */
+    H5MF_extent_t key;                  /* Key for searching the size list */
+    H5MF_extent_t *found = NULL;        /* Extent that fits */
+    H5MF_extent_t *ext = NULL;          /* Extent to allocate from */
+    H5MF_extent_t *frag = NULL;         /* Alignment fragment */
+    H5SL_node_t *node;                  /* Skip list node for extent */
+    hsize_t alignment;                  /* Alignment to use */
+    hsize_t frag_size = 0;              /* Size of alignment fragment */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(size > 0);
+    HDassert(addr);
+
+    /* Check for any free space of this type */
+    if(NULL == (tree = f->shared->fs_tree[fs_type]))
+        HGOTO_DONE(FALSE)
+
+    /* Set up the alignment to use for this request */
+    alignment = f->shared->alignment;
+    if(!((alignment > 1) && (size >= f->shared->threshold)))
+        alignment = 0;
+
+    /* Look for the smallest extent that fits */
+    key.addr = 0;
+    key.size = size;
+    for(node = H5SL_above(tree->size_list, &key); node; node = H5SL_next(node)) {
+        H5MF_extent_t *curr = (H5MF_extent_t *)H5SL_item(node);    /* Current extent */
+        hsize_t mis_align;              /* Misalignment of extent */
+
+        HDassert(curr->size >= size);
+        frag_size = 0;
+        if(alignment && (mis_align = curr->addr % alignment))
+            frag_size = alignment - mis_align;
+        if(curr->size >= size + frag_size) {
+            found = curr;
+            break;
+        } /* end if */
+    } /* end for */
+    if(NULL == found)
+        HGOTO_DONE(FALSE)
+
+    /* Take the extent out of the tree */
+    if(H5MF__tree_remove(tree, found) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from tree")
+    ext = found;
+
+    /* Return the alignment fragment to the tree */
+    if(frag_size) {
+        if(NULL == (frag = H5FL_MALLOC(H5MF_extent_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for extent")
+        frag->addr = ext->addr;
+        frag->size = frag_size;
+        if(H5MF__tree_insert(tree, frag) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert extent into tree")
+        frag = NULL;
+    } /* end if */
+
+    /* Set the address to return */
+    *addr = ext->addr + frag_size;
+
+    /* Return the rest of the extent to the tree */
+    if(ext->size > frag_size + size) {
+        ext->size -= frag_size + size;
+        ext->addr = *addr + size;
+        if(H5MF__tree_insert(tree, ext) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert extent into tree")
+        ext = NULL;
+    } /* end if */
+
+    /* Indicate that space was found */
+    ret_value = TRUE;
+
+done:
+    if(ext)
+        ext = H5FL_FREE(H5MF_extent_t, ext);
+    if(frag)
+        frag = H5FL_FREE(H5MF_extent_t, frag);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_add
+ *
+ * Purpose:     Return freed space to the extent tree of FS_TYPE.  The
+ *              space is merged right away with the free extents on either
+ *              side of it.  If the merged extent ends at the EOA or
+ *              adjoins a block aggregator, it is released there instead,
+ *              and extents smaller than the free-space section threshold
+ *              are dropped, as they are by free-space managers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF__tree_add(H5F_t *f, H5FD_mem_t alloc_type, H5F_mem_page_t fs_type,
+    haddr_t addr, hsize_t size)
+{
+    H5MF_extent_tree_t *tree;           /* Extent tree to add to */
+    H5MF_extent_t *ext = NULL;          /* Extent to work on */
+    haddr_t end;                        /* End of the freed space */
+    htri_t status;                      /* Status from shrinking */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->fs_extent_tree);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(size > 0);
+
+    /* Create the extent tree for this type on first use */
+    if(NULL == (tree = f->shared->fs_tree[fs_type])) {
+        if(NULL == (tree = H5FL_CALLOC(H5MF_extent_tree_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for extent tree")
+        if(NULL == (tree->addr_list = H5SL_create(H5SL_TYPE_HADDR, NULL))) {
+            tree = H5FL_FREE(H5MF_extent_tree_t, tree);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTCREATE, FAIL, "can't create address list for extent tree")
+        } /* end if */
+        if(NULL == (tree->size_list = H5SL_create(H5SL_TYPE_GENERIC, H5MF__tree_size_cmp))) {
+            (void)H5SL_close(tree->addr_list);
+            tree = H5FL_FREE(H5MF_extent_tree_t, tree);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTCREATE, FAIL, "can't create size list for extent tree")
+        } /* end if */
+        f->shared->fs_tree[fs_type] = tree;
+    } /* end if */
+
+    /* Merge with the free extent that ends where the freed space starts */
+    if(NULL != (ext = (H5MF_extent_t *)H5SL_less(tree->addr_list, &addr))) {
+        HDassert(H5F_addr_le(ext->addr + ext->size, addr));
+        if(H5F_addr_eq(ext->addr + ext->size, addr)) {
+            if(H5MF__tree_remove(tree, ext) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from tree")
+            addr = ext->addr;
+            size += ext->size;
+            ext = H5FL_FREE(H5MF_extent_t, ext);
+        } /* end if */
+        else
+            ext = NULL;
+    } /* end if */
+
+    /* Merge with the free extent that starts where the freed space ends */
+    end = addr + size;
+    if(NULL != (ext = (H5MF_extent_t *)H5SL_search(tree->addr_list, &end))) {
+        if(H5MF__tree_remove(tree, ext) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from tree")
+        size += ext->size;
+        ext = H5FL_FREE(H5MF_extent_t, ext);
+    } /* end if */
+
+    /* Try to shrink the file or absorb the space into a block aggregator */
+    if((status = H5MF_try_shrink(f, alloc_type, addr, size)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTMERGE, FAIL, "can't check for absorbing block")
+    else if(status > 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Drop space below the threshold on the floor.  (Extents in the tree
+     * are never below the threshold, so this only drops space that
+     * didn't merge with any of them.)
+     */
+    if(size < f->shared->fs_threshold)
+        HGOTO_DONE(SUCCEED)
+
+    /* Add the extent to the tree */
+    if(NULL == (ext = H5FL_MALLOC(H5MF_extent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for extent")
+    ext->addr = addr;
+    ext->size = size;
+    if(H5MF__tree_insert(tree, ext) < 0) {
+        ext = H5FL_FREE(H5MF_extent_t, ext);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert extent into tree")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_try_extend
+ *
+ * Purpose:     Extend a block that ends at END by EXTRA_REQUESTED bytes,
+ *              if a free extent of FS_TYPE starts at END and is large
+ *              enough.
+ *
+ * Return:      Success:        TRUE (block extended) or FALSE
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5MF__tree_try_extend(H5F_t *f, H5F_mem_page_t fs_type, haddr_t end,
+    hsize_t extra_requested)
+{
+    H5MF_extent_tree_t *tree;           /* Extent tree to search */
+    H5MF_extent_t *ext;                 /* Extent after the block */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Check for a large enough extent right after the block */
+    if(NULL == (tree = f->shared->fs_tree[fs_type]))
+        HGOTO_DONE(FALSE)
+    if(NULL == (ext = (H5MF_extent_t *)H5SL_search(tree->addr_list, &end)))
+        HGOTO_DONE(FALSE)
+    if(ext->size < extra_requested)
+        HGOTO_DONE(FALSE)
+
+    /* Take the space from the start of the extent */
+    if(H5MF__tree_remove(tree, ext) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from tree")
+    if(ext->size > extra_requested) {
+        ext->addr += extra_requested;
+        ext->size -= extra_requested;
+        if(H5MF__tree_insert(tree, ext) < 0) {
+            ext = H5FL_FREE(H5MF_extent_t, ext);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert extent into tree")
+        } /* end if */
+    } /* end if */
+    else
+        ext = H5FL_FREE(H5MF_extent_t, ext);
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_try_extend() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_try_shrink_eoa
+ *
+ * Purpose:     Shrink the EOA with the last extent of FS_TYPE, if that
+ *              extent ends at the EOA.
+ *
+ * Return:      Success:        TRUE (EOA shrunk) or FALSE
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5MF__tree_try_shrink_eoa(H5F_t *f, H5FD_mem_t alloc_type, H5F_mem_page_t fs_type)
+{
+    H5MF_extent_tree_t *tree;           /* Extent tree to check */
+    H5SL_node_t *node;                  /* Skip list node for last extent */
+    H5MF_extent_t *ext;                 /* Last extent */
+    haddr_t eoa;                        /* End of allocated space in the file */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Get the extent with the highest address */
+    if(NULL == (tree = f->shared->fs_tree[fs_type]))
+        HGOTO_DONE(FALSE)
+    if(NULL == (node = H5SL_last(tree->addr_list)))
+        HGOTO_DONE(FALSE)
+    ext = (H5MF_extent_t *)H5SL_item(node);
+
+    /* Check if the extent is at the EOA */
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, alloc_type)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+    if(!H5F_addr_eq(ext->addr + ext->size, eoa))
+        HGOTO_DONE(FALSE)
+
+    /* Release the extent's space at the EOA */
+    if(H5MF__tree_remove(tree, ext) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTREMOVE, FAIL, "can't remove extent from tree")
+    if(H5F__free(f, alloc_type, ext->addr, ext->size) < 0) {
+        ext = H5FL_FREE(H5MF_extent_t, ext);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "driver free request failed")
+    } /* end if */
+    ext = H5FL_FREE(H5MF_extent_t, ext);
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_try_shrink_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_get_sects
+ *
+ * Purpose:     Retrieve the address and size of the extents of FS_TYPE,
+ *              in address order, into the section info array of
+ *              SECT_UDATA, and their number into *NUMS.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF__tree_get_sects(const H5F_t *f, H5F_mem_page_t fs_type,
+    H5MF_sect_iter_ud_t *sect_udata, size_t *nums)
+{
+    H5MF_extent_tree_t *tree;           /* Extent tree to iterate over */
+    H5SL_node_t *node;                  /* Skip list node for extent */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(sect_udata);
+    HDassert(nums);
+
+    *nums = 0;
+    if(NULL != (tree = f->shared->fs_tree[fs_type])) {
+        *nums = H5SL_count(tree->addr_list);
+
+        /* Retrieve the extents' info, if requested */
+        if(sect_udata->sects)
+            for(node = H5SL_first(tree->addr_list); node && sect_udata->sect_idx < sect_udata->sect_count; node = H5SL_next(node)) {
+                const H5MF_extent_t *ext = (const H5MF_extent_t *)H5SL_item(node);
+
+                sect_udata->sects[sect_udata->sect_idx].addr = ext->addr;
+                sect_udata->sects[sect_udata->sect_idx].size = ext->size;
+                sect_udata->sect_idx++;
+            } /* end for */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5MF__tree_get_sects() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__tree_close
+ *
+ * Purpose:     Release the extent tree of FS_TYPE, dropping the free
+ *              space it tracks.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MF__tree_close(H5F_t *f, H5F_mem_page_t fs_type)
+{
+    H5MF_extent_tree_t *tree;           /* Extent tree to close */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(NULL != (tree = f->shared->fs_tree[fs_type])) {
+        f->shared->fs_tree[fs_type] = NULL;
+
+        /* The size list holds the same extents, so only the address list releases them */
+        if(H5SL_close(tree->size_list) < 0)
+            HDONE_ERROR(H5E_RESOURCE, H5E_CANTCLOSEOBJ, FAIL, "can't close size list for extent tree")
+        if(H5SL_destroy(tree->addr_list, H5MF__tree_free_cb, NULL) < 0)
+            HDONE_ERROR(H5E_RESOURCE, H5E_CANTCLOSEOBJ, FAIL, "can't close address list for extent tree")
+        tree = H5FL_FREE(H5MF_extent_tree_t, tree);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__tree_close() */
+
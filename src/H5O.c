@@ -930,6 +930,10 @@ done:
  *              NOTE: Add a a parameter "fields" to indicate selection of
  *              object info to be retrieved to the callback "op".
  *
+ *              Only requesting H5O_INFO_BASIC makes the visit much faster
+ *              for large files, since the objects' headers are then only
+ *              read for their type and reference count.
+ *
  * Return:      Success:    The return value of the first operator that
  *                          returns non-zero, or zero if all members were
  *                          processed with no operator returning non-zero.
@@ -54,6 +54,9 @@
 typedef struct {
     H5F_t      *f;              /* Pointer to file for insertion */
     H5O_ainfo_t *ainfo;         /* Attribute info struct */
+    H5A_t     **attrs;          /* Attributes to insert into dense storage */
+    size_t      nattrs;         /* # of attributes to insert */
+    size_t      alloc_attrs;    /* Size of attribute table */
 } H5O_iter_cvt_t;
 
 /* User data for iteration when opening an attribute */
@@ -128,6 +131,9 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 static herr_t H5O__attr_to_dense_cb(H5O_t *oh, H5O_mesg_t *mesg,
+    unsigned H5_ATTR_UNUSED sequence, unsigned H5_ATTR_UNUSED *oh_modified,
+    void *_udata);
+static herr_t H5O__attr_to_dense_release_cb(H5O_t *oh, H5O_mesg_t *mesg,
     unsigned H5_ATTR_UNUSED sequence, unsigned *oh_modified, void *_udata);
 static htri_t H5O__attr_find_opened_attr(const H5O_loc_t *loc, H5A_t **attr,
     const char* name_to_open);
@@ -165,8 +171,8 @@ static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_to_dense_cb
  *
- * Purpose:     Object header iterator callback routine to convert compact
- *              attributes to dense attributes
+ * Purpose:     Object header iterator callback routine to collect compact
+ *              attributes, for converting them to dense attributes
  *
  * Return:      SUCCEED/FAIL
  *
@@ -178,7 +184,8 @@ static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
  */
 static herr_t
 H5O__attr_to_dense_cb(H5O_t *oh, H5O_mesg_t *mesg/*in,out*/,
-    unsigned H5_ATTR_UNUSED sequence, unsigned *oh_modified, void *_udata/*in,out*/)
+    unsigned H5_ATTR_UNUSED sequence, unsigned H5_ATTR_UNUSED *oh_modified,
+    void *_udata/*in,out*/)
 {
     H5O_iter_cvt_t *udata = (H5O_iter_cvt_t *)_udata;   /* Operator user data */
     H5A_t *attr = (H5A_t *)mesg->native;        /* Pointer to attribute to insert */
@@ -194,9 +201,50 @@ H5O__attr_to_dense_cb(H5O_t *oh, H5O_mesg_t *mesg/*in,out*/,
     HDassert(udata->ainfo);
     HDassert(attr);
 
-    /* Insert attribute into dense storage */
-    if(H5A__dense_insert(udata->f, udata->ainfo, attr) < 0)
-        HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, H5_ITER_ERROR, "unable to add to dense storage")
+    /* Check for needing to increase the size of the attribute table */
+    if(udata->nattrs >= udata->alloc_attrs) {
+        size_t na = MAX(1, udata->alloc_attrs * 2);     /* New # of attributes allocated */
+        H5A_t **x;              /* Pointer to larger attribute table */
+
+        if(NULL == (x = (H5A_t **)H5MM_realloc(udata->attrs, sizeof(H5A_t *) * na)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed")
+        udata->alloc_attrs = na;
+        udata->attrs = x;
+    } /* end if */
+
+    /* Remember the attribute, to insert it into dense storage with the others */
+    /* (the object header is pinned, so the attribute stays in memory) */
+    udata->attrs[udata->nattrs++] = attr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_to_dense_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_to_dense_release_cb
+ *
+ * Purpose:     Object header iterator callback routine to remove compact
+ *              attributes after they are converted to dense attributes
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_to_dense_release_cb(H5O_t *oh, H5O_mesg_t *mesg/*in,out*/,
+    unsigned H5_ATTR_UNUSED sequence, unsigned *oh_modified, void *_udata/*in,out*/)
+{
+    H5O_iter_cvt_t *udata = (H5O_iter_cvt_t *)_udata;   /* Operator user data */
+    herr_t ret_value = H5_ITER_CONT;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(oh);
+    HDassert(mesg);
+    HDassert(udata);
+    HDassert(udata->f);
 
     /* Convert message into a null message in the header */
     /* (don't delete attribute's space in the file though) */
@@ -208,7 +256,7 @@ H5O__attr_to_dense_cb(H5O_t *oh, H5O_mesg_t *mesg/*in,out*/,
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5O__attr_to_dense_cb() */
+} /* end H5O__attr_to_dense_release_cb() */
 
 
 /*-------------------------------------------------------------------------
@@ -294,10 +342,27 @@ H5O__attr_create(const H5O_loc_t *loc, H5A_t *attr)
                 /* Set up user data for callback */
                 udata.f = loc->file;
                 udata.ainfo = &ainfo;
+                udata.attrs = NULL;
+                udata.nattrs = 0;
+                udata.alloc_attrs = 0;
 
-                /* Iterate over existing attributes, moving them to dense storage */
+                /* Iterate over existing attributes, collecting them */
                 op.op_type = H5O_MESG_OP_LIB;
                 op.u.lib_op = H5O__attr_to_dense_cb;
+                if(H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0) {
+                    H5MM_xfree(udata.attrs);
+                    HGOTO_ERROR(H5E_ATTR, H5E_CANTCONVERT, FAIL, "error converting attributes to dense storage")
+                } /* end if */
+
+                /* Move the attributes to dense storage together */
+                if(H5A__dense_insert_multi(loc->file, &ainfo, udata.nattrs, udata.attrs) < 0) {
+                    H5MM_xfree(udata.attrs);
+                    HGOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "unable to add to dense storage")
+                } /* end if */
+                udata.attrs = (H5A_t **)H5MM_xfree(udata.attrs);
+
+                /* Remove the attributes from the object header */
+                op.u.lib_op = H5O__attr_to_dense_release_cb;
                 if(H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
                     HGOTO_ERROR(H5E_ATTR, H5E_CANTCONVERT, FAIL, "error converting attributes to dense storage")
             } /* end if */
@@ -172,15 +172,21 @@ H5FL_SEQ_DEFINE(H5O_cont_t);
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5O__cache_get_initial_load_size(void H5_ATTR_UNUSED *_udata, size_t *image_len)
+H5O__cache_get_initial_load_size(void *_udata, size_t *image_len)
 {
+    H5O_cache_ud_t *udata = (H5O_cache_ud_t *)_udata;   /* User data for callback */
+
     FUNC_ENTER_STATIC_NOERR
 
     /* Check arguments */
+    HDassert(udata);
+    HDassert(udata->common.f);
     HDassert(image_len);
 
     /* Set the image length size */
-    *image_len = H5O_SPEC_READ_SIZE;
+    /* (from the file access property list, see H5Pset_ohdr_read_size) */
+    *image_len = H5F_OHDR_READ_SIZE(udata->common.f);
+    HDassert(*image_len >= H5F_OHDR_READ_SIZE_MIN);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5O__cache_get_initial_load_size() */
@@ -1884,6 +1884,10 @@ H5O__dtype_debug(H5F_t *f, const void *mesg, FILE *stream, int indent,
                 s = "disk";
                 break;
 
+            case H5T_LOC_CHUNK:
+                s = "chunk";
+                break;
+
             case H5T_LOC_BADLOC:
             case H5T_LOC_MAXLOC:
             default:
@@ -57,8 +57,6 @@
 /* User data for recursive traversal over objects from a group */
 typedef struct {
     hid_t       obj_id;         /* The ID for the starting group */
-    H5G_loc_t	*start_loc;     /* Location of starting group */
-    H5SL_t     *visited;        /* Skip list for tracking visited nodes */
     H5O_iterate_t op;           /* Application callback */
     void       *op_data;        /* Application's op data */
     unsigned    fields;         /* Selection of object info */
@@ -75,12 +73,13 @@ typedef struct {
 /********************/
 
 static herr_t H5O__delete_oh(H5F_t *f, H5O_t *oh);
+static herr_t H5O__prefetch_chunks(H5F_t *f, const H5O_cont_msgs_t *cont_msg_info,
+    size_t start);
+static int H5O__prefetch_cmp(const void *_addr1, const void *_addr2);
 static herr_t H5O__obj_type_real(const H5O_t *oh, H5O_type_t *obj_type);
 static herr_t H5O__get_hdr_info_real(const H5O_t *oh, H5O_hdr_info_t *hdr);
-static herr_t H5O__free_visit_visited(void *item, void *key,
-    void *operator_data/*in,out*/);
-static herr_t H5O__visit_cb(hid_t group, const char *name, const H5L_info_t *linfo,
-    void *_udata);
+static herr_t H5O__visit_cb(const char *name, const H5O_loc_t *obj_oloc,
+    H5O_type_t obj_type, unsigned rc, void *_udata);
 static const H5O_obj_class_t *H5O__obj_class_real(const H5O_t *oh);
 
 /*********************/
@@ -158,10 +157,6 @@ H5FL_SEQ_EXTERN(H5O_cont_t);
 /* Declare external the free list for time_t's */
 H5FL_EXTERN(time_t);
 
-/* Declare external the free list for H5_obj_t's */
-H5FL_EXTERN(H5_obj_t);
-
-
 /*******************/
 /* Local Variables */
 /*******************/
@@ -1091,6 +1086,10 @@ H5O_protect(const H5O_loc_t *loc, unsigned prot_flags, hbool_t pin_all_chunks)
             size_t chkcnt = oh->nchunks;      /* Count of chunks (for sanity checking) */
 #endif /* NDEBUG */
 
+            /* Read the chunk along with any following chunks nearby */
+            if(H5O__prefetch_chunks(loc->file, &cont_msg_info, curr_msg) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_READERROR, NULL, "unable to prefetch object header chunks")
+
             /* Bring the chunk into the cache */
             /* (which adds to the object header) */
             chk_udata.common.addr = cont_msg_info.msgs[curr_msg].addr;
@@ -1184,6 +1183,203 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__prefetch_chunks
+ *
+ * Purpose:	Read the object header continuation chunk at index 'start'
+ *              in the list of continuation messages found so far together
+ *              with the other chunks that follow it closely in the file,
+ *              with one I/O operation.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__prefetch_chunks(H5F_t *f, const H5O_cont_msgs_t *cont_msg_info, size_t start)
+{
+    haddr_t addr;                       /* Address of the range to read */
+    haddr_t end;                        /* End of the range to read */
+    size_t nchunks = 1;                 /* # of chunks in the range */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(cont_msg_info);
+    HDassert(start < cont_msg_info->nmsgs);
+
+    /* Gather the chunks after this one that are close enough */
+    addr = cont_msg_info->msgs[start].addr;
+    end = addr + cont_msg_info->msgs[start].size;
+    for(u = start + 1; u < cont_msg_info->nmsgs; u++) {
+        haddr_t chk_addr = cont_msg_info->msgs[u].addr;
+        haddr_t chk_end = chk_addr + cont_msg_info->msgs[u].size;
+
+        if(H5F_addr_lt(chk_addr, addr) || H5F_addr_gt(chk_addr, end + H5O_PREFETCH_MAX_GAP)
+                || (chk_end - addr) > H5O_PREFETCH_MAX_SIZE)
+            continue;
+        end = MAX(end, chk_end);
+        nchunks++;
+    } /* end for */
+
+    /* Read the chunks, if there's more than one */
+    if(nchunks > 1)
+        if(H5F_block_prefetch(f, H5FD_MEM_OHDR, addr, (size_t)(end - addr)) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_READERROR, FAIL, "unable to prefetch object header chunks")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__prefetch_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__prefetch_cmp
+ *
+ * Purpose:	Callback routine for sorting object header addresses.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first address is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5O__prefetch_cmp(const void *_addr1, const void *_addr2)
+{
+    haddr_t addr1 = *(const haddr_t *)_addr1;
+    haddr_t addr2 = *(const haddr_t *)_addr2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(addr1, addr2))
+} /* end H5O__prefetch_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O_prefetch
+ *
+ * Purpose:	Load a batch of object headers into the metadata cache, in
+ *              address order.  Runs of headers that are close to each
+ *              other in the file are read with one I/O operation each,
+ *              instead of one or more operations per header.
+ *
+ *              This is a hint for routines that are about to open many
+ *              objects whose addresses are known, e.g. the children of a
+ *              group.  Undefined addresses and headers that are already
+ *              cached are skipped.  A header that can't be loaded is an
+ *              error: the failure must be reported here, since a header
+ *              whose continuation chunks failed to load may be left in
+ *              the cache and appear to be valid when it's used later.
+ *
+ *              The 'addrs' array is sorted in place.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_prefetch(H5F_t *f, size_t naddrs, haddr_t *addrs)
+{
+    haddr_t eoa;                        /* End of the file's address space */
+    size_t read_size;                   /* Size of the speculative read of a header */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(addrs || naddrs == 0);
+
+    /* Nothing to gain unless there are several headers that can be read
+     *  through the metadata accumulator (see H5F_block_prefetch)
+     */
+    if(naddrs < 2 || !H5F_HAS_FEATURE(f, H5FD_FEAT_ACCUMULATE_METADATA)
+            || H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) || (H5F_INTENT(f) & H5F_ACC_SWMR_READ))
+        HGOTO_DONE(SUCCEED)
+
+    /* Get the size of the file & of each header's first read */
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, H5FD_MEM_OHDR)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to determine file size")
+    read_size = H5F_OHDR_READ_SIZE(f);
+
+    /* Sort the addresses (undefined addresses sort last, and are skipped
+     *  along with any other addresses past the end of the file)
+     */
+    HDqsort(addrs, naddrs, sizeof(haddr_t), H5O__prefetch_cmp);
+
+    u = 0;
+    while(u < naddrs && H5F_addr_lt(addrs[u], eoa)) {
+        haddr_t start;                  /* Start of run of headers */
+        haddr_t end;                    /* End of run of headers */
+        size_t nhdrs = 1;               /* # of uncached headers in run */
+        unsigned status = 0;            /* Cache status of header */
+        size_t v;                       /* Local index variable */
+
+        /* Skip headers that are already cached */
+        if(H5AC_get_entry_status(f, addrs[u], &status) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to check status of object header")
+        if(status & H5AC_ES__IN_CACHE) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Find the run of uncached headers that are close to this one */
+        start = addrs[u];
+        end = MIN(start + read_size, eoa);
+        for(v = u + 1; v < naddrs && H5F_addr_lt(addrs[v], eoa); v++) {
+            if(H5F_addr_eq(addrs[v], addrs[v - 1]))
+                continue;
+            if(H5F_addr_gt(addrs[v], end + H5O_PREFETCH_MAX_GAP)
+                    || (MIN(addrs[v] + read_size, eoa) - start) > H5O_PREFETCH_MAX_SIZE)
+                break;
+            if(H5AC_get_entry_status(f, addrs[v], &status) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to check status of object header")
+            if(status & H5AC_ES__IN_CACHE)
+                continue;
+            end = MAX(end, MIN(addrs[v] + read_size, eoa));
+            nhdrs++;
+        } /* end for */
+
+        /* Load the headers, if there's more than one */
+        if(nhdrs > 1) {
+            size_t w;                   /* Local index variable */
+
+            if(H5F_block_prefetch(f, H5FD_MEM_OHDR, start, (size_t)(end - start)) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_READERROR, FAIL, "unable to prefetch object headers")
+
+            for(w = u; w < v; w++) {
+                H5O_loc_t loc;          /* Location of header */
+                H5O_t *oh;              /* Header loaded */
+
+                if(H5AC_get_entry_status(f, addrs[w], &status) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to check status of object header")
+                if(status & H5AC_ES__IN_CACHE)
+                    continue;
+
+                /* Bring the header into the cache */
+                H5O_loc_reset(&loc);
+                loc.file = f;
+                loc.addr = addrs[w];
+                if(NULL == (oh = H5O_protect(&loc, H5AC__READ_ONLY_FLAG, FALSE)))
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+                if(H5O_unprotect(&loc, oh, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+            } /* end for */
+        } /* end if */
+
+        /* Advance to the next run */
+        u = v;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_prefetch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5O_pin
@@ -2597,35 +2793,16 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_get_rc_and_type() */
 
-
-/*-------------------------------------------------------------------------
- * Function:    H5O__free_visit_visited
- *
- * Purpose:     Free the key for an object visited during a group traversal
- *
- * Return:      Non-negative on success, negative on failure
- *
- * Programmer:  Quincey Koziol
- *	        Nov 25, 2007
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5O__free_visit_visited(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *operator_data/*in,out*/)
-{
-    FUNC_ENTER_STATIC_NOERR
-
-    item = H5FL_FREE(H5_obj_t, item);
-
-    FUNC_LEAVE_NOAPI(SUCCEED)
-} /* end H5O__free_visit_visited() */
-
 
 /*-------------------------------------------------------------------------
  * Function:	H5O__visit_cb
  *
  * Purpose:     Callback function for recursively visiting objects from a group
  *
+ *              When only the basic object info is requested, it's filled
+ *              in from what the group traversal already knows about the
+ *              object, without looking at its header again.
+ *
  * Return:	Success:        Non-negative
  *		Failure:	Negative
  *
@@ -2635,80 +2812,39 @@ H5O__free_visit_visited(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSE
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5O__visit_cb(hid_t H5_ATTR_UNUSED group, const char *name, const H5L_info_t *linfo,
-    void *_udata)
+H5O__visit_cb(const char *name, const H5O_loc_t *obj_oloc, H5O_type_t obj_type,
+    unsigned rc, void *_udata)
 {
     H5O_iter_visit_ud_t *udata = (H5O_iter_visit_ud_t *)_udata;     /* User data for callback */
-    H5G_loc_t   obj_loc;                /* Location of object */
-    H5G_name_t  obj_path;            	/* Object's group hier. path */
-    H5O_loc_t   obj_oloc;            	/* Object's object location */
-    hbool_t     obj_found = FALSE;      /* Object at 'name' found */
+    H5O_info_t oinfo;                   /* Object info */
     herr_t ret_value = H5_ITER_CONT;    /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
     HDassert(name);
-    HDassert(linfo);
+    HDassert(obj_oloc);
     HDassert(udata);
 
-    /* Check if this is a hard link */
-    if(linfo->type == H5L_TYPE_HARD) {
-        H5_obj_t obj_pos;       /* Object "position" for this object */
-
-        /* Set up opened group location to fill in */
-        obj_loc.oloc = &obj_oloc;
-        obj_loc.path = &obj_path;
-        H5G_loc_reset(&obj_loc);
-
-        /* Find the object using the LAPL passed in */
-        /* (Correctly handles mounted files) */
-        if(H5G_loc_find(udata->start_loc, name, &obj_loc/*out*/) < 0)
-            HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, H5_ITER_ERROR, "object not found")
-        obj_found = TRUE;
-
-        /* Construct unique "position" for this object */
-        H5F_GET_FILENO(obj_oloc.file, obj_pos.fileno);
-        obj_pos.addr = obj_oloc.addr;
-
-        /* Check if we've seen the object the link references before */
-        if(NULL == H5SL_search(udata->visited, &obj_pos)) {
-            H5O_info_t oinfo;           /* Object info */
-
-            /* Get the object's info */
-            if(H5O_get_info(&obj_oloc, &oinfo, udata->fields) < 0)
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, H5_ITER_ERROR, "unable to get object info")
-
-            /* Make the application callback */
-            ret_value = (udata->op)(udata->obj_id, name, &oinfo, udata->op_data);
-
-            /* Check for continuing to visit objects */
-            if(ret_value == H5_ITER_CONT) {
-                /* If its ref count is > 1, we add it to the list of visited objects */
-                /* (because it could come up again during traversal) */
-                if(oinfo.rc > 1) {
-                    H5_obj_t *new_node;                  /* New object node for visited list */
-
-                    /* Allocate new object "position" node */
-                    if((new_node = H5FL_MALLOC(H5_obj_t)) == NULL)
-                        HGOTO_ERROR(H5E_OHDR, H5E_NOSPACE, H5_ITER_ERROR, "can't allocate object node")
-
-                    /* Set node information */
-                    *new_node = obj_pos;
-
-                    /* Add to list of visited objects */
-                    if(H5SL_insert(udata->visited, new_node, new_node) < 0)
-                        HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, H5_ITER_ERROR, "can't insert object node into visited list")
-                } /* end if */
-            } /* end if */
-        } /* end if */
+    /* Get the object's info */
+    if(udata->fields & ~H5O_INFO_BASIC) {
+        if(H5O_get_info(obj_oloc, &oinfo, udata->fields) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, H5_ITER_ERROR, "unable to get object info")
     } /* end if */
+    else {
+        HDmemset(&oinfo, 0, sizeof(oinfo));
+        if(udata->fields & H5O_INFO_BASIC) {
+            H5F_GET_FILENO(obj_oloc->file, oinfo.fileno);
+            oinfo.addr = obj_oloc->addr;
+            oinfo.type = obj_type;
+            oinfo.rc = rc;
+        } /* end if */
+    } /* end else */
 
-done:
-    /* Release resources */
-    if(obj_found && H5G_loc_free(&obj_loc) < 0)
-        HDONE_ERROR(H5E_OHDR, H5E_CANTRELEASE, H5_ITER_ERROR, "can't free location")
+    /* Make the application callback */
+    ret_value = (udata->op)(udata->obj_id, name, &oinfo, udata->op_data);
 
+done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__visit_cb() */
 
@@ -2802,49 +2938,21 @@ H5O__visit(H5G_loc_t *loc, const char *obj_name, H5_index_t idx_type,
         HGOTO_DONE(ret_value);
 
     /* Check for object being a group */
-    if(oinfo.type == H5O_TYPE_GROUP) {
-        H5G_loc_t	start_loc;          /* Location of starting group */
+    if(opened_type == H5I_GROUP) {
         H5G_loc_t	vis_loc;            /* Location of visited group */
 
-        /* Get the location of the starting group */
-        if(H5G_loc(obj_id, &start_loc) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
-
-        /* Set up user data for visiting links */
+        /* Set up user data for visiting objects */
         udata.obj_id = obj_id;
-        udata.start_loc = &start_loc;
         udata.op = op;
         udata.op_data = op_data;
         udata.fields = fields;
 
-        /* Create skip list to store visited object information */
-        if((udata.visited = H5SL_create(H5SL_TYPE_OBJ, NULL)) == NULL)
-            HGOTO_ERROR(H5E_OHDR, H5E_CANTCREATE, FAIL, "can't create skip list for visited objects")
-
-        /* If its ref count is > 1, we add it to the list of visited objects */
-        /* (because it could come up again during traversal) */
-        if(oinfo.rc > 1) {
-            H5_obj_t *obj_pos;                  /* New object node for visited list */
-
-            /* Allocate new object "position" node */
-            if((obj_pos = H5FL_MALLOC(H5_obj_t)) == NULL)
-                HGOTO_ERROR(H5E_OHDR, H5E_NOSPACE, FAIL, "can't allocate object node")
-
-            /* Construct unique "position" for this object */
-            obj_pos->fileno = oinfo.fileno;
-            obj_pos->addr = oinfo.addr;
-
-            /* Add to list of visited objects */
-            if(H5SL_insert(udata.visited, obj_pos, obj_pos) < 0)
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, FAIL, "can't insert object node into visited list")
-        }
-
         /* Get the location of the visited group */
         if(H5G_loc(obj_id, &vis_loc) < 0)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
 
         /* Call internal group visitation routine */
-        if((ret_value = H5G_visit(&vis_loc, ".", idx_type, order, H5O__visit_cb, &udata)) < 0)
+        if((ret_value = H5G_visit_objs(&vis_loc, ".", idx_type, order, H5O__visit_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_OHDR, H5E_BADITER, FAIL, "object visitation failed")
     } /* end if */
 
@@ -2857,9 +2965,6 @@ done:
     else if(loc_found && H5G_loc_free(&obj_loc) < 0)
         HDONE_ERROR(H5E_OHDR, H5E_CANTRELEASE, FAIL, "can't free location")
 
-    if(udata.visited)
-        H5SL_destroy(udata.visited, H5O__free_visit_visited, NULL);
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__visit() */
 
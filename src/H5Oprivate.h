@@ -887,6 +887,7 @@ H5_DLL H5O_t *H5O_pin(const H5O_loc_t *loc);
 H5_DLL herr_t H5O_unpin(H5O_t *oh);
 H5_DLL herr_t H5O_dec_rc_by_loc(const H5O_loc_t *loc);
 H5_DLL herr_t H5O_unprotect(const H5O_loc_t *loc, H5O_t *oh, unsigned oh_flags);
+H5_DLL herr_t H5O_prefetch(H5F_t *f, size_t naddrs, haddr_t *addrs);
 H5_DLL herr_t H5O_touch(const H5O_loc_t *loc, hbool_t force);
 H5_DLL herr_t H5O_touch_oh(H5F_t *f, H5O_t *oh, hbool_t force);
 #ifdef H5O_ENABLE_BOGUS
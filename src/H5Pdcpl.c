@@ -3111,6 +3111,53 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_nbit() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_vlen_pack
+ *
+ * Purpose:     Sets the VL pack filter for a dataset creation property
+ *              list, so that the variable-length data of the dataset's
+ *              elements is stored inside its chunks instead of in the
+ *              file's global heap.  The filter must be the first filter
+ *              in the pipeline, so any other filters (e.g. deflate) are
+ *              applied to the packed VL data too.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_vlen_pack(hid_t plist_id)
+{
+    H5O_pline_t         pline;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value=SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Check arguments */
+    if(TRUE != H5P_isa_class(plist_id, H5P_DATASET_CREATE))
+        HGOTO_ERROR (H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list")
+
+    /* Get the plist structure */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Add the VL pack filter */
+    if(H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if(pline.nused > 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "VL pack filter must be the first filter in the pipeline")
+    if(H5Z_append(&pline, H5Z_FILTER_VLEN_PACK, H5Z_FLAG_MANDATORY, (size_t)0, NULL) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to add VL pack filter to pipeline")
+    if(H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_vlen_pack() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_scaleoffset
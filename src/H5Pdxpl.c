@@ -152,6 +152,15 @@
 #define H5D_XFER_XFORM_COPY         H5P__dxfr_xform_copy
 #define H5D_XFER_XFORM_CMP          H5P__dxfr_xform_cmp
 #define H5D_XFER_XFORM_CLOSE        H5P__dxfr_xform_close
+/* Definitions for selection I/O plan property */
+#define H5D_XFER_IO_PLAN_SIZE       sizeof(H5D_io_plan_t *)
+#define H5D_XFER_IO_PLAN_DEF        NULL
+#define H5D_XFER_IO_PLAN_SET        H5P__dxfr_io_plan_set
+#define H5D_XFER_IO_PLAN_GET        H5P__dxfr_io_plan_get
+#define H5D_XFER_IO_PLAN_DEL        H5P__dxfr_io_plan_del
+#define H5D_XFER_IO_PLAN_COPY       H5P__dxfr_io_plan_copy
+#define H5D_XFER_IO_PLAN_CMP        H5P__dxfr_io_plan_cmp
+#define H5D_XFER_IO_PLAN_CLOSE      H5P__dxfr_io_plan_close
 
 
 /******************/
@@ -192,6 +201,12 @@ static herr_t H5P__dxfr_xform_del(hid_t prop_id, const char* name, size_t size,
 static herr_t H5P__dxfr_xform_copy(const char* name, size_t size, void* value);
 static int H5P__dxfr_xform_cmp(const void *value1, const void *value2, size_t size);
 static herr_t H5P__dxfr_xform_close(const char* name, size_t size, void* value);
+static herr_t H5P__dxfr_io_plan_set(hid_t prop_id, const char* name, size_t size, void* value);
+static herr_t H5P__dxfr_io_plan_get(hid_t prop_id, const char* name, size_t size, void* value);
+static herr_t H5P__dxfr_io_plan_del(hid_t prop_id, const char* name, size_t size, void* value);
+static herr_t H5P__dxfr_io_plan_copy(const char* name, size_t size, void* value);
+static int H5P__dxfr_io_plan_cmp(const void *value1, const void *value2, size_t size);
+static herr_t H5P__dxfr_io_plan_close(const char* name, size_t size, void* value);
 
 
 /*********************/
@@ -250,6 +265,7 @@ static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;            /* De
 static const H5Z_cb_t H5D_def_filter_cb_g = H5D_XFER_FILTER_CB_DEF;        /* Default value for filter callback */
 static const H5T_conv_cb_t H5D_def_conv_cb_g = H5D_XFER_CONV_CB_DEF;       /* Default value for datatype conversion callback */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF;          /* Default value for data transform */
+static const void *H5D_def_io_plan_g = H5D_XFER_IO_PLAN_DEF;           /* Default value for selection I/O plan */
 
 
 /*-------------------------------------------------------------------------
@@ -400,6 +416,13 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             H5D_XFER_XFORM_DEL, H5D_XFER_XFORM_COPY, H5D_XFER_XFORM_CMP, H5D_XFER_XFORM_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the selection I/O plan property */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P__register_real(pclass, H5D_XFER_IO_PLAN_NAME, H5D_XFER_IO_PLAN_SIZE, &H5D_def_io_plan_g,
+            NULL, H5D_XFER_IO_PLAN_SET, H5D_XFER_IO_PLAN_GET, NULL, NULL,
+            H5D_XFER_IO_PLAN_DEL, H5D_XFER_IO_PLAN_COPY, H5D_XFER_IO_PLAN_CMP, H5D_XFER_IO_PLAN_CLOSE) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
@@ -910,6 +933,179 @@ done:
 } /* end H5P__dxfr_xform_close() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_io_plan_set
+ *
+ * Purpose:     Shares a selection I/O plan when it's set for a property list
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dxfr_io_plan_set(hid_t H5_ATTR_UNUSED prop_id, const char H5_ATTR_UNUSED *name,
+    size_t H5_ATTR_UNUSED size, void *value)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(value);
+
+    /* Share the plan */
+    if(*(H5D_io_plan_t **)value)
+        *(H5D_io_plan_t **)value = H5D_io_plan_copy(*(H5D_io_plan_t **)value);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dxfr_io_plan_set() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_io_plan_get
+ *
+ * Purpose:     Shares a selection I/O plan when it's retrieved from a property list
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dxfr_io_plan_get(hid_t H5_ATTR_UNUSED prop_id, const char H5_ATTR_UNUSED *name,
+    size_t H5_ATTR_UNUSED size, void *value)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(value);
+
+    /* Share the plan */
+    if(*(H5D_io_plan_t **)value)
+        *(H5D_io_plan_t **)value = H5D_io_plan_copy(*(H5D_io_plan_t **)value);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dxfr_io_plan_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_io_plan_del
+ *
+ * Purpose:     Releases a selection I/O plan when the property is deleted
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dxfr_io_plan_del(hid_t H5_ATTR_UNUSED prop_id, const char H5_ATTR_UNUSED *name,
+    size_t H5_ATTR_UNUSED size, void *value)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(value);
+
+    if(*(H5D_io_plan_t **)value && H5D_io_plan_close(*(H5D_io_plan_t **)value) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTRELEASE, FAIL, "unable to release I/O plan")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5P__dxfr_io_plan_del() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_io_plan_copy
+ *
+ * Purpose:     Shares a selection I/O plan when a property list is copied
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dxfr_io_plan_copy(const char H5_ATTR_UNUSED *name, size_t H5_ATTR_UNUSED size,
+    void *value)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(value);
+
+    /* Share the plan */
+    if(*(H5D_io_plan_t **)value)
+        *(H5D_io_plan_t **)value = H5D_io_plan_copy(*(H5D_io_plan_t **)value);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dxfr_io_plan_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_io_plan_cmp
+ *
+ * Purpose:     Compare two selection I/O plans.  Plans are shared, not
+ *              copied, so they are only equal when they are the same plan.
+ *
+ * Return:      positive if VALUE1 is greater than VALUE2, negative if
+ *              VALUE2 is greater than VALUE1 and zero if VALUE1 and
+ *              VALUE2 are equal.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5P__dxfr_io_plan_cmp(const void *_plan1, const void *_plan2, size_t H5_ATTR_UNUSED size)
+{
+    const H5D_io_plan_t * const *plan1 = (const H5D_io_plan_t * const *)_plan1; /* Create local aliases for values */
+    const H5D_io_plan_t * const *plan2 = (const H5D_io_plan_t * const *)_plan2; /* Create local aliases for values */
+    int ret_value = 0;                  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(plan1);
+    HDassert(plan2);
+    HDassert(size == sizeof(H5D_io_plan_t *));
+
+    if(*plan1 < *plan2) HGOTO_DONE(-1);
+    if(*plan1 > *plan2) HGOTO_DONE(1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5P__dxfr_io_plan_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_io_plan_close
+ *
+ * Purpose:     Releases a selection I/O plan when a property list is closed
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dxfr_io_plan_close(const char H5_ATTR_UNUSED *name, size_t H5_ATTR_UNUSED size,
+    void *value)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(value);
+
+    if(*(H5D_io_plan_t **)value && H5D_io_plan_close(*(H5D_io_plan_t **)value) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTRELEASE, FAIL, "unable to release I/O plan")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5P__dxfr_io_plan_close() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_data_transform
  *
@@ -1028,6 +1224,74 @@ done:
 } /* end H5Pget_data_transform() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_dataset_io_plan
+ *
+ * Purpose:	Compiles a memory and file selection into an I/O plan that
+ *              is stored in the dataset transfer property list.  Passing
+ *              H5S_PLIST for both dataspace IDs to H5Dread() or H5Dwrite()
+ *              with this property list then uses the plan's selections,
+ *              and reuses the sequence lists generated for them on the
+ *              first transfer instead of regenerating them for each call.
+ *
+ *              The MEM_SPACE_ID can be H5S_ALL, in which case the memory
+ *              selection is the same as the file selection.  Passing
+ *              H5S_ALL for FILE_SPACE_ID removes the plan.
+ *
+ *              The dataspaces are copied, so later changes to them do not
+ *              affect the plan.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_dataset_io_plan(hid_t plist_id, hid_t mem_space_id, hid_t file_space_id)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    const H5S_t *mem_space = NULL;      /* Memory dataspace */
+    const H5S_t *file_space = NULL;     /* File dataspace */
+    H5D_io_plan_t *plan = NULL;         /* New I/O plan */
+    H5D_io_plan_t *old_plan = NULL;     /* Previous I/O plan */
+    herr_t ret_value = SUCCEED;         /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iii", plist_id, mem_space_id, file_space_id);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Check arguments */
+    if(H5S_ALL != mem_space_id && NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "mem_space_id is not a dataspace ID")
+    if(H5S_ALL != file_space_id && NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "file_space_id is not a dataspace ID")
+
+    /* Compile the plan */
+    if(file_space)
+        if(NULL == (plan = H5D_io_plan_create(mem_space, file_space)))
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, FAIL, "unable to create I/O plan")
+
+    /* Release the previous plan, if there is one */
+    if(H5P_peek(plist, H5D_XFER_IO_PLAN_NAME, &old_plan) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get I/O plan")
+    if(old_plan && H5D_io_plan_close(old_plan) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTRELEASE, FAIL, "unable to release I/O plan")
+
+    /* Update property list (takes ownership of plan) */
+    if(H5P_poke(plist, H5D_XFER_IO_PLAN_NAME, &plan) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set I/O plan")
+
+done:
+    if(ret_value < 0)
+        if(plan && H5D_io_plan_close(plan) < 0)
+            HDONE_ERROR(H5E_PLIST, H5E_CANTRELEASE, FAIL, "unable to release I/O plan")
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_dataset_io_plan() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_buffer
  *
@@ -100,6 +100,11 @@
 #define H5F_ACS_SIEVE_BUF_SIZE_DEF              (64*1024)
 #define H5F_ACS_SIEVE_BUF_SIZE_ENC              H5P__encode_size_t
 #define H5F_ACS_SIEVE_BUF_SIZE_DEC              H5P__decode_size_t
+/* Definition for the size of the speculative read of object headers */
+#define H5F_ACS_OHDR_READ_SIZE_SIZE             sizeof(size_t)
+#define H5F_ACS_OHDR_READ_SIZE_DEF              512
+#define H5F_ACS_OHDR_READ_SIZE_ENC              H5P__encode_size_t
+#define H5F_ACS_OHDR_READ_SIZE_DEC              H5P__decode_size_t
 /* Definition for minimum "small data" allocation block size (when
    aggregating "small" raw data allocations. */
 #define H5F_ACS_SDATA_BLOCK_SIZE_SIZE           sizeof(hsize_t)
@@ -215,11 +220,21 @@
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF     FALSE
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_ENC     H5P__encode_hbool_t
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEC     H5P__decode_hbool_t
+/* Definition for 'mdc log style' property */
+#define H5F_ACS_MDC_LOG_STYLE_SIZE              sizeof(H5F_mdc_log_style_t)
+#define H5F_ACS_MDC_LOG_STYLE_DEF               H5F_MDC_LOG_STYLE_JSON
+#define H5F_ACS_MDC_LOG_STYLE_ENC               H5P__facc_mdc_log_style_enc
+#define H5F_ACS_MDC_LOG_STYLE_DEC               H5P__facc_mdc_log_style_dec
 /* Definition for evict on close property */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE                sizeof(hbool_t)
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF                 FALSE
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC                 H5P__encode_hbool_t
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEC                 H5P__decode_hbool_t
+/* Definition for link lookup index property */
+#define H5F_ACS_LINK_LOOKUP_INDEX_SIZE                  sizeof(hbool_t)
+#define H5F_ACS_LINK_LOOKUP_INDEX_DEF                   FALSE
+#define H5F_ACS_LINK_LOOKUP_INDEX_ENC                   H5P__encode_hbool_t
+#define H5F_ACS_LINK_LOOKUP_INDEX_DEC                   H5P__decode_hbool_t
 #ifdef H5_HAVE_PARALLEL
 /* Definition of collective metadata read mode flag */
 #define H5F_ACS_COLL_MD_READ_FLAG_SIZE   sizeof(H5P_coll_md_read_flag_t)
@@ -318,6 +333,8 @@ static herr_t H5P_facc_mdc_log_location_dec(const void **_pp, void *value);
 static herr_t H5P_facc_mdc_log_location_del(hid_t prop_id, const char *name, size_t size, void *value);
 static herr_t H5P_facc_mdc_log_location_copy(const char *name, size_t size, void *value);
 static int    H5P_facc_mdc_log_location_cmp(const void *value1, const void *value2, size_t size);
+static herr_t H5P__facc_mdc_log_style_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__facc_mdc_log_style_dec(const void **_pp, void *value);
 static herr_t H5P_facc_mdc_log_location_close(const char *name, size_t size, void *value);
 
 /* Metadata cache image property callbacks */
@@ -377,6 +394,7 @@ static const hsize_t H5F_def_threshold_g = H5F_ACS_ALIGN_THRHD_DEF;
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF;                      /* Default allocation alignment value */
 static const hsize_t H5F_def_meta_block_size_g = H5F_ACS_META_BLOCK_SIZE_DEF;      /* Default metadata allocation block size */
 static const size_t H5F_def_sieve_buf_size_g = H5F_ACS_SIEVE_BUF_SIZE_DEF;         /* Default raw data I/O sieve buffer size */
+static const size_t H5F_def_ohdr_read_size_g = H5F_ACS_OHDR_READ_SIZE_DEF;         /* Default object header speculative read size */
 static const hsize_t H5F_def_sdata_block_size_g = H5F_ACS_SDATA_BLOCK_SIZE_DEF;    /* Default small data allocation block size */
 static const unsigned H5F_def_gc_ref_g = H5F_ACS_GARBG_COLCT_REF_DEF;              /* Default garbage collection for references setting */
 static const H5F_close_degree_t H5F_def_close_degree_g = H5F_CLOSE_DEGREE_DEF;     /* Default file close degree */
@@ -400,7 +418,9 @@ static const hbool_t H5F_def_null_fsm_addr_g = H5F_ACS_NULL_FSM_ADDR_DEF;      /
 static const hbool_t H5F_def_use_mdc_logging_g = H5F_ACS_USE_MDC_LOGGING_DEF;                 /* Default metadata cache logging flag */
 static const char *H5F_def_mdc_log_location_g = H5F_ACS_MDC_LOG_LOCATION_DEF;                 /* Default mdc log location */
 static const hbool_t H5F_def_start_mdc_log_on_access_g = H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF; /* Default mdc log start on access flag */
+static const H5F_mdc_log_style_t H5F_def_mdc_log_style_g = H5F_ACS_MDC_LOG_STYLE_DEF;       /* Default mdc log format */
 static const hbool_t H5F_def_evict_on_close_flag_g = H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF;         /* Default setting for evict on close property */
+static const hbool_t H5F_def_link_lookup_index_g = H5F_ACS_LINK_LOOKUP_INDEX_DEF;            /* Default setting for link lookup index property */
 #ifdef H5_HAVE_PARALLEL
 static const H5P_coll_md_read_flag_t H5F_def_coll_md_read_flag_g = H5F_ACS_COLL_MD_READ_FLAG_DEF;  /* Default setting for the collective metedata read flag */
 static const hbool_t H5F_def_coll_md_write_flag_g = H5F_ACS_COLL_MD_WRITE_FLAG_DEF;  /* Default setting for the collective metedata write flag */
@@ -479,6 +499,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the object header speculative read size */
+    if(H5P__register_real(pclass, H5F_ACS_OHDR_READ_SIZE_NAME, H5F_ACS_OHDR_READ_SIZE_SIZE, &H5F_def_ohdr_read_size_g,
+            NULL, NULL, NULL, H5F_ACS_OHDR_READ_SIZE_ENC, H5F_ACS_OHDR_READ_SIZE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the minimum "small data" allocation block size */
     if(H5P__register_real(pclass, H5F_ACS_SDATA_BLOCK_SIZE_NAME, H5F_ACS_SDATA_BLOCK_SIZE_SIZE, &H5F_def_sdata_block_size_g,
             NULL, NULL, NULL, H5F_ACS_SDATA_BLOCK_SIZE_ENC, H5F_ACS_SDATA_BLOCK_SIZE_DEC,
@@ -603,12 +629,23 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, H5F_ACS_START_MDC_LOG_ON_ACCESS_ENC, H5F_ACS_START_MDC_LOG_ON_ACCESS_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the format of the metadata cache log. */
+    if(H5P__register_real(pclass, H5F_ACS_MDC_LOG_STYLE_NAME, H5F_ACS_MDC_LOG_STYLE_SIZE, &H5F_def_mdc_log_style_g,
+            NULL, NULL, NULL, H5F_ACS_MDC_LOG_STYLE_ENC, H5F_ACS_MDC_LOG_STYLE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the evict on close flag */
     if(H5P__register_real(pclass, H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME, H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE, &H5F_def_evict_on_close_flag_g,
             NULL, NULL, NULL, H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC, H5F_ACS_EVICT_ON_CLOSE_FLAG_DEC,
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the link lookup index flag */
+    if(H5P__register_real(pclass, H5F_ACS_LINK_LOOKUP_INDEX_NAME, H5F_ACS_LINK_LOOKUP_INDEX_SIZE, &H5F_def_link_lookup_index_g,
+            NULL, NULL, NULL, H5F_ACS_LINK_LOOKUP_INDEX_ENC, H5F_ACS_LINK_LOOKUP_INDEX_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 #ifdef H5_HAVE_PARALLEL
     /* Register the metadata collective read flag */
     if(H5P__register_real(pclass, H5_COLL_MD_READ_FLAG_NAME, H5F_ACS_COLL_MD_READ_FLAG_SIZE, &H5F_def_coll_md_read_flag_g,
@@ -1671,12 +1708,22 @@ H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr)
 
     /* set the modified metadata cache image config */
 
-    /* If we ever support multiple versions of H5AC_cache_image_config_t, we
-     * will have to test the version and do translation here.
+    /* Translate older versions of H5AC_cache_image_config_t to the current
+     * version, field by field, as they are shorter than the current one.
      */
+    if(config_ptr->version == H5AC__CACHE_IMAGE_CONFIG_VERSION_1) {
+        H5AC_cache_image_config_t curr_config = H5AC__DEFAULT_CACHE_IMAGE_CONFIG;
+
+        curr_config.generate_image = config_ptr->generate_image;
+        curr_config.save_resize_status = config_ptr->save_resize_status;
+        curr_config.entry_ageout = config_ptr->entry_ageout;
 
-    if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, config_ptr) < 0)
-        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image initial config")
+        if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, &curr_config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image initial config")
+    } /* end if */
+    else
+        if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, config_ptr) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image initial config")
 
 done:
     FUNC_LEAVE_API(ret_value)
@@ -1717,17 +1764,26 @@ H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr)
     if(config_ptr == NULL)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL config_ptr on entry.")
 
-    if(config_ptr->version != H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION)
+    if(config_ptr->version != H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION
+            && config_ptr->version != H5AC__CACHE_IMAGE_CONFIG_VERSION_1)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unknown image config version.")
 
-    /* If we ever support multiple versions of H5AC_cache_config_t, we
-     * will have to get the canonical version here, and then translate
-     * to the version of the structure supplied.
+    /* Get the current initial metadata cache resize configuration, and
+     * translate it to the version of the structure supplied.
      */
+    if(config_ptr->version == H5AC__CACHE_IMAGE_CONFIG_VERSION_1) {
+        H5AC_cache_image_config_t curr_config;
 
-    /* Get the current initial metadata cache resize configuration */
-    if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, config_ptr) < 0)
-        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get metadata cache initial image config")
+        if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, &curr_config) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get metadata cache initial image config")
+
+        config_ptr->generate_image = curr_config.generate_image;
+        config_ptr->save_resize_status = curr_config.save_resize_status;
+        config_ptr->entry_ageout = curr_config.entry_ageout;
+    } /* end if */
+    else
+        if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, config_ptr) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get metadata cache initial image config")
 
 done:
     FUNC_LEAVE_API(ret_value)
@@ -2184,6 +2240,85 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_sieve_buf_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_ohdr_read_size
+ *
+ * Purpose:     Sets the number of bytes read from the file when an object
+ *              header is first loaded.  Object headers whose first chunk
+ *              fits in this many bytes are read with one I/O operation;
+ *              larger ones need a second read for the rest of their first
+ *              chunk.
+ *
+ *              The default value is 512 bytes, which holds the default
+ *              object headers of all the object types.  Files with many
+ *              attributes stored in their objects' headers may benefit
+ *              from a larger value.  The value must be at least 64
+ *              bytes, so that the object header's prefix can be decoded
+ *              from the first read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_ohdr_read_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, size);
+
+    /* Check args */
+    if(size < H5F_OHDR_READ_SIZE_MIN)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object header read size too small")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_OHDR_READ_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object header read size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_ohdr_read_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_ohdr_read_size
+ *
+ * Purpose:     Returns the number of bytes read from the file when an
+ *              object header is first loaded.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_ohdr_read_size(hid_t plist_id, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(size)
+        if(H5P_get(plist, H5F_ACS_OHDR_READ_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get object header read size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_ohdr_read_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_small_data_block_size
@@ -3006,6 +3141,9 @@ H5P__facc_cache_image_config_cmp(const void *_config1, const void *_config2, siz
     if(config1->entry_ageout < config2->entry_ageout) HGOTO_DONE(-1);
     if(config1->entry_ageout > config2->entry_ageout) HGOTO_DONE(1);
 
+    if(config1->incremental < config2->incremental) HGOTO_DONE(-1);
+    if(config1->incremental > config2->incremental) HGOTO_DONE(1);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_image_config_cmp() */
@@ -3048,10 +3186,12 @@ H5P__facc_cache_image_config_enc(const void *value, void **_pp, size_t *size)
         H5_ENCODE_UNSIGNED(*pp, config->save_resize_status);
 
         INT32ENCODE(*pp, (int32_t)config->entry_ageout);
+
+        H5_ENCODE_UNSIGNED(*pp, config->incremental);
     } /* end if */
 
     /* Compute encoded size of fixed-size values */
-    *size += (1 + (2 * sizeof(unsigned)) + (2 * sizeof(int32_t)));
+    *size += (1 + (3 * sizeof(unsigned)) + (2 * sizeof(int32_t)));
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_cache_image_config_enc() */
@@ -3104,6 +3244,11 @@ H5P__facc_cache_image_config_dec(const void **_pp, void *_value)
 
     INT32DECODE(*pp, config->entry_ageout);
 
+    /* Version 1 configurations were encoded without the incremental field */
+    if(config->version != H5AC__CACHE_IMAGE_CONFIG_VERSION_1)
+        H5_DECODE_UNSIGNED(*pp, config->incremental);
+    config->version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_image_config_dec() */
@@ -4209,6 +4354,81 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_mdc_log_options() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_log_style
+ *
+ * Purpose:    Set the format of the metadata cache log.
+ *
+ *             H5F_MDC_LOG_STYLE_JSON (the default) writes one JSON text
+ *             record per cache operation.  H5F_MDC_LOG_STYLE_BINARY
+ *             collects fixed size binary records in memory and writes
+ *             them in batches, which is cheap enough to leave on in
+ *             production.  The h5mdclog tool analyzes binary logs.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_log_style(hid_t plist_id, H5F_mdc_log_style_t style)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFl", plist_id, style);
+
+    /* Check arguments */
+    if(H5P_DEFAULT == plist_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't modify default property list")
+    if(style < H5F_MDC_LOG_STYLE_JSON || style >= H5F_MDC_LOG_STYLE_NSTYLES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid mdc log style")
+
+    /* Get the property list structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_MDC_LOG_STYLE_NAME, &style) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set mdc log style")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mdc_log_style() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_log_style
+ *
+ * Purpose:    Get the format of the metadata cache log.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_log_style(hid_t plist_id, H5F_mdc_log_style_t *style/*out*/)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, style);
+
+    /* Get the property list structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Get value */
+    if(style)
+        if(H5P_get(plist, H5F_ACS_MDC_LOG_STYLE_NAME, style) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get mdc log style")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mdc_log_style() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P_facc_mdc_log_location_enc
@@ -4416,6 +4636,73 @@ H5P_facc_mdc_log_location_close(const char H5_ATTR_UNUSED *name, size_t H5_ATTR_
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P_facc_mdc_log_location_close() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_mdc_log_style_enc
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 cache log style property in the file access property
+ *                 list is encoded.
+ *
+ * Return:         Success:     Non-negative
+ *                 Failure:     Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_mdc_log_style_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5F_mdc_log_style_t *style = (const H5F_mdc_log_style_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(style);
+    HDassert(size);
+
+    if(NULL != *pp)
+        /* Encode log style */
+        *(*pp)++ = (uint8_t)*style;
+
+    /* Size of log style */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_mdc_log_style_enc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_mdc_log_style_dec
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 cache log style property in the file access property
+ *                 list is decoded.
+ *
+ * Return:         Success:     Non-negative
+ *                 Failure:     Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_mdc_log_style_dec(const void **_pp, void *_value)
+{
+    H5F_mdc_log_style_t *style = (H5F_mdc_log_style_t *)_value; /* Log style */
+    const uint8_t **pp = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(style);
+
+    /* Decode log style */
+    *style = (H5F_mdc_log_style_t)*(*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_mdc_log_style_dec() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_evict_on_close
@@ -4507,6 +4794,85 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_evict_on_close() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_link_lookup_index
+ *
+ * Purpose:     Sets the link_lookup_index property value.
+ *
+ *              When this property is set, a group that is open and has
+ *              its links looked up by name repeatedly builds an in-memory
+ *              hash index of its links, so later lookups don't search
+ *              the group's B-tree and heap.  The index is discarded
+ *              when the group's links are modified or the group is
+ *              closed.  It uses memory proportional to the number of
+ *              links in the group.
+ *
+ *              The index isn't used for files opened for SWMR reading.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_link_lookup_index(hid_t fapl_id, hbool_t link_lookup_index)
+{
+    H5P_genplist_t *plist;          /* property list pointer */
+    herr_t ret_value = SUCCEED;     /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", fapl_id, link_lookup_index);
+
+    /* Compare the property list's class against the other class */
+    if(TRUE != H5P_isa_class(fapl_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not a file access plist")
+
+    /* Get the plist structure */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_LINK_LOOKUP_INDEX_NAME, &link_lookup_index) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set link lookup index property")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_link_lookup_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_link_lookup_index
+ *
+ * Purpose:     Gets the link_lookup_index property value.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_link_lookup_index(hid_t fapl_id, hbool_t *link_lookup_index)
+{
+    H5P_genplist_t *plist;          /* property list pointer */
+    herr_t ret_value = SUCCEED;     /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", fapl_id, link_lookup_index);
+
+    /* Compare the property list's class against the other class */
+    if(TRUE != H5P_isa_class(fapl_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not an access plist")
+
+    /* Get the plist structure */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(H5P_get(plist, H5F_ACS_LINK_LOOKUP_INDEX_NAME, link_lookup_index) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get link lookup index property")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_link_lookup_index() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
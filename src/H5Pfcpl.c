@@ -111,6 +111,11 @@
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_DEF        H5F_FILE_SPACE_PAGE_SIZE_DEF
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_ENC        H5P__encode_hsize_t
 #define H5F_CRT_FILE_SPACE_PAGE_SIZE_DEC        H5P__decode_hsize_t
+/* Definitions for tracking free space with extent trees */
+#define H5F_CRT_FREE_SPACE_EXTENT_TREE_SIZE     sizeof(hbool_t)
+#define H5F_CRT_FREE_SPACE_EXTENT_TREE_DEF      H5F_FREE_SPACE_EXTENT_TREE_DEF
+#define H5F_CRT_FREE_SPACE_EXTENT_TREE_ENC      H5P__encode_hbool_t
+#define H5F_CRT_FREE_SPACE_EXTENT_TREE_DEC      H5P__decode_hbool_t
 
 
 /******************/
@@ -190,6 +195,7 @@ static const H5F_fspace_strategy_t H5F_def_file_space_strategy_g = H5F_CRT_FILE_
 static const hbool_t H5F_def_free_space_persist_g = H5F_CRT_FREE_SPACE_PERSIST_DEF;
 static const hsize_t H5F_def_free_space_threshold_g = H5F_CRT_FREE_SPACE_THRESHOLD_DEF;
 static const hsize_t H5F_def_file_space_page_size_g = H5F_CRT_FILE_SPACE_PAGE_SIZE_DEF;
+static const hbool_t H5F_def_free_space_extent_tree_g = H5F_CRT_FREE_SPACE_EXTENT_TREE_DEF;
 
 
 
@@ -295,6 +301,12 @@ H5P_fcrt_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the extent tree flag */
+    if(H5P__register_real(pclass, H5F_CRT_FREE_SPACE_EXTENT_TREE_NAME, H5F_CRT_FREE_SPACE_EXTENT_TREE_SIZE, &H5F_def_free_space_extent_tree_g,
+            NULL, NULL, NULL, H5F_CRT_FREE_SPACE_EXTENT_TREE_ENC, H5F_CRT_FREE_SPACE_EXTENT_TREE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P_fcrt_reg_prop() */
@@ -1517,3 +1529,76 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_file_space_page_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_file_space_extent_tree
+ *
+ * Purpose:     Sets whether the free space in a file is tracked with an
+ *              address-ordered and a size-ordered tree of free extents,
+ *              instead of with free-space managers.  Freed space is merged
+ *              with its neighbors immediately and allocations take the
+ *              smallest free extent that fits.
+ *
+ *              Only the non-persistent H5F_FSPACE_STRATEGY_FSM_AGGR
+ *              strategy can use extent trees.  The setting is not stored
+ *              in the file, and the free space is dropped when the file
+ *              is closed, as with non-persistent free-space managers.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_file_space_extent_tree(hid_t plist_id, hbool_t use_tree)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, use_tree);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set the value */
+    if(H5P_set(plist, H5F_CRT_FREE_SPACE_EXTENT_TREE_NAME, &use_tree) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set extent tree flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_file_space_extent_tree() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_file_space_extent_tree
+ *
+ * Purpose:     Retrieves whether the free space in a file is tracked with
+ *              extent trees in the parameter "use_tree".
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_file_space_extent_tree(hid_t plist_id, hbool_t *use_tree)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", plist_id, use_tree);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(use_tree)
+        if(H5P_get(plist, H5F_CRT_FREE_SPACE_EXTENT_TREE_NAME, use_tree) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get extent tree flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_file_space_extent_tree() */
+
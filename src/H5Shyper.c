@@ -56,6 +56,8 @@ static herr_t H5S__hyper_clip_spans(H5S_hyper_span_info_t *a_spans,
     H5S_hyper_span_info_t **a_and_b, H5S_hyper_span_info_t **b_not_a);
 static herr_t H5S__hyper_merge_spans(H5S_t *space,
     H5S_hyper_span_info_t *new_spans, hbool_t can_own);
+static htri_t H5S__hyper_append_disjoint_spans(H5S_t *space,
+    H5S_hyper_span_info_t *new_spans);
 static hsize_t H5S__hyper_spans_nelem(const H5S_hyper_span_info_t *spans);
 static H5S_hyper_span_info_t *H5S__hyper_make_spans(unsigned rank,
     const hsize_t *start, const hsize_t *stride, const hsize_t *count,
@@ -1371,6 +1373,9 @@ H5S__hyper_copy_span_helper(H5S_hyper_span_info_t *spans)
             /* Advance to next span */
             span = span->next;
         } /* end while */
+
+        /* Retain a pointer to the last span in the list */
+        ret_value->tail = prev_span;
     } /* end else */
 
 done:
@@ -3483,6 +3488,9 @@ H5S__hyper_coord_to_span(unsigned rank, const hsize_t *coords)
         /* Build span tree for coordinates below this one */
         if(NULL == (down->head = H5S__hyper_coord_to_span(rank - 1, &coords[1])))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate hyperslab span")
+
+        /* Only one span in the list */
+        down->tail = down->head;
     } /* end if */
 
     /* Build span for this coordinate */
@@ -3625,6 +3633,7 @@ H5S__hyper_add_span_element_helper(H5S_hyper_span_info_t *span_tree,
         /* Make scratch pointer point to last span in list */
         HDassert(tspan_info);
         tspan_info->scratch=(H5S_hyper_span_info_t *)new_span;
+        tspan_info->tail=new_span;
 
         /* Set the proper 'pstride' for new span */
         new_span->pstride=new_span->low-tmp_span->low;
@@ -3661,6 +3670,7 @@ H5S__hyper_add_span_element_helper(H5S_hyper_span_info_t *span_tree,
                             /* Update pointers */
                             tmp2_span->next=NULL;
                             prev_span_info->scratch=(H5S_hyper_span_info_t *)tmp2_span;
+                            prev_span_info->tail=tmp2_span;
                         } /* end if */
                         /* Span is disjoint, but has the same "down tree" selection */
                         else {
@@ -3693,6 +3703,7 @@ H5S__hyper_add_span_element_helper(H5S_hyper_span_info_t *span_tree,
 
             /* Make scratch pointer point to last span in list */
             tspan_info->scratch=(H5S_hyper_span_info_t *)new_span;
+            tspan_info->tail=new_span;
 
             /* Set the proper 'pstride' for new span */
             new_span->pstride = new_span->low - tmp_span->low;
@@ -3749,6 +3760,7 @@ H5S_hyper_add_span_element(H5S_t *space, unsigned rank, const hsize_t *coords)
         /* Build span tree for this coordinate */
         if(NULL == (head->head = H5S__hyper_coord_to_span(rank, coords)))
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab spans for coordinate")
+        head->tail = head->head;
 
         /* Allocate selection info */
         if(NULL == (space->select.sel_info.hslab = H5FL_MALLOC(H5S_hyper_sel_t)))
@@ -4405,6 +4417,7 @@ H5S__hyper_project_simple_higher(const H5S_t *base_space, H5S_t *new_space)
         /* Set the span_info information */
         new_span_info->count = 1;
         new_span_info->head = new_span;
+        new_span_info->tail = new_span;
 
         /* Attach to new space, if top span info */
         if(NULL == new_space->select.sel_info.hslab->span_lst)
@@ -4866,6 +4879,7 @@ H5S__hyper_append_span(H5S_hyper_span_t **prev_span,
         /* Set the span tree's basic information */
         (*span_tree)->count = 1;
         (*span_tree)->head = new_span;
+        (*span_tree)->tail = new_span;
 
         /* Update previous merged span */
         *prev_span = new_span;
@@ -4905,6 +4919,7 @@ H5S__hyper_append_span(H5S_hyper_span_t **prev_span,
             /* Append to end of merged spans list */
             (*prev_span)->next = new_span;
             *prev_span = new_span;
+            (*span_tree)->tail = new_span;
         } /* end else */
     } /* end else */
 
@@ -5796,6 +5811,108 @@ H5S__hyper_merge_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans, hbool_t c
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__hyper_merge_spans() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_append_disjoint_spans
+ PURPOSE
+    Append new hyperslab spans which follow the existing hyperslab selection
+ USAGE
+    htri_t H5S__hyper_append_disjoint_spans(space, new_spans)
+        H5S_t *space;             IN: Dataspace to add new spans to hyperslab
+                                        selection.
+        H5S_hyper_span_info_t *new_spans;   IN: Span tree of new spans to add
+                                            to hyperslab selection
+ RETURNS
+    TRUE if the new spans were appended (and are now owned by the selection),
+    FALSE if they could not be appended, negative on failure
+ DESCRIPTION
+    Fast path for "OR"ing a hyperslab onto an existing hyperslab selection,
+    when the new spans begin after the last span of the current selection in
+    the slowest changing dimension.  In that case the new spans can't overlap
+    the existing ones, so they are linked directly onto the end of the
+    selection's span list instead of clipping and merging the entire span
+    tree.  The first new span is merged into the current last span when they
+    are adjacent and select the same elements in the lower dimensions, and
+    the new spans share the last span's "down tree" when they are equal, to
+    keep the span tree in the same form that merging would produce.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The span info node for 'new_spans' is released when the spans are
+    appended.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static htri_t
+H5S__hyper_append_disjoint_spans(H5S_t *space, H5S_hyper_span_info_t *new_spans)
+{
+    H5S_hyper_span_info_t *span_lst;    /* Current span tree for selection */
+    H5S_hyper_span_t *tail;             /* Last span in current selection */
+    H5S_hyper_span_t *span;             /* Current new span */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(space);
+    HDassert(new_spans);
+    HDassert(new_spans->head);
+    HDassert(new_spans->count == 1);
+
+    /* Check for span tree which can be appended to directly */
+    span_lst = space->select.sel_info.hslab->span_lst;
+    if(NULL == span_lst || span_lst->count > 1 || NULL == span_lst->head)
+        HGOTO_DONE(FALSE)
+    tail = span_lst->tail;
+    HDassert(tail);
+    HDassert(NULL == tail->next);
+    if(new_spans->head->low <= tail->high)
+        HGOTO_DONE(FALSE)
+
+    /* Share the last span's "down tree", if the new spans select the same
+     *  elements in the lower dimensions.  (All the new spans generated for
+     *  a hyperslab share the same "down tree")
+     */
+    if(tail->down && tail->down != new_spans->head->down
+            && H5S__hyper_cmp_spans(tail->down, new_spans->head->down)) {
+        for(span = new_spans->head; span; span = span->next)
+            if(span->down != tail->down) {
+                if(H5S__hyper_free_span_info(span->down) < 0)
+                    HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to release hyperslab span tree")
+                span->down = tail->down;
+                span->down->count++;
+            } /* end if */
+    } /* end if */
+
+    /* Check if the first new span just extends the last span */
+    span = new_spans->head;
+    if((tail->high + 1) == span->low && tail->down == span->down) {
+        H5S_hyper_span_t *next_span = span->next;
+
+        /* Extend the last span to include the new span's elements */
+        tail->high = span->high;
+        tail->nelem += span->nelem;
+
+        /* Release the merged span */
+        if(H5S__hyper_free_span(span) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to release hyperslab span")
+        span = new_spans->head = next_span;
+    } /* end if */
+
+    /* Link any remaining new spans onto the end of the current list */
+    if(span) {
+        span->pstride = span->low - tail->low;
+        tail->next = span;
+        span_lst->tail = new_spans->tail;
+    } /* end if */
+
+    /* Release the (now empty) span info node for the new spans */
+    new_spans = H5FL_FREE(H5S_hyper_span_info_t, new_spans);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_append_disjoint_spans() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -5941,6 +6058,9 @@ H5S__hyper_make_spans(unsigned rank, const hsize_t *start, const hsize_t *stride
         /* Keep the pointer to the next dimension down's completed list */
         down->head = head;
 
+        /* Keep the tail pointer to the next dimension down's completed list */
+        down->tail = last_span;
+
     } /* end for */
 
     /* Indicate that there is a pointer to this tree */
@@ -6295,6 +6415,27 @@ H5S__generate_hyperslab (H5S_t *space, H5S_seloper_t op,
     } /* end if */
     else {
         hbool_t updated_spans = FALSE;  /* Whether the spans in the selection were modified */
+        htri_t appended;                /* Whether the new spans were appended directly */
+
+        /* Check for "OR"ing spans which lie after the current selection */
+        if(op == H5S_SELECT_OR) {
+            hsize_t new_nelem = H5S__hyper_spans_nelem(new_spans);
+
+            if((appended = H5S__hyper_append_disjoint_spans(space, new_spans)) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't append hyperslab spans")
+            if(appended) {
+                /* Indicate that the new_spans are owned */
+                new_spans = NULL;
+
+                /* Update the number of elements in current selection */
+                space->select.num_elem += new_nelem;
+
+                /* Attempt to rebuild "optimized" start/stride/count/block information */
+                H5S__hyper_rebuild(space);
+
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+        } /* end if */
 
         /* Generate lists of spans which overlap and don't overlap */
         if(H5S__hyper_clip_spans(space->select.sel_info.hslab->span_lst,new_spans,&a_not_b,&a_and_b,&b_not_a)<0)
@@ -6450,6 +6591,7 @@ H5S__generate_hyperslab (H5S_t *space, H5S_seloper_t op,
 
             /* Set to empty tree */
             spans->head=NULL;
+            spans->tail=NULL;
 
             /* Set pointer to empty span tree */
             space->select.sel_info.hslab->span_lst=spans;
@@ -7079,6 +7221,7 @@ H5S_operate_hyperslab (H5S_t *result, H5S_hyper_span_info_t *spans1, H5S_seloper
 
             /* Set to empty tree */
             spans->head=NULL;
+            spans->tail=NULL;
 
             /* Set pointer to empty span tree */
             result->select.sel_info.hslab->span_lst=spans;
@@ -9738,6 +9881,7 @@ H5S__hyper_subtract(H5S_t *space, H5S_t *subtract_space)
 
         /* Set to empty tree */
         spans->head = NULL;
+        spans->tail = NULL;
 
         /* Set pointer to empty span tree */
         space->select.sel_info.hslab->span_lst = spans;
@@ -109,6 +109,7 @@ struct H5S_hyper_span_info_t {
                                              * list during single element adds)
                                              */
     struct H5S_hyper_span_t *head;  /* Pointer to list of spans in next dimension down */
+    struct H5S_hyper_span_t *tail;  /* Pointer to the last span in the list */
 };
 
 /* Information about new-style hyperslab selection */
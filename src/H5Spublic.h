@@ -23,6 +23,7 @@
 
 /* Define atomic datatypes */
 #define H5S_ALL         (hid_t)0
+#define H5S_PLIST       (hid_t)1    /* Use the I/O plan from the DXPL (H5Pset_dataset_io_plan) */
 #define H5S_UNLIMITED   HSIZE_UNDEF
 
 /* Define user-level maximum number of dimensions */
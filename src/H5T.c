@@ -4301,6 +4301,15 @@ H5T_cmp(const H5T_t *dt1, const H5T_t *dt2, hbool_t superset)
                     dt2->shared->u.vlen.loc==H5T_LOC_MEMORY) {
                 HGOTO_DONE(1);
             }
+            /* Arbitrarily sort VL datatypes in chunks after memory and disk */
+            else if(dt1->shared->u.vlen.loc==H5T_LOC_CHUNK &&
+                    (dt2->shared->u.vlen.loc==H5T_LOC_MEMORY || dt2->shared->u.vlen.loc==H5T_LOC_DISK)) {
+                HGOTO_DONE(1);
+            }
+            else if((dt1->shared->u.vlen.loc==H5T_LOC_MEMORY || dt1->shared->u.vlen.loc==H5T_LOC_DISK) &&
+                    dt2->shared->u.vlen.loc==H5T_LOC_CHUNK) {
+                HGOTO_DONE(-1);
+            }
             else if(dt1->shared->u.vlen.loc==H5T_LOC_BADLOC &&
                     dt2->shared->u.vlen.loc!=H5T_LOC_BADLOC) {
                 HGOTO_DONE(1);
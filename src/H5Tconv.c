@@ -3037,6 +3037,9 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     void	*tmp_buf = NULL;     	/*temporary background buffer 	     */
     size_t	tmp_buf_size = 0;	/*size of temporary bkg buffer	     */
     hbool_t     nested = FALSE;         /*flag of nested VL case             */
+    H5HG_batch_t batch;                 /*batch of global heap operations    */
+    H5HG_batch_t *read_batch = NULL;    /*batch for reading sequences, if any */
+    H5HG_batch_t *write_batch = NULL;   /*batch for writing sequences, if any */
     size_t	elmtno;			/*element number counter	     */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -3138,6 +3141,37 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Go through a batch of global heap operations when the sequences
+             * don't contain VL data themselves, so that the heap collections
+             * written are sized for all of the sequences, and each collection
+             * is protected once instead of once per sequence.
+             */
+            if(!parent_is_vlen) {
+                if(H5T_LOC_DISK == dst->shared->u.vlen.loc) {
+                    if(H5HG_batch_init(&batch, dst->shared->u.vlen.f) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't initialize global heap batch")
+                    write_batch = &batch;
+
+                    /* Reserve heap space for the sequences */
+                    for(elmtno = 0; elmtno < nelmts; elmtno++) {
+                        s = (uint8_t *)buf + elmtno * (size_t)s_stride;
+                        if(!(*(src->shared->u.vlen.isnull))(src->shared->u.vlen.f, s)) {
+                            ssize_t sseq_len;   /* (signed) The number of elements in the current sequence*/
+
+                            if((sseq_len = (*(src->shared->u.vlen.getlen))(s)) < 0)
+                                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "incorrect length")
+                            if(H5HG_batch_reserve(write_batch, (size_t)sseq_len * dst_base_size) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTALLOC, FAIL, "can't reserve global heap space")
+                        } /* end if */
+                    } /* end for */
+                } /* end if */
+                else if(H5T_LOC_DISK == src->shared->u.vlen.loc) {
+                    if(H5HG_batch_init(&batch, src->shared->u.vlen.f) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't initialize global heap batch")
+                    read_batch = &batch;
+                } /* end if */
+            } /* end if */
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while(nelmts > 0) {
@@ -3223,7 +3257,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             } /* end if */
 
                             /* Read in VL sequence */
-                            if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, s, conv_buf, src_size) < 0)
+                            if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, read_batch, s, conv_buf, src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
                         } /* end else */
 
@@ -3268,7 +3302,7 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                         } /* end if */
 
                         /* Write sequence to destination location */
-                        if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, &vl_alloc_info, d, conv_buf, b, seq_len, dst_base_size) < 0)
+                        if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, write_batch, &vl_alloc_info, d, conv_buf, b, seq_len, dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if(!noop_conv) {
@@ -3315,6 +3349,9 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     }   /* end switch */
 
 done:
+    /* Finish the batch of global heap operations */
+    if((read_batch || write_batch) && H5HG_batch_end(&batch) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTUNPROTECT, FAIL, "can't finish global heap batch")
     /* If the conversion buffer doesn't need to be freed, reset its pointer */
     if(write_to_file && noop_conv)
         conv_buf = NULL;
@@ -388,6 +388,10 @@ H5T_debug(const H5T_t *dt, FILE *stream)
                 HDfprintf(stream, ", loc=disk");
                 break;
 
+            case H5T_LOC_CHUNK:
+                HDfprintf(stream, ", loc=chunk");
+                break;
+
             case H5T_LOC_MAXLOC:
             default:
                 HDfprintf(stream, ", loc=UNKNOWN");
@@ -64,6 +64,7 @@ typedef enum {
     H5T_LOC_BADLOC =   0,  /* invalid datatype location */
     H5T_LOC_MEMORY,        /* data stored in memory */
     H5T_LOC_DISK,          /* data stored on disk */
+    H5T_LOC_CHUNK,         /* data held in dataset chunks */
     H5T_LOC_MAXLOC         /* highest value (Invalid as true value) */
 } H5T_loc_t;
 
@@ -132,6 +133,12 @@ H5_DLL herr_t H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
     size_t nelmts, size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
 H5_DLL herr_t H5T_vlen_reclaim(void *elem, hid_t type_id, unsigned ndim, const hsize_t *point, void *_op_data);
 H5_DLL herr_t H5T_vlen_reclaim_elmt(void *elem, H5T_t *dt);
+H5_DLL htri_t H5T_vlen_chunk_packable(const H5T_t *dt);
+H5_DLL void *H5T_vlen_chunk_pack(const void *elmts, size_t nelmts, size_t elmt_size,
+    size_t base_size, size_t *packed_size);
+H5_DLL void *H5T_vlen_chunk_unpack(const void *packed, size_t packed_size, size_t elmt_size,
+    size_t base_size, size_t *nbytes, size_t *alloc_size);
+H5_DLL void H5T_vlen_chunk_free(void *elmts, size_t nelmts, size_t elmt_size);
 H5_DLL htri_t H5T_set_loc(H5T_t *dt, H5F_t *f, H5T_loc_t loc);
 H5_DLL htri_t H5T_is_sensible(const H5T_t *dt);
 H5_DLL uint32_t H5T_hash(H5F_t * file, const H5T_t *dt);
@@ -29,26 +29,50 @@
 #include "H5Pprivate.h"		/* Property lists			*/
 #include "H5Tpkg.h"		/* Datatypes				*/
 
+/* Layout of a VL element held in a dataset chunk, while the chunk is in
+ * memory: the length of the sequence, flags and a pointer to the sequence's
+ * data (NULL for a "nil" sequence).  The element is the same size as a VL
+ * element on disk, so it fits in the chunk.
+ */
+#define H5T_VLEN_CHUNK_LEN_OFF          0
+#define H5T_VLEN_CHUNK_FLAGS_OFF        4
+#define H5T_VLEN_CHUNK_PTR_OFF          8
+#define H5T_VLEN_CHUNK_MIN_SIZE         (H5T_VLEN_CHUNK_PTR_OFF + sizeof(void *))
+
+/* Flags for VL elements held in a dataset chunk */
+#define H5T_VLEN_CHUNK_OWNED            0x01    /* Sequence's data was allocated for the element */
+
+/* Version & "nil" sequence length for VL data packed into a chunk */
+#define H5T_VLEN_CHUNK_PACK_VERSION     1
+#define H5T_VLEN_CHUNK_PACK_HDR_SIZE    8
+#define H5T_VLEN_CHUNK_PACK_NIL         0xffffffff
+
 /* Local functions */
 static herr_t H5T_vlen_reclaim_recurse(void *elem, const H5T_t *dt, H5MM_free_t free_func, void *free_info);
 static ssize_t H5T_vlen_seq_mem_getlen(const void *_vl);
 static void * H5T_vlen_seq_mem_getptr(void *_vl);
 static htri_t H5T_vlen_seq_mem_isnull(const H5F_t *f, void *_vl);
-static herr_t H5T_vlen_seq_mem_read(H5F_t *f, void *_vl, void *_buf, size_t len);
-static herr_t H5T_vlen_seq_mem_write(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_seq_mem_read(H5F_t *f, H5HG_batch_t *batch, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_seq_mem_write(H5F_t *f, H5HG_batch_t *batch, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T_vlen_seq_mem_setnull(H5F_t *f, void *_vl, void *_bg);
 static ssize_t H5T_vlen_str_mem_getlen(const void *_vl);
 static void * H5T_vlen_str_mem_getptr(void *_vl);
 static htri_t H5T_vlen_str_mem_isnull(const H5F_t *f, void *_vl);
-static herr_t H5T_vlen_str_mem_read(H5F_t *f, void *_vl, void *_buf, size_t len);
-static herr_t H5T_vlen_str_mem_write(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_str_mem_read(H5F_t *f, H5HG_batch_t *batch, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_str_mem_write(H5F_t *f, H5HG_batch_t *batch, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T_vlen_str_mem_setnull(H5F_t *f, void *_vl, void *_bg);
 static ssize_t H5T_vlen_disk_getlen(const void *_vl);
 static void * H5T_vlen_disk_getptr(void *_vl);
 static htri_t H5T_vlen_disk_isnull(const H5F_t *f, void *_vl);
-static herr_t H5T_vlen_disk_read(H5F_t *f, void *_vl, void *_buf, size_t len);
-static herr_t H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_disk_read(H5F_t *f, H5HG_batch_t *batch, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_disk_write(H5F_t *f, H5HG_batch_t *batch, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
 static herr_t H5T_vlen_disk_setnull(H5F_t *f, void *_vl, void *_bg);
+static ssize_t H5T_vlen_chunk_getlen(const void *_vl);
+static void * H5T_vlen_chunk_getptr(void *_vl);
+static htri_t H5T_vlen_chunk_isnull(const H5F_t *f, void *_vl);
+static herr_t H5T_vlen_chunk_read(H5F_t *f, H5HG_batch_t *batch, void *_vl, void *_buf, size_t len);
+static herr_t H5T_vlen_chunk_write(H5F_t *f, H5HG_batch_t *batch, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *_buf, void *_bg, size_t seq_len, size_t base_size);
+static herr_t H5T_vlen_chunk_setnull(H5F_t *f, void *_vl, void *_bg);
 
 /* Local variables */
 
@@ -251,6 +275,34 @@ H5T__vlen_set_loc(const H5T_t *dt, H5F_t *f, H5T_loc_t loc)
                 dt->shared->u.vlen.f = f;
                 break;
 
+            case H5T_LOC_CHUNK:   /* VL datatype held in dataset chunks */
+                HDassert(f);
+
+                /*
+                 * Elements keep the size they have on disk, which must be
+                 * large enough to hold the length, flags and pointer to the
+                 * sequence's data
+                 */
+                if((4 + (size_t)H5F_SIZEOF_ADDR(f) + 4) < H5T_VLEN_CHUNK_MIN_SIZE)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "file addresses too small to hold VL data in chunks")
+
+                /* Mark this type as being held in chunks */
+                dt->shared->u.vlen.loc = H5T_LOC_CHUNK;
+                dt->shared->size = 4 + (size_t)H5F_SIZEOF_ADDR(f) + 4;
+
+                /* Set up the function pointers to access the VL information in the chunks */
+                /* VL sequences and VL strings are held identically in chunks, so use the same functions */
+                dt->shared->u.vlen.getlen = H5T_vlen_chunk_getlen;
+                dt->shared->u.vlen.getptr = H5T_vlen_chunk_getptr;
+                dt->shared->u.vlen.isnull = H5T_vlen_chunk_isnull;
+                dt->shared->u.vlen.read = H5T_vlen_chunk_read;
+                dt->shared->u.vlen.write = H5T_vlen_chunk_write;
+                dt->shared->u.vlen.setnull = H5T_vlen_chunk_setnull;
+
+                /* Set file ID (since this VL is in a dataset in the file) */
+                dt->shared->u.vlen.f = f;
+                break;
+
             case H5T_LOC_BADLOC:
                 /* Allow undefined location. In H5Odtype.c, H5O_dtype_decode sets undefined
                  * location for VL type and leaves it for the caller to decide.
@@ -396,7 +448,7 @@ H5T_vlen_seq_mem_isnull(const H5F_t H5_ATTR_UNUSED *f, void *_vl)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_seq_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
+H5T_vlen_seq_mem_read(H5F_t H5_ATTR_UNUSED *f, H5HG_batch_t H5_ATTR_UNUSED *batch, void *_vl, void *buf, size_t len)
 {
 #ifdef H5_NO_ALIGNMENT_RESTRICTIONS
     const hvl_t *vl=(const hvl_t *)_vl;   /* Pointer to the user's hvl_t information */
@@ -437,7 +489,7 @@ H5T_vlen_seq_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_seq_mem_write(H5F_t H5_ATTR_UNUSED *f, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *buf, void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
+H5T_vlen_seq_mem_write(H5F_t H5_ATTR_UNUSED *f, H5HG_batch_t H5_ATTR_UNUSED *batch, const H5T_vlen_alloc_info_t *vl_alloc_info, void *_vl, void *buf, void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
 {
     hvl_t vl;                       /* Temporary hvl_t to use during operation */
     size_t len;
@@ -627,7 +679,7 @@ H5T_vlen_str_mem_isnull(const H5F_t H5_ATTR_UNUSED *f, void *_vl)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_str_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
+H5T_vlen_str_mem_read(H5F_t H5_ATTR_UNUSED *f, H5HG_batch_t H5_ATTR_UNUSED *batch, void *_vl, void *buf, size_t len)
 {
 #ifdef H5_NO_ALIGNMENT_RESTRICTIONS
     char *s=*(char **)_vl;   /* Pointer to the user's string information */
@@ -667,7 +719,7 @@ H5T_vlen_str_mem_read(H5F_t H5_ATTR_UNUSED *f, void *_vl, void *buf, size_t len)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_str_mem_write(H5F_t H5_ATTR_UNUSED *f, const H5T_vlen_alloc_info_t *vl_alloc_info,
+H5T_vlen_str_mem_write(H5F_t H5_ATTR_UNUSED *f, H5HG_batch_t H5_ATTR_UNUSED *batch, const H5T_vlen_alloc_info_t *vl_alloc_info,
     void *_vl, void *buf, void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
 {
     char *t;                        /* Pointer to temporary buffer allocated */
@@ -816,7 +868,8 @@ H5T_vlen_disk_isnull(const H5F_t *f, void *_vl)
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_read
  *
- * Purpose:	Reads the disk based VL element into a buffer
+ * Purpose:	Reads the disk based VL element into a buffer, through
+ *		BATCH if it's not NULL
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -826,7 +879,7 @@ H5T_vlen_disk_isnull(const H5F_t *f, void *_vl)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_disk_read(H5F_t *f, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
+H5T_vlen_disk_read(H5F_t *f, H5HG_batch_t *batch, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
 {
     uint8_t *vl=(uint8_t *)_vl;   /* Pointer to the user's hvl_t information */
     H5HG_t hobjid;
@@ -849,8 +902,13 @@ H5T_vlen_disk_read(H5F_t *f, void *_vl, void *buf, size_t H5_ATTR_UNUSED len)
     /* Check if this sequence actually has any data */
     if(hobjid.addr > 0) {
         /* Read the VL information from disk */
-        if(NULL == H5HG_read(f, &hobjid, buf, NULL))
-            HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "Unable to read VL information")
+        if(batch) {
+            if(H5HG_batch_read(batch, &hobjid, buf) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "Unable to read VL information")
+        } /* end if */
+        else
+            if(NULL == H5HG_read(f, &hobjid, buf, NULL))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "Unable to read VL information")
     }
 
 done:
@@ -861,7 +919,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_write
  *
- * Purpose:	Writes the disk based VL element from a buffer
+ * Purpose:	Writes the disk based VL element from a buffer, through
+ *		BATCH if it's not NULL
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -871,7 +930,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_alloc_info,
+H5T_vlen_disk_write(H5F_t *f, H5HG_batch_t *batch, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_alloc_info,
     void *_vl, void *buf, void *_bg, size_t seq_len, size_t base_size)
 {
     uint8_t *vl = (uint8_t *)_vl; /*Pointer to the user's hvl_t information*/
@@ -911,8 +970,13 @@ H5T_vlen_disk_write(H5F_t *f, const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_all
 
     /* Write the VL information to disk (allocates space also) */
     len = (seq_len*base_size);
-    if(H5HG_insert(f, len, buf, &hobjid) < 0)
-        HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to write VL information")
+    if(batch) {
+        if(H5HG_batch_insert(batch, len, buf, &hobjid) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to write VL information")
+    } /* end if */
+    else
+        if(H5HG_insert(f, len, buf, &hobjid) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to write VL information")
 
     /* Encode the heap information */
     H5F_addr_encode(f, &vl, hobjid.addr);
@@ -979,6 +1043,202 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5T_vlen_disk_setnull() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_getlen
+ *
+ * Purpose:	Retrieves the length of a VL element held in a chunk.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5T_vlen_chunk_getlen(const void *_vl)
+{
+    const uint8_t *vl = (const uint8_t *)_vl; /* Pointer to the chunk's VL information */
+    uint32_t	seq_len;        /* Sequence length */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check parameters */
+    HDassert(vl);
+
+    HDmemcpy(&seq_len, vl + H5T_VLEN_CHUNK_LEN_OFF, sizeof(seq_len));
+
+    FUNC_LEAVE_NOAPI((ssize_t)seq_len)
+}   /* end H5T_vlen_chunk_getlen() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_getptr
+ *
+ * Purpose:	Retrieves the pointer to the data of a VL element held in a
+ *		chunk.
+ *
+ * Return:	Non-NULL on success/NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5T_vlen_chunk_getptr(void *_vl)
+{
+    const uint8_t *vl = (const uint8_t *)_vl; /* Pointer to the chunk's VL information */
+    void	*ptr;           /* Pointer to the sequence's data */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check parameters */
+    HDassert(vl);
+
+    HDmemcpy(&ptr, vl + H5T_VLEN_CHUNK_PTR_OFF, sizeof(ptr));
+
+    FUNC_LEAVE_NOAPI(ptr)
+}   /* end H5T_vlen_chunk_getptr() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_isnull
+ *
+ * Purpose:	Checks if a VL element held in a chunk is the "nil" object
+ *
+ * Return:	TRUE/FALSE on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5T_vlen_chunk_isnull(const H5F_t H5_ATTR_UNUSED *f, void *_vl)
+{
+    void	*ptr;           /* Pointer to the sequence's data */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check parameters */
+    HDassert(_vl);
+
+    HDmemcpy(&ptr, (uint8_t *)_vl + H5T_VLEN_CHUNK_PTR_OFF, sizeof(ptr));
+
+    FUNC_LEAVE_NOAPI(ptr == NULL ? TRUE : FALSE)
+}   /* end H5T_vlen_chunk_isnull() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_read
+ *
+ * Purpose:	Reads the data of a VL element held in a chunk into a buffer
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_vlen_chunk_read(H5F_t H5_ATTR_UNUSED *f, H5HG_batch_t H5_ATTR_UNUSED *batch, void *_vl, void *buf, size_t len)
+{
+    void	*ptr;           /* Pointer to the sequence's data */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check parameters */
+    HDassert(_vl);
+    HDassert(buf);
+
+    HDmemcpy(&ptr, (uint8_t *)_vl + H5T_VLEN_CHUNK_PTR_OFF, sizeof(ptr));
+    if(len > 0)
+        HDmemcpy(buf, ptr, len);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* end H5T_vlen_chunk_read() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_write
+ *
+ * Purpose:	Writes a VL element to be held in a chunk from a buffer.
+ *		The element gets its own copy of the sequence's data, which
+ *		is released along with the chunk (or when the element is
+ *		overwritten in the chunk), so the "background" element is
+ *		ignored here.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_vlen_chunk_write(H5F_t H5_ATTR_UNUSED *f, H5HG_batch_t H5_ATTR_UNUSED *batch,
+    const H5T_vlen_alloc_info_t H5_ATTR_UNUSED *vl_alloc_info, void *_vl, void *buf,
+    void H5_ATTR_UNUSED *_bg, size_t seq_len, size_t base_size)
+{
+    uint8_t	*vl = (uint8_t *)_vl;   /* Pointer to the chunk's VL information */
+    uint32_t	len32;          /* Sequence length */
+    void	*ptr;           /* Pointer to the sequence's data */
+    size_t	len;            /* Size of the sequence's data (in bytes) */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* check parameters */
+    HDassert(vl);
+    HDassert(seq_len == 0 || buf);
+
+    /* The sequence's length must not look like a "nil" sequence when packed */
+    if(seq_len >= H5T_VLEN_CHUNK_PACK_NIL)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADRANGE, FAIL, "VL sequence too long to hold in a chunk")
+
+    /* Copy the sequence's data (allocating at least one byte, so that an
+     * empty sequence isn't confused with a "nil" one)
+     */
+    len = seq_len * base_size;
+    if(NULL == (ptr = H5MM_malloc(MAX(len, 1))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL data")
+    if(len > 0)
+        HDmemcpy(ptr, buf, len);
+
+    /* Set the element's information */
+    len32 = (uint32_t)seq_len;
+    HDmemcpy(vl + H5T_VLEN_CHUNK_LEN_OFF, &len32, sizeof(len32));
+    vl[H5T_VLEN_CHUNK_FLAGS_OFF] = H5T_VLEN_CHUNK_OWNED;
+    HDmemcpy(vl + H5T_VLEN_CHUNK_PTR_OFF, &ptr, sizeof(ptr));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5T_vlen_chunk_write() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_setnull
+ *
+ * Purpose:	Sets a VL element held in a chunk to the "nil" value
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_vlen_chunk_setnull(H5F_t H5_ATTR_UNUSED *f, void *_vl, void H5_ATTR_UNUSED *_bg)
+{
+    uint8_t	*vl = (uint8_t *)_vl;   /* Pointer to the chunk's VL information */
+    uint32_t	len32 = 0;      /* Sequence length */
+    void	*ptr = NULL;    /* Pointer to the sequence's data */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check parameters */
+    HDassert(vl);
+
+    HDmemcpy(vl + H5T_VLEN_CHUNK_LEN_OFF, &len32, sizeof(len32));
+    vl[H5T_VLEN_CHUNK_FLAGS_OFF] = 0;
+    HDmemcpy(vl + H5T_VLEN_CHUNK_PTR_OFF, &ptr, sizeof(ptr));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* end H5T_vlen_chunk_setnull() */
+
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1195,3 +1455,271 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5T_vlen_reclaim_elmt */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_packable
+ *
+ * Purpose:	Check if the VL data of a datatype can be packed into the
+ *		chunks of a dataset: the datatype must be a VL sequence or
+ *		string whose base type holds neither VL data nor references,
+ *		and whose elements are large enough to point to their data.
+ *
+ * Return:	TRUE/FALSE on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5T_vlen_chunk_packable(const H5T_t *dt)
+{
+    htri_t      is_class;               /* Whether the base type holds a class */
+    htri_t      ret_value = TRUE;       /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* check parameters */
+    HDassert(dt);
+
+    if(H5T_VLEN != dt->shared->type)
+        HGOTO_DONE(FALSE)
+    if(dt->shared->size < H5T_VLEN_CHUNK_MIN_SIZE)
+        HGOTO_DONE(FALSE)
+
+    /* Check the base type */
+    if((is_class = H5T_detect_class(dt->shared->parent, H5T_VLEN, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't detect VL datatype class")
+    if(is_class)
+        HGOTO_DONE(FALSE)
+    if((is_class = H5T_detect_class(dt->shared->parent, H5T_REFERENCE, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't detect reference datatype class")
+    if(is_class)
+        HGOTO_DONE(FALSE)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_chunk_packable() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_pack
+ *
+ * Purpose:	Pack the VL data of NELMTS elements held in a chunk into a
+ *		new buffer, as a header (version, reserved bytes and number
+ *		of elements), the length of each element's sequence
+ *		(H5T_VLEN_CHUNK_PACK_NIL for a "nil" sequence) and the
+ *		sequences' data, one after another.
+ *
+ * Return:	Success:	Pointer to the packed data, whose size is
+ *				returned in PACKED_SIZE
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5T_vlen_chunk_pack(const void *elmts, size_t nelmts, size_t elmt_size,
+    size_t base_size, size_t *packed_size)
+{
+    const uint8_t *elmt;                /* Pointer to the current element */
+    uint8_t     *packed = NULL;         /* Buffer for the packed data */
+    uint8_t     *p;                     /* Pointer into the lengths */
+    uint8_t     *data;                  /* Pointer into the sequences' data */
+    size_t      data_size = 0;          /* Size of the sequences' data */
+    size_t      u;                      /* Local index variable */
+    void        *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* check parameters */
+    HDassert(elmts || nelmts == 0);
+    HDassert(elmt_size >= H5T_VLEN_CHUNK_MIN_SIZE);
+    HDassert(packed_size);
+
+    if(nelmts >= H5T_VLEN_CHUNK_PACK_NIL)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADRANGE, NULL, "too many elements to pack VL data")
+
+    /* Compute the size of the sequences' data */
+    for(u = 0, elmt = (const uint8_t *)elmts; u < nelmts; u++, elmt += elmt_size) {
+        uint32_t seq_len;       /* Sequence length */
+        void    *ptr;           /* Pointer to the sequence's data */
+
+        HDmemcpy(&ptr, elmt + H5T_VLEN_CHUNK_PTR_OFF, sizeof(ptr));
+        if(ptr) {
+            HDmemcpy(&seq_len, elmt + H5T_VLEN_CHUNK_LEN_OFF, sizeof(seq_len));
+            data_size += (size_t)seq_len * base_size;
+        } /* end if */
+    } /* end for */
+
+    /* Allocate the buffer */
+    *packed_size = H5T_VLEN_CHUNK_PACK_HDR_SIZE + (nelmts * 4) + data_size;
+    if(NULL == (packed = (uint8_t *)H5MM_malloc(*packed_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for packed VL data")
+
+    /* Encode the header */
+    p = packed;
+    *p++ = H5T_VLEN_CHUNK_PACK_VERSION;
+    *p++ = 0;
+    *p++ = 0;
+    *p++ = 0;
+    UINT32ENCODE(p, nelmts);
+
+    /* Encode the lengths & copy the sequences' data */
+    data = p + (nelmts * 4);
+    for(u = 0, elmt = (const uint8_t *)elmts; u < nelmts; u++, elmt += elmt_size) {
+        uint32_t seq_len;       /* Sequence length */
+        void    *ptr;           /* Pointer to the sequence's data */
+
+        HDmemcpy(&ptr, elmt + H5T_VLEN_CHUNK_PTR_OFF, sizeof(ptr));
+        if(ptr) {
+            size_t len;         /* Size of the sequence's data */
+
+            HDmemcpy(&seq_len, elmt + H5T_VLEN_CHUNK_LEN_OFF, sizeof(seq_len));
+            UINT32ENCODE(p, seq_len);
+            len = (size_t)seq_len * base_size;
+            if(len > 0) {
+                HDmemcpy(data, ptr, len);
+                data += len;
+            } /* end if */
+        } /* end if */
+        else
+            UINT32ENCODE(p, H5T_VLEN_CHUNK_PACK_NIL);
+    } /* end for */
+    HDassert((size_t)(data - packed) == *packed_size);
+
+    /* Set return value */
+    ret_value = packed;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_chunk_pack() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_unpack
+ *
+ * Purpose:	Unpack the VL data packed by H5T_vlen_chunk_pack into a new
+ *		buffer of elements to hold in a chunk, followed by the
+ *		sequences' data the elements point to.
+ *
+ * Return:	Success:	Pointer to the elements, whose size is
+ *				returned in NBYTES and the size of the
+ *				whole buffer in ALLOC_SIZE
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5T_vlen_chunk_unpack(const void *_packed, size_t packed_size, size_t elmt_size,
+    size_t base_size, size_t *nbytes, size_t *alloc_size)
+{
+    const uint8_t *packed = (const uint8_t *)_packed;   /* Pointer to the packed data */
+    const uint8_t *p;                   /* Pointer into the lengths */
+    const uint8_t *src;                 /* Pointer into the packed sequences' data */
+    uint8_t     *elmts = NULL;          /* Buffer for the elements */
+    uint8_t     *elmt;                  /* Pointer to the current element */
+    uint8_t     *data;                  /* Pointer into the sequences' data */
+    size_t      nelmts;                 /* Number of elements */
+    size_t      data_size = 0;          /* Size of the sequences' data */
+    size_t      u;                      /* Local index variable */
+    void        *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* check parameters */
+    HDassert(packed);
+    HDassert(elmt_size >= H5T_VLEN_CHUNK_MIN_SIZE);
+    HDassert(nbytes);
+    HDassert(alloc_size);
+
+    /* Decode the header */
+    if(packed_size < H5T_VLEN_CHUNK_PACK_HDR_SIZE)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTDECODE, NULL, "packed VL data too small")
+    if(H5T_VLEN_CHUNK_PACK_VERSION != packed[0])
+        HGOTO_ERROR(H5E_DATATYPE, H5E_VERSION, NULL, "bad version number for packed VL data")
+    p = packed + 4;
+    UINT32DECODE(p, nelmts);
+    if(nelmts > (packed_size - H5T_VLEN_CHUNK_PACK_HDR_SIZE) / 4)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTDECODE, NULL, "packed VL data too small for its lengths")
+
+    /* Compute & check the size of the sequences' data */
+    for(u = 0; u < nelmts; u++) {
+        uint32_t seq_len;       /* Sequence length */
+
+        UINT32DECODE(p, seq_len);
+        if(H5T_VLEN_CHUNK_PACK_NIL != seq_len)
+            data_size += (size_t)seq_len * base_size;
+    } /* end for */
+    if(data_size != packed_size - (size_t)(p - packed))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTDECODE, NULL, "packed VL data has wrong size")
+
+    /* Allocate the buffer, with the sequences' data after the elements */
+    *nbytes = nelmts * elmt_size;
+    *alloc_size = MAX(*nbytes + data_size, 1);
+    if(NULL == (elmts = (uint8_t *)H5MM_calloc(*alloc_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for VL data")
+
+    /* Set up the elements & copy the sequences' data */
+    p = packed + H5T_VLEN_CHUNK_PACK_HDR_SIZE;
+    src = p + (nelmts * 4);
+    data = elmts + *nbytes;
+    for(u = 0, elmt = elmts; u < nelmts; u++, elmt += elmt_size) {
+        uint32_t seq_len;       /* Sequence length */
+
+        UINT32DECODE(p, seq_len);
+        if(H5T_VLEN_CHUNK_PACK_NIL != seq_len) {
+            size_t len = (size_t)seq_len * base_size;   /* Size of the sequence's data */
+
+            HDmemcpy(elmt + H5T_VLEN_CHUNK_LEN_OFF, &seq_len, sizeof(seq_len));
+            HDmemcpy(elmt + H5T_VLEN_CHUNK_PTR_OFF, &data, sizeof(data));
+            if(len > 0) {
+                HDmemcpy(data, src, len);
+                src += len;
+                data += len;
+            } /* end if */
+        } /* end if */
+    } /* end for */
+
+    /* Set return value */
+    ret_value = elmts;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_vlen_chunk_unpack() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_vlen_chunk_free
+ *
+ * Purpose:	Release the sequences' data allocated for NELMTS elements
+ *		held in a chunk.  (Data unpacked along with the elements is
+ *		released with the chunk itself.)
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T_vlen_chunk_free(void *elmts, size_t nelmts, size_t elmt_size)
+{
+    uint8_t     *elmt;                  /* Pointer to the current element */
+    size_t      u;                      /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check parameters */
+    HDassert(elmts || nelmts == 0);
+
+    for(u = 0, elmt = (uint8_t *)elmts; u < nelmts; u++, elmt += elmt_size)
+        if(elmt[H5T_VLEN_CHUNK_FLAGS_OFF] & H5T_VLEN_CHUNK_OWNED) {
+            void *ptr;          /* Pointer to the sequence's data */
+
+            HDmemcpy(&ptr, elmt + H5T_VLEN_CHUNK_PTR_OFF, sizeof(ptr));
+            H5MM_xfree(ptr);
+            elmt[H5T_VLEN_CHUNK_FLAGS_OFF] = 0;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_vlen_chunk_free() */
+
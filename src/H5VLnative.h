@@ -30,6 +30,7 @@ typedef int H5VL_native_attr_optional_t;
 #ifndef H5_NO_DEPRECATED_SYMBOLS
 #define H5VL_NATIVE_ATTR_ITERATE_OLD    0   /* H5Aiterate (deprecated routine) */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
+#define H5VL_NATIVE_ATTR_READ_ALL       1   /* H5Aread_all */
 
 /* Typedef and values for native VOL connector dataset optional VOL operations */
 typedef int H5VL_native_dataset_optional_t;
@@ -75,6 +76,7 @@ typedef int H5VL_native_group_optional_t;
 #define H5VL_NATIVE_GROUP_ITERATE_OLD   0   /* HG5Giterate (deprecated routine) */
 #define H5VL_NATIVE_GROUP_GET_OBJINFO   1   /* HG5Gget_objinfo (deprecated routine) */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
+#define H5VL_NATIVE_GROUP_CREATE_MULTI  2   /* H5Gcreate_multi */
 
 /* Typedef and values for native VOL connector object optional VOL operations */
 typedef int H5VL_native_object_optional_t;
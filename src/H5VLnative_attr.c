@@ -536,7 +536,7 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5VL__native_attr_optional(void H5_ATTR_UNUSED *obj, hid_t H5_ATTR_UNUSED dxpl_id,
+H5VL__native_attr_optional(void *obj, hid_t H5_ATTR_UNUSED dxpl_id,
     void H5_ATTR_UNUSED **req, va_list arguments)
 {
     H5VL_native_attr_optional_t optional_type;
@@ -562,6 +562,30 @@ H5VL__native_attr_optional(void H5_ATTR_UNUSED *obj, hid_t H5_ATTR_UNUSED dxpl_i
             }
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+        /* H5Aread_all */
+        case H5VL_NATIVE_ATTR_READ_ALL:
+            {
+                const H5VL_loc_params_t *loc_params = HDva_arg(arguments, const H5VL_loc_params_t *);
+                H5_index_t idx_type = (H5_index_t)HDva_arg(arguments, int);
+                H5_iter_order_t order = (H5_iter_order_t)HDva_arg(arguments, int);
+                size_t *nattrs = HDva_arg(arguments, size_t *);
+                H5A_bulk_info_t *info = HDva_arg(arguments, H5A_bulk_info_t *);
+                size_t *buf_size = HDva_arg(arguments, size_t *);
+                void *buf = HDva_arg(arguments, void *);
+                ssize_t *ret = HDva_arg(arguments, ssize_t *);
+                H5G_loc_t loc;
+
+                /* Get the location struct for the object */
+                if(H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+
+                /* Read the attributes */
+                if((*ret = H5A__read_all(&loc, idx_type, order, nattrs, info, buf_size, buf)) < 0)
+                    HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+                break;
+            }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
@@ -172,10 +172,18 @@ H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id,
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
 
     /* Get validated dataspace pointers */
-    if(H5S_get_validated_dataspace(mem_space_id, &mem_space) < 0)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
-    if(H5S_get_validated_dataspace(file_space_id, &file_space) < 0)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
+    if(H5S_PLIST == mem_space_id || H5S_PLIST == file_space_id) {
+        if(mem_space_id != file_space_id)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "H5S_PLIST must be used for both dataspaces")
+        if(H5D__io_plan_get_spaces(&mem_space, &file_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get dataspaces from I/O plan")
+    } /* end if */
+    else {
+        if(H5S_get_validated_dataspace(mem_space_id, &mem_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
+        if(H5S_get_validated_dataspace(file_space_id, &file_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
+    } /* end else */
 
     /* Read raw data */
     if(H5D__read(dset, mem_type_id, mem_space, file_space, buf/*out*/) < 0)
@@ -212,10 +220,18 @@ H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id,
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
 
     /* Get validated dataspace pointers */
-    if(H5S_get_validated_dataspace(mem_space_id, &mem_space) < 0)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
-    if(H5S_get_validated_dataspace(file_space_id, &file_space) < 0)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
+    if(H5S_PLIST == mem_space_id || H5S_PLIST == file_space_id) {
+        if(mem_space_id != file_space_id)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "H5S_PLIST must be used for both dataspaces")
+        if(H5D__io_plan_get_spaces(&mem_space, &file_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get dataspaces from I/O plan")
+    } /* end if */
+    else {
+        if(H5S_get_validated_dataspace(mem_space_id, &mem_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from mem_space_id")
+        if(H5S_get_validated_dataspace(file_space_id, &file_space) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
+    } /* end else */
 
     /* Write the data */
     if(H5D__write(dset, mem_type_id, mem_space, file_space, buf) < 0) 
@@ -39,6 +39,7 @@ typedef int H5Z_filter_t;
 #define H5Z_FILTER_SZIP         4       /*szip compression              */
 #define H5Z_FILTER_NBIT         5       /*nbit compression              */
 #define H5Z_FILTER_SCALEOFFSET  6       /*scale+offset compression      */
+#define H5Z_FILTER_VLEN_PACK    7       /*VL data packed into chunks    */
 #define H5Z_FILTER_RESERVED     256	/*filter ids below this value are reserved for library use */
 
 #define H5Z_FILTER_MAX		65535	/*maximum filter id		*/
@@ -91,6 +92,10 @@ typedef int H5Z_filter_t;
 /* Macros for the scale offset filter */
 #define H5Z_SCALEOFFSET_USER_NPARMS      2    /* Number of parameters that users can set */
 
+/* Macros for the VL pack filter */
+#define H5Z_VLEN_PACK_USER_NPARMS   0   /* Number of parameters that users can set */
+#define H5Z_VLEN_PACK_TOTAL_NPARMS  2   /* Total number of parameters for filter */
+
 
 /* Special parameters for ScaleOffset filter*/
 #define H5Z_SO_INT_MINBITS_DEFAULT 0
@@ -0,0 +1,213 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The "VL pack" filter stores the variable-length data of a
+ *		dataset's elements inside each chunk, as a table of sequence
+ *		lengths followed by the sequences' data, instead of in global
+ *		heap collections.  The rest of the chunk's pipeline (e.g.
+ *		deflate) then operates on the sequences' data as well.
+ *
+ *		The dataset's datatype is marked with the H5T_LOC_CHUNK
+ *		location while it is open, so that chunks in the chunk cache
+ *		hold pointers to their sequences (see H5Tvlen.c), which this
+ *		filter packs when a chunk is written and unpacks when it is
+ *		read.
+ */
+
+#include "H5Zmodule.h"          /* This source code file is part of the H5Z module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Pprivate.h"         /* Property lists                       */
+#include "H5Tprivate.h"		/* Datatypes         			*/
+#include "H5Zpkg.h"		/* Data filters				*/
+
+/* Local function prototypes */
+static htri_t H5Z_can_apply_vlen_pack(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static herr_t H5Z_set_local_vlen_pack(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+static size_t H5Z_filter_vlen_pack(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_VLEN_PACK[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    H5Z_FILTER_VLEN_PACK,	/* Filter id number		*/
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "vlen_pack",		/* Filter name for debugging	*/
+    H5Z_can_apply_vlen_pack,    /* The "can apply" callback     */
+    H5Z_set_local_vlen_pack,    /* The "set local" callback     */
+    H5Z_filter_vlen_pack,	/* The actual filter function	*/
+}};
+
+/* Local macros */
+#define H5Z_VLEN_PACK_PARM_ELMT_SIZE    0   /* "Local" parameter for the size of a dataset element */
+#define H5Z_VLEN_PACK_PARM_BASE_SIZE    1   /* "Local" parameter for the size of a sequence element */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_can_apply_vlen_pack
+ *
+ * Purpose:	Check the parameters for the VL pack filter for validity:
+ *              the datatype must be a VL sequence or string whose base
+ *              type holds neither VL data nor references.
+ *
+ * Return:	Success: Non-negative
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5Z_can_apply_vlen_pack(hid_t H5_ATTR_UNUSED dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    const H5T_t	*type;                  /* Datatype */
+    htri_t packable;                    /* Whether the VL data can be packed */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Get datatype */
+    if(NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Check that the datatype's VL data can be held in the chunks */
+    if((packable = H5T_vlen_chunk_packable(type)) < 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "can't check datatype")
+    if(!packable)
+	HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "VL pack filter requires a VL datatype whose base type is neither VL nor a reference")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_can_apply_vlen_pack() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_set_local_vlen_pack
+ *
+ * Purpose:	Set the "local" dataset parameters for the VL pack filter to
+ *              be the size of the dataset's elements and the size of the
+ *              elements of their sequences.
+ *
+ * Return:	Success: Non-negative
+ *		Failure: Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z_set_local_vlen_pack(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
+{
+    H5P_genplist_t *dcpl_plist;         /* Property list pointer */
+    const H5T_t	*type;                  /* Datatype */
+    H5T_t	*base = NULL;           /* Base datatype of the sequences */
+    unsigned flags;                     /* Filter flags */
+    size_t cd_nelmts = H5Z_VLEN_PACK_USER_NPARMS;   /* Number of filter parameters */
+    unsigned cd_values[H5Z_VLEN_PACK_TOTAL_NPARMS];  /* Filter parameters */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Get the plist structure */
+    if(NULL == (dcpl_plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get datatype */
+    if(NULL == (type = (const H5T_t *)H5I_object_verify(type_id, H5I_DATATYPE)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Get the filter's current parameters */
+    if(H5P_get_filter_by_id(dcpl_plist, H5Z_FILTER_VLEN_PACK, &flags, &cd_nelmts, cd_values, (size_t)0, NULL, NULL) < 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get VL pack parameters")
+
+    /* Set "local" parameters for this dataset */
+    if((cd_values[H5Z_VLEN_PACK_PARM_ELMT_SIZE] = (unsigned)H5T_get_size(type)) == 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
+    if(NULL == (base = H5T_get_super(type)))
+	HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "unable to get base datatype")
+    if((cd_values[H5Z_VLEN_PACK_PARM_BASE_SIZE] = (unsigned)H5T_get_size(base)) == 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad base datatype size")
+
+    /* Modify the filter's parameters for this dataset */
+    if(H5P_modify_filter(dcpl_plist, H5Z_FILTER_VLEN_PACK, flags, (size_t)H5Z_VLEN_PACK_TOTAL_NPARMS, cd_values) < 0)
+	HGOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set local VL pack parameters")
+
+done:
+    if(base && H5T_close_real(base) < 0)
+        HDONE_ERROR(H5E_PLINE, H5E_CANTRELEASE, FAIL, "unable to release base datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_set_local_vlen_pack() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_filter_vlen_pack
+ *
+ * Purpose:	Implement an I/O filter which packs the VL data pointed to by
+ *              a chunk's elements into the chunk on output, and unpacks it
+ *              into a buffer of elements pointing to their sequences on
+ *              input.
+ *
+ * Return:	Success: Size of buffer filtered
+ *		Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5Z_filter_vlen_pack(unsigned flags, size_t cd_nelmts, const unsigned cd_values[],
+    size_t nbytes, size_t *buf_size, void **buf)
+{
+    void *dest = NULL;          /* Buffer holding the [un]packed chunk */
+    size_t elmt_size;           /* Size of a dataset element */
+    size_t base_size;           /* Size of a sequence element */
+    size_t dest_nbytes;         /* Size of the [un]packed chunk */
+    size_t dest_alloc;          /* Size of the buffer holding it */
+    size_t ret_value = 0;       /* Return value */
+
+    FUNC_ENTER_NOAPI(0)
+
+    /* Check arguments */
+    if(cd_nelmts != H5Z_VLEN_PACK_TOTAL_NPARMS || cd_values[H5Z_VLEN_PACK_PARM_ELMT_SIZE] == 0
+            || cd_values[H5Z_VLEN_PACK_PARM_BASE_SIZE] == 0)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid VL pack parameters")
+    elmt_size = cd_values[H5Z_VLEN_PACK_PARM_ELMT_SIZE];
+    base_size = cd_values[H5Z_VLEN_PACK_PARM_BASE_SIZE];
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        /* Input; unpack the sequences */
+        if(NULL == (dest = H5T_vlen_chunk_unpack(*buf, nbytes, elmt_size, base_size, &dest_nbytes, &dest_alloc)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTDECODE, 0, "unable to unpack VL data")
+    } /* end if */
+    else {
+        /* Output; pack the sequences */
+        if(nbytes % elmt_size)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "chunk isn't a whole number of elements")
+        if(NULL == (dest = H5T_vlen_chunk_pack(*buf, nbytes / elmt_size, elmt_size, base_size, &dest_nbytes)))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTENCODE, 0, "unable to pack VL data")
+        dest_alloc = dest_nbytes;
+    } /* end else */
+
+    /* Free the input buffer */
+    H5MM_xfree(*buf);
+
+    /* Set return values */
+    *buf = dest;
+    *buf_size = dest_alloc;
+    ret_value = dest_nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_filter_vlen_pack() */
+
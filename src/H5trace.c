@@ -948,6 +948,33 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         } /* end else */
                         break;
 
+                    case 'l':
+                        if(ptr) {
+                            if(vp)
+                               HDfprintf(out, "0x%lx", (unsigned long)vp);
+                            else
+                               HDfprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5F_mdc_log_style_t log_style = (H5F_mdc_log_style_t)HDva_arg(ap, int);
+
+                            switch(log_style) {
+                                case H5F_MDC_LOG_STYLE_JSON:
+                                   HDfprintf(out, "H5F_MDC_LOG_STYLE_JSON");
+                                    break;
+
+                                case H5F_MDC_LOG_STYLE_BINARY:
+                                   HDfprintf(out, "H5F_MDC_LOG_STYLE_BINARY");
+                                    break;
+
+                                case H5F_MDC_LOG_STYLE_NSTYLES:
+                                default:
+                                   HDfprintf(out, "%ld", (long)log_style);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
                     case 'm':
                         if(ptr) {
                             if(vp)
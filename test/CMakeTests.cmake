@@ -528,6 +528,7 @@ set (test_CLEANFILES
     test_swmr*.h5
     cache_logging.h5
     cache_logging.out
+    cache_logging.bin
     vds_swmr.h5
     vds_swmr_src_*.h5
     tmp/vds_src_2.h5
@@ -636,6 +636,30 @@ remove_cb(const void *_record, void *_op_data)
     return(0);
 } /* end remove_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	bulk_cb
+ *
+ * Purpose:	v2 B-tree bulk-load callback, returning every other record
+ *
+ * Return:	Success:	0
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+bulk_cb(const void **udata, void *_op_data)
+{
+    hsize_t *record = (hsize_t *)_op_data;
+
+    /* Advance to the next even record (the first one is 0) */
+    record[1] = record[0];
+    record[0] += 2;
+    *udata = &record[1];
+
+    return(0);
+} /* end bulk_cb() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_insert_basic
@@ -3176,6 +3200,170 @@ error:
     return 1;
 } /* test_insert_lots() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_insert_bulk_load
+ *
+ * Purpose:	Tests bulk-loading records into an empty v2 B-tree, then
+ *              inserting & removing records in the bulk-loaded B-tree.
+ *
+ * Return:	Success:	0
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_insert_bulk_load(hid_t fapl, const H5B2_create_t *cparam,
+    const bt2_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    H5B2_t      *bt2 = NULL;            /* v2 B-tree wrapper */
+    haddr_t     bt2_addr;               /* Address of B-tree created */
+    hsize_t     record;                 /* Record to insert into tree */
+    hsize_t     bulk[2];                /* Bulk-load callback state */
+    hsize_t     idx;                    /* Index within B-tree, for iterator */
+    hsize_t     *records = NULL;        /* Record #'s for random insertion */
+    unsigned    u;                      /* Local index variable */
+    unsigned    swap_idx;               /* Location to swap with when shuffling */
+    hsize_t     temp_rec;               /* Temporary record */
+    H5B2_stat_t bt2_stat;               /* Statistics about B-tree created */
+    hsize_t     nrec;                   /* Number of records in B-tree */
+    herr_t      ret;                    /* Generic error return value */
+
+    HDsrandom((unsigned)HDtime(NULL));
+
+    TESTING("B-tree insert: bulk-load level 3 B-tree");
+
+    /* Allocate space for the odd records, inserted later */
+    if(NULL == (records = (hsize_t *)HDmalloc(sizeof(hsize_t) * (INSERT_MANY / 2))))
+        TEST_ERROR
+
+    /* Initialize & shuffle record #'s */
+    for(u = 0; u < INSERT_MANY / 2; u++)
+        records[u] = (2 * u) + 1;
+    for(u = 0; u < INSERT_MANY / 2; u++) {
+        swap_idx = ((unsigned)HDrandom() % ((INSERT_MANY / 2) - u)) + u;
+        temp_rec = records[u];
+        records[u] = records[swap_idx];
+        records[swap_idx] = temp_rec;
+    } /* end for */
+
+    /* Create the file to work on */
+    if(create_file(&file, &f, fapl) < 0)
+        TEST_ERROR
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Bulk-load the even records */
+    bulk[0] = 0;
+    if(H5B2_bulk_load(bt2, (hsize_t)(INSERT_MANY / 2), bulk_cb, bulk) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check up on B-tree */
+    bt2_stat.depth = 3;
+    bt2_stat.nrecords = INSERT_MANY / 2;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Find random records, by value & by index */
+    for(u = 0; u < FIND_MANY; u++) {
+        idx = (hsize_t)(HDrandom() % (INSERT_MANY / 2));
+
+        /* Find record by value */
+        record = 2 * idx;
+        if(H5B2_find(bt2, &record, find_cb, &record) != TRUE)
+            FAIL_STACK_ERROR
+
+        /* Find record by index */
+        if(H5B2_index(bt2, H5_ITER_INC, idx, find_cb, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* A non-empty B-tree can't be bulk-loaded */
+    bulk[0] = 0;
+    H5E_BEGIN_TRY {
+        ret = H5B2_bulk_load(bt2, (hsize_t)1, bulk_cb, bulk);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+
+    PASSED();
+
+    TESTING("B-tree insert: insert into bulk-loaded B-tree");
+
+    /* Insert the odd records, in random order */
+    for(u = 0; u < INSERT_MANY / 2; u++) {
+        record = records[u];
+        if(H5B2_insert(bt2, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Iterate over B-tree to check records have been inserted correctly */
+    idx = 0;
+    if(H5B2_iterate(bt2, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != INSERT_MANY)
+        TEST_ERROR
+
+    PASSED();
+
+    TESTING("B-tree remove: remove from bulk-loaded B-tree");
+
+    /* Remove some of the odd records */
+    for(u = 0; u < FIND_MANY; u++) {
+        record = records[u];
+        if(H5B2_remove(bt2, &record, remove_cb, &temp_rec) < 0)
+            FAIL_STACK_ERROR
+        if(temp_rec != records[u])
+            TEST_ERROR
+    } /* end for */
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Make certain that the # of records is correct */
+    if(H5B2_get_nrec(bt2, &nrec) < 0)
+        FAIL_STACK_ERROR
+    if(nrec != (INSERT_MANY - FIND_MANY))
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    /* Close file */
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    HDfree(records);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(bt2)
+            H5B2_close(bt2);
+	H5Fclose(file);
+    } H5E_END_TRY;
+    HDfree(records);
+    return 1;
+} /* test_insert_bulk_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_update_basic
@@ -9997,6 +10185,7 @@ main(void)
             printf("***Express test mode on.  test_insert_lots skipped\n");
         else
             nerrors += test_insert_lots(fapl, &cparam, &tparam);
+        nerrors += test_insert_bulk_load(fapl, &cparam, &tparam);
 
         /* Test B-tree record update (ie. insert/modify) */
         /* (Iteration, find & index routines exercised in these routines as well) */
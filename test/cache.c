@@ -26169,7 +26169,7 @@ check_auto_cache_resize_input_errs(unsigned paged)
 
 
         invalid_auto_size_ctl.incr_mode              =
-        			(enum H5C_cache_incr_mode) 2; /* INVALID */
+        			(enum H5C_cache_incr_mode) 3; /* INVALID */
 
         invalid_auto_size_ctl.lower_hr_threshold     = 0.75f;
 
@@ -26998,7 +26998,7 @@ check_auto_cache_resize_input_errs(unsigned paged)
 
 
         invalid_auto_size_ctl.decr_mode              =
-        			(enum H5C_cache_decr_mode) 4; /* INVALID */
+        			(enum H5C_cache_decr_mode) 5; /* INVALID */
 
         invalid_auto_size_ctl.upper_hr_threshold     = 0.999f;
 
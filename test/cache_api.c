@@ -34,6 +34,7 @@ static hbool_t mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t
 static H5AC_cache_config_t * init_invalid_configs(void);
 static hbool_t check_fapl_mdc_api_errs(void);
 static hbool_t check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id);
+static hbool_t check_mrc_auto_resize(void);
 
 
 
@@ -1561,7 +1562,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
  *-------------------------------------------------------------------------
  */
 
-#define NUM_INVALID_CONFIGS	36
+#define NUM_INVALID_CONFIGS	37
 static H5AC_cache_config_t * invalid_configs = NULL;
 
 static H5AC_cache_config_t *
@@ -1733,6 +1734,10 @@ init_invalid_configs(void) {
     /* 35 -- unknown metadata write strategy */
     configs[35].metadata_write_strategy     = -1;
 
+    /* 36 -- empty_reserve leaves no room for the miss rate curve's knee */
+    configs[36].decr_mode                   = H5C_decr__miss_rate_curve;
+    configs[36].empty_reserve               = 1.0f;
+
     return configs;
 
 } /* initialize_invalid_configs() */
@@ -2259,6 +2264,207 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 
 } /* check_file_mdc_api_errs() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    check_mrc_auto_resize()
+ *
+ * Purpose:     Verify that the miss rate curve resize modes size the
+ *              cache to the working set of a simple workload: a cache
+ *              much larger than the working set should shrink, and one
+ *              much smaller should grow, while staying within the
+ *              configured [min_size, max_size].
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#define MRC_NUM_GROUPS          200
+#define MRC_NUM_PASSES          100
+#define MRC_MIN_SIZE            (64 * 1024)
+#define MRC_MAX_SIZE            (8 * 1024 * 1024)
+
+static hbool_t
+check_mrc_auto_resize(void)
+{
+    char filename[512];
+    char group_name[64];
+    hid_t file_id = -1;
+    hid_t group_id = -1;
+    H5G_info_t group_info;
+    size_t max_size = 0;
+    int i, j, k;
+    H5AC_cache_config_t mod_config =
+    {
+      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* hbool_t     rpt_fcn_enabled        = */ FALSE,
+      /* hbool_t     open_trace_file        = */ FALSE,
+      /* hbool_t     close_trace_file       = */ FALSE,
+      /* char        trace_file_name[]      = */ "",
+      /* hbool_t     evictions_enabled      = */ TRUE,
+      /* hbool_t     set_initial_size       = */ TRUE,
+      /* size_t      initial_size           = */ (4 * 1024 * 1024),
+      /* double      min_clean_fraction     = */ 0.3f,
+      /* size_t      max_size               = */ MRC_MAX_SIZE,
+      /* size_t      min_size               = */ MRC_MIN_SIZE,
+      /* long int    epoch_length           = */ 1000,
+      /* enum H5C_cache_incr_mode incr_mode = */ H5C_incr__miss_rate_curve,
+      /* double      lower_hr_threshold     = */ 0.9f,
+      /* double      increment              = */ 2.0f,
+      /* hbool_t     apply_max_increment    = */ FALSE,
+      /* size_t      max_increment          = */ (4 * 1024 * 1024),
+      /* enum H5C_cache_flash_incr_mode       */
+      /*                    flash_incr_mode = */ H5C_flash_incr__off,
+      /* double      flash_multiple         = */ 1.0f,
+      /* double      flash_threshold        = */ 0.25f,
+      /* enum H5C_cache_decr_mode decr_mode = */ H5C_decr__miss_rate_curve,
+      /* double      upper_hr_threshold     = */ 0.999f,
+      /* double      decrement              = */ 0.9f,
+      /* hbool_t     apply_max_decrement    = */ FALSE,
+      /* size_t      max_decrement          = */ (1 * 1024 * 1024),
+      /* int         epochs_before_eviction = */ 3,
+      /* hbool_t     apply_empty_reserve    = */ TRUE,
+      /* double      empty_reserve          = */ 0.1f,
+      /* int         dirty_bytes_threshold  = */ (256 * 1024),
+      /* int	    metadata_write_strategy = */
+				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+    };
+
+    TESTING("MDC miss rate curve automatic resize");
+
+    pass = TRUE;
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAME[1], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    /* create the file and the groups making up the working set */
+    if ( pass ) {
+
+        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+        if ( file_id < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fcreate() failed.\n";
+        }
+    }
+
+    for ( i = 0; ( pass ) && ( i < MRC_NUM_GROUPS ); i++ ) {
+
+        HDsprintf(group_name, "/group%03d", i);
+
+        if ( ( ( group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT,
+                                       H5P_DEFAULT, H5P_DEFAULT) ) < 0 ) ||
+             ( H5Gclose(group_id) < 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "can't create group.\n";
+        }
+    }
+
+    /* First start with a cache much larger than the working set, and
+     * then with one much smaller.  In both cases, cycle through the
+     * groups until the cache has had time to adjust.
+     */
+    for ( k = 0; ( pass ) && ( k < 2 ); k++ ) {
+
+        if ( k == 1 ) {
+
+            mod_config.initial_size = MRC_MIN_SIZE;
+        }
+
+        if ( H5Fset_mdc_config(file_id, &mod_config) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fset_mdc_config() failed.\n";
+        }
+
+        for ( j = 0; ( pass ) && ( j < MRC_NUM_PASSES ); j++ ) {
+
+            for ( i = 0; ( pass ) && ( i < MRC_NUM_GROUPS ); i++ ) {
+
+                HDsprintf(group_name, "/group%03d", i);
+
+                if ( ( ( group_id = H5Gopen2(file_id, group_name,
+                                             H5P_DEFAULT) ) < 0 ) ||
+                     ( H5Gget_info(group_id, &group_info) < 0 ) ||
+                     ( H5Gclose(group_id) < 0 ) ) {
+
+                    pass = FALSE;
+                    failure_mssg = "can't access group.\n";
+                }
+            }
+        }
+
+        if ( pass ) {
+
+            if ( H5Fget_mdc_size(file_id, &max_size, NULL, NULL, NULL) < 0 ) {
+
+                pass = FALSE;
+                failure_mssg = "H5Fget_mdc_size() failed.\n";
+
+            } else if ( ( max_size < MRC_MIN_SIZE ) ||
+                        ( max_size > MRC_MAX_SIZE ) ) {
+
+                pass = FALSE;
+                failure_mssg = "cache size out of range.\n";
+
+            } else if ( ( k == 0 ) &&
+                        ( max_size >= mod_config.initial_size ) ) {
+
+                pass = FALSE;
+                failure_mssg = "cache size didn't decrease.\n";
+
+            } else if ( ( k == 1 ) &&
+                        ( max_size <= mod_config.initial_size ) ) {
+
+                pass = FALSE;
+                failure_mssg = "cache size didn't increase.\n";
+            }
+        }
+    }
+
+    /* close the file and delete it */
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+
+        } else if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        PASSED();
+
+    } else {
+
+        H5_FAILED();
+    }
+
+    if ( ! pass ) {
+
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+    }
+
+    return pass;
+
+} /* check_mrc_auto_resize() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -2343,6 +2549,9 @@ main(void)
     if(!check_fapl_mdc_api_errs())
         nerrs += 1;
 
+    if(!check_mrc_auto_resize())
+        nerrs += 1;
+
     if(invalid_configs)
         HDfree(invalid_configs);
 
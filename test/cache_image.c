@@ -61,6 +61,7 @@ static unsigned cache_image_api_error_check_4(hbool_t single_file_vfd);
 
 static unsigned get_free_sections_test(hbool_t single_file_vfd);
 static unsigned evict_on_close_test(hbool_t single_file_vfd);
+static unsigned incremental_cache_image_test(hbool_t single_file_vfd);
 
 
 /****************************************************************************/
@@ -552,7 +553,8 @@ open_hdf5_file(hbool_t create_file, hbool_t mdci_sbem_expected,
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
         TRUE,
         FALSE,
-        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE};
+        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE,
+        FALSE};
 
     if ( pass )
     {
@@ -926,7 +928,8 @@ attempt_swmr_open_hdf5_file(const hbool_t create_file,
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
         TRUE,
         FALSE,
-        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE};
+        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE,
+        FALSE};
 
     /* create a file access propertly list. */
     if ( pass ) {
@@ -8156,6 +8159,494 @@ evict_on_close_test(hbool_t single_file_vfd)
 
 } /* evict_on_close_test() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    incremental_cache_image_test()
+ *
+ * Purpose:     Verify that a metadata cache image created in incremental
+ *		mode is brought up to date by flushes, is kept in the file
+ *		across R/O and incremental R/W opens, and that the images of
+ *		its entries are loaded on demand.
+ *
+ *		The test is set up as follows:
+ *
+ *		 1) Create a HDF5 file with an incremental cache image 
+ *		    requested.
+ *
+ *		 2) Create some data sets and verify them.
+ *
+ *		 3) Flush the file, and verify that it now contains a 
+ *		    current cache image.
+ *
+ *		 4) Create some more data sets, flush the file, and verify
+ *		    that the image is current again.
+ *
+ *		 5) Close the file.
+ *
+ *		 6) Open the file R/O.  Verify that the cache image is 
+ *		    loaded lazily, i.e. that prefetched entries without 
+ *		    images exist after the load, and verify the data sets.
+ *
+ *		 7) Close the file.
+ *
+ *		 8) Open the file R/W with an incremental cache image 
+ *		    requested.  Verify the data sets, and verify that the
+ *		    image is kept in the file.  Create some more data sets.
+ *
+ *		 9) Close the file.
+ *
+ *		10) Open the file R/W without a cache image requested,
+ *		    verify all data sets, and close the file.  This 
+ *		    discards the cache image.
+ *
+ *		11) Open the file R/O, verify that it contains no cache
+ *		    image, verify all data sets, and close the file.
+ *
+ *		12) Discard the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+incremental_cache_image_test(hbool_t single_file_vfd)
+{
+#ifndef H5_HAVE_PARALLEL
+    const char * fcn_name = "incremental_cache_image_test()";
+    char filename[512];
+    hbool_t show_progress = FALSE;
+    hid_t fapl_id = -1;
+    hid_t file_id = -1;
+    H5F_t *file_ptr = NULL;
+    H5C_t *cache_ptr = NULL;
+    H5C_cache_entry_t *entry_ptr;
+    H5AC_cache_image_config_t cache_image_config;
+    H5G_info_t group_info;
+    haddr_t image_addr = HADDR_UNDEF;
+    hsize_t image_len = 0;
+    int lazy_entries;
+    int cp = 0;
+#endif /* H5_HAVE_PARALLEL */
+
+    TESTING("Incremental metadata cache image");
+
+#ifdef H5_HAVE_PARALLEL
+    SKIPPED();
+    HDputs("    Incremental cache image not supported in the parallel library.");
+    return 0;
+#else
+
+    /* Check for VFD that is a single file */
+    if(!single_file_vfd) {
+        SKIPPED();
+        HDputs("    Cache image not supported with the current VFD.");
+        return 0;
+    }
+
+    pass = TRUE;
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    /* setup a FAPL requesting an incremental cache image */
+    if ( pass ) {
+
+        if ( ( (fapl_id = h5_fileaccess()) < 0 ) ||
+             ( H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST,
+                                    H5F_LIBVER_LATEST) < 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "can't setup FAPL.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        cache_image_config.version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+        cache_image_config.generate_image = TRUE;
+        cache_image_config.save_resize_status = FALSE;
+        cache_image_config.entry_ageout = H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE;
+        cache_image_config.incremental = TRUE;
+
+        if ( H5Pset_mdc_image_config(fapl_id, &cache_image_config) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Pset_mdc_image_config() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 1) Create a HDF5 file with an incremental cache image requested. */
+
+    if ( pass ) {
+
+        if ( ( (file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT,
+                                    fapl_id)) < 0 ) ||
+             ( NULL == (file_ptr = (H5F_t *)H5VL_object_verify(file_id,
+                                                             H5I_FILE)) ) ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fcreate() failed.\n";
+
+        } else {
+
+            cache_ptr = file_ptr->shared->cache;
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 2) Create some data sets and verify them. */
+
+    if ( pass ) {
+
+        create_datasets(file_id, 1, 5);
+    }
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 1, 5);
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 3) Flush the file, and verify that it now contains a current
+     *    cache image.
+     */
+
+    if ( pass ) {
+
+        if ( H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fflush() failed (1).\n";
+        }
+    }
+
+    if ( pass ) {
+
+        if ( ( ! cache_ptr->image_is_current ) ||
+             ( ! H5F_addr_defined(cache_ptr->image_addr) ) ||
+             ( H5Fget_mdc_image_info(file_id, &image_addr, &image_len) < 0 ) ||
+             ( image_addr != cache_ptr->image_addr ) ||
+             ( image_len == 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "no current cache image after flush (1).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 4) Create some more data sets, flush the file, and verify that
+     *    the image is current again.
+     */
+
+    if ( pass ) {
+
+        create_datasets(file_id, 6, 10);
+    }
+
+    if ( pass ) {
+
+        if ( H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fflush() failed (2).\n";
+        }
+    }
+
+    if ( pass ) {
+
+        if ( ( ! cache_ptr->image_is_current ) ||
+             ( ! H5F_addr_defined(cache_ptr->image_addr) ) ) {
+
+            pass = FALSE;
+            failure_mssg = "no current cache image after flush (2).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 5) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed (1).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 6) Open the file R/O.  Verify that the cache image is loaded
+     *    lazily, and verify the data sets.
+     */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ TRUE,
+                       /* set_mdci_fapl      */ FALSE,
+		       /* config_fsm         */ FALSE,
+		       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    /* force the load of the cache image */
+    if ( pass ) {
+
+        if ( H5Gget_info(file_id, &group_info) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Gget_info() failed.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        lazy_entries = 0;
+
+        for ( entry_ptr = cache_ptr->il_head; entry_ptr != NULL;
+              entry_ptr = entry_ptr->il_next )
+
+            if ( ( entry_ptr->prefetched ) && 
+                 ( entry_ptr->image_ptr == NULL ) &&
+                 ( H5F_addr_defined(entry_ptr->prefetch_image_addr) ) )
+
+                lazy_entries++;
+
+        if ( ( ! cache_ptr->image_loaded ) || ( lazy_entries == 0 ) ||
+             ( cache_ptr->image_is_current ) ) {
+
+            pass = FALSE;
+            failure_mssg = "cache image not loaded lazily.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 1, 10);
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 7) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed (2).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 8) Open the file R/W with an incremental cache image requested.
+     *    Verify the data sets, and verify that the image is kept in 
+     *    the file.  Create some more data sets.
+     */
+
+    if ( pass ) {
+
+        if ( ( (file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0 ) ||
+             ( NULL == (file_ptr = (H5F_t *)H5VL_object_verify(file_id,
+                                                             H5I_FILE)) ) ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fopen() failed.\n";
+
+        } else {
+
+            cache_ptr = file_ptr->shared->cache;
+        }
+    }
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 1, 10);
+    }
+
+    if ( pass ) {
+
+        if ( ( ! cache_ptr->image_loaded ) || 
+             ( cache_ptr->delete_image ) ||
+             ( ! H5F_addr_defined(cache_ptr->image_addr) ) ) {
+
+            pass = FALSE;
+            failure_mssg = "incremental cache image not kept.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        create_datasets(file_id, 11, 15);
+    }
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 11, 15);
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 9) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed (3).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 10) Open the file R/W without a cache image requested, verify
+     *     all data sets, and close the file.
+     */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ FALSE,
+		       /* config_fsm         */ FALSE,
+		       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 1, 15);
+    }
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed (4).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 11) Open the file R/O, verify that it contains no cache image, 
+     *     verify all data sets, and close the file.
+     */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ TRUE,
+                       /* set_mdci_fapl      */ FALSE,
+		       /* config_fsm         */ FALSE,
+		       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( pass ) {
+
+        verify_datasets(file_id, 1, 15);
+    }
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed (5).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 12) Discard the file. */
+
+    if ( pass ) {
+
+        if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( fapl_id >= 0 )
+        H5Pclose(fapl_id);
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    if ( pass ) { PASSED(); } else { H5_FAILED(); }
+
+    if ( ! pass )
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+
+    return !pass;
+#endif /* H5_HAVE_PARALLEL */
+
+} /* incremental_cache_image_test() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -8217,6 +8708,7 @@ main(void)
 
     nerrs += get_free_sections_test(single_file_vfd);
     nerrs += evict_on_close_test(single_file_vfd);
+    nerrs += incremental_cache_image_test(single_file_vfd);
 
     return(nerrs > 0);
 
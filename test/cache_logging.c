@@ -16,10 +16,19 @@
 #include "h5test.h"
 
 #define LOG_LOCATION "cache_logging.out"
+#define BINARY_LOG_LOCATION "cache_logging.bin"
 #define FILE_NAME    "cache_logging"
 
 #define N_GROUPS 100
 
+/* Binary log format constants (see H5Clog.h) */
+#define BINARY_LOG_SIGNATURE        "H5MDCLOG"
+#define BINARY_LOG_VERSION          1
+#define BINARY_LOG_HEADER_SIZE      40
+#define BINARY_LOG_RECORD_SIZE      32
+#define BINARY_LOG_EVENT_OFFSET     28
+#define BINARY_LOG_EVENT_PROTECT    16
+
 /*-------------------------------------------------------------------------
  * Function:    test_logging_api
  *
@@ -141,6 +150,119 @@ error:
     return 1;
  } /* test_logging_api() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_binary_logging
+ *
+ * Purpose:     Tests writing the metadata cache log in the binary format
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_binary_logging(void)
+{
+    hid_t       fapl = -1;
+    hid_t       fid = -1;
+    hid_t       gid = -1;
+    H5F_mdc_log_style_t style;
+    char        group_name[8];
+    char        filename[1024];
+    FILE        *fp = NULL;
+    uint8_t     header[BINARY_LOG_HEADER_SIZE];
+    uint8_t     record[BINARY_LOG_RECORD_SIZE];
+    size_t      nrecords = 0;
+    hbool_t     found_protect = FALSE;
+    int         i;
+
+    TESTING("binary metadata cache log");
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILE_NAME, fapl, filename, sizeof filename);
+
+    /* The default log style is JSON */
+    if(H5Pget_mdc_log_style(fapl, &style) < 0)
+        TEST_ERROR;
+    if(style != H5F_MDC_LOG_STYLE_JSON)
+        TEST_ERROR;
+
+    /* Set up binary metadata cache logging, started on file access */
+    if(H5Pset_mdc_log_options(fapl, TRUE, BINARY_LOG_LOCATION, TRUE) < 0)
+        TEST_ERROR;
+    if(H5Pset_mdc_log_style(fapl, H5F_MDC_LOG_STYLE_BINARY) < 0)
+        TEST_ERROR;
+    if(H5Pget_mdc_log_style(fapl, &style) < 0)
+        TEST_ERROR;
+    if(style != H5F_MDC_LOG_STYLE_BINARY)
+        TEST_ERROR;
+
+    /* Invalid styles should fail */
+    H5E_BEGIN_TRY {
+        if(H5Pset_mdc_log_style(fapl, H5F_MDC_LOG_STYLE_NSTYLES) >= 0)
+            TEST_ERROR;
+    } H5E_END_TRY;
+
+    /* Create a file and perform some manipulations */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    for(i = 0; i < N_GROUPS; i++) {
+        HDmemset(group_name, 0, 8);
+        HDsnprintf(group_name, 8, "%d", i);
+        if((gid = H5Gcreate2(fid, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if(H5Gclose(gid) < 0)
+            TEST_ERROR;
+    }
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    /* Check the log's header */
+    if(NULL == (fp = HDfopen(BINARY_LOG_LOCATION, "rb")))
+        TEST_ERROR;
+    if(1 != HDfread(header, sizeof(header), (size_t)1, fp))
+        TEST_ERROR;
+    if(HDmemcmp(header, BINARY_LOG_SIGNATURE, HDstrlen(BINARY_LOG_SIGNATURE)))
+        TEST_ERROR;
+    if(header[8] != BINARY_LOG_VERSION || header[9] != BINARY_LOG_RECORD_SIZE)
+        TEST_ERROR;
+
+    /* Check the records */
+    while(1 == HDfread(record, sizeof(record), (size_t)1, fp)) {
+        if(record[BINARY_LOG_EVENT_OFFSET] == BINARY_LOG_EVENT_PROTECT)
+            found_protect = TRUE;
+        nrecords++;
+    }
+    if(!HDfeof(fp))
+        TEST_ERROR;
+    if(nrecords < N_GROUPS || !found_protect)
+        TEST_ERROR;
+
+    /* The log holds whole records only */
+    if(HDfseek(fp, 0, SEEK_END) < 0)
+        TEST_ERROR;
+    if((size_t)HDftell(fp) != BINARY_LOG_HEADER_SIZE + (nrecords * BINARY_LOG_RECORD_SIZE))
+        TEST_ERROR;
+
+    HDfclose(fp);
+    fp = NULL;
+
+    PASSED();
+    return 0;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+
+    return 1;
+} /* test_binary_logging() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -162,6 +284,7 @@ main(void)
     HDprintf("Testing basic metadata cache logging functionality.\n");
 
     nerrors += test_logging_api();
+    nerrors += test_binary_logging();
 
     if(nerrors) {
         HDprintf("***** %d Metadata cache logging TEST%s FAILED! *****\n",
@@ -99,6 +99,7 @@ const char *FILENAME[] = {
 #define DSET_CHUNKED_NAME           "chunked"
 #define DSET_COMPACT_NAME           "compact"
 #define DSET_SIMPLE_IO_NAME         "simple_io"
+#define DSET_IO_PLAN_NAME           "io_plan"
 #define DSET_USERBLOCK_IO_NAME      "userblock_io"
 #define DSET_COMPACT_IO_NAME        "compact_io"
 #define DSET_COMPACT_MAX_NAME       "max_compact"
@@ -627,6 +628,149 @@ error:
 } /* end test_simple_io() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:   test_io_plan
+ *
+ * Purpose:    Tests I/O with a selection I/O plan set in the DXPL
+ *             (H5Pset_dataset_io_plan & H5S_PLIST), reusing the plan for
+ *             repeated writes and reads of a strided selection.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_io_plan(hid_t file)
+{
+    hid_t       dataset = -1, fspace = -1, mspace = -1, xfer = -1, xfer2 = -1;
+    hsize_t     dims[2] = {DSET_DIM1, DSET_DIM2};
+    hsize_t     mdims[1];
+    hsize_t     start[2] = {1, 3};
+    hsize_t     stride[2] = {3, 4};
+    hsize_t     count[2] = {DSET_DIM1 / 3, (DSET_DIM2 - 3) / 4};
+    hsize_t     block[2] = {1, 2};
+    int         *wbuf = NULL, *rbuf = NULL;
+    size_t      nelmts, half, u;
+    int         i, j, step;
+    herr_t      ret;
+
+    TESTING("I/O with selection I/O plan");
+
+    /* Create the dataset & fill it with known values */
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            points[i][j] = -1;
+    if((fspace = H5Screate_simple(2, dims, NULL)) < 0) TEST_ERROR
+    if((dataset = H5Dcreate2(file, DSET_IO_PLAN_NAME, H5T_NATIVE_INT, fspace,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0) TEST_ERROR
+
+    /* Select a strided file selection and an irregular memory selection:
+     * every 2nd element for the first half, then every 3rd element.
+     */
+    if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, stride, count, block) < 0) TEST_ERROR
+    nelmts = (size_t)H5Sget_select_npoints(fspace);
+    half = nelmts / 2;
+    mdims[0] = (3 * nelmts) + 1;
+    if((mspace = H5Screate_simple(1, mdims, NULL)) < 0) TEST_ERROR
+    start[0] = 1;
+    stride[0] = 2;
+    count[0] = half;
+    block[0] = 1;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, stride, count, block) < 0) TEST_ERROR
+    start[0] = (2 * half) + 1;
+    stride[0] = 3;
+    count[0] = nelmts - half;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_OR, start, stride, count, block) < 0) TEST_ERROR
+    if(H5Sis_regular_hyperslab(mspace) != FALSE) TEST_ERROR
+
+    if(NULL == (wbuf = (int *)HDcalloc((size_t)mdims[0], sizeof(int)))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDcalloc((size_t)mdims[0], sizeof(int)))) TEST_ERROR
+
+    /* H5S_PLIST without a plan should fail */
+    if((xfer = H5Pcreate(H5P_DATASET_XFER)) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_PLIST, H5S_PLIST, xfer, rbuf);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Compile the plan, then change the selections, which shouldn't affect it */
+    if(H5Pset_dataset_io_plan(xfer, mspace, fspace) < 0) TEST_ERROR
+    if(H5Sselect_none(mspace) < 0) TEST_ERROR
+
+    /* H5S_PLIST must be used for both dataspaces */
+    H5E_BEGIN_TRY {
+        ret = H5Dread(dataset, H5T_NATIVE_INT, mspace, H5S_PLIST, xfer, rbuf);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Use the plan for several time steps, from a copy of the DXPL too */
+    if((xfer2 = H5Pcopy(xfer)) < 0) TEST_ERROR
+    for(step = 0; step < 4; step++) {
+        for(u = 0; u < nelmts; u++)
+            wbuf[u < half ? (2 * u) + 1 : (2 * half) + 1 + 3 * (u - half)] = (int)(step * 100000 + u);
+        if(H5Dwrite(dataset, H5T_NATIVE_INT, H5S_PLIST, H5S_PLIST, (step % 2) ? xfer2 : xfer, wbuf) < 0) TEST_ERROR
+
+        HDmemset(rbuf, 0, (size_t)mdims[0] * sizeof(int));
+        if(H5Dread(dataset, H5T_NATIVE_INT, H5S_PLIST, H5S_PLIST, (step % 2) ? xfer : xfer2, rbuf) < 0) TEST_ERROR
+        if(HDmemcmp(rbuf, wbuf, (size_t)mdims[0] * sizeof(int))) {
+            H5_FAILED();
+            printf("    Read different values than written at step %d\n", step);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Verify the file contents without the plan */
+    if(H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0) TEST_ERROR
+    u = 0;
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++) {
+            hbool_t selected = (i % 3) == 1 && i < 1 + 3 * (DSET_DIM1 / 3) &&
+                    j >= 3 && ((j - 3) % 4) < 2 && j < 3 + 4 * ((DSET_DIM2 - 3) / 4);
+
+            if(selected) {
+                if(check[i][j] != (int)(300000 + u)) TEST_ERROR
+                u++;
+            } /* end if */
+            else if(check[i][j] != -1)
+                TEST_ERROR
+        } /* end for */
+    if(u != nelmts) TEST_ERROR
+
+    /* Removing the plan should make H5S_PLIST fail again */
+    if(H5Pset_dataset_io_plan(xfer, H5S_ALL, H5S_ALL) < 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dread(dataset, H5T_NATIVE_INT, H5S_PLIST, H5S_PLIST, xfer, rbuf);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    if(H5Pclose(xfer2) < 0) TEST_ERROR
+    if(H5Pclose(xfer) < 0) TEST_ERROR
+    if(H5Sclose(mspace) < 0) TEST_ERROR
+    if(H5Sclose(fspace) < 0) TEST_ERROR
+    if(H5Dclose(dataset) < 0) TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(xfer2);
+        H5Pclose(xfer);
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+        H5Dclose(dataset);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return FAIL;
+} /* end test_io_plan() */
+
+
 /*-------------------------------------------------------------------------
  * Function:  test_userblock_offset
  *
@@ -13277,6 +13421,7 @@ main(void)
 
             nerrors += (test_create(file) < 0             ? 1 : 0);
             nerrors += (test_simple_io(envval, my_fapl) < 0        ? 1 : 0);
+            nerrors += (test_io_plan(file) < 0                ? 1 : 0);
             nerrors += (test_compact_io(my_fapl) < 0          ? 1 : 0);
             nerrors += (test_max_compact(my_fapl) < 0        ? 1 : 0);
             nerrors += (test_compact_open_close_dirty(my_fapl) < 0     ? 1 : 0);
@@ -157,6 +157,13 @@ typedef struct fheap_heap_ids_t {
     size_t *offs;               /* Array of object offsets (in global shared write buffer) */
 } fheap_heap_ids_t;
 
+/* Expected value of an object operated on */
+typedef struct fheap_obj_check_t {
+    const unsigned char *obj;   /* Expected object */
+    size_t      len;            /* Expected length of object */
+    unsigned    count;          /* # of times object was operated on */
+} fheap_obj_check_t;
+
 /* Local variables */
 unsigned char *shared_wobj_g;   /* Pointer to shared write buffer for objects */
 unsigned char *shared_robj_g;   /* Pointer to shared read buffer for objects */
@@ -334,6 +341,34 @@ op_memcpy(const void *obj, size_t obj_len, void *op_data)
     return(SUCCEED);
 } /* op_memcpy() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	op_check
+ *
+ * Purpose:	Compare an object against its expected value, counting the
+ *              number of times the object is operated on
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+op_check(const void *obj, size_t obj_len, void *op_data)
+{
+    fheap_obj_check_t *check = (fheap_obj_check_t *)op_data;
+
+    /* Check the object */
+    if(obj_len != check->len || HDmemcmp(obj, check->obj, obj_len))
+        return(FAIL);
+
+    /* Count the operation */
+    check->count++;
+
+    return(SUCCEED);
+} /* op_check() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	add_obj
@@ -7917,6 +7952,126 @@ error:
     return(1);
 } /* test_man_remove_first_row() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_man_op_batch
+ *
+ * Purpose:	Test operating on a batch of objects spread across the first
+ *              row of direct blocks in heap, along with a 'tiny' and a
+ *              'huge' object, then removing all the objects
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_man_op_batch(hid_t fapl, H5HF_create_t *cparam, fheap_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    char	filename[FHEAP_FILENAME_LEN];         /* Filename to use */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    H5HF_t      *fh = NULL;             /* Fractal heap wrapper */
+    haddr_t     fh_addr;                /* Address of fractal heap */
+    fheap_heap_ids_t keep_ids;          /* Structure to retain heap IDs */
+    h5_stat_size_t       empty_size;             /* Size of a file with an empty heap */
+    size_t      fill_size;              /* Size of objects for "bulk" filled blocks */
+    size_t      id_len;                 /* Size of fractal heap IDs */
+    fheap_heap_state_t state;           /* State of fractal heap */
+    const void **ids = NULL;            /* Heap IDs of objects in batch */
+    void **op_data = NULL;              /* 'op' callback data for objects in batch */
+    fheap_obj_check_t *check = NULL;    /* Expected values of objects in batch */
+    size_t      u;                      /* Local index variable */
+    const char *base_desc = "operating on a batch of objects in absolute heap %s";       /* Test description */
+
+    /* Perform common test initialization operations */
+    if(begin_test(tparam, base_desc, &keep_ids, &fill_size) < 0)
+        TEST_ERROR
+
+    /* Perform common file & heap open operations */
+    if(open_heap(filename, fapl, cparam, tparam, &file, &f, &fh, &fh_addr, &state, &empty_size) < 0)
+        TEST_ERROR
+
+
+    /* Fill first row of direct blocks */
+    if(fill_root_row(fh, 0, fill_size, &state, &keep_ids))
+        TEST_ERROR
+
+    /* Insert a 'tiny' object */
+    if(add_obj(fh, (size_t)10, (size_t)1, &state, &keep_ids))
+        TEST_ERROR
+
+    /* Insert a 'huge' object */
+    if(add_obj(fh, (size_t)20, (size_t)(cparam->max_man_size + 1), NULL, &keep_ids))
+        TEST_ERROR
+    state.huge_nobjs++;
+    state.huge_size += cparam->max_man_size + 1;
+
+    /* Check for closing & re-opening the heap */
+    if(reopen_heap(f, &fh, fh_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Set up the batch, with the objects in reverse order */
+    if(H5HF_get_id_len(fh, &id_len) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == (ids = (const void **)H5MM_malloc(sizeof(void *) * keep_ids.num_ids)))
+        TEST_ERROR
+    if(NULL == (op_data = (void **)H5MM_malloc(sizeof(void *) * keep_ids.num_ids)))
+        TEST_ERROR
+    if(NULL == (check = (fheap_obj_check_t *)H5MM_calloc(sizeof(fheap_obj_check_t) * keep_ids.num_ids)))
+        TEST_ERROR
+    for(u = 0; u < keep_ids.num_ids; u++) {
+        size_t obj_idx = keep_ids.num_ids - (u + 1);
+
+        check[u].obj = &shared_wobj_g[keep_ids.offs[obj_idx]];
+        check[u].len = keep_ids.lens[obj_idx];
+        ids[u] = &keep_ids.ids[id_len * obj_idx];
+        op_data[u] = &check[u];
+    } /* end for */
+
+    /* Operate on all the objects at once */
+    if(H5HF_op_batch(fh, keep_ids.num_ids, ids, op_check, op_data) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify that each object was operated on exactly once */
+    for(u = 0; u < keep_ids.num_ids; u++)
+        if(check[u].count != 1)
+            TEST_ERROR
+
+
+    /* Perform common file & heap close operations */
+    if(close_heap(filename, fapl, tparam, file, f, &fh, fh_addr, &state, &keep_ids, empty_size) < 0)
+        TEST_ERROR
+
+    /* Free resources */
+    H5MM_xfree((void *)ids);
+    H5MM_xfree(op_data);
+    H5MM_xfree(check);
+    H5MM_xfree(keep_ids.ids);
+    H5MM_xfree(keep_ids.lens);
+    H5MM_xfree(keep_ids.offs);
+
+    /* All tests passed */
+    PASSED()
+
+    return(0);
+
+error:
+    H5E_BEGIN_TRY {
+        H5MM_xfree((void *)ids);
+        H5MM_xfree(op_data);
+        H5MM_xfree(check);
+        H5MM_xfree(keep_ids.ids);
+        H5MM_xfree(keep_ids.lens);
+        H5MM_xfree(keep_ids.offs);
+        if(fh)
+            H5HF_close(fh);
+	H5Fclose(file);
+    } H5E_END_TRY;
+    return(1);
+} /* test_man_op_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_man_remove_first_two_rows
@@ -16574,6 +16729,7 @@ main(void)
                         nerrors += test_man_remove_root_direct(fapl, &small_cparam, &tparam);
                         nerrors += test_man_remove_two_direct(fapl, &small_cparam, &tparam);
                         nerrors += test_man_remove_first_row(fapl, &small_cparam, &tparam);
+                        nerrors += test_man_op_batch(fapl, &small_cparam, &tparam);
                         nerrors += test_man_remove_first_two_rows(fapl, &small_cparam, &tparam);
                         nerrors += test_man_remove_first_four_rows(fapl, &small_cparam, &tparam);
                         if(ExpressMode > 1)
@@ -83,7 +83,8 @@ main(void)
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
         TRUE,
 	FALSE,
-        -1};
+        -1,
+        FALSE};
 
 
     /* check endianess */
@@ -54,6 +54,7 @@ const char *FILENAME[] = {
     "gheap3",
     "gheap4",
     "gheapooo",
+    "gheapbatch",
     NULL
 };
 
@@ -566,6 +567,128 @@ test_ooo_indices(hid_t fapl)
     return MAX(1, nerrors);
 } /* end test_ooo_indices */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_batch
+ *
+ * Purpose:     Inserts and reads objects with a batch of global heap
+ *              operations, checking that reserved objects share a
+ *              collection.
+ *
+ * Return:      Success:    0
+ *
+ *              Failure:    number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_batch(hid_t fapl)
+{
+    hid_t       file = H5I_INVALID_HID;
+    H5F_t       *f = NULL;
+    H5HG_t      *obj = NULL;
+    H5HG_batch_t batch;
+    hbool_t     batch_started = FALSE;
+    uint8_t     out[GHEAP_TEST_NOBJS];
+    uint8_t     in[GHEAP_TEST_NOBJS];
+    size_t      u;
+    size_t      size;
+    int         nerrors = 0;
+    char        filename[1024];
+
+    TESTING("batched insertion and reading");
+
+    /* Allocate buffer for H5HG_t, with room for an unreserved object */
+    if(NULL == (obj = (H5HG_t *)HDmalloc(sizeof(H5HG_t) * (GHEAP_TEST_NOBJS + 1))))
+        goto error;
+
+    /* Open a clean file */
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if(NULL == (f = (H5F_t *)H5VL_object(file))) {
+        H5_FAILED();
+        HDputs("    Unable to create file");
+        goto error;
+    }
+
+    /* Reserve space for the objects, then insert them */
+    if(H5HG_batch_init(&batch, f) < 0)
+        goto error;
+    batch_started = TRUE;
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++)
+        if(H5HG_batch_reserve(&batch, u % 37) < 0)
+            goto error;
+    for(u = 0; u < GHEAP_TEST_NOBJS + 1; u++) {
+        size = u % 37;
+        HDmemset(out, (int)('A' + u % 26), size);
+        if(H5HG_batch_insert(&batch, size, out, obj + u) < 0)
+            GHEAP_REPEATED_ERR("    Unable to insert object into global heap")
+        else if(u < GHEAP_TEST_NOBJS && !H5F_addr_eq(obj[0].addr, obj[u].addr))
+            GHEAP_REPEATED_ERR("    Reserved objects are not in the same collection")
+    }
+    batch_started = FALSE;
+    if(H5HG_batch_end(&batch) < 0)
+        goto error;
+
+    /* Reopen the file */
+    if(H5Fclose(file) < 0)
+        goto error;
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        goto error;
+    if(NULL == (f = (H5F_t *)H5VL_object(file))) {
+        H5_FAILED();
+        HDputs("    Unable to open file");
+        goto error;
+    }
+
+    /* Read the objects back, with and without a batch */
+    if(H5HG_batch_init(&batch, f) < 0)
+        goto error;
+    batch_started = TRUE;
+    for(u = 0; u < GHEAP_TEST_NOBJS + 1; u++) {
+        size = u % 37;
+        HDmemset(out, (int)('A' + u % 26), size);
+        if(H5HG_batch_read(&batch, obj + u, in) < 0)
+            GHEAP_REPEATED_ERR("    Unable to read object")
+        else if(HDmemcmp(in, out, size))
+            GHEAP_REPEATED_ERR("    Value read doesn't match value written")
+    }
+    batch_started = FALSE;
+    if(H5HG_batch_end(&batch) < 0)
+        goto error;
+    for(u = 0; u < GHEAP_TEST_NOBJS + 1; u++) {
+        size = u % 37;
+        HDmemset(out, (int)('A' + u % 26), size);
+        if(NULL == H5HG_read(f, obj + u, in, NULL))
+            GHEAP_REPEATED_ERR("    Unable to read object")
+        else if(HDmemcmp(in, out, size))
+            GHEAP_REPEATED_ERR("    Value read doesn't match value written")
+    }
+
+    /* Release buffer */
+    HDfree(obj);
+    obj = NULL;
+
+    if(H5Fclose(file) < 0)
+        goto error;
+    if(nerrors)
+        goto error;
+
+    PASSED();
+    return 0;
+
+error:
+    if(batch_started)
+        H5HG_batch_end(&batch);
+    H5E_BEGIN_TRY {
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(obj)
+        HDfree(obj);
+    return MAX(1, nerrors);
+} /* end test_batch */
+
 
 /*-------------------------------------------------------------------------
  * Function:	main
@@ -596,6 +719,7 @@ main (void)
     nerrors += test_3(fapl_id);
     nerrors += test_4(fapl_id);
     nerrors += test_ooo_indices(fapl_id);
+    nerrors += test_batch(fapl_id);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl_id) < 0 ? 1 : 0);
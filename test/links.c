@@ -315,6 +315,12 @@ typedef struct {
     const obj_visit_t *info;    /* Pointer to the object visit structure to use */
 } ovisit_ud_t;
 
+typedef struct {
+    unsigned idx;               /* Index in object visit structure */
+    const obj_visit_t *info;    /* Pointer to the object visit structure to use */
+    unsigned fields;            /* Selection of object info visited with */
+} ovisit_fields_ud_t;
+
 static hid_t dcpl_g; /* for [un]minimized dataset object headers */
 
 
@@ -9825,6 +9831,123 @@ error:
 } /* end obj_visit_stop() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    visit_obj_fields_cb
+ *
+ * Purpose:     Callback routine for visiting objects in a file, checking
+ *              that exactly the selected fields of the object info are
+ *              filled in, with the same values H5Oget_info gives
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+visit_obj_fields_cb(hid_t group_id, const char *name, const H5O_info_t *oinfo,
+    void *_op_data)
+{
+    ovisit_fields_ud_t *op_data = (ovisit_fields_ud_t *)_op_data;
+    H5O_info_t full_oinfo;      /* Object info for all fields */
+
+    /* Check for correct object path */
+    if(HDstrcmp(op_data->info[op_data->idx].path, name)) return(H5_ITER_ERROR);
+
+    /* Get all the object's info */
+    if(H5Oget_info_by_name2(group_id, name, &full_oinfo, H5O_INFO_ALL, H5P_DEFAULT) < 0) return(H5_ITER_ERROR);
+    if(op_data->info[op_data->idx].type != full_oinfo.type) return(H5_ITER_ERROR);
+
+    /* Check the selected fields of the object info */
+    if(op_data->fields & H5O_INFO_BASIC) {
+        if(oinfo->fileno != full_oinfo.fileno) return(H5_ITER_ERROR);
+        if(oinfo->addr != full_oinfo.addr) return(H5_ITER_ERROR);
+        if(oinfo->type != full_oinfo.type) return(H5_ITER_ERROR);
+        if(oinfo->rc != full_oinfo.rc) return(H5_ITER_ERROR);
+    } /* end if */
+    else
+        if(oinfo->addr != 0 || oinfo->rc != 0) return(H5_ITER_ERROR);
+    if(op_data->fields & H5O_INFO_NUM_ATTRS) {
+        if(oinfo->num_attrs != full_oinfo.num_attrs) return(H5_ITER_ERROR);
+    } /* end if */
+    if(op_data->fields & H5O_INFO_HDR) {
+        if(oinfo->hdr.nmesgs != full_oinfo.hdr.nmesgs) return(H5_ITER_ERROR);
+        if(oinfo->hdr.space.total != full_oinfo.hdr.space.total) return(H5_ITER_ERROR);
+    } /* end if */
+    else
+        if(oinfo->hdr.nmesgs != 0) return(H5_ITER_ERROR);
+
+    /* Advance to next location in expected output */
+    op_data->idx++;
+
+    return(H5_ITER_CONT);
+} /* end visit_obj_fields_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    obj_visit_fields
+ *
+ * Purpose:     Test that the object visiting routine visits the same
+ *              objects, once each, whichever fields of the object info are
+ *              selected, including only the basic fields (which are
+ *              filled in without decoding the objects' headers again).
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+obj_visit_fields(hid_t fapl, hbool_t new_format)
+{
+    unsigned fields[] = {H5O_INFO_BASIC, H5O_INFO_ALL, H5O_INFO_BASIC | H5O_INFO_NUM_ATTRS,
+        H5O_INFO_HDR, 0};
+    ovisit_fields_ud_t udata;   /* User-data for visiting */
+    hid_t fid = -1;
+    hid_t gid = -1;             /* Group ID */
+    size_t u;                   /* Local index variable */
+
+    if(new_format)
+        TESTING("object visiting with selected object info (w/new group format)")
+    else
+        TESTING("object visiting with selected object info")
+
+    /* Construct "interesting" file to visit */
+    if((fid = build_visit_file(fapl)) < 0) TEST_ERROR
+
+    for(u = 0; u < sizeof(fields) / sizeof(fields[0]); u++) {
+        /* Visit all the objects reachable from the root group */
+        udata.idx = 0;
+        udata.info = new_format ? ovisit0_new : ovisit0_old;
+        udata.fields = fields[u];
+        if(H5Ovisit2(fid, H5_INDEX_NAME, H5_ITER_INC, visit_obj_fields_cb, &udata, fields[u]) < 0) FAIL_STACK_ERROR
+        if(udata.idx != sizeof(ovisit0_old) / sizeof(ovisit0_old[0])) TEST_ERROR
+
+        /* Visit all the objects reachable from an internal group, through
+         * a cycle of hard links back to the root group
+         */
+        if((gid = H5Gopen2(fid, "/Group1/Group2", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        udata.idx = 0;
+        udata.info = new_format ? ovisit2_new : ovisit2_old;
+        if(H5Ovisit2(gid, H5_INDEX_NAME, H5_ITER_INC, visit_obj_fields_cb, &udata, fields[u]) < 0) FAIL_STACK_ERROR
+        if(udata.idx != sizeof(ovisit2_old) / sizeof(ovisit2_old[0])) TEST_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Close file created */
+    if(H5Fclose(fid) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end obj_visit_fields() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    link_filters
  *
@@ -10492,6 +10615,378 @@ error:
     return -1;
 } /* end obj_exists() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    link_lookup_index
+ *
+ * Purpose:     Look up links by name in a large open group, with the
+ *              file's in-memory link lookup index enabled, and verify
+ *              that lookups see links that are created and deleted.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+link_lookup_index(hid_t fapl, hbool_t new_format)
+{
+    char filename[NAME_BUF_SIZE];       /* Buffer for file name */
+    char objname[NAME_BUF_SIZE];        /* Object name */
+    hid_t fid = -1;     /* File ID */
+    hid_t gid = -1;     /* Group ID */
+    hid_t oid = -1;     /* Object ID */
+    hid_t my_fapl = -1; /* File access property list ID */
+    hbool_t use_index;  /* Whether the link lookup index is used */
+    unsigned u;         /* Local index variable */
+
+    if(new_format)
+        TESTING("link lookup index (w/new group format)")
+    else
+        TESTING("link lookup index")
+
+    /* Set up filename and create file */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create a group with many links, including a soft link */
+    if((gid = H5Gcreate2(fid, "grp", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 200; u++) {
+        HDsprintf(objname, "obj%03u", u);
+        if((oid = H5Gcreate2(gid, objname, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gclose(oid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Lcreate_soft("obj000", gid, "soft", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Enable the link lookup index */
+    if((my_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_link_lookup_index(my_fapl, &use_index) < 0) FAIL_STACK_ERROR
+    if(use_index) TEST_ERROR
+    if(H5Pset_link_lookup_index(my_fapl, TRUE) < 0) FAIL_STACK_ERROR
+    if(H5Pget_link_lookup_index(my_fapl, &use_index) < 0) FAIL_STACK_ERROR
+    if(!use_index) TEST_ERROR
+
+    /* Re-open the file and the group, and look up all its links */
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, my_fapl)) < 0) FAIL_STACK_ERROR
+    if((gid = H5Gopen2(fid, "grp", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 200; u++) {
+        HDsprintf(objname, "obj%03u", u);
+        if(TRUE != H5Lexists(gid, objname, H5P_DEFAULT)) TEST_ERROR
+        if((oid = H5Oopen(gid, objname, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Oclose(oid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(FALSE != H5Lexists(gid, "missing", H5P_DEFAULT)) TEST_ERROR
+    if((oid = H5Oopen(gid, "soft", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Oclose(oid) < 0) FAIL_STACK_ERROR
+    if(TRUE != H5Lexists(fid, "grp/obj100", H5P_DEFAULT)) TEST_ERROR
+
+    /* Modify the group's links, and verify that lookups see the changes */
+    if(H5Ldelete(gid, "obj010", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(FALSE != H5Lexists(gid, "obj010", H5P_DEFAULT)) TEST_ERROR
+    if((oid = H5Gcreate2(gid, "missing", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(oid) < 0) FAIL_STACK_ERROR
+    if(TRUE != H5Lexists(gid, "missing", H5P_DEFAULT)) TEST_ERROR
+    for(u = 0; u < 200; u++) {
+        HDsprintf(objname, "obj%03u", u);
+        if((u == 10) != (FALSE == H5Lexists(gid, objname, H5P_DEFAULT))) TEST_ERROR
+    } /* end for */
+    if(H5Lmove(gid, "obj020", gid, "moved", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(FALSE != H5Lexists(gid, "obj020", H5P_DEFAULT)) TEST_ERROR
+    if(TRUE != H5Lexists(gid, "moved", H5P_DEFAULT)) TEST_ERROR
+    if(H5Ldelete(gid, "soft", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        oid = H5Oopen(gid, "soft", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(oid >= 0) TEST_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Verify the changes without the index */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+    if(FALSE != H5Lexists(fid, "grp/obj010", H5P_DEFAULT)) TEST_ERROR
+    if(FALSE != H5Lexists(fid, "grp/obj020", H5P_DEFAULT)) TEST_ERROR
+    if(TRUE != H5Lexists(fid, "grp/moved", H5P_DEFAULT)) TEST_ERROR
+    if(TRUE != H5Lexists(fid, "grp/missing", H5P_DEFAULT)) TEST_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if(H5Pclose(my_fapl) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Oclose(oid);
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end link_lookup_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    path_cache
+ *
+ * Purpose:     Open objects by absolute paths in a deep hierarchy, and
+ *              verify that the paths still resolve correctly after the
+ *              links in them are moved or deleted, and after a file is
+ *              mounted on and unmounted from a group in them.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+path_cache(hid_t fapl, hbool_t new_format)
+{
+    char filename[NAME_BUF_SIZE];       /* Buffer for file name */
+    char filename2[NAME_BUF_SIZE];      /* Buffer for name of file to mount */
+    char objname[NAME_BUF_SIZE];        /* Object name */
+    char namebuf[NAME_BUF_SIZE];        /* Name of opened object */
+    hid_t fid = -1, fid2 = -1;          /* File IDs */
+    hid_t gid = -1;                     /* Group ID */
+    hid_t lcpl_id = -1;                 /* Link creation property list ID */
+    unsigned u;                         /* Local index variable */
+
+    if(new_format)
+        TESTING("path cache (w/new group format)")
+    else
+        TESTING("path cache")
+
+    /* Create the file to mount, with one group */
+    h5_fixname(FILENAME[1], fapl, filename2, sizeof filename2);
+    if((fid2 = H5Fcreate(filename2, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((gid = H5Gcreate2(fid2, "inner", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+
+    /* Create a deep hierarchy of groups */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((lcpl_id = H5Pcreate(H5P_LINK_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_create_intermediate_group(lcpl_id, TRUE) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4; u++) {
+        HDsprintf(objname, "/run/step%u/field/u", u);
+        if((gid = H5Gcreate2(fid, objname, lcpl_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+        HDsprintf(objname, "/run/step%u/field/v", u);
+        if((gid = H5Gcreate2(fid, objname, lcpl_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Open the groups repeatedly by absolute paths, and check their names */
+    for(u = 0; u < 8; u++) {
+        HDsprintf(objname, "/run/step%u/field/%c", u % 4, (u < 4 ? 'u' : 'v'));
+        if((gid = H5Gopen2(fid, objname, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Iget_name(gid, namebuf, sizeof namebuf) < 0) FAIL_STACK_ERROR
+        if(HDstrcmp(namebuf, objname)) TEST_ERROR
+        if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if((gid = H5Gopen2(fid, "//run/./step1//field/./v", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Iget_name(gid, namebuf, sizeof namebuf) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(namebuf, "/run/step1/field/v")) TEST_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if((gid = H5Gopen2(fid, "/run/step2/field/.", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Iget_name(gid, namebuf, sizeof namebuf) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(namebuf, "/run/step2/field")) TEST_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+
+    /* Move and delete links in the paths */
+    if(H5Lmove(fid, "/run/step0", fid, "/run/old0", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/run/step0", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if((gid = H5Gopen2(fid, "/run/old0/field/u", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Iget_name(gid, namebuf, sizeof namebuf) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(namebuf, "/run/old0/field/u")) TEST_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if(H5Ldelete(fid, "/run/step1/field", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/run/step1/field", H5P_DEFAULT) != FALSE) TEST_ERROR
+    H5E_BEGIN_TRY {
+        gid = H5Gopen2(fid, "/run/step1/field/u", H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(gid >= 0) TEST_ERROR
+
+    /* Re-create a moved group's path */
+    if((gid = H5Gcreate2(fid, "/run/step0/field/w", lcpl_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/run/step0/field/w", H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Lexists(fid, "/run/step0/field/u", H5P_DEFAULT) != FALSE) TEST_ERROR
+
+    /* Mount a file on a group in the paths, then unmount it */
+    if(H5Fmount(fid, "/run/step0/field", fid2, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/run/step0/field/w", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if((gid = H5Gopen2(fid, "/run/step0/field/inner", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Iget_name(gid, namebuf, sizeof namebuf) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(namebuf, "/run/step0/field/inner")) TEST_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/run/step0/field/inner", H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Funmount(fid, "/run/step0/field") < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/run/step0/field/inner", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Lexists(fid, "/run/step0/field/w", H5P_DEFAULT) != TRUE) TEST_ERROR
+
+    /* Paths through soft links */
+    if(H5Lcreate_soft("/run/old0", fid, "/alias", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/alias/field/u", H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Ldelete(fid, "/run/old0/field/u", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lexists(fid, "/alias/field/u", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Lexists(fid, "/alias/field/v", H5P_DEFAULT) != TRUE) TEST_ERROR
+
+    if(H5Pclose(lcpl_id) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid2) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Pclose(lcpl_id);
+        H5Fclose(fid);
+        H5Fclose(fid2);
+    } H5E_END_TRY;
+    return -1;
+} /* end path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    group_create_multi
+ *
+ * Purpose:     Create many groups with one call to H5Gcreate_multi, in
+ *              groups that stay "compact", that become "dense" and that
+ *              use the "old format", and check that bad names are caught
+ *              before any group is created.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+group_create_multi(hid_t fapl, hbool_t new_format)
+{
+    char filename[NAME_BUF_SIZE];       /* Buffer for file name */
+    char namebufs[CORDER_NLINKS][NAME_BUF_SIZE];    /* Names of the groups to create */
+    const char *names[CORDER_NLINKS];   /* Pointers to names */
+    char namebuf[NAME_BUF_SIZE];        /* Name of link */
+    hid_t fid = -1;                     /* File ID */
+    hid_t gid = -1, gid2 = -1;          /* Group IDs */
+    hid_t gcpl_id = -1;                 /* Group creation property list ID */
+    hid_t lcpl_id = -1;                 /* Link creation property list ID */
+    H5G_info_t grp_info;                /* Info about group */
+    herr_t ret;                         /* Generic return value */
+    unsigned u;                         /* Local index variable */
+
+    if(new_format)
+        TESTING("creating many groups at once (w/new group format)")
+    else
+        TESTING("creating many groups at once")
+
+    for(u = 0; u < CORDER_NLINKS; u++) {
+        HDsprintf(namebufs[u], "grp %02u", (CORDER_NLINKS - 1) - u);
+        names[u] = namebufs[u];
+    } /* end for */
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create a group that tracks creation order, with one link in it */
+    if((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED) < 0) FAIL_STACK_ERROR
+    if(H5Pset_link_phase_change(gcpl_id, 8, 6) < 0) FAIL_STACK_ERROR
+    if((gid = H5Gcreate2(fid, "corder", H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((gid2 = H5Gcreate2(gid, "first", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid2) < 0) FAIL_STACK_ERROR
+
+    /* Add a few groups, staying in "compact" storage */
+    if(H5Gcreate_multi(gid, (size_t)4, names, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Gget_info(gid, &grp_info) < 0) FAIL_STACK_ERROR
+    if(grp_info.nlinks != 5) TEST_ERROR
+    if(grp_info.storage_type != H5G_STORAGE_TYPE_COMPACT) TEST_ERROR
+
+    /* Add the rest, switching to "dense" storage */
+    if(H5Gcreate_multi(gid, (size_t)(CORDER_NLINKS - 4), names + 4, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Gget_info(gid, &grp_info) < 0) FAIL_STACK_ERROR
+    if(grp_info.nlinks != (CORDER_NLINKS + 1)) TEST_ERROR
+    if(grp_info.storage_type != H5G_STORAGE_TYPE_DENSE) TEST_ERROR
+    if(grp_info.max_corder != (CORDER_NLINKS + 1)) TEST_ERROR
+
+    /* Check the groups, in creation and name order */
+    for(u = 0; u < CORDER_NLINKS; u++) {
+        if(H5Lget_name_by_idx(gid, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)(u + 1), namebuf, sizeof namebuf, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(HDstrcmp(namebuf, names[u])) TEST_ERROR
+        if(H5Lget_name_by_idx(gid, ".", H5_INDEX_NAME, H5_ITER_DEC, (hsize_t)u, namebuf, sizeof namebuf, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(HDstrcmp(namebuf, names[u])) TEST_ERROR
+        if((gid2 = H5Gopen2(gid, names[u], H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Gget_info(gid2, &grp_info) < 0) FAIL_STACK_ERROR
+        if(grp_info.nlinks != 0) TEST_ERROR
+        if(H5Gclose(gid2) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+
+    /* Create groups in a group with the default format, at the root, then
+     * in a group with UTF-8 link names
+     */
+    if(H5Gcreate_multi(fid, (size_t)CORDER_NLINKS, names, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Gget_info(fid, &grp_info) < 0) FAIL_STACK_ERROR
+    if(grp_info.nlinks != (CORDER_NLINKS + 1)) TEST_ERROR
+    if((gid = H5Gcreate2(fid, "utf8", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((lcpl_id = H5Pcreate(H5P_LINK_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_char_encoding(lcpl_id, H5T_CSET_UTF8) < 0) FAIL_STACK_ERROR
+    if(H5Gcreate_multi(gid, (size_t)CORDER_NLINKS, names, lcpl_id, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Gget_info(gid, &grp_info) < 0) FAIL_STACK_ERROR
+    if(grp_info.nlinks != CORDER_NLINKS) TEST_ERROR
+    for(u = 0; u < CORDER_NLINKS; u++) {
+        H5L_info_t linfo;               /* Link information */
+
+        if(H5Lget_info(gid, names[u], &linfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(linfo.cset != H5T_CSET_UTF8) TEST_ERROR
+        if(H5Lexists(fid, names[u], H5P_DEFAULT) != TRUE) TEST_ERROR
+    } /* end for */
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+
+    /* Bad names must fail without creating any group */
+    if((gid = H5Gcreate2(fid, "bad", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    names[1] = names[0];
+    H5E_BEGIN_TRY {
+        ret = H5Gcreate_multi(gid, (size_t)3, names, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    names[1] = "a/b";
+    H5E_BEGIN_TRY {
+        ret = H5Gcreate_multi(gid, (size_t)3, names, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    names[1] = namebufs[1];
+    if(H5Gcreate_multi(gid, (size_t)1, names + 2, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Gcreate_multi(gid, (size_t)3, names, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Gget_info(gid, &grp_info) < 0) FAIL_STACK_ERROR
+    if(grp_info.nlinks != 1) TEST_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+
+    if(H5Pclose(lcpl_id) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(gcpl_id) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid2);
+        H5Gclose(gid);
+        H5Pclose(lcpl_id);
+        H5Pclose(gcpl_id);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end group_create_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    corder_create_empty
@@ -15056,8 +15551,12 @@ main(void)
             nerrors += obj_visit(my_fapl, new_format) < 0 ? 1 : 0;
             nerrors += obj_visit_by_name(my_fapl, new_format) < 0 ? 1 : 0;
             nerrors += obj_visit_stop(my_fapl, new_format) < 0 ? 1 : 0;
+            nerrors += obj_visit_fields(my_fapl, new_format) < 0 ? 1 : 0;
             nerrors += link_filters(my_fapl, new_format) < 0 ? 1 : 0;
             nerrors += obj_exists(my_fapl, new_format) < 0 ? 1 : 0;
+            nerrors += link_lookup_index(my_fapl, new_format) < 0 ? 1 : 0;
+            nerrors += path_cache(my_fapl, new_format) < 0 ? 1 : 0;
+            nerrors += group_create_multi(my_fapl, new_format) < 0 ? 1 : 0;
 
             /* Keep this test last, it's testing files that are used above */
             /* do not do this for files used by external link tests */
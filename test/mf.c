@@ -53,11 +53,13 @@
 #endif /* PB_OUT */
 #define TBLOCK_SIZE10   10
 #define TBLOCK_SIZE11   11
+#define TBLOCK_SIZE15   15
 #define TBLOCK_SIZE20   20
 #define TBLOCK_SIZE30   30
 #define TBLOCK_SIZE36   36
 #define TBLOCK_SIZE40   40
 #define TBLOCK_SIZE50   50
+#define TBLOCK_SIZE60   60
 #define TBLOCK_SIZE80   80
 #define TBLOCK_SIZE90   90
 #define TBLOCK_SIZE98   98
@@ -142,6 +144,7 @@ static unsigned test_mf_fs_gone(const char *env_h5_drvr, hid_t fapl, hbool_t new
 static unsigned test_mf_strat_thres_gone(const char *env_h5_drvr, hid_t fapl, hbool_t new_format);
 static unsigned test_mf_fs_persist(const char *env_h5_drvr, hid_t fapl, hbool_t new_format);
 static unsigned test_mf_strat_thres_persist(const char *env_h5_drvr, hid_t fapl, hbool_t new_format);
+static unsigned test_mf_extent_tree(hid_t fapl);
 #ifdef PB_OUT
 static unsigned test_mf_fs_persist_split(void);
 static unsigned test_mf_fs_persist_multi(void);
@@ -6093,6 +6096,164 @@ error:
     return(1);
 } /* test_mf_bug1() */
 
+/*
+ *-------------------------------------------------------------------------
+ * To verify that H5MF_alloc(), H5MF_xfree() and H5MF_try_extend() work with
+ * the extent trees of a file created with H5Pset_file_space_extent_tree():
+ *
+ *	Allocate 5 adjoining blocks A1..A5 of size 30, 50, 30, 20 and 10
+ *	Free A2 and A4: the tree holds 2 extents
+ *	Allocate a block of size 15: it's taken from A4, the best fit
+ *	Free A3: it's merged with A2 right away
+ *	Extend A1 by 60 into the merged extent
+ *	Free the rest: the merged extents end at EOA, which shrinks back
+ *	The file should be the size of an empty file when closed
+ *	Creating a file with extent trees and persistent free-space fails
+ *
+ * Return:	Success:	0
+ *		Failure:	number of errors
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_mf_extent_tree(hid_t fapl)
+{
+    hid_t		file = -1;              /* File ID */
+    hid_t		fcpl = -1;              /* File creation property list */
+    hid_t		fapl_new = -1;		/* copy of fapl */
+    char		filename[FILENAME_LEN]; /* Filename to use */
+    H5F_t		*f = NULL;              /* Internal file object pointer */
+    h5_stat_size_t      file_size, new_file_size; 	/* file size */
+    H5F_mem_page_t      fs_type;                /* Free space type */
+    H5F_sect_info_t     sect_info[2];           /* Free sections */
+    hbool_t             use_tree = FALSE;       /* Extent tree flag */
+    haddr_t             addr1, addr2, addr3, addr4, addr5, addr;
+
+    TESTING("H5MF_alloc()/H5MF_xfree() with extent trees");
+
+    /* Set the filename to use for this test (dependent on fapl) */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    /* Turn off using meta/small data aggregator */
+    if((fapl_new = H5Pcopy(fapl)) < 0) TEST_ERROR
+    if(H5Pset_meta_block_size(fapl_new, (hsize_t)0) < 0) TEST_ERROR
+    if(H5Pset_small_data_block_size(fapl_new, (hsize_t)0) < 0) TEST_ERROR
+
+    /* Track free space with extent trees */
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_file_space_extent_tree(fcpl, TRUE) < 0) TEST_ERROR
+    if(H5Pget_file_space_extent_tree(fcpl, &use_tree) < 0) TEST_ERROR
+    if(!use_tree) TEST_ERROR
+
+    /* Get the size of an empty file */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl_new)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+    if((file_size = h5_get_file_size(filename, fapl_new)) < 0)
+        TEST_ERROR
+
+    /* Create the file to work on */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl_new)) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == (f = (H5F_t *)H5VL_object(file)))
+        FAIL_STACK_ERROR
+    H5MF__alloc_to_fs_type(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE30, &fs_type);
+
+    /* Allocate 5 blocks */
+    addr1 = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE30);
+    addr2 = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE50);
+    addr3 = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE30);
+    addr4 = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE20);
+    addr5 = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE10);
+    if(addr2 != addr1 + TBLOCK_SIZE30 || addr3 != addr2 + TBLOCK_SIZE50 ||
+            addr4 != addr3 + TBLOCK_SIZE30 || addr5 != addr4 + TBLOCK_SIZE20)
+        TEST_ERROR
+
+    /* Free A2 and A4 */
+    if(H5MF_xfree(f, H5FD_MEM_SUPER, addr2, (hsize_t)TBLOCK_SIZE50) < 0)
+        FAIL_STACK_ERROR
+    if(H5MF_xfree(f, H5FD_MEM_SUPER, addr4, (hsize_t)TBLOCK_SIZE20) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == f->shared->fs_tree[fs_type])
+        TEST_ERROR
+    if(f->shared->fs_man[fs_type])
+        TEST_ERROR
+    if(f->shared->fs_tree[fs_type]->tot_space != (TBLOCK_SIZE50 + TBLOCK_SIZE20))
+        TEST_ERROR
+    if(H5SL_count(f->shared->fs_tree[fs_type]->addr_list) != 2)
+        TEST_ERROR
+
+    /* The smallest extent that fits is used */
+    addr = H5MF_alloc(f, H5FD_MEM_SUPER, (hsize_t)TBLOCK_SIZE15);
+    if(addr != addr4)
+        TEST_ERROR
+
+    /* Free A3, which is merged with A2 */
+    if(H5MF_xfree(f, H5FD_MEM_SUPER, addr3, (hsize_t)TBLOCK_SIZE30) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fget_free_sections(file, H5FD_MEM_SUPER, (size_t)2, sect_info) != 2)
+        TEST_ERROR
+    if(sect_info[0].addr != addr2 || sect_info[0].size != (TBLOCK_SIZE50 + TBLOCK_SIZE30))
+        TEST_ERROR
+    if(sect_info[1].addr != (addr4 + TBLOCK_SIZE15) || sect_info[1].size != (TBLOCK_SIZE20 - TBLOCK_SIZE15))
+        TEST_ERROR
+    if(H5Fget_freespace(file) != (TBLOCK_SIZE50 + TBLOCK_SIZE30 + TBLOCK_SIZE20 - TBLOCK_SIZE15))
+        TEST_ERROR
+
+    /* Extend A1 into the merged extent */
+    if(H5MF_try_extend(f, H5FD_MEM_SUPER, addr1, (hsize_t)TBLOCK_SIZE30, (hsize_t)TBLOCK_SIZE60) != TRUE)
+        TEST_ERROR
+    if(f->shared->fs_tree[fs_type]->tot_space != (TBLOCK_SIZE20 + TBLOCK_SIZE20 - TBLOCK_SIZE15))
+        TEST_ERROR
+
+    /* Free the rest of the blocks, which shrinks the EOA */
+    if(H5MF_xfree(f, H5FD_MEM_SUPER, addr5, (hsize_t)TBLOCK_SIZE10) < 0)
+        FAIL_STACK_ERROR
+    if(H5MF_xfree(f, H5FD_MEM_SUPER, addr, (hsize_t)TBLOCK_SIZE15) < 0)
+        FAIL_STACK_ERROR
+    if(H5MF_xfree(f, H5FD_MEM_SUPER, addr1, (hsize_t)(TBLOCK_SIZE30 + TBLOCK_SIZE60)) < 0)
+        FAIL_STACK_ERROR
+    if(f->shared->fs_tree[fs_type]->tot_space != 0)
+        TEST_ERROR
+    if(H5F_get_eoa(f, H5FD_MEM_SUPER) != addr1)
+        TEST_ERROR
+
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify the file is the correct size */
+    if((new_file_size = h5_get_file_size(filename, fapl_new)) < 0)
+        TEST_ERROR
+    if(new_file_size != file_size)
+        TEST_ERROR
+
+    /* Extent trees can't be used with persistent free-space */
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_FSM_AGGR, TRUE, (hsize_t)1) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        file = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl_new);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR
+
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(fapl_new) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED()
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(file);
+        H5Pclose(fcpl);
+        H5Pclose(fapl_new);
+    } H5E_END_TRY;
+    return 1;
+} /* test_mf_extent_tree() */
+
 /*
  * Verify that the file's free-space manager(s) are persistent for a split-file
  *-------------------------------------------------------------------------
@@ -8993,6 +9154,9 @@ main(void)
     /* tests for specific bugs */
     nerrors += test_mf_bug1(env_h5_drvr, fapl);
 
+    /* Tests for extent trees */
+    nerrors += test_mf_extent_tree(fapl);
+
     if(H5Pclose(new_fapl) < 0)
         FAIL_STACK_ERROR
     h5_cleanup(FILENAME, fapl);
@@ -301,12 +301,205 @@ error:
     return FAIL;
 } /* test_ohdr_cache() */
 
+/* Callback for counting objects visited */
+static herr_t
+count_visit_cb(hid_t H5_ATTR_UNUSED obj_id, const char H5_ATTR_UNUSED *name,
+    const H5O_info_t H5_ATTR_UNUSED *info, void *_count)
+{
+    unsigned *count = (unsigned *)_count;
+
+    (*count)++;
+
+    return H5_ITER_CONT;
+} /* count_visit_cb() */
+
+/*
+ *  Verify that object headers are read correctly with different speculative
+ *      read sizes, that an object header with several continuation chunks is
+ *      read correctly, and that a batch of object headers can be loaded into
+ *      the cache together.
+ */
+#define PREFETCH_NOBJS  40
+#define PREFETCH_NATTRS 30
+static herr_t
+test_ohdr_prefetch(char *filename, hid_t fapl)
+{
+    hid_t       file = -1;              /* File ID */
+    hid_t       my_fapl = -1;           /* FAPL ID */
+    hid_t       gcpl = -1;              /* Group creation property list ID */
+    hid_t       gid = -1;               /* Group ID */
+    hid_t       pad_gid = -1;           /* Group ID for padding objects */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       aid = -1;               /* Attribute ID */
+    H5F_t       *f = NULL;              /* File handle */
+    H5O_info_t  oinfo;                  /* Object info */
+    haddr_t     addrs[PREFETCH_NOBJS + 3];      /* Addresses of objects */
+    haddr_t     obj_addrs[PREFETCH_NOBJS];      /* Copy of addresses, as created */
+    size_t      read_sizes[] = {64, 4096};      /* Speculative read sizes to use */
+    size_t      read_size;              /* Speculative read size */
+    unsigned    count;                  /* # of objects visited */
+    char        name[32];               /* Object name */
+    int         val;                    /* Attribute value */
+    unsigned    u, v;                   /* Local index variables */
+    herr_t      ret;                    /* Generic return value */
+
+    TESTING("object header prefetching");
+
+    /* Check the speculative read size property */
+    if((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pget_ohdr_read_size(my_fapl, &read_size) < 0)
+        FAIL_STACK_ERROR
+    if(read_size != 512)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_ohdr_read_size(my_fapl, (size_t)32);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR
+
+    /* Create a file with a group of objects & an object with many chunks */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < PREFETCH_NOBJS; u++) {
+        HDsprintf(name, "obj%03u", u);
+        if((gid = H5Gcreate2(file, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Oget_info2(gid, &oinfo, H5O_INFO_BASIC) < 0)
+            FAIL_STACK_ERROR
+        obj_addrs[u] = oinfo.addr;
+        if(H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Lcreate_soft("/obj000", file, "soft", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    /* Keep the attributes in the object header, and put other objects
+     *  between its chunks, so that it needs many chunks
+     */
+    if((pad_gid = H5Gcreate2(file, "pad", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_attr_phase_change(gcpl, PREFETCH_NATTRS + 1, PREFETCH_NATTRS) < 0)
+        FAIL_STACK_ERROR
+    if((gid = H5Gcreate2(file, "multi", H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if((sid = H5Screate(H5S_SCALAR)) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < PREFETCH_NATTRS; u++) {
+        HDsprintf(name, "attr%03u", u);
+        if((aid = H5Acreate2(gid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        val = (int)u;
+        if(H5Awrite(aid, H5T_NATIVE_INT, &val) < 0)
+            FAIL_STACK_ERROR
+        if(H5Aclose(aid) < 0)
+            FAIL_STACK_ERROR
+        if(H5Gclose(H5Gcreate2(pad_gid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Oget_info2(gid, &oinfo, H5O_INFO_HDR) < 0)
+        FAIL_STACK_ERROR
+    if(oinfo.hdr.nchunks < 3)
+        TEST_ERROR
+    if(H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Gclose(pad_gid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(gcpl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    for(v = 0; v < NELMTS(read_sizes); v++) {
+        /* Re-open the file with the speculative read size */
+        if(H5Pset_ohdr_read_size(my_fapl, read_sizes[v]) < 0)
+            FAIL_STACK_ERROR
+        if((file = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+        if(NULL == (f = (H5F_t *)H5VL_object(file)))
+            FAIL_STACK_ERROR
+
+        /* Load the group's headers together, along with some bogus addresses */
+        HDmemcpy(addrs, obj_addrs, sizeof(obj_addrs));
+        addrs[PREFETCH_NOBJS] = HADDR_UNDEF;
+        addrs[PREFETCH_NOBJS + 1] = obj_addrs[0];
+        addrs[PREFETCH_NOBJS + 2] = H5F_get_eoa(f, H5FD_MEM_OHDR) + 1024;
+        if(H5O_prefetch(f, NELMTS(addrs), addrs) < 0)
+            FAIL_STACK_ERROR
+        if(H5F_HAS_FEATURE(f, H5FD_FEAT_ACCUMULATE_METADATA)) {
+            for(u = 0; u < PREFETCH_NOBJS; u++) {
+                unsigned status = 0;
+
+                if(H5AC_get_entry_status(f, obj_addrs[u], &status) < 0)
+                    FAIL_STACK_ERROR
+                if(!(status & H5AC_ES__IN_CACHE))
+                    TEST_ERROR
+            } /* end for */
+        } /* end if */
+
+        /* Visit all the objects */
+        count = 0;
+        if(H5Ovisit2(file, H5_INDEX_NAME, H5_ITER_INC, count_visit_cb, &count, H5O_INFO_BASIC) < 0)
+            FAIL_STACK_ERROR
+        if(count != (PREFETCH_NOBJS + PREFETCH_NATTRS + 3))
+            TEST_ERROR
+
+        /* Read the attributes of the object with many chunks */
+        if((gid = H5Gopen2(file, "multi", H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Oget_info2(gid, &oinfo, H5O_INFO_NUM_ATTRS) < 0)
+            FAIL_STACK_ERROR
+        if(oinfo.num_attrs != PREFETCH_NATTRS)
+            TEST_ERROR
+        for(u = 0; u < PREFETCH_NATTRS; u++) {
+            HDsprintf(name, "attr%03u", u);
+            if((aid = H5Aopen(gid, name, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if(H5Aread(aid, H5T_NATIVE_INT, &val) < 0)
+                FAIL_STACK_ERROR
+            if(val != (int)u)
+                TEST_ERROR
+            if(H5Aclose(aid) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+        if(H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR
+
+        if(H5Fclose(file) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(aid);
+        H5Sclose(sid);
+        H5Gclose(gid);
+        H5Gclose(pad_gid);
+        H5Pclose(gcpl);
+        H5Pclose(my_fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    return FAIL;
+} /* test_ohdr_prefetch() */
+
 /*
  *  To exercise the coding for the re-read of the object header for SWMR access.
  *  When the object header is read in H5O_load() of H5Ocache.c, the library initially reads
- *  H5O_SPEC_READ_SIZE (512, currently)  bytes for decoding, then reads the
- *  remaining bytes later if the object header is greater than H5O_SPEC_READ_SIZE
- *  bytes.  For SWMR access, the read should be done all at one time.
+ *  the FAPL's object header read size (512 by default) bytes for decoding, then reads the
+ *  remaining bytes later if the object header is greater than that size.
+ *  For SWMR access, the read should be done all at one time.
  */
 static herr_t
 test_ohdr_swmr(hbool_t new_format)
@@ -317,6 +510,7 @@ test_ohdr_swmr(hbool_t new_format)
     hid_t sid = -1;                 /* Dataspace ID */
     hid_t plist = -1;               /* Dataset creation property list */
     size_t compact_size = 1024;     /* The size of compact dataset */
+    size_t read_size = 0;           /* Size of speculative read of object headers */
     int *wbuf = NULL;               /* Buffer for writing */
     hsize_t dims[1];                /* Dimension sizes */
     size_t u;                       /* Iterator */
@@ -398,9 +592,11 @@ test_ohdr_swmr(hbool_t new_format)
         if(obj_info.hdr.version != OBJ_VERSION_LATEST)
             FAIL_STACK_ERROR
 
-    /* The size of object header should be greater than the speculative read size of H5O_SPEC_READ_SIZE */
+    /* The size of object header should be greater than the speculative read size */
     /* This will exercise the coding for the re-read of the object header for SWMR access */
-    if(obj_info.hdr.space.total < H5O_SPEC_READ_SIZE)
+    if(H5Pget_ohdr_read_size(fapl, &read_size) < 0)
+        FAIL_STACK_ERROR
+    if(obj_info.hdr.space.total < read_size)
         TEST_ERROR;
 
     /* Close the dataset */
@@ -1946,6 +2142,10 @@ main(void)
         if(test_ohdr_cache(filename, fapl) < 0)
             TEST_ERROR
 
+        /* Test object header prefetching & speculative read sizes */
+        if(test_ohdr_prefetch(filename, fapl) < 0)
+            TEST_ERROR
+
         if(test_minimized_dset_ohdr_attribute_addition(fapl) < 0)
             TEST_ERROR
 
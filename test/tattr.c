@@ -129,6 +129,10 @@ float attr_data5=-5.123F;        /* Test data for 5th attribute */
 #define NATTR_MANY_OLD  350
 #define NATTR_MANY_NEW  35000
 
+#define NATTR_READ_ALL  20
+#define READ_ALL_VLSTR_NAME "vlstr"
+#define READ_ALL_VLSTR  "variable-length string"
+
 #define BUG2_NATTR  100
 #define BUG2_NATTR2 16
 
@@ -4348,6 +4352,222 @@ test_attr_many(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 }   /* test_attr_many() */
 
+
+/****************************************************************
+**
+**  test_attr_read_all(): Test basic H5A (attribute) code.
+**      Tests reading all the attributes of an object at once
+**
+****************************************************************/
+static void
+test_attr_read_all(hid_t fcpl, hid_t fapl)
+{
+    hid_t    fid;        /* HDF5 File ID            */
+    hid_t    gid;            /* Group ID            */
+    hid_t    sid;            /* Dataspace ID            */
+    hid_t    aid;            /* Attribute ID            */
+    hid_t    tid;            /* Datatype ID             */
+    char    attrname[NAME_BUF_SIZE];        /* Name of attribute */
+    int     data[NATTR_READ_ALL];           /* Attribute data */
+    const char *vlstr = READ_ALL_VLSTR;     /* Variable-length string attribute data */
+    H5A_bulk_info_t info[NATTR_READ_ALL + 1];   /* Information for attributes */
+    size_t  nattrs;             /* # of attributes */
+    size_t  buf_size;           /* Size of buffer for attributes */
+    size_t  needed_size;        /* Size of buffer needed for attributes */
+    void    *buf;               /* Buffer for attributes */
+    ssize_t nread;              /* # of attributes read */
+    hsize_t dims;               /* Dimension size */
+    unsigned    u, v;           /* Local index variables */
+    herr_t    ret;        /* Generic return value        */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading All Attributes of an Object\n"));
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create group for attributes */
+    gid = H5Gcreate2(fid, GROUP1_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gcreate2");
+
+    /* Create attributes of different sizes, so they're stored densely
+     * with the "new format"
+     */
+    for(u = 0; u < NATTR_READ_ALL; u++) {
+        sprintf(attrname, "attr %02u", u);
+
+        dims = u + 1;
+        sid = H5Screate_simple(1, &dims, NULL);
+        CHECK(sid, FAIL, "H5Screate_simple");
+
+        aid = H5Acreate2(gid, attrname, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(aid, FAIL, "H5Acreate2");
+
+        for(v = 0; v <= u; v++)
+            data[v] = (int)(u * 100 + v);
+        ret = H5Awrite(aid, H5T_NATIVE_INT, data);
+        CHECK(ret, FAIL, "H5Awrite");
+
+        ret = H5Aclose(aid);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Create a variable-length string attribute */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+    tid = H5Tcopy(H5T_C_S1);
+    CHECK(tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    aid = H5Acreate2(gid, READ_ALL_VLSTR_NAME, tid, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(aid, FAIL, "H5Acreate2");
+    ret = H5Awrite(aid, tid, &vlstr);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+
+    ret = H5Tclose(tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Close group */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+
+    /* Re-open the file and read the attributes */
+
+    /* Re-open file */
+    fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    /* Re-open group */
+    gid = H5Gopen2(fid, GROUP1_NAME, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gopen2");
+
+    /* Query the number of attributes & the size of buffer needed */
+    nattrs = 0;
+    buf_size = 0;
+    nread = H5Aread_all(gid, H5_INDEX_NAME, H5_ITER_INC, &nattrs, NULL, &buf_size, NULL);
+    VERIFY(nread, 0, "H5Aread_all");
+    VERIFY(nattrs, NATTR_READ_ALL + 1, "H5Aread_all");
+    CHECK(buf_size, 0, "H5Aread_all");
+    needed_size = buf_size;
+
+    /* Read all the attributes */
+    buf = HDmalloc(needed_size);
+    CHECK_PTR(buf, "HDmalloc");
+    nread = H5Aread_all(gid, H5_INDEX_NAME, H5_ITER_INC, &nattrs, info, &buf_size, buf);
+    VERIFY(nread, NATTR_READ_ALL + 1, "H5Aread_all");
+    VERIFY(nattrs, NATTR_READ_ALL + 1, "H5Aread_all");
+    VERIFY(buf_size, needed_size, "H5Aread_all");
+
+    /* Verify the attributes, in increasing name order */
+    for(u = 0; u < NATTR_READ_ALL; u++) {
+        const int *read_data = (const int *)info[u].data;
+
+        sprintf(attrname, "attr %02u", u);
+        VERIFY_STR(info[u].name, attrname, "H5Aread_all");
+
+        ret = H5Tequal(info[u].type_id, H5T_NATIVE_INT);
+        VERIFY(ret, TRUE, "H5Tequal");
+        VERIFY(H5Sget_simple_extent_npoints(info[u].space_id), u + 1, "H5Sget_simple_extent_npoints");
+        VERIFY(info[u].data_size, (u + 1) * sizeof(int), "H5Aread_all");
+        for(v = 0; v <= u; v++)
+            VERIFY(read_data[v], (int)(u * 100 + v), "H5Aread_all");
+
+        ret = H5Tclose(info[u].type_id);
+        CHECK(ret, FAIL, "H5Tclose");
+        ret = H5Sclose(info[u].space_id);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Verify the variable-length string attribute */
+    VERIFY_STR(info[NATTR_READ_ALL].name, READ_ALL_VLSTR_NAME, "H5Aread_all");
+    ret = H5Tis_variable_str(info[NATTR_READ_ALL].type_id);
+    VERIFY(ret, TRUE, "H5Tis_variable_str");
+    VERIFY_STR(*(char **)info[NATTR_READ_ALL].data, READ_ALL_VLSTR, "H5Aread_all");
+    ret = H5Dvlen_reclaim(info[NATTR_READ_ALL].type_id, info[NATTR_READ_ALL].space_id, H5P_DEFAULT, info[NATTR_READ_ALL].data);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+    ret = H5Tclose(info[NATTR_READ_ALL].type_id);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(info[NATTR_READ_ALL].space_id);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Read the attributes in decreasing name order, with room for only a few */
+    nattrs = 3;
+    buf_size = needed_size;
+    nread = H5Aread_all(gid, H5_INDEX_NAME, H5_ITER_DEC, &nattrs, info, &buf_size, buf);
+    VERIFY(nread, 3, "H5Aread_all");
+    VERIFY(nattrs, NATTR_READ_ALL + 1, "H5Aread_all");
+    VERIFY_STR(info[0].name, READ_ALL_VLSTR_NAME, "H5Aread_all");
+    ret = H5Dvlen_reclaim(info[0].type_id, info[0].space_id, H5P_DEFAULT, info[0].data);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+    for(u = 0; u < 3; u++) {
+        if(u > 0) {
+            sprintf(attrname, "attr %02u", NATTR_READ_ALL - u);
+            VERIFY_STR(info[u].name, attrname, "H5Aread_all");
+            VERIFY(((const int *)info[u].data)[0], (int)((NATTR_READ_ALL - u) * 100), "H5Aread_all");
+        } /* end if */
+
+        ret = H5Tclose(info[u].type_id);
+        CHECK(ret, FAIL, "H5Tclose");
+        ret = H5Sclose(info[u].space_id);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Read the attributes with a buffer that's too small for all of them */
+    nattrs = NATTR_READ_ALL + 1;
+    buf_size = needed_size / 2;
+    nread = H5Aread_all(gid, H5_INDEX_NAME, H5_ITER_INC, &nattrs, info, &buf_size, buf);
+    CHECK(nread, FAIL, "H5Aread_all");
+    if(nread == 0 || nread > NATTR_READ_ALL)
+        TestErrPrintf("%d: wrong number of attributes read: %ld\n", __LINE__, (long)nread);
+    VERIFY(nattrs, NATTR_READ_ALL + 1, "H5Aread_all");
+    VERIFY(buf_size, needed_size, "H5Aread_all");
+    for(u = 0; u < (unsigned)nread; u++) {
+        sprintf(attrname, "attr %02u", u);
+        VERIFY_STR(info[u].name, attrname, "H5Aread_all");
+
+        ret = H5Tclose(info[u].type_id);
+        CHECK(ret, FAIL, "H5Tclose");
+        ret = H5Sclose(info[u].space_id);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    HDfree(buf);
+
+    /* Check the arguments are checked */
+    nattrs = NATTR_READ_ALL + 1;
+    buf_size = 0;
+    H5E_BEGIN_TRY {
+        nread = H5Aread_all(gid, H5_INDEX_NAME, H5_ITER_INC, &nattrs, NULL, &buf_size, NULL);
+    } H5E_END_TRY;
+    VERIFY(nread, FAIL, "H5Aread_all");
+    H5E_BEGIN_TRY {
+        nread = H5Aread_all(gid, H5_INDEX_N, H5_ITER_INC, &nattrs, info, &buf_size, NULL);
+    } H5E_END_TRY;
+    VERIFY(nread, FAIL, "H5Aread_all");
+
+    /* Close group */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+}   /* test_attr_read_all() */
+
 
 /****************************************************************
 **
@@ -11230,6 +11450,7 @@ test_attr(void)
                 test_attr_null_space(my_fcpl, my_fapl);         /* Test storing attribute with NULL dataspace */
                 test_attr_deprec(fcpl, my_fapl);                /* Test deprecated API routines */
                 test_attr_many(new_format, my_fcpl, my_fapl);               /* Test storing lots of attributes */
+                test_attr_read_all(my_fcpl, my_fapl);                       /* Test reading all attributes at once */
                 test_attr_info_null_info_pointer(my_fcpl, my_fapl); /* Test passing a NULL attribute info pointer to H5Aget_info(_by_name/_by_idx) */
                 test_attr_rename_invalid_name(my_fcpl, my_fapl); /* Test passing a NULL or empty attribute name to H5Arename(_by_name) */
                 test_attr_get_name_invalid_buf(my_fcpl, my_fapl); /* Test passing NULL buffer to H5Aget_name(_by_idx) */
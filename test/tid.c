@@ -727,6 +727,124 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+/* Test many IDs in one type, which grows and shrinks the type's ID table */
+#define TEST_MANY_NIDS 100000
+
+/* User data for test_many_ids_cb */
+typedef struct {
+    hid_t prev_id;              /* ID visited before the current one */
+    long nvisited;              /* # of IDs visited */
+    int *objs;                  /* Array of objects */
+} test_many_ids_ud_t;
+
+/* H5Isearch callback: check that IDs are visited in increasing order */
+static int test_many_ids_cb(void *obj, hid_t id, void *_udata)
+{
+    test_many_ids_ud_t *udata = (test_many_ids_ud_t *)_udata;
+
+    if(id <= udata->prev_id || (int *)obj != &udata->objs[*(int *)obj])
+        return -1;
+    udata->prev_id = id;
+    udata->nvisited++;
+
+    return 0;
+}
+
+static int test_many_ids(void)
+{
+    H5I_type_t obj_type;
+    hid_t *ids = NULL;
+    int *objs = NULL;
+    test_many_ids_ud_t udata;
+    hsize_t nmembers;
+    int i;
+    herr_t ret;         /* return value */
+
+    /* Register type */
+    obj_type = H5Iregister_type((size_t)64, 0, NULL);
+    CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+    if(obj_type == H5I_BADID)
+        goto out;
+
+    ids = (hid_t *)HDmalloc(TEST_MANY_NIDS * sizeof(hid_t));
+    objs = (int *)HDmalloc(TEST_MANY_NIDS * sizeof(int));
+    if(NULL == ids || NULL == objs)
+        goto out;
+
+    /* Register the IDs and look all of them up */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        objs[i] = i;
+        ids[i] = H5Iregister(obj_type, &objs[i]);
+        CHECK(ids[i], H5I_INVALID_HID, "H5Iregister");
+        if(ids[i] == H5I_INVALID_HID)
+            goto out;
+    }
+    for(i = 0; i < TEST_MANY_NIDS; i++)
+        if(H5Iobject_verify(ids[i], obj_type) != &objs[i]) {
+            TestErrPrintf("wrong object for ID %d\n", i);
+            goto out;
+        }
+
+    /* Remove all IDs but every tenth one */
+    for(i = 0; i < TEST_MANY_NIDS; i++)
+        if(i % 10) {
+            ret = H5Idec_ref(ids[i]);
+            VERIFY(ret, 0, "H5Idec_ref");
+            if(ret != 0)
+                goto out;
+        }
+    ret = H5Inmembers(obj_type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    VERIFY(nmembers, (hsize_t)(TEST_MANY_NIDS / 10), "H5Inmembers");
+    if(nmembers != (hsize_t)(TEST_MANY_NIDS / 10))
+        goto out;
+
+    /* Check which IDs are still valid */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        void *obj;
+
+        H5E_BEGIN_TRY {
+            obj = H5Iobject_verify(ids[i], obj_type);
+        } H5E_END_TRY
+        if(obj != ((i % 10) ? NULL : &objs[i])) {
+            TestErrPrintf("wrong object for ID %d after removal\n", i);
+            goto out;
+        }
+    }
+
+    /* Iterate over the remaining IDs */
+    udata.prev_id = 0;
+    udata.nvisited = 0;
+    udata.objs = objs;
+    if(NULL != H5Isearch(obj_type, test_many_ids_cb, &udata)) {
+        TestErrPrintf("IDs not visited in order\n");
+        goto out;
+    }
+    VERIFY(udata.nvisited, (long)(TEST_MANY_NIDS / 10), "number of IDs visited");
+    if(udata.nvisited != (long)(TEST_MANY_NIDS / 10))
+        goto out;
+
+    /* Destroy type */
+    ret = H5Idestroy_type(obj_type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if(ret == FAIL)
+        goto out;
+
+    HDfree(ids);
+    HDfree(objs);
+
+    return 0;
+
+out:
+    /* Cleanup.  For simplicity, just destroy the types and ignore errors. */
+    H5E_BEGIN_TRY
+        H5Idestroy_type(obj_type);
+    H5E_END_TRY
+    HDfree(ids);
+    HDfree(objs);
+    return -1;
+} /* end test_many_ids() */
+
 void test_ids(void)
 {
     /* Set the random # seed */
@@ -738,5 +856,6 @@ void test_ids(void)
     if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
     if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0) TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_many_ids() < 0) TestErrPrintf("Many IDs test failed\n");
 
 }
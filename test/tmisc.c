@@ -30,6 +30,7 @@
 #include "H5srcdir.h"
 #include "H5Dpkg.h"         /* Datasets                 */
 #include "H5MMprivate.h"    /* Memory                   */
+#include "H5FLprivate.h"    /* Free Lists               */
 
 /* Definitions for misc. test #1 */
 #define MISC1_FILE  "tmisc1.h5"
@@ -323,6 +324,14 @@ typedef struct
 /* and bad offset values are written to that file for testing */
 #define MISC33_FILE             "bad_offset.h5"
 
+/* Definitions for misc. test #35 */
+#define MISC35_SPACE_RANK       3
+#define MISC35_SPACE_DIM1       3
+#define MISC35_SPACE_DIM2       15
+#define MISC35_SPACE_DIM3       13
+#define MISC35_NPOINTS          10
+#define MISC35_NBLOCKS          64
+
 /****************************************************************
 **
 **  test_misc1(): test unlinking a dataset from a group and immediately
@@ -5625,6 +5634,144 @@ test_misc34(void)
 
 } /* end test_misc34() */
 
+#ifndef H5_NO_BLK_FREE_LISTS
+/* Block free list for test_misc35 */
+H5FL_BLK_DEFINE_STATIC(misc35_blk);
+#endif /* H5_NO_BLK_FREE_LISTS */
+
+
+/****************************************************************
+**
+**  test_misc35(): Check operation of free-list statistics API
+**      calls and block free list size classes.
+**
+****************************************************************/
+static void
+test_misc35(void)
+{
+    hid_t       sid = H5I_INVALID_HID;  /* Dataspace ID */
+    hsize_t     dims[] = {MISC35_SPACE_DIM1, MISC35_SPACE_DIM2, MISC35_SPACE_DIM3};  /* Dataspace dims */
+    hsize_t     coord[MISC35_NPOINTS][MISC35_SPACE_RANK] =  /* Coordinates for point selection */
+                            {{0,10, 5},
+                            {1, 2, 7},
+                            {2, 4, 9},
+                            {0, 6,11},
+                            {1, 8,13},
+                            {2,12, 0},
+                            {0,14, 2},
+                            {1, 0, 4},
+                            {2, 1, 6},
+                            {0, 3, 8}};
+    size_t      reg_size_start;         /* Initial amount of regular memory allocated */
+    size_t      arr_size_start;         /* Initial amount of array memory allocated */
+    size_t      blk_size_start;         /* Initial amount of block memory allocated */
+    size_t      fac_size_start;         /* Initial amount of factory memory allocated */
+    size_t      reg_size_final;         /* Final amount of regular memory allocated */
+    size_t      arr_size_final;         /* Final amount of array memory allocated */
+    size_t      blk_size_final;         /* Final amount of block memory allocated */
+    size_t      fac_size_final;         /* Final amount of factory memory allocated */
+#ifndef H5_NO_BLK_FREE_LISTS
+    uint8_t     *blocks[MISC35_NBLOCKS];  /* Blocks allocated from the test's free list */
+    uint8_t     *blk, *new_blk;         /* Block pointers */
+    htri_t      avail;                  /* Whether a block is available */
+    unsigned    u;                      /* Local index variable */
+#endif /* H5_NO_BLK_FREE_LISTS */
+    herr_t      ret;                    /* Return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Free-list API calls"));
+
+    /* Create dataspace */
+    /* (Allocates array free-list nodes) */
+    sid = H5Screate_simple(MISC35_SPACE_RANK, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+
+    /* Select sequence of ten points */
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)MISC35_NPOINTS, (const hsize_t *)coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+
+    /* Close dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Retrieve initial free list values */
+    ret = H5get_free_list_sizes(&reg_size_start, &arr_size_start, &blk_size_start, &fac_size_start);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+
+#if !defined H5_NO_REG_FREE_LISTS && !defined H5_NO_ARR_FREE_LISTS
+    /* The regular & array free lists should be holding memory now */
+    CHECK(reg_size_start, 0, "H5get_free_list_sizes");
+    CHECK(arr_size_start, 0, "H5get_free_list_sizes");
+#endif /* !H5_NO_REG_FREE_LISTS && !H5_NO_ARR_FREE_LISTS */
+
+    /* Garbage collect the free lists */
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+
+    /* Retrieve free list values again */
+    ret = H5get_free_list_sizes(&reg_size_final, &arr_size_final, &blk_size_final, &fac_size_final);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+
+    /* All the free lists should be empty now */
+    VERIFY(reg_size_final, 0, "H5get_free_list_sizes");
+    VERIFY(arr_size_final, 0, "H5get_free_list_sizes");
+    VERIFY(blk_size_final, 0, "H5get_free_list_sizes");
+    VERIFY(fac_size_final, 0, "H5get_free_list_sizes");
+
+    /* NULL pointers are allowed for sizes that aren't wanted */
+    ret = H5get_free_list_sizes(NULL, NULL, &blk_size_final, NULL);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+
+#ifndef H5_NO_BLK_FREE_LISTS
+    /* Blocks of similar sizes share a size class, so a freed block
+     * can be re-used for a slightly different size.
+     */
+    blk = H5FL_BLK_MALLOC(misc35_blk, 1000);
+    CHECK_PTR(blk, "H5FL_BLK_MALLOC");
+    blk = H5FL_BLK_FREE(misc35_blk, blk);
+    avail = H5FL_BLK_AVAIL(misc35_blk, 1010);
+    VERIFY(avail, TRUE, "H5FL_BLK_AVAIL");
+    avail = H5FL_BLK_AVAIL(misc35_blk, 2000);
+    VERIFY(avail, FALSE, "H5FL_BLK_AVAIL");
+
+    /* Re-allocating a block within its size class keeps the block */
+    blk = H5FL_BLK_MALLOC(misc35_blk, 1010);
+    CHECK_PTR(blk, "H5FL_BLK_MALLOC");
+    HDmemset(blk, 1, 1010);
+    new_blk = H5FL_BLK_REALLOC(misc35_blk, blk, 1020);
+    VERIFY(new_blk, blk, "H5FL_BLK_REALLOC");
+    new_blk = H5FL_BLK_REALLOC(misc35_blk, blk, 4000);
+    CHECK_PTR(new_blk, "H5FL_BLK_REALLOC");
+    VERIFY(new_blk[1009], 1, "H5FL_BLK_REALLOC");
+    blk = H5FL_BLK_FREE(misc35_blk, new_blk);
+
+    /* Limit the block free lists, then release more than the limit at once */
+    ret = H5set_free_list_limits(-1, -1, -1, -1, -1, 16 * 1024);
+    CHECK(ret, FAIL, "H5set_free_list_limits");
+    for(u = 0; u < MISC35_NBLOCKS; u++) {
+        blocks[u] = H5FL_BLK_MALLOC(misc35_blk, 1024);
+        CHECK_PTR(blocks[u], "H5FL_BLK_MALLOC");
+    } /* end for */
+    for(u = 0; u < MISC35_NBLOCKS; u++)
+        blocks[u] = H5FL_BLK_FREE(misc35_blk, blocks[u]);
+
+    /* The list should have been trimmed, but not emptied */
+    ret = H5get_free_list_sizes(NULL, NULL, &blk_size_final, NULL);
+    CHECK(ret, FAIL, "H5get_free_list_sizes");
+    if(blk_size_final == 0 || blk_size_final > 16 * 1024)
+        TestErrPrintf("block free list size of %lu is out of range\n", (unsigned long)blk_size_final);
+    avail = H5FL_BLK_AVAIL(misc35_blk, 1024);
+    VERIFY(avail, TRUE, "H5FL_BLK_AVAIL");
+
+    /* Restore the default limits */
+    ret = H5set_free_list_limits(1024 * 1024, 64 * 1024, 4 * 1024 * 1024, 256 * 1024, 16 * 1024 * 1024, 1024 * 1024);
+    CHECK(ret, FAIL, "H5set_free_list_limits");
+
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+#endif /* H5_NO_BLK_FREE_LISTS */
+} /* end test_misc35() */
+
 
 /****************************************************************
 **
@@ -5675,6 +5822,7 @@ test_misc(void)
     test_misc32();      /* Test filter memory allocation functions */
     test_misc33();      /* Test to verify that H5HL_offset_into() returns error if offset exceeds heap block */
     test_misc34();      /* Test behavior of 0 and NULL in H5MM API calls */
+    test_misc35();      /* Test behavior of free-list & allocation statistics API calls */
 
 } /* test_misc() */
 
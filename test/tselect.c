@@ -5789,6 +5789,120 @@ test_select_hyper_nota_2d(void)
     HDfree(rbuf);
 }   /* test_select_hyper_nota_2d() */
 
+/****************************************************************
+**
+**  test_select_hyper_union_append(): Test basic H5S (dataspace) selection code.
+**      Tests unions of 2-D hyperslabs which are added after the existing
+**      selection, comparing them with the same unions made in reverse order.
+**
+****************************************************************/
+#define SPACE10_RANK            2
+#define SPACE10_DIM1            12
+#define SPACE10_DIM2            12
+#define SPACE10_NHYPERSLABS     7
+static void
+test_select_hyper_union_append(void)
+{
+    hid_t		sid1, sid2;	/* Dataspace IDs */
+    hsize_t		dims[] = {SPACE10_DIM1, SPACE10_DIM2};
+    /* Hyperslabs, in increasing order in the slowest changing dimension */
+    hsize_t	        start[SPACE10_NHYPERSLABS][SPACE10_RANK] = {{0, 2}, {1, 2}, {2, 2}, {5, 2}, {6, 0}, {8, 4}, {11, 2}};
+    hsize_t		stride[SPACE10_NHYPERSLABS][SPACE10_RANK] = {{1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 7}, {1, 1}, {1, 1}};
+    hsize_t		count[SPACE10_NHYPERSLABS][SPACE10_RANK] = {{1, 1}, {1, 1}, {2, 1}, {1, 1}, {1, 2}, {2, 1}, {1, 1}};
+    hsize_t		block[SPACE10_NHYPERSLABS][SPACE10_RANK] = {{1, 4}, {1, 4}, {1, 4}, {1, 4}, {1, 2}, {1, 1}, {1, 4}};
+    hsize_t		blocks1[SPACE10_DIM1 * SPACE10_DIM2][2][SPACE10_RANK];  /* Blocks for forward selection */
+    hsize_t		blocks2[SPACE10_DIM1 * SPACE10_DIM2][2][SPACE10_RANK];  /* Blocks for reverse selection */
+    hsize_t		q_start[SPACE10_RANK];  /* Regular hyperslab queried */
+    hsize_t		q_stride[SPACE10_RANK];
+    hsize_t		q_count[SPACE10_RANK];
+    hsize_t		q_block[SPACE10_RANK];
+    hssize_t	        npoints;	/* Number of elements in selection */
+    hssize_t	        nblocks;	/* Number of blocks in selection */
+    htri_t		check;          /* Shape comparison return value */
+    int                 i;              /* Counter */
+    herr_t		ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Hyperslab Selection Functions with appending unions of 2-D hyperslabs\n"));
+
+    /* Create dataspaces */
+    sid1 = H5Screate_simple(SPACE10_RANK, dims, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+    sid2 = H5Screate_simple(SPACE10_RANK, dims, NULL);
+    CHECK(sid2, FAIL, "H5Screate_simple");
+
+    /* Combine the hyperslabs in increasing order */
+    for(i = 0; i < SPACE10_NHYPERSLABS; i++) {
+        ret = H5Sselect_hyperslab(sid1, (i == 0 ? H5S_SELECT_SET : H5S_SELECT_OR), start[i], stride[i], count[i], block[i]);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+
+    /* Combine the hyperslabs in decreasing order */
+    for(i = SPACE10_NHYPERSLABS - 1; i >= 0; i--) {
+        ret = H5Sselect_hyperslab(sid2, (i == (SPACE10_NHYPERSLABS - 1) ? H5S_SELECT_SET : H5S_SELECT_OR), start[i], stride[i], count[i], block[i]);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+
+    /* Verify the number of elements selected */
+    npoints = H5Sget_select_npoints(sid1);
+    VERIFY(npoints, 30, "H5Sget_select_npoints");
+    npoints = H5Sget_select_npoints(sid2);
+    VERIFY(npoints, 30, "H5Sget_select_npoints");
+
+    /* Verify that both selections are made of the same blocks */
+    nblocks = H5Sget_select_hyper_nblocks(sid1);
+    VERIFY(nblocks, 6, "H5Sget_select_hyper_nblocks");
+    nblocks = H5Sget_select_hyper_nblocks(sid2);
+    VERIFY(nblocks, 6, "H5Sget_select_hyper_nblocks");
+    ret = H5Sget_select_hyper_blocklist(sid1, (hsize_t)0, (hsize_t)nblocks, (hsize_t *)blocks1);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+    ret = H5Sget_select_hyper_blocklist(sid2, (hsize_t)0, (hsize_t)nblocks, (hsize_t *)blocks2);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+    if(HDmemcmp(blocks1, blocks2, (size_t)nblocks * sizeof(blocks1[0])))
+        TestErrPrintf("hyperslab blocks don't match!, line=%d\n", __LINE__);
+
+    /* Merged block for the first three (adjacent) hyperslabs */
+    VERIFY(blocks1[0][0][0], 0, "H5Sget_select_hyper_blocklist");
+    VERIFY(blocks1[0][0][1], 2, "H5Sget_select_hyper_blocklist");
+    VERIFY(blocks1[0][1][0], 3, "H5Sget_select_hyper_blocklist");
+    VERIFY(blocks1[0][1][1], 5, "H5Sget_select_hyper_blocklist");
+
+    /* Check that the shapes are the same */
+    check = H5S_select_shape_same_test(sid1, sid2);
+    VERIFY(check, TRUE, "H5S_select_shape_same_test");
+
+    /* Select rows with the same columns in increasing order */
+    for(i = 0; i < SPACE10_DIM1; i += 2) {
+        hsize_t row_start[SPACE10_RANK] = {0, 3};
+        hsize_t row_count[SPACE10_RANK] = {1, 4};
+
+        row_start[0] = (hsize_t)i;
+        ret = H5Sselect_hyperslab(sid1, (i == 0 ? H5S_SELECT_SET : H5S_SELECT_OR), row_start, NULL, row_count, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    } /* end for */
+
+    /* Verify that the union is detected as a regular hyperslab */
+    npoints = H5Sget_select_npoints(sid1);
+    VERIFY(npoints, (SPACE10_DIM1 / 2) * 4, "H5Sget_select_npoints");
+    check = H5Sis_regular_hyperslab(sid1);
+    VERIFY(check, TRUE, "H5Sis_regular_hyperslab");
+    ret = H5Sget_regular_hyperslab(sid1, q_start, q_stride, q_count, q_block);
+    CHECK(ret, FAIL, "H5Sget_regular_hyperslab");
+    VERIFY(q_start[0], 0, "H5Sget_regular_hyperslab");
+    VERIFY(q_stride[0], 2, "H5Sget_regular_hyperslab");
+    VERIFY(q_count[0], SPACE10_DIM1 / 2, "H5Sget_regular_hyperslab");
+    VERIFY(q_block[0], 1, "H5Sget_regular_hyperslab");
+    VERIFY(q_start[1], 3, "H5Sget_regular_hyperslab");
+    VERIFY(q_count[1], 1, "H5Sget_regular_hyperslab");
+    VERIFY(q_block[1], 4, "H5Sget_regular_hyperslab");
+
+    /* Close dataspaces */
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid2);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_select_hyper_union_append() */
+
 /****************************************************************
 **
 **  test_select_hyper_iter2(): Iterator for checking hyperslab iteration
@@ -13669,6 +13783,7 @@ test_select(void)
     test_select_hyper_xor_2d(); /* Test hyperslab XOR code for 2-D dataset */
     test_select_hyper_notb_2d(); /* Test hyperslab NOTB code for 2-D dataset */
     test_select_hyper_nota_2d(); /* Test hyperslab NOTA code for 2-D dataset */
+    test_select_hyper_union_append(); /* Test hyperslab union code for appended 2-D hyperslabs */
 
     /* test the random hyperslab I/O with the default property list for reading */
     test_select_hyper_union_random_5d(H5P_DEFAULT);  /* Test hyperslab union code for random 5-D hyperslabs */
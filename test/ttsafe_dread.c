@@ -0,0 +1,203 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing for thread safety in H5Dread operations that perform their
+ * raw data I/O outside the library lock. -- Threaded program --
+ * ------------------------------------------------------------------
+ *
+ * Plan: Open a contiguous and a chunked dataset read-only and have
+ *       many threads read different hyperslabs from both datasets
+ *       through the same dataset IDs at the same time.
+ *
+ * Claim: Every thread reads back the values that were written.  If the
+ *        reads deferred by one H5Dread call were mixed up with those of
+ *        another thread's call, or were performed after the dataset
+ *        was released, the data would not match.
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME        "ttsafe_dread.h5"
+#define CONTIG_NAME     "contig"
+#define CHUNKED_NAME    "chunked"
+#define NUM_THREADS     8
+#define NUM_READS       64
+#define NROWS           256
+#define NCOLS           128
+
+void *tts_dread_thread(void *);
+
+typedef struct dread_data_struct {
+    hid_t contig;
+    hid_t chunked;
+    int thread_index;
+    int nerrors;
+} ttsafe_dread_data_t;
+
+/* Value stored at (row, col) in both datasets */
+static int
+dread_value(hsize_t row, hsize_t col)
+{
+    return (int)(row * NCOLS + col);
+}
+
+void
+tts_dread(void)
+{
+    /* Thread declarations */
+    H5TS_thread_t threads[NUM_THREADS];
+    ttsafe_dread_data_t thread_data[NUM_THREADS];
+
+    /* HDF5 data declarations */
+    hid_t   file        = H5I_INVALID_HID;
+    hid_t   dataspace   = H5I_INVALID_HID;
+    hid_t   dcpl        = H5I_INVALID_HID;
+    hid_t   contig      = H5I_INVALID_HID;
+    hid_t   chunked     = H5I_INVALID_HID;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {16, 32};
+    int     *data;
+    hsize_t row, col;
+    int     i;
+    herr_t  status;
+
+    /* Create the datasets */
+    data = (int *)HDmalloc(NROWS * NCOLS * sizeof(int));
+    CHECK_PTR(data, "HDmalloc");
+    for(row = 0; row < NROWS; row++)
+        for(col = 0; col < NCOLS; col++)
+            data[row * NCOLS + col] = dread_value(row, col);
+
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fcreate");
+    dataspace = H5Screate_simple(2, dims, NULL);
+    CHECK(dataspace, H5I_INVALID_HID, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    status = H5Pset_chunk(dcpl, 2, chunk_dims);
+    CHECK(status, FAIL, "H5Pset_chunk");
+
+    contig = H5Dcreate2(file, CONTIG_NAME, H5T_NATIVE_INT, dataspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(contig, H5I_INVALID_HID, "H5Dcreate2");
+    status = H5Dwrite(contig, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dwrite");
+    status = H5Dclose(contig);
+    CHECK(status, FAIL, "H5Dclose");
+
+    chunked = H5Dcreate2(file, CHUNKED_NAME, H5T_NATIVE_INT, dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(chunked, H5I_INVALID_HID, "H5Dcreate2");
+    status = H5Dwrite(chunked, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    CHECK(status, FAIL, "H5Dwrite");
+    status = H5Dclose(chunked);
+    CHECK(status, FAIL, "H5Dclose");
+
+    status = H5Pclose(dcpl);
+    CHECK(status, FAIL, "H5Pclose");
+    status = H5Sclose(dataspace);
+    CHECK(status, FAIL, "H5Sclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+    HDfree(data);
+
+    /* Reopen the datasets read-only, so their reads can run concurrently */
+    file = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file, H5I_INVALID_HID, "H5Fopen");
+    contig = H5Dopen2(file, CONTIG_NAME, H5P_DEFAULT);
+    CHECK(contig, H5I_INVALID_HID, "H5Dopen2");
+    chunked = H5Dopen2(file, CHUNKED_NAME, H5P_DEFAULT);
+    CHECK(chunked, H5I_INVALID_HID, "H5Dopen2");
+
+    /* Simultaneously read from both datasets */
+    for(i = 0; i < NUM_THREADS; i++) {
+        thread_data[i].contig = contig;
+        thread_data[i].chunked = chunked;
+        thread_data[i].thread_index = i;
+        thread_data[i].nerrors = 0;
+        threads[i] = H5TS_create_thread(tts_dread_thread, NULL, &thread_data[i]);
+    }
+
+    for(i = 0; i < NUM_THREADS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    /* verify the correctness of the test */
+    for(i = 0; i < NUM_THREADS; i++)
+        VERIFY(thread_data[i].nerrors, 0, "data values don't match");
+
+    /* close remaining resources */
+    status = H5Dclose(chunked);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Dclose(contig);
+    CHECK(status, FAIL, "H5Dclose");
+    status = H5Fclose(file);
+    CHECK(status, FAIL, "H5Fclose");
+} /* end tts_dread() */
+
+void *
+tts_dread_thread(void *client_data)
+{
+    ttsafe_dread_data_t *thread_data = (ttsafe_dread_data_t *)client_data;
+    hid_t   file_space  = H5I_INVALID_HID;
+    hid_t   mem_space   = H5I_INVALID_HID;
+    hsize_t start[2], count[2];
+    hsize_t row, col;
+    int     buf[16][NCOLS / 2];
+    int     n;
+    herr_t  status;
+
+    count[0] = 16;
+    count[1] = NCOLS / 2;
+    mem_space = H5Screate_simple(2, count, NULL);
+    CHECK(mem_space, H5I_INVALID_HID, "H5Screate_simple");
+
+    for(n = 0; n < NUM_READS; n++) {
+        hid_t dset = (n % 2) ? thread_data->chunked : thread_data->contig;
+
+        /* Pick a block that isn't aligned with the chunks */
+        start[0] = (hsize_t)((thread_data->thread_index * 7 + n * 13) % (NROWS - 16));
+        start[1] = (hsize_t)((thread_data->thread_index * 5 + n * 3) % (NCOLS / 2));
+
+        file_space = H5Dget_space(dset);
+        CHECK(file_space, H5I_INVALID_HID, "H5Dget_space");
+        status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, NULL, count, NULL);
+        CHECK(status, FAIL, "H5Sselect_hyperslab");
+
+        HDmemset(buf, 0, sizeof(buf));
+        status = H5Dread(dset, H5T_NATIVE_INT, mem_space, file_space, H5P_DEFAULT, buf);
+        CHECK(status, FAIL, "H5Dread");
+
+        for(row = 0; row < count[0]; row++)
+            for(col = 0; col < count[1]; col++)
+                if(buf[row][col] != dread_value(start[0] + row, start[1] + col))
+                    thread_data->nerrors++;
+
+        status = H5Sclose(file_space);
+        CHECK(status, FAIL, "H5Sclose");
+    }
+
+    status = H5Sclose(mem_space);
+    CHECK(status, FAIL, "H5Sclose");
+
+    return NULL;
+} /* end tts_dread_thread() */
+
+void
+cleanup_dread(void)
+{
+    HDunlink(FILENAME);
+}
+
+#endif /*H5_HAVE_THREADSAFE*/
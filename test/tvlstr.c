@@ -24,6 +24,7 @@
 #define DATAFILE   "tvlstr.h5"
 #define DATAFILE2  "tvlstr2.h5"
 #define DATAFILE3  "sel2el.h5"
+#define DATAFILE4  "tvlstrpack.h5"
 
 #define DATASET    "1Darray"
 
@@ -34,6 +35,10 @@
 
 #define VLSTR_TYPE  "vl_string_type"
 
+/* Definitions for the VL packing test */
+#define PACK_DIM1       10
+#define PACK_CHUNK_DIM1 4
+
 /* Definitions for the VL re-writing test */
 #define REWRITE_NDATASETS       32
 
@@ -944,6 +949,209 @@ static void test_write_same_element(void)
     CHECK(ret, FAIL, "H5Fclose");
 } /* test_write_same_element */
 
+/* Helper routine for test_vlstrings_pack() */
+static void
+verify_packed_strings(hid_t dataset, hid_t tid, size_t nelmts, const char *expected[])
+{
+    char    *rdata[PACK_DIM1];      /* Information read in */
+    hid_t   sid;                    /* Dataspace ID */
+    size_t  u;                      /* Local index variable */
+    herr_t  ret;                    /* Generic return value */
+
+    sid = H5Dget_space(dataset);
+    CHECK(sid, FAIL, "H5Dget_space");
+    VERIFY(H5Sget_simple_extent_npoints(sid), (hssize_t)nelmts, "H5Sget_simple_extent_npoints");
+
+    ret = H5Dread(dataset, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+
+    for(u = 0; u < nelmts; u++) {
+        if(expected[u] == NULL || rdata[u] == NULL) {
+            if(expected[u] != rdata[u])
+                TestErrPrintf("VL data 'nil' status doesn't match!, element %u\n", (unsigned)u);
+        } /* end if */
+        else if(HDstrcmp(expected[u], rdata[u]) != 0)
+            TestErrPrintf("VL data values don't match!, expected[%u]=%s, rdata[%u]=%s\n", (unsigned)u, expected[u], (unsigned)u, rdata[u]);
+    } /* end for */
+
+    ret = H5Dvlen_reclaim(tid, sid, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+} /* end verify_packed_strings() */
+
+/****************************************************************
+**
+**  test_vlstrings_pack(): Test VL strings packed into the chunks
+**      of a dataset with the VL pack filter.
+**
+****************************************************************/
+static void
+test_vlstrings_pack(void)
+{
+    const char *wdata[PACK_DIM1] = {"Parting", NULL, "is such", "", "sweet",
+        "sorrow", NULL, "that I shall say", "good night", "till it be morrow."};
+    const char *expected[PACK_DIM1];    /* Expected data */
+    const char *pdata[3] = {"But", "reuniting", "is a great joy"};
+    hid_t       fid;            /* HDF5 File ID */
+    hid_t       dataset;        /* Dataset ID */
+    hid_t       sid, psid;      /* Dataspace IDs */
+    hid_t       tid;            /* Datatype ID */
+    hid_t       dcpl;           /* Dataset creation property list ID */
+    hid_t       dapl;           /* Dataset access property list ID */
+    hsize_t     dims[] = {PACK_DIM1};
+    hsize_t     maxdims[] = {H5S_UNLIMITED};
+    hsize_t     chunk_dims[] = {PACK_CHUNK_DIM1};
+    hsize_t     pdims[] = {3};
+    hsize_t     coord[3] = {1, 5, 1};
+    hsize_t     new_dims[1];
+    unsigned    flags;          /* Filter flags */
+    size_t      u;              /* Local index variable */
+    herr_t      ret;            /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing VL Strings Packed into Chunks\n"));
+
+    fid = H5Fcreate(DATAFILE4, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    tid = H5Tcopy(H5T_C_S1);
+    CHECK(tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+
+    sid = H5Screate_simple(1, dims, maxdims);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+
+    /* The VL pack filter must be the first filter */
+#ifdef H5_HAVE_FILTER_DEFLATE
+    ret = H5Pset_deflate(dcpl, 6);
+    CHECK(ret, FAIL, "H5Pset_deflate");
+    H5E_BEGIN_TRY {
+        ret = H5Pset_vlen_pack(dcpl);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_vlen_pack");
+    ret = H5Premove_filter(dcpl, H5Z_FILTER_DEFLATE);
+    CHECK(ret, FAIL, "H5Premove_filter");
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    ret = H5Pset_vlen_pack(dcpl);
+    CHECK(ret, FAIL, "H5Pset_vlen_pack");
+#ifdef H5_HAVE_FILTER_DEFLATE
+    ret = H5Pset_deflate(dcpl, 6);
+    CHECK(ret, FAIL, "H5Pset_deflate");
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+    /* The VL pack filter can't be applied to fixed-size data */
+    H5E_BEGIN_TRY {
+        dataset = H5Dcreate2(fid, "fixed", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    } H5E_END_TRY;
+    VERIFY(dataset, FAIL, "H5Dcreate2");
+
+    dataset = H5Dcreate2(fid, DATASET, tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    ret = H5Dwrite(dataset, tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    for(u = 0; u < PACK_DIM1; u++)
+        expected[u] = wdata[u];
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+
+    /* Overwrite some of the elements, including the same element twice */
+    psid = H5Screate_simple(1, pdims, NULL);
+    CHECK(psid, FAIL, "H5Screate_simple");
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)3, coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    ret = H5Dwrite(dataset, tid, psid, sid, H5P_DEFAULT, pdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    expected[5] = pdata[1];
+    expected[1] = pdata[2];
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file, with the chunk cache disabled */
+    fid = H5Fopen(DATAFILE4, H5F_ACC_RDWR, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fopen");
+    dapl = H5Pcreate(H5P_DATASET_ACCESS);
+    CHECK(dapl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT);
+    CHECK(ret, FAIL, "H5Pset_chunk_cache");
+    dataset = H5Dopen2(fid, DATASET, dapl);
+    CHECK(dataset, FAIL, "H5Dopen2");
+
+    /* Check the filter is in the dataset's pipeline */
+    H5Pclose(dcpl);
+    dcpl = H5Dget_create_plist(dataset);
+    CHECK(dcpl, FAIL, "H5Dget_create_plist");
+    ret = H5Pget_filter_by_id2(dcpl, H5Z_FILTER_VLEN_PACK, &flags, NULL, NULL, (size_t)0, NULL, NULL);
+    CHECK(ret, FAIL, "H5Pget_filter_by_id2");
+
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+
+    /* Overwrite elements without the chunk cache */
+    coord[0] = 9;
+    coord[1] = 0;
+    coord[2] = 9;
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)3, coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    ret = H5Dwrite(dataset, tid, psid, sid, H5P_DEFAULT, pdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    expected[0] = pdata[1];
+    expected[9] = pdata[2];
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Shrink the dataset, then extend it again */
+    dataset = H5Dopen2(fid, DATASET, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dopen2");
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+    new_dims[0] = 6;
+    ret = H5Dset_extent(dataset, new_dims);
+    CHECK(ret, FAIL, "H5Dset_extent");
+    verify_packed_strings(dataset, tid, (size_t)6, expected);
+    ret = H5Dset_extent(dataset, dims);
+    CHECK(ret, FAIL, "H5Dset_extent");
+    for(u = 6; u < PACK_DIM1; u++)
+        expected[u] = NULL;
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Copy the dataset, which copies its chunks as they are */
+    ret = H5Ocopy(fid, DATASET, fid, "copy", H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Ocopy");
+    dataset = H5Dopen2(fid, "copy", H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dopen2");
+    verify_packed_strings(dataset, tid, (size_t)PACK_DIM1, expected);
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    ret = H5Pclose(dapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(psid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Tclose(tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end test_vlstrings_pack() */
+
 /****************************************************************
 **
 **  test_vlstrings(): Main VL string testing routine.
@@ -970,6 +1178,8 @@ test_vlstrings(void)
     test_vl_rewrite();
     /* Test writing to the same element more than once using H5Sselect_elements */
     test_write_same_element();
+    /* Test VL strings packed into the chunks of a dataset */
+    test_vlstrings_pack();
 }   /* test_vlstrings() */
 
 /*-------------------------------------------------------------------------
@@ -992,5 +1202,6 @@ cleanup_vlstrings(void)
     HDremove(DATAFILE);
     HDremove(DATAFILE2);
     HDremove(DATAFILE3);
+    HDremove(DATAFILE4);
 }
 
@@ -934,7 +934,8 @@ open_hdf5_file(const hbool_t create_file,
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
         TRUE,
         FALSE,
-        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE};
+        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE,
+        FALSE};
 
     HDassert(!create_file || config_fsm);
 
@@ -856,3 +856,203 @@ test_file_properties(void)
     VRFY((ret >= 0), "H5Pclose succeeded");
 } /* end test_file_properties() */
 
+
+/*
+ * Test subfiling with the MPI-IO driver.  Datasets are written to a subfiled
+ * file, with a small stripe size so that every process' data is spread over
+ * several subfiles, using collective I/O with both contiguous and strided
+ * file selections and using independent I/O.  The file is then reopened
+ * without subfiling in the file access property list, which must find the
+ * subfiles through the map file and reassemble the data.
+ */
+#define SUBFILING_STRIPE_SIZE   4096
+#define SUBFILING_ROWS          64
+#define SUBFILING_COLS          128
+#define SUBFILING_NDSETS        3
+
+void
+test_subfiling(void)
+{
+    hid_t fid;                  /* HDF5 file ID */
+    hid_t fapl_id;		/* File access plist */
+    hid_t dxpl_id;		/* Dataset transfer plist */
+    hid_t dset_ids[SUBFILING_NDSETS];
+    hid_t fspace_id, mspace_id;
+    hsize_t dims[2];
+    hsize_t start[2], stride[2], count[2], block[2];
+    hsize_t stripe_size;
+    unsigned ranks_per_subfile;
+    const char *filename;
+    char name[1024];
+    int *wbuf, *rbuf;
+    int i, j, k;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Info info = MPI_INFO_NULL;
+    herr_t ret;                 /* Generic return value */
+
+    filename = (const char *)GetTestParameters();
+
+    /* set up MPI parameters */
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    dims[0] = (hsize_t)(SUBFILING_ROWS * mpi_size);
+    dims[1] = SUBFILING_COLS;
+    wbuf = (int *)HDmalloc(sizeof(int) * dims[0] * dims[1]);
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc(sizeof(int) * dims[0] * dims[1]);
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+
+    /* setup file access plist, with one subfile per process */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl_id >= 0), "H5Pcreate");
+    ret = H5Pset_fapl_mpio_subfiling(fapl_id, 1, (hsize_t)SUBFILING_STRIPE_SIZE);
+    VRFY((ret < 0), "H5Pset_fapl_mpio_subfiling fails without the MPI-IO driver");
+    ret = H5Pset_fapl_mpio(fapl_id, comm, info);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio");
+    ret = H5Pset_fapl_mpio_subfiling(fapl_id, 1, (hsize_t)0);
+    VRFY((ret < 0), "H5Pset_fapl_mpio_subfiling fails with 0 stripe size");
+    ret = H5Pset_fapl_mpio_subfiling(fapl_id, 1, (hsize_t)SUBFILING_STRIPE_SIZE);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio_subfiling");
+    ret = H5Pget_fapl_mpio_subfiling(fapl_id, &ranks_per_subfile, &stripe_size);
+    VRFY((ret >= 0), "H5Pget_fapl_mpio_subfiling");
+    VRFY((ranks_per_subfile == 1 && stripe_size == SUBFILING_STRIPE_SIZE), "subfiling parameters");
+
+    /* Write metadata collectively, so the metadata cache's collective
+     * writes go through subfiling too
+     */
+    ret = H5Pset_coll_metadata_write(fapl_id, TRUE);
+    VRFY((ret >= 0), "H5Pset_coll_metadata_write succeeded");
+
+    /* create the file and datasets */
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+    fspace_id = H5Screate_simple(2, dims, NULL);
+    VRFY((fspace_id >= 0), "H5Screate_simple succeeded");
+    for(k = 0; k < SUBFILING_NDSETS; k++) {
+        HDsprintf(name, "dset%d", k);
+        dset_ids[k] = H5Dcreate2(fid, name, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((dset_ids[k] >= 0), "H5Dcreate2 succeeded");
+    }
+
+    dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl_id >= 0), "H5Pcreate succeeded");
+
+    /* Write each dataset: a block of rows per process (collective), a set of
+     * interleaved columns per process (collective) and a block of rows per
+     * process (independent)
+     */
+    for(k = 0; k < SUBFILING_NDSETS; k++) {
+        for(i = 0; i < (int)dims[0]; i++)
+            for(j = 0; j < (int)dims[1]; j++)
+                wbuf[i * (int)dims[1] + j] = (k * 1000000) + (i * 1000) + j;
+
+        if(k == 1) {
+            start[0] = 0; start[1] = (hsize_t)mpi_rank;
+            stride[0] = 1; stride[1] = (hsize_t)mpi_size;
+            count[0] = 1; count[1] = (dims[1] - (hsize_t)mpi_rank + (hsize_t)mpi_size - 1) / (hsize_t)mpi_size;
+            block[0] = dims[0]; block[1] = 1;
+        }
+        else {
+            start[0] = (hsize_t)(mpi_rank * SUBFILING_ROWS); start[1] = 0;
+            stride[0] = 1; stride[1] = 1;
+            count[0] = 1; count[1] = 1;
+            block[0] = SUBFILING_ROWS; block[1] = dims[1];
+        }
+        ret = H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, block);
+        VRFY((ret >= 0), "H5Sselect_hyperslab succeeded");
+
+        ret = H5Pset_dxpl_mpio(dxpl_id, k == 2 ? H5FD_MPIO_INDEPENDENT : H5FD_MPIO_COLLECTIVE);
+        VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+        /* (Use the same selection in memory, so the full buffer can be checked) */
+        ret = H5Dwrite(dset_ids[k], H5T_NATIVE_INT, fspace_id, fspace_id, dxpl_id, wbuf);
+        VRFY((ret >= 0), "H5Dwrite succeeded");
+    }
+
+    for(k = 0; k < SUBFILING_NDSETS; k++) {
+        ret = H5Dclose(dset_ids[k]);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+    }
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Check that the subfiles and the map were created */
+    if(MAINPROCESS) {
+        HDsnprintf(name, sizeof(name), "%s.subfile_map", filename);
+        VRFY((HDaccess(name, F_OK) == 0), "subfiling map file exists");
+        for(i = 1; i < mpi_size; i++) {
+            HDsnprintf(name, sizeof(name), "%s.subfile_%d", filename, i);
+            VRFY((HDaccess(name, F_OK) == 0), "subfile exists");
+        }
+    }
+
+    /* Reopen the file without subfiling in the file access plist */
+    ret = H5Pset_fapl_mpio(fapl_id, comm, info);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio");
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* The file's access plist describes the subfiling layout */
+    fapl_id = H5Fget_access_plist(fid);
+    VRFY((fapl_id >= 0), "H5Fget_access_plist succeeded");
+    ret = H5Pget_fapl_mpio_subfiling(fapl_id, NULL, &stripe_size);
+    VRFY((ret >= 0), "H5Pget_fapl_mpio_subfiling");
+    VRFY((stripe_size == SUBFILING_STRIPE_SIZE), "subfiling stripe size");
+
+    /* Read the whole of each dataset on every process, collectively and
+     * independently
+     */
+    mspace_id = H5Screate_simple(2, dims, NULL);
+    VRFY((mspace_id >= 0), "H5Screate_simple succeeded");
+    for(k = 0; k < SUBFILING_NDSETS; k++) {
+        HDsprintf(name, "dset%d", k);
+        dset_ids[k] = H5Dopen2(fid, name, H5P_DEFAULT);
+        VRFY((dset_ids[k] >= 0), "H5Dopen2 succeeded");
+
+        ret = H5Pset_dxpl_mpio(dxpl_id, k == 1 ? H5FD_MPIO_INDEPENDENT : H5FD_MPIO_COLLECTIVE);
+        VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+        HDmemset(rbuf, 0, sizeof(int) * dims[0] * dims[1]);
+        ret = H5Dread(dset_ids[k], H5T_NATIVE_INT, mspace_id, H5S_ALL, dxpl_id, rbuf);
+        VRFY((ret >= 0), "H5Dread succeeded");
+
+        for(i = 0; i < (int)dims[0]; i++)
+            for(j = 0; j < (int)dims[1]; j++)
+                if(rbuf[i * (int)dims[1] + j] != (k * 1000000) + (i * 1000) + j) {
+                    if(nerrors++ < MAX_ERR_REPORT)
+                        HDprintf("Dataset %d, element [%d][%d] = %d, expected %d\n", k, i, j,
+                                rbuf[i * (int)dims[1] + j], (k * 1000000) + (i * 1000) + j);
+                }
+
+        ret = H5Dclose(dset_ids[k]);
+        VRFY((ret >= 0), "H5Dclose succeeded");
+    }
+
+    ret = H5Sclose(mspace_id);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Sclose(fspace_id);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Pclose(dxpl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Remove the map and subfiles */
+    MPI_Barrier(MPI_COMM_WORLD);
+    if(MAINPROCESS) {
+        HDsnprintf(name, sizeof(name), "%s.subfile_map", filename);
+        HDremove(name);
+        for(i = 1; i < mpi_size; i++) {
+            HDsnprintf(name, sizeof(name), "%s.subfile_%d", filename, i);
+            HDremove(name);
+        }
+    }
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_subfiling() */
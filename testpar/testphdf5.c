@@ -357,6 +357,9 @@ int main(int argc, char **argv)
     AddTest("props", test_file_properties, NULL,
 	    "Coll Metadata file property settings", PARATESTFILE);
 
+    AddTest("subfiling", test_subfiling, NULL,
+	    "subfiling with the MPI-IO driver", PARATESTFILE);
+
     AddTest("idsetw", dataset_writeInd, NULL,
 	    "dataset independent write", PARATESTFILE);
     AddTest("idsetr", dataset_readInd, NULL,
@@ -0,0 +1,914 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A tool that analyzes a binary metadata cache log, as written
+ *          when the file access property list's log style is
+ *          H5F_MDC_LOG_STYLE_BINARY (see H5Pset_mdc_log_style()).
+ *
+ *          The tool replays the log to track which entries are resident
+ *          in the cache.  Protecting a resident entry is a hit and
+ *          protecting any other entry is a miss.  From this it reports:
+ *
+ *          (1) the hit rate of each entry type
+ *          (2) the number of entries of each type evicted for each cause
+ *          (3) a histogram of the reuse (LRU stack) distances of the
+ *              protects, in entries
+ *          (4) the hit rate an LRU cache of a given size would have had,
+ *              for a range of cache sizes (the working set curve)
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5ACprivate.h"
+#include "H5Clog.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME     "h5mdclog"
+
+/* Number of records read from the log at a time */
+#define NRECORDS_READ       1024
+
+/* Number of buckets in the reuse distance histograms: log2 buckets for
+ * distances in entries and bytes, up to 2^63.
+ */
+#define NDIST_BUCKETS       64
+
+/* Initial number of buckets in the hash table of entries */
+#define NHASH_BUCKETS_INIT  1024
+
+/* Type id used for records that don't name an entry type */
+#define NTYPES              (H5AC_NTYPES + 1)
+#define UNKNOWN_TYPE        H5AC_NTYPES
+
+/* Causes of an entry leaving the cache */
+typedef enum {
+    CAUSE_REPLACEMENT = 0,          /* Evicted to make space */
+    CAUSE_AGEOUT,                   /* Evicted by the age out code */
+    CAUSE_TAGGED,                   /* Evicted with the object it belongs to */
+    CAUSE_INVALIDATE,               /* Evicted when the cache was flushed and invalidated */
+    CAUSE_EXPUNGE,                  /* Expunged by the library */
+    CAUSE_REMOVE,                   /* Removed from the cache by the library */
+    CAUSE_DELETE,                   /* Deleted from the file */
+    NCAUSES
+} cause_t;
+
+/* A decoded log record */
+typedef struct record_t {
+    uint64_t time;                  /* Microseconds since logging started */
+    haddr_t addr;                   /* Address of the entry */
+    uint64_t size;                  /* Size of the entry, or event specific value */
+    unsigned flags;                 /* Cache flags */
+    unsigned event;                 /* Event (H5C_LOG_EVENT_*) */
+    unsigned type_id;               /* Entry type */
+    unsigned failed;                /* Whether the operation failed */
+    unsigned cause;                 /* Eviction cause (evict entry events) */
+} record_t;
+
+/* An entry the log has referred to */
+typedef struct entry_t {
+    haddr_t addr;                   /* Address of the entry */
+    unsigned type_id;               /* Entry type */
+    uint64_t size;                  /* Size of the entry */
+    hbool_t resident;               /* Whether the entry is in the cache */
+    uint64_t last_access;           /* Access number of the last access, 0 if never */
+    struct entry_t *next;           /* Next entry in the hash bucket */
+} entry_t;
+
+/* Statistics for an entry type */
+typedef struct type_stats_t {
+    uint64_t hits;                  /* Protects of resident entries */
+    uint64_t misses;                /* Protects of other entries */
+    uint64_t inserts;               /* Entries inserted */
+    uint64_t evictions[NCAUSES];    /* Entries leaving the cache, by cause */
+} type_stats_t;
+
+/* State of the replay */
+typedef struct replay_t {
+    /* Hash table of entries, keyed by address */
+    entry_t **buckets;
+    size_t nbuckets;
+    size_t nentries;
+
+    /* Fenwick trees over the access numbers: whether each access is the
+     * most recent access to its entry, and the size of the entry if so.
+     * These give the number of distinct entries and bytes accessed since
+     * an entry's last access.
+     */
+    uint64_t naccesses_max;
+    uint64_t naccesses;
+    int64_t *live_tree;
+    int64_t *bytes_tree;
+
+    /* Statistics */
+    type_stats_t types[NTYPES];
+    uint64_t nrecords;
+    uint64_t nfailed;
+    uint64_t nevents[H5C_LOG_EVENT_NEVENTS];
+    uint64_t cache_evictions;       /* Whole cache evictions */
+    uint64_t resident_bytes;
+    uint64_t max_resident_bytes;
+    uint64_t max_cache_size;
+    uint64_t end_time;
+    uint64_t cold_misses;           /* Protects of entries never accessed before */
+    uint64_t dist_entries[NDIST_BUCKETS];   /* Reuse distances in entries, log2 buckets */
+    uint64_t dist_bytes[NDIST_BUCKETS];     /* Reuse distances in bytes, log2 buckets */
+} replay_t;
+
+static const char *type_names_g[NTYPES] = {
+    "B-tree node",                          /* H5AC_BT_ID */
+    "symbol table node",                    /* H5AC_SNODE_ID */
+    "local heap prefix",                    /* H5AC_LHEAP_PRFX_ID */
+    "local heap data block",                /* H5AC_LHEAP_DBLK_ID */
+    "global heap",                          /* H5AC_GHEAP_ID */
+    "object header",                        /* H5AC_OHDR_ID */
+    "object header chunk",                  /* H5AC_OHDR_CHK_ID */
+    "v2 B-tree header",                     /* H5AC_BT2_HDR_ID */
+    "v2 B-tree internal node",              /* H5AC_BT2_INT_ID */
+    "v2 B-tree leaf node",                  /* H5AC_BT2_LEAF_ID */
+    "fractal heap header",                  /* H5AC_FHEAP_HDR_ID */
+    "fractal heap direct block",            /* H5AC_FHEAP_DBLOCK_ID */
+    "fractal heap indirect block",          /* H5AC_FHEAP_IBLOCK_ID */
+    "free space header",                    /* H5AC_FSPACE_HDR_ID */
+    "free space sections",                  /* H5AC_FSPACE_SINFO_ID */
+    "shared message table",                 /* H5AC_SOHM_TABLE_ID */
+    "shared message list",                  /* H5AC_SOHM_LIST_ID */
+    "extensible array header",              /* H5AC_EARRAY_HDR_ID */
+    "extensible array index block",         /* H5AC_EARRAY_IBLOCK_ID */
+    "extensible array super block",         /* H5AC_EARRAY_SBLOCK_ID */
+    "extensible array data block",          /* H5AC_EARRAY_DBLOCK_ID */
+    "extensible array data block page",     /* H5AC_EARRAY_DBLK_PAGE_ID */
+    "fixed array header",                   /* H5AC_FARRAY_HDR_ID */
+    "fixed array data block",               /* H5AC_FARRAY_DBLOCK_ID */
+    "fixed array data block page",          /* H5AC_FARRAY_DBLK_PAGE_ID */
+    "superblock",                           /* H5AC_SUPERBLOCK_ID */
+    "driver info block",                    /* H5AC_DRVRINFO_ID */
+    "epoch marker",                         /* H5AC_EPOCH_MARKER_ID */
+    "proxy entry",                          /* H5AC_PROXY_ENTRY_ID */
+    "prefetched entry",                     /* H5AC_PREFETCHED_ENTRY_ID */
+    "unknown"                               /* UNKNOWN_TYPE */
+};
+
+static const char *cause_names_g[NCAUSES] = {
+    "replacement", "age out", "tagged", "invalidate", "expunge", "remove", "delete"
+};
+
+static char *fname_g = NULL;
+
+/*
+ * Command-line options: only publicize long options
+ */
+static const char *s_opts = "hV";
+static struct long_options l_opts[] = {
+        { "help", no_arg, 'h' },
+        { "hel", no_arg, 'h'},
+        { "he", no_arg, 'h'},
+        { "version", no_arg, 'V' },
+        { "versio", no_arg, 'V' },
+        { "versi", no_arg, 'V' },
+        { "vers", no_arg, 'V' },
+        { NULL, 0, '\0' }
+};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] log_file\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Analyzes the binary metadata cache log <log_file>, written by the library\n");
+    HDfprintf(stdout, "when the log style is set to H5F_MDC_LOG_STYLE_BINARY, and reports the\n");
+    HDfprintf(stdout, "hit rate of each entry type, the causes of evictions, the distribution of\n");
+    HDfprintf(stdout, "reuse distances, and the hit rate of LRU caches of various sizes.\n");
+} /* usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: parse_command_line
+ *
+ * Purpose: Parses command line and sets up global variable to control output
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+     /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    } /* end while */
+
+    /* check for file name to be processed */
+    if(argc <= opt_ind) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    fname_g = HDstrdup(argv[opt_ind]);
+
+done:
+    return(0);
+
+error:
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    HDexit(ret);
+} /* leave() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    decode_record
+ *
+ * Purpose:     Decode a log record
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+decode_record(const uint8_t *p, record_t *rec)
+{
+    uint32_t flags;
+
+    UINT64DECODE(p, rec->time);
+    UINT64DECODE(p, rec->addr);
+    UINT64DECODE(p, rec->size);
+    UINT32DECODE(p, flags);
+    rec->flags = (unsigned)flags;
+    rec->event = *p++;
+    rec->type_id = *p++;
+    rec->failed = *p++;
+    rec->cause = *p++;
+
+    if(rec->type_id >= H5AC_NTYPES)
+        rec->type_id = UNKNOWN_TYPE;
+} /* decode_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    dist_bucket
+ *
+ * Purpose:     Get the log2 histogram bucket of a distance: bucket 0 holds
+ *              distance 0 and bucket n holds distances in [2^(n-1), 2^n).
+ *
+ * Return:      The bucket
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+dist_bucket(uint64_t dist)
+{
+    unsigned bucket = 0;
+
+    while(dist > 0 && bucket < NDIST_BUCKETS - 1) {
+        dist >>= 1;
+        bucket++;
+    } /* end while */
+
+    return bucket;
+} /* dist_bucket() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    tree_add / tree_sum
+ *
+ * Purpose:     Add a value at an access number of a Fenwick tree, and sum
+ *              the values at access numbers up to and including n.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+tree_add(int64_t *tree, uint64_t n_max, uint64_t n, int64_t val)
+{
+    for(; n <= n_max; n += n & (~n + 1))
+        tree[n] += val;
+} /* tree_add() */
+
+static int64_t
+tree_sum(const int64_t *tree, uint64_t n)
+{
+    int64_t sum = 0;
+
+    for(; n > 0; n -= n & (~n + 1))
+        sum += tree[n];
+
+    return sum;
+} /* tree_sum() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    find_entry
+ *
+ * Purpose:     Look up an entry by address, optionally creating it
+ *
+ * Return:      Success: The entry, or NULL if it doesn't exist and
+ *                       create is FALSE
+ *              Failure: NULL, if create is TRUE
+ *
+ *-------------------------------------------------------------------------
+ */
+static entry_t *
+find_entry(replay_t *rp, haddr_t addr, hbool_t create)
+{
+    entry_t *entry;
+    size_t bucket = (size_t)(addr % rp->nbuckets);
+
+    for(entry = rp->buckets[bucket]; entry; entry = entry->next)
+        if(entry->addr == addr)
+            return entry;
+
+    if(!create)
+        return NULL;
+
+    /* Grow the hash table when it gets full */
+    if(rp->nentries >= rp->nbuckets) {
+        entry_t **new_buckets;
+        size_t new_nbuckets = rp->nbuckets * 2;
+        size_t u;
+
+        if(NULL == (new_buckets = (entry_t **)HDcalloc(new_nbuckets, sizeof(entry_t *))))
+            return NULL;
+        for(u = 0; u < rp->nbuckets; u++)
+            while(rp->buckets[u]) {
+                entry = rp->buckets[u];
+                rp->buckets[u] = entry->next;
+                entry->next = new_buckets[entry->addr % new_nbuckets];
+                new_buckets[entry->addr % new_nbuckets] = entry;
+            } /* end while */
+        HDfree(rp->buckets);
+        rp->buckets = new_buckets;
+        rp->nbuckets = new_nbuckets;
+        bucket = (size_t)(addr % rp->nbuckets);
+    } /* end if */
+
+    if(NULL == (entry = (entry_t *)HDcalloc((size_t)1, sizeof(entry_t))))
+        return NULL;
+    entry->addr = addr;
+    entry->type_id = UNKNOWN_TYPE;
+    entry->next = rp->buckets[bucket];
+    rp->buckets[bucket] = entry;
+    rp->nentries++;
+
+    return entry;
+} /* find_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    unlink_entry
+ *
+ * Purpose:     Remove an entry from the hash table, without freeing it
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+unlink_entry(replay_t *rp, entry_t *entry)
+{
+    entry_t **pp = &rp->buckets[entry->addr % rp->nbuckets];
+
+    while(*pp != entry)
+        pp = &(*pp)->next;
+    *pp = entry->next;
+    rp->nentries--;
+} /* unlink_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    set_resident / set_size
+ *
+ * Purpose:     Track the entries in the cache and the bytes they use
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+set_resident(replay_t *rp, entry_t *entry, hbool_t resident)
+{
+    if(entry->resident == resident)
+        return;
+
+    entry->resident = resident;
+    if(resident) {
+        rp->resident_bytes += entry->size;
+        if(rp->resident_bytes > rp->max_resident_bytes)
+            rp->max_resident_bytes = rp->resident_bytes;
+    } /* end if */
+    else
+        rp->resident_bytes -= entry->size;
+} /* set_resident() */
+
+static void
+set_size(replay_t *rp, entry_t *entry, uint64_t size)
+{
+    if(entry->resident) {
+        rp->resident_bytes -= entry->size;
+        rp->resident_bytes += size;
+        if(rp->resident_bytes > rp->max_resident_bytes)
+            rp->max_resident_bytes = rp->resident_bytes;
+    } /* end if */
+
+    /* Keep the bytes tree in step with the size of the entry */
+    if(entry->last_access > 0)
+        tree_add(rp->bytes_tree, rp->naccesses_max, entry->last_access, (int64_t)size - (int64_t)entry->size);
+
+    entry->size = size;
+} /* set_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    access_entry
+ *
+ * Purpose:     Record an access to an entry, and return the number of
+ *              distinct entries and bytes accessed since its last access.
+ *
+ * Return:      TRUE if the entry was accessed before, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+access_entry(replay_t *rp, entry_t *entry, uint64_t *dist_entries, uint64_t *dist_bytes)
+{
+    hbool_t reused = FALSE;
+
+    HDassert(rp->naccesses < rp->naccesses_max);
+    rp->naccesses++;
+
+    if(entry->last_access > 0) {
+        *dist_entries = (uint64_t)(tree_sum(rp->live_tree, rp->naccesses) - tree_sum(rp->live_tree, entry->last_access));
+        *dist_bytes = (uint64_t)(tree_sum(rp->bytes_tree, rp->naccesses) - tree_sum(rp->bytes_tree, entry->last_access));
+        tree_add(rp->live_tree, rp->naccesses_max, entry->last_access, (int64_t)-1);
+        tree_add(rp->bytes_tree, rp->naccesses_max, entry->last_access, -(int64_t)entry->size);
+        reused = TRUE;
+    } /* end if */
+
+    entry->last_access = rp->naccesses;
+    tree_add(rp->live_tree, rp->naccesses_max, entry->last_access, (int64_t)1);
+    tree_add(rp->bytes_tree, rp->naccesses_max, entry->last_access, (int64_t)entry->size);
+
+    return reused;
+} /* access_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    evict_all
+ *
+ * Purpose:     Mark all entries as not resident, when the whole cache is
+ *              evicted or destroyed
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+evict_all(replay_t *rp)
+{
+    entry_t *entry;
+    size_t u;
+
+    for(u = 0; u < rp->nbuckets; u++)
+        for(entry = rp->buckets[u]; entry; entry = entry->next)
+            set_resident(rp, entry, FALSE);
+} /* evict_all() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    replay_record
+ *
+ * Purpose:     Update the replay state for a log record
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+replay_record(replay_t *rp, const record_t *rec)
+{
+    entry_t *entry;
+    uint64_t dist_entries = 0;
+    uint64_t dist_bytes = 0;
+
+    rp->nrecords++;
+    if(rec->event < H5C_LOG_EVENT_NEVENTS)
+        rp->nevents[rec->event]++;
+    rp->end_time = rec->time;
+
+    /* Failed operations don't change the contents of the cache */
+    if(rec->failed) {
+        rp->nfailed++;
+        return 0;
+    } /* end if */
+
+    switch(rec->event) {
+        case H5C_LOG_EVENT_PROTECT_ENTRY:
+            if(NULL == (entry = find_entry(rp, rec->addr, TRUE)))
+                return -1;
+            entry->type_id = rec->type_id;
+            if(entry->resident)
+                rp->types[rec->type_id].hits++;
+            else
+                rp->types[rec->type_id].misses++;
+            if(entry->size != rec->size)
+                set_size(rp, entry, rec->size);
+            set_resident(rp, entry, TRUE);
+            if(access_entry(rp, entry, &dist_entries, &dist_bytes)) {
+                rp->dist_entries[dist_bucket(dist_entries)]++;
+                rp->dist_bytes[dist_bucket(dist_bytes)]++;
+            } /* end if */
+            else
+                rp->cold_misses++;
+            break;
+
+        case H5C_LOG_EVENT_INSERT_ENTRY:
+            if(NULL == (entry = find_entry(rp, rec->addr, TRUE)))
+                return -1;
+            entry->type_id = rec->type_id;
+            rp->types[rec->type_id].inserts++;
+            set_size(rp, entry, rec->size);
+            set_resident(rp, entry, TRUE);
+
+            /* An insertion is the first use of the entry; it isn't a hit
+             * or a miss, but later protects are reuses of it.
+             */
+            (void)access_entry(rp, entry, &dist_entries, &dist_bytes);
+            break;
+
+        case H5C_LOG_EVENT_MOVE_ENTRY:
+            /* The size field holds the new address */
+            if(NULL != (entry = find_entry(rp, rec->addr, FALSE))) {
+                entry_t *old_entry;
+
+                /* Drop any stale entry at the new address */
+                if(NULL != (old_entry = find_entry(rp, (haddr_t)rec->size, FALSE))) {
+                    set_resident(rp, old_entry, FALSE);
+                    if(old_entry->last_access > 0) {
+                        tree_add(rp->live_tree, rp->naccesses_max, old_entry->last_access, (int64_t)-1);
+                        tree_add(rp->bytes_tree, rp->naccesses_max, old_entry->last_access, -(int64_t)old_entry->size);
+                    } /* end if */
+                    unlink_entry(rp, old_entry);
+                    HDfree(old_entry);
+                } /* end if */
+
+                unlink_entry(rp, entry);
+                entry->addr = (haddr_t)rec->size;
+                entry->next = rp->buckets[entry->addr % rp->nbuckets];
+                rp->buckets[entry->addr % rp->nbuckets] = entry;
+                rp->nentries++;
+            } /* end if */
+            break;
+
+        case H5C_LOG_EVENT_RESIZE_ENTRY:
+            /* The size field holds the new size */
+            if(NULL != (entry = find_entry(rp, rec->addr, FALSE)))
+                set_size(rp, entry, rec->size);
+            break;
+
+        case H5C_LOG_EVENT_EXPUNGE_ENTRY:
+        case H5C_LOG_EVENT_REMOVE_ENTRY:
+        case H5C_LOG_EVENT_EVICT_ENTRY:
+        case H5C_LOG_EVENT_UNPROTECT_ENTRY:
+            {
+                cause_t cause;
+
+                if(H5C_LOG_EVENT_EXPUNGE_ENTRY == rec->event)
+                    cause = CAUSE_EXPUNGE;
+                else if(H5C_LOG_EVENT_REMOVE_ENTRY == rec->event)
+                    cause = CAUSE_REMOVE;
+                else if(H5C_LOG_EVENT_UNPROTECT_ENTRY == rec->event) {
+                    /* Only unprotects that delete the entry evict it */
+                    if(!(rec->flags & H5C__DELETED_FLAG))
+                        break;
+                    cause = CAUSE_DELETE;
+                } /* end else-if */
+                else if(rec->cause >= H5C_LOG_EVICT_REPLACEMENT && rec->cause <= H5C_LOG_EVICT_INVALIDATE)
+                    cause = (cause_t)(CAUSE_REPLACEMENT + (rec->cause - H5C_LOG_EVICT_REPLACEMENT));
+                else
+                    cause = CAUSE_REPLACEMENT;
+
+                if(NULL != (entry = find_entry(rp, rec->addr, FALSE))) {
+                    if(entry->resident)
+                        rp->types[entry->type_id].evictions[cause]++;
+                    set_resident(rp, entry, FALSE);
+                } /* end if */
+                else
+                    rp->types[rec->type_id].evictions[cause]++;
+            }
+            break;
+
+        case H5C_LOG_EVENT_EVICT_CACHE:
+        case H5C_LOG_EVENT_DESTROY_CACHE:
+            rp->cache_evictions++;
+            evict_all(rp);
+            break;
+
+        case H5C_LOG_EVENT_SET_CACHE_CONFIG:
+            /* The size field holds the maximum cache size */
+            if(rec->size > rp->max_cache_size)
+                rp->max_cache_size = rec->size;
+            break;
+
+        default:
+            break;
+    } /* end switch */
+
+    return 0;
+} /* replay_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    print_results
+ *
+ * Purpose:     Print the statistics gathered by replaying the log
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+print_results(const replay_t *rp)
+{
+    uint64_t total_hits = 0, total_misses = 0;
+    uint64_t reuses = 0, cum;
+    uint64_t cache_size;
+    unsigned u, v;
+
+    HDfprintf(stdout, "Records: %llu (%llu failed operations) over %.6f seconds\n",
+            (unsigned long long)rp->nrecords, (unsigned long long)rp->nfailed,
+            (double)rp->end_time / 1000000.0);
+    HDfprintf(stdout, "Distinct entries: %llu\n", (unsigned long long)rp->nentries);
+    HDfprintf(stdout, "Peak resident bytes: %llu\n", (unsigned long long)rp->max_resident_bytes);
+    if(rp->max_cache_size > 0)
+        HDfprintf(stdout, "Maximum configured cache size: %llu\n", (unsigned long long)rp->max_cache_size);
+    HDfprintf(stdout, "Whole cache evictions: %llu\n", (unsigned long long)rp->cache_evictions);
+
+    /* Per-type hit rates */
+    HDfprintf(stdout, "\nHit rates by entry type:\n");
+    HDfprintf(stdout, "  %-34s %12s %12s %12s %8s\n", "type", "protects", "hits", "inserts", "hit rate");
+    for(u = 0; u < NTYPES; u++) {
+        const type_stats_t *ts = &rp->types[u];
+        uint64_t protects = ts->hits + ts->misses;
+
+        total_hits += ts->hits;
+        total_misses += ts->misses;
+        if(protects == 0 && ts->inserts == 0)
+            continue;
+        HDfprintf(stdout, "  %-34s %12llu %12llu %12llu %7.2f%%\n", type_names_g[u],
+                (unsigned long long)protects, (unsigned long long)ts->hits,
+                (unsigned long long)ts->inserts,
+                protects ? 100.0 * (double)ts->hits / (double)protects : 0.0);
+    } /* end for */
+    HDfprintf(stdout, "  %-34s %12llu %12llu %12s %7.2f%%\n", "all",
+            (unsigned long long)(total_hits + total_misses), (unsigned long long)total_hits, "",
+            (total_hits + total_misses) ? 100.0 * (double)total_hits / (double)(total_hits + total_misses) : 0.0);
+
+    /* Eviction causes */
+    HDfprintf(stdout, "\nEvictions by entry type and cause:\n");
+    HDfprintf(stdout, "  %-34s", "type");
+    for(v = 0; v < NCAUSES; v++)
+        HDfprintf(stdout, " %11s", cause_names_g[v]);
+    HDfprintf(stdout, "\n");
+    for(u = 0; u < NTYPES; u++) {
+        uint64_t total = 0;
+
+        for(v = 0; v < NCAUSES; v++)
+            total += rp->types[u].evictions[v];
+        if(total == 0)
+            continue;
+        HDfprintf(stdout, "  %-34s", type_names_g[u]);
+        for(v = 0; v < NCAUSES; v++)
+            HDfprintf(stdout, " %11llu", (unsigned long long)rp->types[u].evictions[v]);
+        HDfprintf(stdout, "\n");
+    } /* end for */
+
+    /* Reuse distances */
+    for(u = 0; u < NDIST_BUCKETS; u++)
+        reuses += rp->dist_entries[u];
+    HDfprintf(stdout, "\nReuse distances (distinct entries protected or inserted in between):\n");
+    HDfprintf(stdout, "  first use (cold miss)                %12llu\n", (unsigned long long)rp->cold_misses);
+    for(u = 0; u < NDIST_BUCKETS; u++) {
+        if(rp->dist_entries[u] == 0)
+            continue;
+        if(u == 0)
+            HDfprintf(stdout, "  %-36s %12llu\n", "0", (unsigned long long)rp->dist_entries[u]);
+        else {
+            char range[64];
+
+            HDsnprintf(range, sizeof(range), "%llu - %llu", 1ULL << (u - 1), (1ULL << u) - 1);
+            HDfprintf(stdout, "  %-36s %12llu\n", range, (unsigned long long)rp->dist_entries[u]);
+        } /* end else */
+    } /* end for */
+
+    /* Working set curve: an LRU cache larger than the bytes accessed
+     * between two protects of an entry would have kept the entry.  The
+     * byte distances are bucketed, so an access is counted as a hit for
+     * cache sizes at least the upper bound of its bucket.
+     */
+    HDfprintf(stdout, "\nLRU hit rate by cache size (working set curve):\n");
+    HDfprintf(stdout, "  %20s %8s\n", "cache size (bytes)", "hit rate");
+    cum = 0;
+    for(u = 0, cache_size = 1; u < NDIST_BUCKETS - 1; u++, cache_size <<= 1) {
+        cum += rp->dist_bytes[u];
+        if(cache_size < 1024 || cum == 0)
+            continue;
+        HDfprintf(stdout, "  %20llu %7.2f%%\n", (unsigned long long)cache_size,
+                (total_hits + total_misses) ? 100.0 * (double)cum / (double)(total_hits + total_misses) : 0.0);
+        if(cum == reuses)
+            break;
+    } /* end for */
+} /* print_results() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Read the binary metadata cache log, replay it and print
+ *              the results
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main (int argc, const char *argv[])
+{
+    FILE *fp = NULL;
+    uint8_t header[H5C_LOG_BIN_HEADER_SIZE];
+    uint8_t *buf = NULL;
+    replay_t rp;
+    record_t rec;
+    size_t nread, u;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    HDmemset(&rp, 0, sizeof(rp));
+
+    /* Disable the HDF5 library's error reporting */
+    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    /* Parse command line options */
+    if(parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if(fname_g == NULL)
+        goto done;
+
+    /* Open the log and check its header */
+    if(NULL == (fp = HDfopen(fname_g, "rb"))) {
+        error_msg("unable to open log file \"%s\"\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    if(1 != HDfread(header, sizeof(header), (size_t)1, fp)
+            || HDmemcmp(header, H5C_LOG_BIN_SIGNATURE, (size_t)H5C_LOG_BIN_SIGNATURE_LEN)) {
+        error_msg("\"%s\" is not a binary metadata cache log\n", fname_g);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    if(header[H5C_LOG_BIN_SIGNATURE_LEN] != H5C_LOG_BIN_VERSION
+            || header[H5C_LOG_BIN_SIGNATURE_LEN + 1] != H5C_LOG_BIN_RECORD_SIZE) {
+        error_msg("unsupported log version %u\n", (unsigned)header[H5C_LOG_BIN_SIGNATURE_LEN]);
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    if(NULL == (buf = (uint8_t *)HDmalloc((size_t)NRECORDS_READ * H5C_LOG_BIN_RECORD_SIZE))) {
+        error_msg("unable to allocate memory\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    /* Count the accesses, to size the Fenwick trees */
+    while((nread = HDfread(buf, (size_t)H5C_LOG_BIN_RECORD_SIZE, (size_t)NRECORDS_READ, fp)) > 0)
+        for(u = 0; u < nread; u++) {
+            decode_record(buf + (u * H5C_LOG_BIN_RECORD_SIZE), &rec);
+            if(!rec.failed && (H5C_LOG_EVENT_PROTECT_ENTRY == rec.event || H5C_LOG_EVENT_INSERT_ENTRY == rec.event))
+                rp.naccesses_max++;
+        } /* end for */
+
+    rp.nbuckets = NHASH_BUCKETS_INIT;
+    if(NULL == (rp.buckets = (entry_t **)HDcalloc(rp.nbuckets, sizeof(entry_t *)))
+            || NULL == (rp.live_tree = (int64_t *)HDcalloc((size_t)rp.naccesses_max + 1, sizeof(int64_t)))
+            || NULL == (rp.bytes_tree = (int64_t *)HDcalloc((size_t)rp.naccesses_max + 1, sizeof(int64_t)))) {
+        error_msg("unable to allocate memory\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    /* Replay the log */
+    if(HDfseek(fp, (long)H5C_LOG_BIN_HEADER_SIZE, SEEK_SET) < 0) {
+        error_msg("unable to read log file\n");
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+    while((nread = HDfread(buf, (size_t)H5C_LOG_BIN_RECORD_SIZE, (size_t)NRECORDS_READ, fp)) > 0)
+        for(u = 0; u < nread; u++) {
+            decode_record(buf + (u * H5C_LOG_BIN_RECORD_SIZE), &rec);
+            if(replay_record(&rp, &rec) < 0) {
+                error_msg("unable to allocate memory\n");
+                h5tools_setstatus(EXIT_FAILURE);
+                goto done;
+            }
+        } /* end for */
+
+    print_results(&rp);
+
+    h5tools_setstatus(EXIT_SUCCESS);
+
+done:
+    if(fp)
+        HDfclose(fp);
+    if(buf)
+        HDfree(buf);
+    if(rp.buckets) {
+        for(u = 0; u < rp.nbuckets; u++)
+            while(rp.buckets[u]) {
+                entry_t *entry = rp.buckets[u];
+
+                rp.buckets[u] = entry->next;
+                HDfree(entry);
+            } /* end while */
+        HDfree(rp.buckets);
+    }
+    if(rp.live_tree)
+        HDfree(rp.live_tree);
+    if(rp.bytes_tree)
+        HDfree(rp.bytes_tree);
+    if(fname_g)
+        HDfree(fname_g);
+
+    leave(h5tools_getstatus());
+} /* main() */
+